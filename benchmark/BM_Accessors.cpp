@@ -0,0 +1,272 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Accessors.cpp
+ * @brief Benchmark column loops over the inline accessors and formatters
+ * @details Uses only the header-implemented API, so the same source builds against the compiled
+ *          library (BM_Accessors) and, with NFX_DATETIME_HEADER_ONLY, against the header-only
+ *          target (BM_Accessors_HeaderOnly). The loops run over whole columns so the compiler
+ *          can keep the calendar math in registers and vectorize it.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/DateTime.h>
+#include <nfx/datetime/DateTimeOffset.h>
+#include <nfx/datetime/TimeSpan.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // Accessor benchmark suite
+    //=====================================================================
+
+    /** @brief Uniformly distributed DateTime column between 1970 and 2100 */
+    static std::vector<DateTime> makeDateTimeColumn( std::size_t count )
+    {
+        std::mt19937_64 rng{ 42 };
+        std::uniform_int_distribution<std::int64_t> ticks{ DateTime{ 1970, 1, 1 }.ticks(),
+            DateTime{ 2100, 1, 1 }.ticks() };
+
+        std::vector<DateTime> values;
+        values.reserve( count );
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            values.push_back( DateTime{ ticks( rng ) } );
+        }
+
+        return values;
+    }
+
+    /** @brief DateTimeOffset column with offsets between -12:00 and +14:00 in whole hours */
+    static std::vector<DateTimeOffset> makeDateTimeOffsetColumn( std::size_t count )
+    {
+        const auto dateTimes{ makeDateTimeColumn( count ) };
+        std::mt19937 rng{ 7 };
+        std::uniform_int_distribution<std::int32_t> hours{ -12, 14 };
+
+        std::vector<DateTimeOffset> values;
+        values.reserve( count );
+        for( const auto& dateTime : dateTimes )
+        {
+            values.emplace_back( dateTime, TimeSpan::fromHours( hours( rng ) ) );
+        }
+
+        return values;
+    }
+
+    //----------------------------------------------
+    // DateTime accessors
+    //----------------------------------------------
+
+    static void BM_Accessors_DateTime_YearMonthDay( ::benchmark::State& state )
+    {
+        const auto values{ makeDateTimeColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+
+        for( auto _ : state )
+        {
+            std::int64_t sum{ 0 };
+            for( const auto& value : values )
+            {
+                sum += value.year() + value.month() + value.day();
+            }
+            ::benchmark::DoNotOptimize( sum );
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_Accessors_DateTime_HourDayOfWeek( ::benchmark::State& state )
+    {
+        const auto values{ makeDateTimeColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+
+        for( auto _ : state )
+        {
+            std::int64_t sum{ 0 };
+            for( const auto& value : values )
+            {
+                sum += value.hour() + value.dayOfWeek();
+            }
+            ::benchmark::DoNotOptimize( sum );
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_Accessors_DateTime_DateTimeOfDay( ::benchmark::State& state )
+    {
+        const auto values{ makeDateTimeColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+
+        for( auto _ : state )
+        {
+            std::int64_t sum{ 0 };
+            for( const auto& value : values )
+            {
+                sum += value.date().ticks() + value.timeOfDay().ticks();
+            }
+            ::benchmark::DoNotOptimize( sum );
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    //----------------------------------------------
+    // DateTimeOffset accessors
+    //----------------------------------------------
+
+    static void BM_Accessors_DateTimeOffset_UtcDateTime( ::benchmark::State& state )
+    {
+        const auto values{ makeDateTimeOffsetColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+
+        for( auto _ : state )
+        {
+            std::int64_t sum{ 0 };
+            for( const auto& value : values )
+            {
+                sum += value.utcDateTime().ticks();
+            }
+            ::benchmark::DoNotOptimize( sum );
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_Accessors_DateTimeOffset_UtcHour( ::benchmark::State& state )
+    {
+        const auto values{ makeDateTimeOffsetColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+
+        for( auto _ : state )
+        {
+            std::int64_t sum{ 0 };
+            for( const auto& value : values )
+            {
+                sum += value.toUniversalTime().hour();
+            }
+            ::benchmark::DoNotOptimize( sum );
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    //----------------------------------------------
+    // Formatting
+    //----------------------------------------------
+
+    static void BM_Accessors_DateTime_FormatTo( ::benchmark::State& state )
+    {
+        const auto values{ makeDateTimeColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+
+        for( auto _ : state )
+        {
+            std::size_t total{ 0 };
+            for( const auto& value : values )
+            {
+                total += value.formatTo( buffer, sizeof( buffer ), DateTime::Format::Iso8601Millis );
+                ::benchmark::DoNotOptimize( buffer );
+            }
+            ::benchmark::DoNotOptimize( total );
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_Accessors_DateTimeOffset_FormatTo( ::benchmark::State& state )
+    {
+        const auto values{ makeDateTimeOffsetColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+
+        for( auto _ : state )
+        {
+            std::size_t total{ 0 };
+            for( const auto& value : values )
+            {
+                total += value.formatTo( buffer, sizeof( buffer ) );
+                ::benchmark::DoNotOptimize( buffer );
+            }
+            ::benchmark::DoNotOptimize( total );
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_Accessors_TimeSpan_FormatTo( ::benchmark::State& state )
+    {
+        const auto dateTimes{ makeDateTimeColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::vector<TimeSpan> values;
+        values.reserve( dateTimes.size() );
+        for( const auto& dateTime : dateTimes )
+        {
+            values.push_back( dateTime.timeOfDay() );
+        }
+        char buffer[constants::MAX_ISO8601_DURATION_LENGTH];
+
+        for( auto _ : state )
+        {
+            std::size_t total{ 0 };
+            for( const auto& value : values )
+            {
+                total += value.formatTo( buffer, sizeof( buffer ) );
+                ::benchmark::DoNotOptimize( buffer );
+            }
+            ::benchmark::DoNotOptimize( total );
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    //=====================================================================
+    // Benchmarks registration
+    //=====================================================================
+
+    //----------------------------------------------
+    // DateTime accessors
+    //----------------------------------------------
+
+    BENCHMARK( BM_Accessors_DateTime_YearMonthDay )->Arg( 4096 );
+    BENCHMARK( BM_Accessors_DateTime_HourDayOfWeek )->Arg( 4096 );
+    BENCHMARK( BM_Accessors_DateTime_DateTimeOfDay )->Arg( 4096 );
+
+    //----------------------------------------------
+    // DateTimeOffset accessors
+    //----------------------------------------------
+
+    BENCHMARK( BM_Accessors_DateTimeOffset_UtcDateTime )->Arg( 4096 );
+    BENCHMARK( BM_Accessors_DateTimeOffset_UtcHour )->Arg( 4096 );
+
+    //----------------------------------------------
+    // Formatting
+    //----------------------------------------------
+
+    BENCHMARK( BM_Accessors_DateTime_FormatTo )->Arg( 4096 );
+    BENCHMARK( BM_Accessors_DateTimeOffset_FormatTo )->Arg( 4096 );
+    BENCHMARK( BM_Accessors_TimeSpan_FormatTo )->Arg( 4096 );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
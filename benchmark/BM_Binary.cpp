@@ -0,0 +1,180 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Binary.cpp
+ * @brief Benchmark the binary wire format against ISO 8601 text round trips
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/Binary.h>
+
+#include <array>
+#include <random>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // Binary benchmark suite
+    //=====================================================================
+
+    namespace
+    {
+        /** @brief Random offset instants across the full DateTime range */
+        const std::vector<DateTimeOffset>& randomValues()
+        {
+            static const std::vector<DateTimeOffset> values{ [] {
+                std::vector<DateTimeOffset> result;
+                result.reserve( 4096 );
+                std::mt19937_64 rng{ 42 };
+                std::uniform_int_distribution<std::int64_t> ticks{ 0, constants::MAX_DATETIME_TICKS };
+                std::uniform_int_distribution<std::int32_t> quarters{ -56, 56 };
+                for( std::size_t i{ 0 }; i < 4096; ++i )
+                {
+                    result.emplace_back( DateTime{ ticks( rng ) }, TimeSpan::fromMinutes( quarters( rng ) * 15 ) );
+                }
+                return result;
+            }() };
+
+            return values;
+        }
+    } // namespace
+
+    //----------------------------------------------
+    // Single values
+    //----------------------------------------------
+
+    static void BM_Text_RoundTrip( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            const auto length{ values[i].formatTo( buffer, sizeof( buffer ), DateTime::Format::Iso8601Precise ) };
+            DateTimeOffset decoded;
+            auto ok{ DateTimeOffset::fromString( std::string_view{ buffer, length }, decoded ) };
+            ::benchmark::DoNotOptimize( ok );
+            ::benchmark::DoNotOptimize( decoded );
+            i = ( i + 1 ) & ( values.size() - 1 );
+        }
+    }
+
+    static void BM_Binary_RoundTrip( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::array<std::byte, binary::OFFSET_FIXED_SIZE> buffer;
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto written{ binary::encode( values[i], buffer ) };
+            ::benchmark::DoNotOptimize( written );
+            ::benchmark::DoNotOptimize( buffer );
+            DateTimeOffset decoded;
+            auto read{ binary::decode( buffer, decoded ) };
+            ::benchmark::DoNotOptimize( read );
+            ::benchmark::DoNotOptimize( decoded );
+            i = ( i + 1 ) & ( values.size() - 1 );
+        }
+    }
+
+    static void BM_BinaryVarint_RoundTrip( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::array<std::byte, binary::MAX_VARINT_OFFSET_SIZE> buffer;
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto written{ binary::encodeVarint( values[i], buffer ) };
+            ::benchmark::DoNotOptimize( buffer );
+            DateTimeOffset decoded;
+            auto read{ binary::decodeVarint( std::span{ buffer }.first( written ), decoded ) };
+            ::benchmark::DoNotOptimize( read );
+            ::benchmark::DoNotOptimize( decoded );
+            i = ( i + 1 ) & ( values.size() - 1 );
+        }
+    }
+
+    //----------------------------------------------
+    // Bulk
+    //----------------------------------------------
+
+    static void BM_Binary_EncodeBulk( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<std::byte> buffer( values.size() * binary::OFFSET_FIXED_SIZE );
+
+        for( auto _ : state )
+        {
+            auto written{ binary::encode( std::span<const DateTimeOffset>{ values }, buffer ) };
+            ::benchmark::DoNotOptimize( written );
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * static_cast<std::int64_t>( values.size() ) );
+    }
+
+    static void BM_Binary_DecodeBulk( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<std::byte> buffer( values.size() * binary::OFFSET_FIXED_SIZE );
+        (void)binary::encode( std::span<const DateTimeOffset>{ values }, buffer );
+        std::vector<DateTimeOffset> decoded( values.size() );
+
+        for( auto _ : state )
+        {
+            auto count{ binary::decode( buffer, std::span{ decoded } ) };
+            ::benchmark::DoNotOptimize( count );
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * static_cast<std::int64_t>( values.size() ) );
+    }
+
+    //=====================================================================
+    // Benchmarks registration
+    //=====================================================================
+
+    //----------------------------------------------
+    // Single values
+    //----------------------------------------------
+
+    BENCHMARK( BM_Text_RoundTrip );
+    BENCHMARK( BM_Binary_RoundTrip );
+    BENCHMARK( BM_BinaryVarint_RoundTrip );
+
+    //----------------------------------------------
+    // Bulk
+    //----------------------------------------------
+
+    BENCHMARK( BM_Binary_EncodeBulk );
+    BENCHMARK( BM_Binary_DecodeBulk );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,390 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Bulk.cpp
+ * @brief Benchmark the span kernels against element-wise member function loops
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/Bulk.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // Bulk benchmark suite
+    //=====================================================================
+
+    namespace
+    {
+        /** @brief Number of values per column (fits in L2 so kernels are not memory-bound) */
+        constexpr std::size_t COLUMN_SIZE{ 16384 };
+
+        /** @brief Random instants across the full DateTime range */
+        const std::vector<DateTime>& randomValues()
+        {
+            static const std::vector<DateTime> values{ [] {
+                std::vector<DateTime> result;
+                result.reserve( COLUMN_SIZE );
+                std::mt19937_64 rng{ 42 };
+                std::uniform_int_distribution<std::int64_t> ticks{ 0, constants::MAX_DATETIME_TICKS };
+                for( std::size_t i{ 0 }; i < COLUMN_SIZE; ++i )
+                {
+                    result.emplace_back( ticks( rng ) );
+                }
+                return result;
+            }() };
+
+            return values;
+        }
+
+        /** @brief Run a column kernel and report items per second */
+        template <typename Kernel>
+        void runColumn( ::benchmark::State& state, Kernel kernel )
+        {
+            for( auto _ : state )
+            {
+                kernel();
+                ::benchmark::ClobberMemory();
+            }
+
+            state.SetItemsProcessed( state.iterations() * static_cast<std::int64_t>( COLUMN_SIZE ) );
+        }
+    } // namespace
+
+    //----------------------------------------------
+    // Arithmetic
+    //----------------------------------------------
+
+    static void BM_Loop_Add( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+        const auto duration{ TimeSpan::fromHours( 1 ) };
+
+        runColumn( state, [&] {
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                out[i] = values[i] + duration;
+            }
+        } );
+    }
+
+    static void BM_Bulk_Add( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+
+        runColumn( state, [&] { bulk::add( values, TimeSpan::fromHours( 1 ), out ); } );
+    }
+
+    //----------------------------------------------
+    // Calendar arithmetic
+    //----------------------------------------------
+
+    static void BM_Loop_AddMonthsByComponents( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+
+        runColumn( state, [&] {
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                // Component round trip with loop normalization, as done before addMonths()
+                auto year{ values[i].year() };
+                auto month{ values[i].month() + 7 };
+                while( month > 12 )
+                {
+                    month -= 12;
+                    ++year;
+                }
+                const auto day{ std::min( values[i].day(), DateTime::daysInMonth( year, month ) ) };
+                out[i] = DateTime{ year, month, day } + values[i].timeOfDay();
+            }
+        } );
+    }
+
+    static void BM_Bulk_AddMonths( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+
+        runColumn( state, [&] { bulk::addMonths( values, 7, out ); } );
+    }
+
+    static void BM_Bulk_AddBusinessDays( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+
+        runColumn( state, [&] { bulk::addBusinessDays( values, 23, out ); } );
+    }
+
+    //----------------------------------------------
+    // Epoch conversion
+    //----------------------------------------------
+
+    static void BM_Loop_ToEpochMilliseconds( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<std::int64_t> out( values.size() );
+
+        runColumn( state, [&] {
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                out[i] = values[i].toEpochMilliseconds();
+            }
+        } );
+    }
+
+    static void BM_Bulk_ToEpochMilliseconds( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<std::int64_t> out( values.size() );
+
+        runColumn( state, [&] { bulk::toEpochMilliseconds( values, out ); } );
+    }
+
+    //----------------------------------------------
+    // Calendar fields
+    //----------------------------------------------
+
+    static void BM_Loop_Date( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+
+        runColumn( state, [&] {
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                out[i] = values[i].date();
+            }
+        } );
+    }
+
+    static void BM_Bulk_Date( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+
+        runColumn( state, [&] { bulk::date( values, out ); } );
+    }
+
+    static void BM_Loop_DayOfWeek( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<std::int32_t> out( values.size() );
+
+        runColumn( state, [&] {
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                out[i] = values[i].dayOfWeek();
+            }
+        } );
+    }
+
+    static void BM_Bulk_DayOfWeek( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<std::int32_t> out( values.size() );
+
+        runColumn( state, [&] { bulk::dayOfWeek( values, out ); } );
+    }
+
+    static void BM_Loop_Hour( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<std::int32_t> out( values.size() );
+
+        runColumn( state, [&] {
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                out[i] = values[i].hour();
+            }
+        } );
+    }
+
+    static void BM_Bulk_Hour( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<std::int32_t> out( values.size() );
+
+        runColumn( state, [&] { bulk::hour( values, out ); } );
+    }
+
+    //----------------------------------------------
+    // Bucketing
+    //----------------------------------------------
+
+    static void BM_Loop_Floor( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+        auto interval{ TimeSpan::fromMinutes( 5 ) };
+        ::benchmark::DoNotOptimize( interval );
+
+        runColumn( state, [&] {
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                out[i] = values[i].floor( interval );
+            }
+        } );
+    }
+
+    static void BM_Bulk_Floor( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+        auto interval{ TimeSpan::fromMinutes( 5 ) };
+        ::benchmark::DoNotOptimize( interval );
+
+        runColumn( state, [&] { bulk::floor( values, interval, out ); } );
+    }
+
+    static void BM_Loop_StartOfMonth( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+
+        runColumn( state, [&] {
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                out[i] = values[i].startOfMonth();
+            }
+        } );
+    }
+
+    static void BM_Loop_StartOfMonthByComponents( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<DateTime> out( values.size() );
+
+        runColumn( state, [&] {
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                out[i] = DateTime{ values[i].year(), values[i].month(), 1 };
+            }
+        } );
+    }
+
+    //----------------------------------------------
+    // Reductions and sort keys
+    //----------------------------------------------
+
+    static void BM_Loop_MinMax( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+
+        runColumn( state, [&] {
+            auto low{ values[0] };
+            auto high{ values[0] };
+            for( const auto& value : values )
+            {
+                low = value < low ? value : low;
+                high = value > high ? value : high;
+            }
+            ::benchmark::DoNotOptimize( low );
+            ::benchmark::DoNotOptimize( high );
+        } );
+    }
+
+    static void BM_Bulk_MinMax( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+
+        runColumn( state, [&] {
+            auto range{ bulk::minMax( values ) };
+            ::benchmark::DoNotOptimize( range );
+        } );
+    }
+
+    static void BM_Bulk_SortKeys( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        std::vector<std::uint64_t> out( values.size() );
+
+        runColumn( state, [&] { bulk::sortKeys( values, out ); } );
+    }
+
+    //=====================================================================
+    // Benchmarks registration
+    //=====================================================================
+
+    //----------------------------------------------
+    // Arithmetic
+    //----------------------------------------------
+
+    BENCHMARK( BM_Loop_Add );
+    BENCHMARK( BM_Bulk_Add );
+
+    //----------------------------------------------
+    // Calendar arithmetic
+    //----------------------------------------------
+
+    BENCHMARK( BM_Loop_AddMonthsByComponents );
+    BENCHMARK( BM_Bulk_AddMonths );
+    BENCHMARK( BM_Bulk_AddBusinessDays );
+
+    //----------------------------------------------
+    // Epoch conversion
+    //----------------------------------------------
+
+    BENCHMARK( BM_Loop_ToEpochMilliseconds );
+    BENCHMARK( BM_Bulk_ToEpochMilliseconds );
+
+    //----------------------------------------------
+    // Calendar fields
+    //----------------------------------------------
+
+    BENCHMARK( BM_Loop_Date );
+    BENCHMARK( BM_Bulk_Date );
+    BENCHMARK( BM_Loop_DayOfWeek );
+    BENCHMARK( BM_Bulk_DayOfWeek );
+    BENCHMARK( BM_Loop_Hour );
+    BENCHMARK( BM_Bulk_Hour );
+
+    //----------------------------------------------
+    // Bucketing
+    //----------------------------------------------
+
+    BENCHMARK( BM_Loop_Floor );
+    BENCHMARK( BM_Bulk_Floor );
+    BENCHMARK( BM_Loop_StartOfMonth );
+    BENCHMARK( BM_Loop_StartOfMonthByComponents );
+
+    //----------------------------------------------
+    // Reductions and sort keys
+    //----------------------------------------------
+
+    BENCHMARK( BM_Loop_MinMax );
+    BENCHMARK( BM_Bulk_MinMax );
+    BENCHMARK( BM_Bulk_SortKeys );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_CachedClock.cpp
+ * @brief Benchmark CachedClock reads against direct system clock and time zone reads
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/CachedClock.h>
+
+#include <chrono>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // CachedClock benchmark suite
+    //=====================================================================
+
+    /** @brief Shared clock refreshed every 100 microseconds by its background thread */
+    static CachedClock& sharedClock()
+    {
+        static CachedClock clock{ std::chrono::microseconds( 100 ) };
+
+        return clock;
+    }
+
+    //----------------------------------------------
+    // Direct path (baseline)
+    //----------------------------------------------
+
+    static void BM_Direct_DateTimeOffset_Now( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dto{ DateTimeOffset::now() };
+            ::benchmark::DoNotOptimize( dto );
+        }
+    }
+
+    static void BM_Direct_DateTime_UtcNow( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dt{ DateTime::utcNow() };
+            ::benchmark::DoNotOptimize( dt );
+        }
+    }
+
+    //----------------------------------------------
+    // Cached reads
+    //----------------------------------------------
+
+    static void BM_CachedClock_UtcTicks( ::benchmark::State& state )
+    {
+        const auto& clock{ sharedClock() };
+        for( auto _ : state )
+        {
+            auto ticks{ clock.utcTicks() };
+            ::benchmark::DoNotOptimize( ticks );
+        }
+    }
+
+    static void BM_CachedClock_Now( ::benchmark::State& state )
+    {
+        const auto& clock{ sharedClock() };
+        for( auto _ : state )
+        {
+            auto dto{ clock.now() };
+            ::benchmark::DoNotOptimize( dto );
+        }
+    }
+
+    static void BM_CachedClock_Snapshot( ::benchmark::State& state )
+    {
+        const auto& clock{ sharedClock() };
+        for( auto _ : state )
+        {
+            auto snapshot{ clock.snapshot() };
+            ::benchmark::DoNotOptimize( snapshot );
+        }
+    }
+
+    //----------------------------------------------
+    // Global hook
+    //----------------------------------------------
+
+    static void BM_Installed_DateTimeOffset_Now( ::benchmark::State& state )
+    {
+        CachedClock::install( &sharedClock() );
+        for( auto _ : state )
+        {
+            auto dto{ DateTimeOffset::now() };
+            ::benchmark::DoNotOptimize( dto );
+        }
+        CachedClock::install( nullptr );
+    }
+
+    static void BM_Installed_DateTime_UtcNow( ::benchmark::State& state )
+    {
+        CachedClock::install( &sharedClock() );
+        for( auto _ : state )
+        {
+            auto dt{ DateTime::utcNow() };
+            ::benchmark::DoNotOptimize( dt );
+        }
+        CachedClock::install( nullptr );
+    }
+
+    //----------------------------------------------
+    // Direct path (baseline)
+    //----------------------------------------------
+
+    BENCHMARK( BM_Direct_DateTimeOffset_Now );
+    BENCHMARK( BM_Direct_DateTimeOffset_Now )->Threads( 8 );
+    BENCHMARK( BM_Direct_DateTime_UtcNow );
+
+    //----------------------------------------------
+    // Cached reads
+    //----------------------------------------------
+
+    BENCHMARK( BM_CachedClock_UtcTicks );
+    BENCHMARK( BM_CachedClock_Now );
+    BENCHMARK( BM_CachedClock_Now )->Threads( 8 );
+    BENCHMARK( BM_CachedClock_Snapshot );
+
+    //----------------------------------------------
+    // Global hook
+    //----------------------------------------------
+
+    BENCHMARK( BM_Installed_DateTimeOffset_Now );
+    BENCHMARK( BM_Installed_DateTime_UtcNow );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,517 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Corpus.cpp
+ * @brief Benchmark parsing, formatting and span kernels over generated corpora of random values
+ * @details Unlike the single-literal benchmarks, every iteration walks a fixed-seed corpus of
+ *          random valid values (random instants, precisions, offsets and durations), so branch
+ *          prediction and caches see realistic input. Each layout is measured on its own and as
+ *          a random mix. Results report items/s and bytes/s of text (or of values for kernels).
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/Bulk.h>
+#include <nfx/datetime/DateTime.h>
+#include <nfx/datetime/DateTimeOffset.h>
+#include <nfx/datetime/PackedDateTimeOffset.h>
+#include <nfx/datetime/TimeSpan.h>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // Corpus generation
+    //=====================================================================
+
+    using Format = DateTime::Format;
+
+    /** @brief Elements per corpus (about 250 KB of timestamp text, past L1 and L2) */
+    static constexpr std::size_t CORPUS_SIZE{ 8192 };
+
+    /** @brief Fixed seed: every run, and every commit, measures the same corpus */
+    static constexpr std::uint64_t CORPUS_SEED{ 0x6E66782D64617465 };
+
+    /** @brief Layouts accepted by fromString() and parseMany() */
+    static constexpr std::array PARSEABLE_LAYOUTS{ Format::Iso8601, Format::Iso8601Precise,
+        Format::Iso8601PreciseTrimmed, Format::Iso8601Millis, Format::Iso8601Micros, Format::Iso8601Extended,
+        Format::Iso8601Date };
+
+    /** @brief Every layout written by toString() and formatTo() */
+    static constexpr std::array FORMAT_LAYOUTS{ Format::Iso8601, Format::Iso8601Precise,
+        Format::Iso8601PreciseTrimmed, Format::Iso8601Millis, Format::Iso8601Micros, Format::Iso8601Extended,
+        Format::Iso8601Basic, Format::Iso8601Date, Format::Iso8601Time, Format::UnixSeconds,
+        Format::UnixMilliseconds };
+
+    /** @brief One layout for every element, or (MIXED) a random layout per element */
+    using Layout = std::optional<Format>;
+
+    /** @brief Random layout per element */
+    static constexpr Layout MIXED{};
+
+    /** @brief Random instants in [1970, 2100), truncated to seconds, ms, us or ticks */
+    static std::vector<DateTime> randomDateTimes( std::mt19937_64& rng )
+    {
+        constexpr std::array<std::int64_t, 4> precisions{ 10'000'000, 10'000, 10, 1 };
+        std::uniform_int_distribution<std::int64_t> ticks{ DateTime{ 1970, 1, 1 }.ticks(),
+            DateTime{ 2100, 1, 1 }.ticks() - 1 };
+        std::uniform_int_distribution<std::size_t> precision{ 0, precisions.size() - 1 };
+
+        std::vector<DateTime> values;
+        values.reserve( CORPUS_SIZE );
+        for( std::size_t i{ 0 }; i < CORPUS_SIZE; ++i )
+        {
+            const auto value{ ticks( rng ) };
+            values.emplace_back( value - value % precisions[precision( rng )] );
+        }
+
+        return values;
+    }
+
+    /** @brief Random instants with quarter-hour offsets in [-12:00, +14:00] */
+    static std::vector<DateTimeOffset> randomDateTimeOffsets( std::mt19937_64& rng )
+    {
+        std::uniform_int_distribution<int> quarterHours{ -48, 56 };
+
+        std::vector<DateTimeOffset> values;
+        values.reserve( CORPUS_SIZE );
+        for( const auto& dateTime : randomDateTimes( rng ) )
+        {
+            values.emplace_back( dateTime, TimeSpan::fromMinutes( quarterHours( rng ) * 15 ) );
+        }
+
+        return values;
+    }
+
+    /** @brief Random durations, log-uniform from one tick to about 160 days, one in eight negative */
+    static std::vector<TimeSpan> randomTimeSpans( std::mt19937_64& rng )
+    {
+        std::uniform_int_distribution<int> bits{ 1, 47 };
+        std::uniform_int_distribution<int> sign{ 0, 7 };
+
+        std::vector<TimeSpan> values;
+        values.reserve( CORPUS_SIZE );
+        for( std::size_t i{ 0 }; i < CORPUS_SIZE; ++i )
+        {
+            const auto magnitude{ static_cast<std::int64_t>( rng() >> ( 64 - bits( rng ) ) ) };
+            values.emplace_back( sign( rng ) == 0 ? -magnitude : magnitude );
+        }
+
+        return values;
+    }
+
+    /** @brief Random corpus of T, identical across runs */
+    template <typename T>
+    static std::vector<T> randomValues()
+    {
+        std::mt19937_64 rng{ CORPUS_SEED };
+        if constexpr( std::is_same_v<T, DateTime> )
+        {
+            return randomDateTimes( rng );
+        }
+        else if constexpr( std::is_same_v<T, DateTimeOffset> )
+        {
+            return randomDateTimeOffsets( rng );
+        }
+        else
+        {
+            return randomTimeSpans( rng );
+        }
+    }
+
+    /** @brief Per-element layouts: the fixed layout, or random picks from the given set */
+    template <std::size_t N>
+    static std::vector<Format> layoutsFor( Layout layout, const std::array<Format, N>& choices )
+    {
+        std::mt19937_64 rng{ CORPUS_SEED + 1 };
+        std::uniform_int_distribution<std::size_t> pick{ 0, N - 1 };
+
+        std::vector<Format> layouts( CORPUS_SIZE );
+        for( auto& value : layouts )
+        {
+            value = layout ? *layout : choices[pick( rng )];
+        }
+
+        return layouts;
+    }
+
+    /** @brief Formatted corpus with string_view handles and its total text size */
+    struct TextCorpus
+    {
+        std::vector<std::string> strings;
+        std::vector<std::string_view> views;
+        std::int64_t bytes{ 0 };
+    };
+
+    /** @brief Format random values of T in the requested parseable layout(s) */
+    template <typename T>
+    static TextCorpus makeTextCorpus( Layout layout )
+    {
+        const auto values{ randomValues<T>() };
+        const auto layouts{ layoutsFor( layout, PARSEABLE_LAYOUTS ) };
+
+        TextCorpus corpus;
+        corpus.strings.reserve( values.size() );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            if constexpr( std::is_same_v<T, TimeSpan> )
+            {
+                corpus.strings.push_back( values[i].toString() );
+            }
+            else
+            {
+                corpus.strings.push_back( values[i].toString( layouts[i] ) );
+            }
+            corpus.bytes += static_cast<std::int64_t>( corpus.strings.back().size() );
+        }
+        corpus.views.assign( corpus.strings.begin(), corpus.strings.end() );
+
+        return corpus;
+    }
+
+    /** @brief Report corpus elements and text bytes per iteration */
+    static void setCorpusCounters( ::benchmark::State& state, std::int64_t items, std::int64_t bytes )
+    {
+        state.SetItemsProcessed( state.iterations() * items );
+        state.SetBytesProcessed( state.iterations() * bytes );
+    }
+
+    //=====================================================================
+    // Corpus benchmark suite
+    //=====================================================================
+
+    //----------------------------------------------
+    // Shared bodies
+    //----------------------------------------------
+
+    template <typename T>
+    static void parseCorpus( ::benchmark::State& state, Layout layout )
+    {
+        const auto corpus{ makeTextCorpus<T>( layout ) };
+        std::vector<T> results( corpus.views.size() );
+
+        for( auto _ : state )
+        {
+            for( std::size_t i{ 0 }; i < corpus.views.size(); ++i )
+            {
+                ::benchmark::DoNotOptimize( T::fromString( corpus.views[i], results[i] ) );
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        setCorpusCounters( state, static_cast<std::int64_t>( corpus.views.size() ), corpus.bytes );
+    }
+
+    template <typename T>
+    static void parseManyCorpus( ::benchmark::State& state, Layout layout )
+    {
+        const auto corpus{ makeTextCorpus<T>( layout ) };
+        std::vector<T> results( corpus.views.size() );
+        std::vector<std::uint8_t> ok( corpus.views.size() );
+
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( T::parseMany( corpus.views, results, ok ) );
+            ::benchmark::ClobberMemory();
+        }
+
+        setCorpusCounters( state, static_cast<std::int64_t>( corpus.views.size() ), corpus.bytes );
+    }
+
+    template <typename T>
+    static void formatCorpus( ::benchmark::State& state, Layout layout )
+    {
+        const auto values{ randomValues<T>() };
+        const auto layouts{ layoutsFor( layout, FORMAT_LAYOUTS ) };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+
+        std::int64_t bytes{ 0 };
+        for( auto _ : state )
+        {
+            bytes = 0;
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                std::size_t length;
+                if constexpr( std::is_same_v<T, TimeSpan> )
+                {
+                    length = values[i].formatTo( buffer, sizeof( buffer ) );
+                }
+                else
+                {
+                    length = values[i].formatTo( buffer, sizeof( buffer ), layouts[i] );
+                }
+                ::benchmark::DoNotOptimize( buffer );
+                bytes += static_cast<std::int64_t>( length );
+            }
+        }
+
+        setCorpusCounters( state, static_cast<std::int64_t>( values.size() ), bytes );
+    }
+
+    //----------------------------------------------
+    // DateTime
+    //----------------------------------------------
+
+    static void BM_Corpus_DateTime_Parse( ::benchmark::State& state, Layout layout )
+    {
+        parseCorpus<DateTime>( state, layout );
+    }
+
+    static void BM_Corpus_DateTime_ParseMany( ::benchmark::State& state, Layout layout )
+    {
+        parseManyCorpus<DateTime>( state, layout );
+    }
+
+    static void BM_Corpus_DateTime_Format( ::benchmark::State& state, Layout layout )
+    {
+        formatCorpus<DateTime>( state, layout );
+    }
+
+    static void BM_Corpus_DateTime_ParsePrefix_LogBuffer( ::benchmark::State& state )
+    {
+        std::string buffer;
+        for( const auto& timestamp : makeTextCorpus<DateTime>( MIXED ).strings )
+        {
+            buffer += timestamp;
+            buffer += " GET /index.html 200\n";
+        }
+        const char* last{ buffer.data() + buffer.size() };
+
+        for( auto _ : state )
+        {
+            for( const char* p{ buffer.data() }; p != last; )
+            {
+                DateTime dt;
+                p = DateTime::parsePrefix( p, last, dt );
+                ::benchmark::DoNotOptimize( dt );
+                p = std::find( p, last, '\n' ) + 1;
+            }
+        }
+
+        setCorpusCounters(
+            state, static_cast<std::int64_t>( CORPUS_SIZE ), static_cast<std::int64_t>( buffer.size() ) );
+    }
+
+    //----------------------------------------------
+    // DateTimeOffset
+    //----------------------------------------------
+
+    static void BM_Corpus_DateTimeOffset_Parse( ::benchmark::State& state, Layout layout )
+    {
+        parseCorpus<DateTimeOffset>( state, layout );
+    }
+
+    static void BM_Corpus_DateTimeOffset_ParseMany( ::benchmark::State& state, Layout layout )
+    {
+        parseManyCorpus<DateTimeOffset>( state, layout );
+    }
+
+    static void BM_Corpus_DateTimeOffset_Format( ::benchmark::State& state, Layout layout )
+    {
+        formatCorpus<DateTimeOffset>( state, layout );
+    }
+
+    //----------------------------------------------
+    // TimeSpan
+    //----------------------------------------------
+
+    static void BM_Corpus_TimeSpan_Parse( ::benchmark::State& state )
+    {
+        parseCorpus<TimeSpan>( state, MIXED );
+    }
+
+    static void BM_Corpus_TimeSpan_ParseMany( ::benchmark::State& state )
+    {
+        parseManyCorpus<TimeSpan>( state, MIXED );
+    }
+
+    static void BM_Corpus_TimeSpan_Format( ::benchmark::State& state )
+    {
+        formatCorpus<TimeSpan>( state, MIXED );
+    }
+
+    //----------------------------------------------
+    // Span kernels
+    //----------------------------------------------
+
+    static void BM_Corpus_Bulk_Hour( ::benchmark::State& state )
+    {
+        const auto values{ randomValues<DateTime>() };
+        std::vector<std::int32_t> out( values.size() );
+
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( bulk::hour( values, out ) );
+            ::benchmark::ClobberMemory();
+        }
+
+        setCorpusCounters( state, static_cast<std::int64_t>( values.size() ),
+            static_cast<std::int64_t>( values.size() * sizeof( DateTime ) ) );
+    }
+
+    static void BM_Corpus_Bulk_Floor( ::benchmark::State& state )
+    {
+        const auto values{ randomValues<DateTime>() };
+        std::vector<DateTime> out( values.size() );
+
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( bulk::floor( values, TimeSpan::fromMinutes( 5 ), out ) );
+            ::benchmark::ClobberMemory();
+        }
+
+        setCorpusCounters( state, static_cast<std::int64_t>( values.size() ),
+            static_cast<std::int64_t>( values.size() * sizeof( DateTime ) ) );
+    }
+
+    static void BM_Corpus_Bulk_Pack( ::benchmark::State& state )
+    {
+        const auto values{ randomValues<DateTimeOffset>() };
+        std::vector<PackedDateTimeOffset> out( values.size() );
+
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( bulk::pack( values, out ) );
+            ::benchmark::ClobberMemory();
+        }
+
+        setCorpusCounters( state, static_cast<std::int64_t>( values.size() ),
+            static_cast<std::int64_t>( values.size() * sizeof( DateTimeOffset ) ) );
+    }
+
+    static void BM_Corpus_Bulk_SortKeys( ::benchmark::State& state )
+    {
+        const auto values{ randomValues<DateTimeOffset>() };
+        std::vector<std::uint64_t> out( values.size() );
+
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( bulk::sortKeys( values, out ) );
+            ::benchmark::ClobberMemory();
+        }
+
+        setCorpusCounters( state, static_cast<std::int64_t>( values.size() ),
+            static_cast<std::int64_t>( values.size() * sizeof( DateTimeOffset ) ) );
+    }
+
+    //----------------------------------------------
+    // DateTime
+    //----------------------------------------------
+
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Parse, Iso8601, Format::Iso8601 );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Parse, Iso8601Precise, Format::Iso8601Precise );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Parse, Iso8601PreciseTrimmed, Format::Iso8601PreciseTrimmed );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Parse, Iso8601Millis, Format::Iso8601Millis );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Parse, Iso8601Micros, Format::Iso8601Micros );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Parse, Iso8601Extended, Format::Iso8601Extended );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Parse, Iso8601Date, Format::Iso8601Date );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Parse, Mixed, MIXED );
+
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_ParseMany, Iso8601, Format::Iso8601 );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_ParseMany, Iso8601Precise, Format::Iso8601Precise );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_ParseMany, Iso8601PreciseTrimmed, Format::Iso8601PreciseTrimmed );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_ParseMany, Iso8601Millis, Format::Iso8601Millis );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_ParseMany, Iso8601Micros, Format::Iso8601Micros );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_ParseMany, Iso8601Extended, Format::Iso8601Extended );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_ParseMany, Iso8601Date, Format::Iso8601Date );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_ParseMany, Mixed, MIXED );
+
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Iso8601, Format::Iso8601 );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Iso8601Precise, Format::Iso8601Precise );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Iso8601PreciseTrimmed, Format::Iso8601PreciseTrimmed );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Iso8601Millis, Format::Iso8601Millis );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Iso8601Micros, Format::Iso8601Micros );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Iso8601Extended, Format::Iso8601Extended );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Iso8601Basic, Format::Iso8601Basic );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Iso8601Date, Format::Iso8601Date );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Iso8601Time, Format::Iso8601Time );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, UnixSeconds, Format::UnixSeconds );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, UnixMilliseconds, Format::UnixMilliseconds );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTime_Format, Mixed, MIXED );
+
+    BENCHMARK( BM_Corpus_DateTime_ParsePrefix_LogBuffer );
+
+    //----------------------------------------------
+    // DateTimeOffset
+    //----------------------------------------------
+
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Parse, Iso8601, Format::Iso8601 );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Parse, Iso8601Precise, Format::Iso8601Precise );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Parse, Iso8601PreciseTrimmed, Format::Iso8601PreciseTrimmed );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Parse, Iso8601Millis, Format::Iso8601Millis );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Parse, Iso8601Micros, Format::Iso8601Micros );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Parse, Iso8601Extended, Format::Iso8601Extended );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Parse, Iso8601Date, Format::Iso8601Date );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Parse, Mixed, MIXED );
+
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_ParseMany, Iso8601, Format::Iso8601 );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_ParseMany, Iso8601Precise, Format::Iso8601Precise );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_ParseMany, Iso8601PreciseTrimmed, Format::Iso8601PreciseTrimmed );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_ParseMany, Iso8601Millis, Format::Iso8601Millis );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_ParseMany, Iso8601Micros, Format::Iso8601Micros );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_ParseMany, Iso8601Extended, Format::Iso8601Extended );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_ParseMany, Iso8601Date, Format::Iso8601Date );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_ParseMany, Mixed, MIXED );
+
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Iso8601, Format::Iso8601 );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Iso8601Precise, Format::Iso8601Precise );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Iso8601PreciseTrimmed, Format::Iso8601PreciseTrimmed );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Iso8601Millis, Format::Iso8601Millis );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Iso8601Micros, Format::Iso8601Micros );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Iso8601Extended, Format::Iso8601Extended );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Iso8601Basic, Format::Iso8601Basic );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Iso8601Date, Format::Iso8601Date );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Iso8601Time, Format::Iso8601Time );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, UnixSeconds, Format::UnixSeconds );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, UnixMilliseconds, Format::UnixMilliseconds );
+    BENCHMARK_CAPTURE( BM_Corpus_DateTimeOffset_Format, Mixed, MIXED );
+
+    //----------------------------------------------
+    // TimeSpan
+    //----------------------------------------------
+
+    BENCHMARK( BM_Corpus_TimeSpan_Parse );
+    BENCHMARK( BM_Corpus_TimeSpan_ParseMany );
+    BENCHMARK( BM_Corpus_TimeSpan_Format );
+
+    //----------------------------------------------
+    // Span kernels
+    //----------------------------------------------
+
+    BENCHMARK( BM_Corpus_Bulk_Hour );
+    BENCHMARK( BM_Corpus_Bulk_Floor );
+    BENCHMARK( BM_Corpus_Bulk_Pack );
+    BENCHMARK( BM_Corpus_Bulk_SortKeys );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
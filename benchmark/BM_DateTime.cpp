@@ -31,12 +31,71 @@
 
 #include <nfx/datetime/DateTime.h>
 
+#include <algorithm>
+#include <array>
+#include <format>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace nfx::time::benchmark
 {
     //=====================================================================
     // DateTime benchmark suite
     //=====================================================================
 
+    /** @brief Number of random samples cycled through by the random-input benchmarks (power of two) */
+    static constexpr std::size_t RANDOM_SAMPLE_COUNT{ 1024 };
+
+    /** @brief Civil date components for random-input benchmarks */
+    struct RandomDate
+    {
+        std::int32_t year;
+        std::int32_t month;
+        std::int32_t day;
+    };
+
+    /** @brief Uniformly distributed random dates, so branch prediction cannot learn a fixed value */
+    static const std::array<RandomDate, RANDOM_SAMPLE_COUNT>& randomDates()
+    {
+        static const auto dates{ [] {
+            std::array<RandomDate, RANDOM_SAMPLE_COUNT> result{};
+            std::mt19937 rng{ 42 };
+            std::uniform_int_distribution<std::int32_t> yearDistribution{ 1, 9999 };
+            std::uniform_int_distribution<std::int32_t> monthDistribution{ 1, 12 };
+            for( auto& date : result )
+            {
+                date.year = yearDistribution( rng );
+                date.month = monthDistribution( rng );
+                date.day = std::uniform_int_distribution<std::int32_t>{
+                    1, DateTime::daysInMonth( date.year, date.month ) }( rng );
+            }
+            return result;
+        }() };
+
+        return dates;
+    }
+
+    /** @brief Uniformly distributed random DateTime values over the full supported range */
+    static const std::array<DateTime, RANDOM_SAMPLE_COUNT>& randomDateTimes()
+    {
+        static const auto values{ [] {
+            std::array<DateTime, RANDOM_SAMPLE_COUNT> result{};
+            std::mt19937_64 rng{ 42 };
+            std::uniform_int_distribution<std::int64_t> distribution{
+                DateTime::min().ticks(), DateTime::max().ticks() };
+            for( auto& value : result )
+            {
+                value = DateTime{ distribution( rng ) };
+            }
+            return result;
+        }() };
+
+        return values;
+    }
+
     //----------------------------------------------
     // Construction
     //----------------------------------------------
@@ -50,6 +109,19 @@ namespace nfx::time::benchmark
         }
     }
 
+    static void BM_DateTime_Construct_YMD_Random( ::benchmark::State& state )
+    {
+        const auto& dates{ randomDates() };
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            const auto& date{ dates[i++ & ( RANDOM_SAMPLE_COUNT - 1 )] };
+            auto dt{ DateTime{ date.year, date.month, date.day } };
+            ::benchmark::DoNotOptimize( dt );
+        }
+    }
+
     static void BM_DateTime_Construct_YMDHMS( ::benchmark::State& state )
     {
         for( auto _ : state )
@@ -77,6 +149,37 @@ namespace nfx::time::benchmark
         }
     }
 
+    template <typename Clock>
+    static void BM_DateTime_UtcNow_Clock( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dt{ DateTime::utcNow<Clock>() };
+            ::benchmark::DoNotOptimize( dt );
+        }
+    }
+
+    /** @brief Observed resolution: spin until the clock value changes, report the mean step */
+    template <typename Clock>
+    static void BM_DateTime_UtcNow_Resolution( ::benchmark::State& state )
+    {
+        std::int64_t totalStep{ 0 };
+        for( auto _ : state )
+        {
+            const auto first{ Clock::utcTicks() };
+            auto next{ first };
+            while( next == first )
+            {
+                next = Clock::utcTicks();
+            }
+            totalStep += next - first;
+        }
+
+        state.counters["resolution_ns"] = ::benchmark::Counter(
+            static_cast<double>( totalStep * constants::NANOSECONDS_PER_TICK ) /
+            static_cast<double>( state.iterations() ) );
+    }
+
     //----------------------------------------------
     // Parsing
     //----------------------------------------------
@@ -103,6 +206,111 @@ namespace nfx::time::benchmark
         }
     }
 
+    /** @brief Build a column of consecutive ISO 8601 timestamps with 7-digit fractions */
+    static std::vector<std::string> makeIso8601Column( std::size_t count )
+    {
+        std::vector<std::string> column;
+        column.reserve( count );
+
+        DateTime dt{ 2024, 10, 23, 15, 30, 45 };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            column.push_back( dt.toString( DateTime::Format::Iso8601Precise ) );
+            dt += TimeSpan{ 12345679 };
+        }
+
+        return column;
+    }
+
+    static void BM_DateTime_ParseColumn_FromString( ::benchmark::State& state )
+    {
+        const auto column{ makeIso8601Column( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::vector<DateTime> results( column.size() );
+
+        for( auto _ : state )
+        {
+            for( std::size_t i{ 0 }; i < column.size(); ++i )
+            {
+                ::benchmark::DoNotOptimize( DateTime::fromString( column[i], results[i] ) );
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_DateTime_ParseMany( ::benchmark::State& state )
+    {
+        const auto column{ makeIso8601Column( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const std::vector<std::string_view> views( column.begin(), column.end() );
+        std::vector<DateTime> results( column.size() );
+        std::vector<std::uint8_t> ok( column.size() );
+
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( DateTime::parseMany( views, results, ok ) );
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    /** @brief Build a log buffer of "timestamp message" lines */
+    static std::string makeLogBuffer( std::size_t count )
+    {
+        std::string buffer;
+        for( const auto& timestamp : makeIso8601Column( count ) )
+        {
+            buffer += timestamp;
+            buffer += " GET /index.html 200\n";
+        }
+
+        return buffer;
+    }
+
+    static void BM_DateTime_ParsePrefix_LogBuffer( ::benchmark::State& state )
+    {
+        const auto buffer{ makeLogBuffer( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const char* last{ buffer.data() + buffer.size() };
+
+        for( auto _ : state )
+        {
+            for( const char* p{ buffer.data() }; p != last; )
+            {
+                DateTime dt;
+                p = DateTime::parsePrefix( p, last, dt );
+                ::benchmark::DoNotOptimize( dt );
+                p = std::find( p, last, '\n' ) + 1;
+            }
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+        state.SetBytesProcessed( state.iterations() * static_cast<std::int64_t>( buffer.size() ) );
+    }
+
+    static void BM_DateTime_StreamExtract( ::benchmark::State& state )
+    {
+        const auto column{ makeIso8601Column( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::string text;
+        for( const auto& timestamp : column )
+        {
+            text += timestamp;
+            text += ' ';
+        }
+
+        for( auto _ : state )
+        {
+            std::istringstream stream{ text };
+            DateTime dt;
+            while( stream >> dt )
+            {
+                ::benchmark::DoNotOptimize( dt );
+            }
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
     //----------------------------------------------
     // Formatting
     //----------------------------------------------
@@ -129,6 +337,58 @@ namespace nfx::time::benchmark
         }
     }
 
+    static void BM_DateTime_FormatTo_ISO8601( ::benchmark::State& state )
+    {
+        auto dt{ DateTime::utcNow() };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+
+        for( auto _ : state )
+        {
+            auto length{ dt.formatTo( buffer, sizeof( buffer ) ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+        }
+    }
+
+    static void BM_DateTime_FormatTo_ISO8601Precise( ::benchmark::State& state )
+    {
+        auto dt{ DateTime::utcNow() };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+
+        for( auto _ : state )
+        {
+            auto length{ dt.formatTo( buffer, sizeof( buffer ), DateTime::Format::Iso8601Precise ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+        }
+    }
+
+    static void BM_DateTime_StdFormatTo_Millis( ::benchmark::State& state )
+    {
+        auto dt{ DateTime::utcNow() };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+
+        for( auto _ : state )
+        {
+            auto end{ std::format_to( buffer, "{:ms}", dt ) };
+            ::benchmark::DoNotOptimize( end );
+            ::benchmark::DoNotOptimize( buffer );
+        }
+    }
+
+    static void BM_DateTime_StdFormatTo_Pattern( ::benchmark::State& state )
+    {
+        auto dt{ DateTime::utcNow() };
+        char buffer[64];
+
+        for( auto _ : state )
+        {
+            auto end{ std::format_to( buffer, "{:yyyy-MM-dd HH:mm:ss.fff}", dt ) };
+            ::benchmark::DoNotOptimize( end );
+            ::benchmark::DoNotOptimize( buffer );
+        }
+    }
+
     //----------------------------------------------
     // Arithmetic
     //----------------------------------------------
@@ -220,6 +480,58 @@ namespace nfx::time::benchmark
         }
     }
 
+    static void BM_DateTime_GetComponents_Random( ::benchmark::State& state )
+    {
+        const auto& values{ randomDateTimes() };
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            const auto& dt{ values[i++ & ( RANDOM_SAMPLE_COUNT - 1 )] };
+            auto y{ dt.year() };
+            auto m{ dt.month() };
+            auto d{ dt.day() };
+            ::benchmark::DoNotOptimize( y );
+            ::benchmark::DoNotOptimize( m );
+            ::benchmark::DoNotOptimize( d );
+        }
+    }
+
+    static void BM_DateTime_Components( ::benchmark::State& state )
+    {
+        auto dt{ DateTime::utcNow() };
+
+        for( auto _ : state )
+        {
+            auto components{ dt.components() };
+            ::benchmark::DoNotOptimize( components );
+        }
+    }
+
+    static void BM_DateTime_Components_Random( ::benchmark::State& state )
+    {
+        const auto& values{ randomDateTimes() };
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto components{ values[i++ & ( RANDOM_SAMPLE_COUNT - 1 )].components() };
+            ::benchmark::DoNotOptimize( components );
+        }
+    }
+
+    static void BM_DateTime_DayOfYear_Random( ::benchmark::State& state )
+    {
+        const auto& values{ randomDateTimes() };
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto doy{ values[i++ & ( RANDOM_SAMPLE_COUNT - 1 )].dayOfYear() };
+            ::benchmark::DoNotOptimize( doy );
+        }
+    }
+
     //----------------------------------------------
     // Comparison
     //----------------------------------------------
@@ -245,9 +557,16 @@ namespace nfx::time::benchmark
     //----------------------------------------------
 
     BENCHMARK( BM_DateTime_Construct_YMD );
+    BENCHMARK( BM_DateTime_Construct_YMD_Random );
     BENCHMARK( BM_DateTime_Construct_YMDHMS );
     BENCHMARK( BM_DateTime_Now );
     BENCHMARK( BM_DateTime_UtcNow );
+    BENCHMARK_TEMPLATE( BM_DateTime_UtcNow_Clock, PreciseClock );
+    BENCHMARK_TEMPLATE( BM_DateTime_UtcNow_Clock, CoarseClock );
+    BENCHMARK_TEMPLATE( BM_DateTime_UtcNow_Clock, TscClock );
+    BENCHMARK_TEMPLATE( BM_DateTime_UtcNow_Resolution, PreciseClock );
+    BENCHMARK_TEMPLATE( BM_DateTime_UtcNow_Resolution, CoarseClock );
+    BENCHMARK_TEMPLATE( BM_DateTime_UtcNow_Resolution, TscClock );
 
     //----------------------------------------------
     // Parsing
@@ -255,6 +574,10 @@ namespace nfx::time::benchmark
 
     BENCHMARK( BM_DateTime_Parse );
     BENCHMARK( BM_DateTime_ParseExtended );
+    BENCHMARK( BM_DateTime_ParseColumn_FromString )->Arg( 4096 );
+    BENCHMARK( BM_DateTime_ParseMany )->Arg( 4096 );
+    BENCHMARK( BM_DateTime_ParsePrefix_LogBuffer )->Arg( 4096 );
+    BENCHMARK( BM_DateTime_StreamExtract )->Arg( 4096 );
 
     //----------------------------------------------
     // Formatting
@@ -262,6 +585,10 @@ namespace nfx::time::benchmark
 
     BENCHMARK( BM_DateTime_ToString_ISO8601 );
     BENCHMARK( BM_DateTime_toIso8601Precise );
+    BENCHMARK( BM_DateTime_FormatTo_ISO8601 );
+    BENCHMARK( BM_DateTime_FormatTo_ISO8601Precise );
+    BENCHMARK( BM_DateTime_StdFormatTo_Millis );
+    BENCHMARK( BM_DateTime_StdFormatTo_Pattern );
 
     //----------------------------------------------
     // Arithmetic
@@ -283,6 +610,10 @@ namespace nfx::time::benchmark
     //----------------------------------------------
 
     BENCHMARK( BM_DateTime_GetComponents );
+    BENCHMARK( BM_DateTime_GetComponents_Random );
+    BENCHMARK( BM_DateTime_Components );
+    BENCHMARK( BM_DateTime_Components_Random );
+    BENCHMARK( BM_DateTime_DayOfYear_Random );
 
     //----------------------------------------------
     // Comparison
@@ -31,6 +31,10 @@
 
 #include <nfx/datetime/DateTimeOffset.h>
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace nfx::time::benchmark
 {
     //=====================================================================
@@ -61,6 +65,37 @@ namespace nfx::time::benchmark
         }
     }
 
+    template <typename Clock>
+    static void BM_DateTimeOffset_Now_Clock( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dto{ DateTimeOffset::now<Clock>() };
+            ::benchmark::DoNotOptimize( dto );
+        }
+    }
+
+    template <typename Clock>
+    static void BM_DateTimeOffset_UtcNow_Clock( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dto{ DateTimeOffset::utcNow<Clock>() };
+            ::benchmark::DoNotOptimize( dto );
+        }
+    }
+
+    static void BM_DateTimeOffset_FromLocalDateTime( ::benchmark::State& state )
+    {
+        const auto dt{ DateTime{ 2024, 10, 23, 15, 30, 45 } };
+
+        for( auto _ : state )
+        {
+            auto dto{ DateTimeOffset{ dt } };
+            ::benchmark::DoNotOptimize( dto );
+        }
+    }
+
     //----------------------------------------------
     // Parsing
     //----------------------------------------------
@@ -87,6 +122,55 @@ namespace nfx::time::benchmark
         }
     }
 
+    /** @brief Build a column of consecutive ISO 8601 timestamps with millisecond fractions and offsets */
+    static std::vector<std::string> makeIso8601OffsetColumn( std::size_t count )
+    {
+        std::vector<std::string> column;
+        column.reserve( count );
+
+        DateTimeOffset dto{ 2024, 10, 23, 15, 30, 45, TimeSpan::fromHours( 5.5 ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            column.push_back( dto.toString( DateTime::Format::Iso8601Millis ) );
+            dto += TimeSpan{ 12345679 };
+        }
+
+        return column;
+    }
+
+    static void BM_DateTimeOffset_ParseColumn_FromString( ::benchmark::State& state )
+    {
+        const auto column{ makeIso8601OffsetColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::vector<DateTimeOffset> results( column.size() );
+
+        for( auto _ : state )
+        {
+            for( std::size_t i{ 0 }; i < column.size(); ++i )
+            {
+                ::benchmark::DoNotOptimize( DateTimeOffset::fromString( column[i], results[i] ) );
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_DateTimeOffset_ParseMany( ::benchmark::State& state )
+    {
+        const auto column{ makeIso8601OffsetColumn( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const std::vector<std::string_view> views( column.begin(), column.end() );
+        std::vector<DateTimeOffset> results( column.size() );
+        std::vector<std::uint8_t> ok( column.size() );
+
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( DateTimeOffset::parseMany( views, results, ok ) );
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
     //----------------------------------------------
     // Conversion
     //----------------------------------------------
@@ -125,6 +209,25 @@ namespace nfx::time::benchmark
         }
     }
 
+    static void BM_DateTimeOffset_ToLocalTime_Historical( ::benchmark::State& state )
+    {
+        // Scattered hours over several decades (every lookup lands in a different hour)
+        std::vector<DateTimeOffset> values;
+        std::int64_t ticks{ DateTime{ 1975, 1, 1 }.ticks() };
+        for( std::size_t i{ 0 }; i < 1024; ++i )
+        {
+            ticks += 7919 * constants::TICKS_PER_HOUR / 7;
+            values.emplace_back( DateTime{ ticks }, TimeSpan{ 0 } );
+        }
+
+        std::size_t i{ 0 };
+        for( auto _ : state )
+        {
+            auto local{ values[i++ & 1023].toLocalTime() };
+            ::benchmark::DoNotOptimize( local );
+        }
+    }
+
     //----------------------------------------------
     // Formatting
     //----------------------------------------------
@@ -140,6 +243,19 @@ namespace nfx::time::benchmark
         }
     }
 
+    static void BM_DateTimeOffset_FormatTo( ::benchmark::State& state )
+    {
+        auto dto{ DateTimeOffset::now() };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+
+        for( auto _ : state )
+        {
+            auto length{ dto.formatTo( buffer, sizeof( buffer ) ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+        }
+    }
+
     //----------------------------------------------
     // Arithmetic
     //----------------------------------------------
@@ -194,6 +310,15 @@ namespace nfx::time::benchmark
 
     BENCHMARK( BM_DateTimeOffset_Construct );
     BENCHMARK( BM_DateTimeOffset_Now );
+    BENCHMARK( BM_DateTimeOffset_Now )->Threads( 8 );
+    BENCHMARK_TEMPLATE( BM_DateTimeOffset_Now_Clock, PreciseClock );
+    BENCHMARK_TEMPLATE( BM_DateTimeOffset_Now_Clock, CoarseClock );
+    BENCHMARK_TEMPLATE( BM_DateTimeOffset_Now_Clock, TscClock );
+    BENCHMARK_TEMPLATE( BM_DateTimeOffset_UtcNow_Clock, PreciseClock );
+    BENCHMARK_TEMPLATE( BM_DateTimeOffset_UtcNow_Clock, CoarseClock );
+    BENCHMARK_TEMPLATE( BM_DateTimeOffset_UtcNow_Clock, TscClock );
+    BENCHMARK( BM_DateTimeOffset_FromLocalDateTime );
+    BENCHMARK( BM_DateTimeOffset_FromLocalDateTime )->Threads( 8 );
 
     //----------------------------------------------
     // Parsing
@@ -201,6 +326,8 @@ namespace nfx::time::benchmark
 
     BENCHMARK( BM_DateTimeOffset_Parse );
     BENCHMARK( BM_DateTimeOffset_ParseZ );
+    BENCHMARK( BM_DateTimeOffset_ParseColumn_FromString )->Arg( 4096 );
+    BENCHMARK( BM_DateTimeOffset_ParseMany )->Arg( 4096 );
 
     //----------------------------------------------
     // Conversion
@@ -209,12 +336,14 @@ namespace nfx::time::benchmark
     BENCHMARK( BM_DateTimeOffset_ToUniversalTime );
     BENCHMARK( BM_DateTimeOffset_ToOffset );
     BENCHMARK( BM_DateTimeOffset_UtcDateTime );
+    BENCHMARK( BM_DateTimeOffset_ToLocalTime_Historical );
 
     //----------------------------------------------
     // Formatting
     //----------------------------------------------
 
     BENCHMARK( BM_DateTimeOffset_ToString );
+    BENCHMARK( BM_DateTimeOffset_FormatTo );
 
     //----------------------------------------------
     // Arithmetic
@@ -0,0 +1,223 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_DateTimePattern.cpp
+ * @brief Benchmark compile-time and runtime custom patterns against the built-in ISO 8601 paths
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/DateTimePattern.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // DateTimePattern benchmark suite
+    //=====================================================================
+
+    namespace
+    {
+        /** @brief Random instants across the full DateTime range */
+        const std::vector<DateTime>& randomValues()
+        {
+            static const std::vector<DateTime> values{ [] {
+                std::vector<DateTime> result;
+                result.reserve( 4096 );
+                std::mt19937_64 rng{ 42 };
+                std::uniform_int_distribution<std::int64_t> ticks{ 0, constants::MAX_DATETIME_TICKS };
+                for( std::size_t i{ 0 }; i < 4096; ++i )
+                {
+                    result.emplace_back( ticks( rng ) );
+                }
+                return result;
+            }() };
+
+            return values;
+        }
+
+        /** @brief Same instants rendered as "yyyy-MM-dd'T'HH:mm:ss.fffffffK", the Iso8601Precise layout */
+        const std::vector<std::string>& preciseTexts()
+        {
+            static const std::vector<std::string> texts{ [] {
+                std::vector<std::string> result;
+                for( const auto& value : randomValues() )
+                {
+                    result.push_back( value.toString( DateTime::Format::Iso8601Precise ) );
+                }
+                return result;
+            }() };
+
+            return texts;
+        }
+    } // namespace
+
+    //----------------------------------------------
+    // Formatting
+    //----------------------------------------------
+
+    static void BM_Builtin_FormatTo_Precise( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto length{ values[i].formatTo( buffer, sizeof( buffer ), DateTime::Format::Iso8601Precise ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+            i = ( i + 1 ) & ( values.size() - 1 );
+        }
+    }
+
+    static void BM_FixedPattern_FormatTo_Precise( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto length{ formatTo<"yyyy-MM-dd'T'HH:mm:ss.fffffffK">( values[i], buffer ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+            i = ( i + 1 ) & ( values.size() - 1 );
+        }
+    }
+
+    static void BM_RuntimePattern_FormatTo_Precise( ::benchmark::State& state )
+    {
+        const auto pattern{ DateTimePattern::compile( "yyyy-MM-dd'T'HH:mm:ss.fffffffK" ).value() };
+        const auto& values{ randomValues() };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto length{ pattern.formatTo( values[i], buffer, sizeof( buffer ) ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+            i = ( i + 1 ) & ( values.size() - 1 );
+        }
+    }
+
+    static void BM_FixedPattern_FormatTo_Vendor( ::benchmark::State& state )
+    {
+        const auto& values{ randomValues() };
+        char buffer[32];
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto length{ formatTo<"dd/MM/yyyy HH:mm:ss.fff">( values[i], buffer ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+            i = ( i + 1 ) & ( values.size() - 1 );
+        }
+    }
+
+    //----------------------------------------------
+    // Parsing
+    //----------------------------------------------
+
+    static void BM_Builtin_FromString_Precise( ::benchmark::State& state )
+    {
+        const auto& texts{ preciseTexts() };
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            DateTime result;
+            auto ok{ DateTime::fromString( texts[i], result ) };
+            ::benchmark::DoNotOptimize( ok );
+            ::benchmark::DoNotOptimize( result );
+            i = ( i + 1 ) & ( texts.size() - 1 );
+        }
+    }
+
+    static void BM_FixedPattern_TryParse_Precise( ::benchmark::State& state )
+    {
+        const auto& texts{ preciseTexts() };
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            DateTime result;
+            auto ok{ tryParse<"yyyy-MM-dd'T'HH:mm:ss.fffffffK">( texts[i], result ) };
+            ::benchmark::DoNotOptimize( ok );
+            ::benchmark::DoNotOptimize( result );
+            i = ( i + 1 ) & ( texts.size() - 1 );
+        }
+    }
+
+    static void BM_RuntimePattern_TryParse_Precise( ::benchmark::State& state )
+    {
+        const auto pattern{ DateTimePattern::compile( "yyyy-MM-dd'T'HH:mm:ss.fffffffK" ).value() };
+        const auto& texts{ preciseTexts() };
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            DateTime result;
+            auto ok{ pattern.tryParse( texts[i], result ) };
+            ::benchmark::DoNotOptimize( ok );
+            ::benchmark::DoNotOptimize( result );
+            i = ( i + 1 ) & ( texts.size() - 1 );
+        }
+    }
+
+    static void BM_RuntimePattern_Compile( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto pattern{ DateTimePattern::compile( "dd/MM/yyyy HH:mm:ss.fff" ) };
+            ::benchmark::DoNotOptimize( pattern );
+        }
+    }
+
+    //----------------------------------------------
+    // Formatting
+    //----------------------------------------------
+
+    BENCHMARK( BM_Builtin_FormatTo_Precise );
+    BENCHMARK( BM_FixedPattern_FormatTo_Precise );
+    BENCHMARK( BM_RuntimePattern_FormatTo_Precise );
+    BENCHMARK( BM_FixedPattern_FormatTo_Vendor );
+
+    //----------------------------------------------
+    // Parsing
+    //----------------------------------------------
+
+    BENCHMARK( BM_Builtin_FromString_Precise );
+    BENCHMARK( BM_FixedPattern_TryParse_Precise );
+    BENCHMARK( BM_RuntimePattern_TryParse_Precise );
+    BENCHMARK( BM_RuntimePattern_Compile );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
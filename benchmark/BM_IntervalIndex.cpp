@@ -0,0 +1,158 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_IntervalIndex.cpp
+ * @brief Benchmark IntervalIndex overlap and stabbing queries against linear scans
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/IntervalIndex.h>
+
+#include <random>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // IntervalIndex benchmark suite
+    //=====================================================================
+
+    namespace
+    {
+        /** @brief Random sessions of up to two hours within one year */
+        std::vector<DateTimeInterval> randomIntervals( std::size_t count, std::uint64_t seed = 42 )
+        {
+            std::vector<DateTimeInterval> result;
+            result.reserve( count );
+            std::mt19937_64 rng{ seed };
+            std::uniform_int_distribution<std::int64_t> seconds{ 0, 365 * 86'400 };
+            std::uniform_int_distribution<std::int64_t> length{ 60, 7'200 };
+            const auto start{ DateTime{ 2024, 1, 1 }.ticks() };
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                const auto first{ start + seconds( rng ) * constants::TICKS_PER_SECOND };
+                const auto last{ first + length( rng ) * constants::TICKS_PER_SECOND };
+                result.emplace_back( DateTime{ first }, DateTime{ last } );
+            }
+
+            return result;
+        }
+    } // namespace
+
+    //----------------------------------------------
+    // Overlap queries
+    //----------------------------------------------
+
+    static void BM_LinearScan_Overlapping( ::benchmark::State& state )
+    {
+        const auto intervals{ randomIntervals( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const auto queries{ randomIntervals( 1024, 7 ) };
+        std::size_t q{ 0 };
+        for( auto _ : state )
+        {
+            const auto& query{ queries[q++ & 1023] };
+            std::size_t hits{ 0 };
+            for( const auto& interval : intervals )
+            {
+                hits += interval.overlaps( query );
+            }
+            ::benchmark::DoNotOptimize( hits );
+        }
+        state.SetItemsProcessed( state.iterations() );
+    }
+
+    static void BM_IntervalIndex_Overlapping( ::benchmark::State& state )
+    {
+        const IntervalIndex index{ randomIntervals( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const auto queries{ randomIntervals( 1024, 7 ) };
+        std::size_t q{ 0 };
+        for( auto _ : state )
+        {
+            std::size_t hits{ 0 };
+            index.forEachOverlapping( queries[q++ & 1023], [&]( const DateTimeInterval&, std::size_t ) { ++hits; } );
+            ::benchmark::DoNotOptimize( hits );
+        }
+        state.SetItemsProcessed( state.iterations() );
+    }
+
+    static void BM_IntervalIndex_Stabbing( ::benchmark::State& state )
+    {
+        const IntervalIndex index{ randomIntervals( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const auto queries{ randomIntervals( 1024, 7 ) };
+        std::size_t q{ 0 };
+        for( auto _ : state )
+        {
+            std::size_t hits{ 0 };
+            index.forEachStabbing( queries[q++ & 1023].start(), [&]( const DateTimeInterval&, std::size_t ) {
+                ++hits;
+            } );
+            ::benchmark::DoNotOptimize( hits );
+        }
+        state.SetItemsProcessed( state.iterations() );
+    }
+
+    //----------------------------------------------
+    // Construction and coalescing
+    //----------------------------------------------
+
+    static void BM_IntervalIndex_Build( ::benchmark::State& state )
+    {
+        const auto intervals{ randomIntervals( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        for( auto _ : state )
+        {
+            const IntervalIndex index{ intervals };
+            ::benchmark::DoNotOptimize( index.size() );
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_Coalesce( ::benchmark::State& state )
+    {
+        const auto intervals{ randomIntervals( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( coalesce( intervals ) );
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    //----------------------------------------------
+    // Overlap queries
+    //----------------------------------------------
+
+    BENCHMARK( BM_LinearScan_Overlapping )->Arg( 1 << 10 )->Arg( 1 << 20 );
+    BENCHMARK( BM_IntervalIndex_Overlapping )->Arg( 1 << 10 )->Arg( 1 << 20 );
+    BENCHMARK( BM_IntervalIndex_Stabbing )->Arg( 1 << 20 );
+
+    //----------------------------------------------
+    // Construction and coalescing
+    //----------------------------------------------
+
+    BENCHMARK( BM_IntervalIndex_Build )->Arg( 1 << 20 )->Unit( ::benchmark::kMillisecond );
+    BENCHMARK( BM_Coalesce )->Arg( 1 << 20 )->Unit( ::benchmark::kMillisecond );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,193 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_PackedDateTimeOffset.cpp
+ * @brief Benchmark sorting, scanning and packing PackedDateTimeOffset against DateTimeOffset arrays
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/Bulk.h>
+#include <nfx/datetime/PackedDateTimeOffset.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // PackedDateTimeOffset benchmark suite
+    //=====================================================================
+
+    namespace
+    {
+        /** @brief Random millisecond instants in 2000-2030 with quarter-hour offsets */
+        std::vector<DateTimeOffset> randomValues( std::size_t count )
+        {
+            std::vector<DateTimeOffset> result;
+            result.reserve( count );
+            std::mt19937_64 rng{ 42 };
+            std::uniform_int_distribution<std::int64_t> ticks{
+                DateTime{ 2000, 1, 1 }.ticks(), DateTime{ 2030, 1, 1 }.ticks() };
+            std::uniform_int_distribution<std::int32_t> quarters{ -48, 56 };
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                const auto value{ ticks( rng ) };
+                result.emplace_back(
+                    value - value % constants::TICKS_PER_MILLISECOND, TimeSpan::fromMinutes( quarters( rng ) * 15 ) );
+            }
+
+            return result;
+        }
+
+        std::vector<PackedDateTimeOffset> packedValues( std::size_t count )
+        {
+            const auto values{ randomValues( count ) };
+            std::vector<PackedDateTimeOffset> result( values.size() );
+            bulk::pack( values, result );
+
+            return result;
+        }
+    } // namespace
+
+    //----------------------------------------------
+    // Sorting
+    //----------------------------------------------
+
+    static void BM_DateTimeOffset_Sort( ::benchmark::State& state )
+    {
+        const auto values{ randomValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::vector<DateTimeOffset> work( values.size() );
+        for( auto _ : state )
+        {
+            std::copy( values.begin(), values.end(), work.begin() );
+            std::sort( work.begin(), work.end() );
+            ::benchmark::DoNotOptimize( work.data() );
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_Packed_Sort( ::benchmark::State& state )
+    {
+        const auto values{ packedValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::vector<PackedDateTimeOffset> work( values.size() );
+        for( auto _ : state )
+        {
+            std::copy( values.begin(), values.end(), work.begin() );
+            std::sort( work.begin(), work.end() );
+            ::benchmark::DoNotOptimize( work.data() );
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    //----------------------------------------------
+    // Scanning
+    //----------------------------------------------
+
+    static void BM_DateTimeOffset_CountBefore( ::benchmark::State& state )
+    {
+        const auto values{ randomValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const DateTimeOffset pivot{ DateTime{ 2015, 1, 1 }, TimeSpan{} };
+        for( auto _ : state )
+        {
+            auto count{ std::count_if( values.begin(), values.end(), [&]( const auto& value ) {
+                return value < pivot;
+            } ) };
+            ::benchmark::DoNotOptimize( count );
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+        state.SetBytesProcessed(
+            state.iterations() * state.range( 0 ) * static_cast<std::int64_t>( sizeof( DateTimeOffset ) ) );
+    }
+
+    static void BM_Packed_CountBefore( ::benchmark::State& state )
+    {
+        const auto values{ packedValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const PackedDateTimeOffset pivot{ DateTimeOffset{ DateTime{ 2015, 1, 1 }, TimeSpan{} } };
+        for( auto _ : state )
+        {
+            auto count{ std::count_if( values.begin(), values.end(), [&]( const auto& value ) {
+                return value < pivot;
+            } ) };
+            ::benchmark::DoNotOptimize( count );
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+        state.SetBytesProcessed(
+            state.iterations() * state.range( 0 ) * static_cast<std::int64_t>( sizeof( PackedDateTimeOffset ) ) );
+    }
+
+    //----------------------------------------------
+    // Packing
+    //----------------------------------------------
+
+    static void BM_Bulk_Pack( ::benchmark::State& state )
+    {
+        const auto values{ randomValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::vector<PackedDateTimeOffset> out( values.size() );
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( bulk::pack( values, out ) );
+            ::benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_Bulk_Unpack( ::benchmark::State& state )
+    {
+        const auto values{ packedValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::vector<DateTimeOffset> out( values.size() );
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( bulk::unpack( values, out ) );
+            ::benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    //----------------------------------------------
+    // Sorting
+    //----------------------------------------------
+
+    // 16K values fit in L2; 4M values (64 MB unpacked) are memory-bound
+    BENCHMARK( BM_DateTimeOffset_Sort )->Arg( 1 << 14 )->Arg( 1 << 22 )->Unit( ::benchmark::kMillisecond );
+    BENCHMARK( BM_Packed_Sort )->Arg( 1 << 14 )->Arg( 1 << 22 )->Unit( ::benchmark::kMillisecond );
+
+    //----------------------------------------------
+    // Scanning
+    //----------------------------------------------
+
+    BENCHMARK( BM_DateTimeOffset_CountBefore )->Arg( 1 << 14 )->Arg( 1 << 22 );
+    BENCHMARK( BM_Packed_CountBefore )->Arg( 1 << 14 )->Arg( 1 << 22 );
+
+    //----------------------------------------------
+    // Packing
+    //----------------------------------------------
+
+    BENCHMARK( BM_Bulk_Pack )->Arg( 1 << 14 );
+    BENCHMARK( BM_Bulk_Unpack )->Arg( 1 << 14 );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
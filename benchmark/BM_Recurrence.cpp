@@ -0,0 +1,177 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Recurrence.cpp
+ * @brief Benchmark Recurrence compilation and occurrence search against day-by-day loops
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <ranges>
+
+#include <nfx/datetime/Recurrence.h>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // Recurrence benchmark suite
+    //=====================================================================
+
+    //----------------------------------------------
+    // Compilation
+    //----------------------------------------------
+
+    static void BM_Recurrence_FromCron( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto schedule{ Recurrence::fromCron( "30 9 * * MON-FRI" ) };
+            ::benchmark::DoNotOptimize( schedule );
+        }
+    }
+
+    static void BM_Recurrence_FromRRule( ::benchmark::State& state )
+    {
+        const DateTime start{ 2024, 1, 1, 9, 30, 0 };
+        for( auto _ : state )
+        {
+            auto schedule{ Recurrence::fromRRule( "FREQ=MONTHLY;BYDAY=-1FR;BYHOUR=17;BYMINUTE=0", start ) };
+            ::benchmark::DoNotOptimize( schedule );
+        }
+    }
+
+    //----------------------------------------------
+    // Next occurrence
+    //----------------------------------------------
+
+    static void BM_Loop_NextWeekdayAtTime( ::benchmark::State& state )
+    {
+        // Friday after the occurrence: the loop walks over the weekend
+        const DateTime after{ 2024, 6, 14, 10, 0, 0 };
+        for( auto _ : state )
+        {
+            auto candidate{ after.date() + TimeSpan::fromHours( 9 ) + TimeSpan::fromMinutes( 30 ) };
+            while( candidate <= after || candidate.dayOfWeek() == 0 || candidate.dayOfWeek() == 6 )
+            {
+                candidate += TimeSpan::fromDays( 1 );
+            }
+            ::benchmark::DoNotOptimize( candidate );
+        }
+    }
+
+    static void BM_Recurrence_NextWeekdayAtTime( ::benchmark::State& state )
+    {
+        const auto schedule{ *Recurrence::fromCron( "30 9 * * MON-FRI" ) };
+        const DateTime after{ 2024, 6, 14, 10, 0, 0 };
+        for( auto _ : state )
+        {
+            auto next{ schedule.nextAfter( after ) };
+            ::benchmark::DoNotOptimize( next );
+        }
+    }
+
+    static void BM_Loop_NextLastFridayOfMonth( ::benchmark::State& state )
+    {
+        const DateTime after{ 2024, 6, 1 };
+        for( auto _ : state )
+        {
+            auto candidate{ after + TimeSpan::fromDays( 1 ) };
+            while( candidate.dayOfWeek() != 5 ||
+                   candidate.day() + 7 <= DateTime::daysInMonth( candidate.year(), candidate.month() ) )
+            {
+                candidate += TimeSpan::fromDays( 1 );
+            }
+            ::benchmark::DoNotOptimize( candidate );
+        }
+    }
+
+    static void BM_Recurrence_NextLastFridayOfMonth( ::benchmark::State& state )
+    {
+        const auto schedule{ *Recurrence::fromCron( "0 0 * * 5L" ) };
+        const DateTime after{ 2024, 6, 1 };
+        for( auto _ : state )
+        {
+            auto next{ schedule.nextAfter( after ) };
+            ::benchmark::DoNotOptimize( next );
+        }
+    }
+
+    static void BM_Recurrence_NextAfterYearsAhead( ::benchmark::State& state )
+    {
+        // Friday the 13th in February: months and years are skipped without visiting their days
+        const DateTime after{ 2016, 2, 13 };
+        const auto schedule{ *Recurrence::fromRRule( "FREQ=YEARLY;BYMONTH=2;BYMONTHDAY=13;BYDAY=FR", after ) };
+        for( auto _ : state )
+        {
+            auto next{ schedule.nextAfter( after ) };
+            ::benchmark::DoNotOptimize( next );
+        }
+    }
+
+    //----------------------------------------------
+    // Ranges
+    //----------------------------------------------
+
+    static void BM_Recurrence_ExpandYearOfWeekdays( ::benchmark::State& state )
+    {
+        const auto schedule{ *Recurrence::fromCron( "30 9 * * MON-FRI" ) };
+        const DateTime after{ 2024, 1, 1 };
+        for( auto _ : state )
+        {
+            std::int64_t sum{ 0 };
+            for( const auto& value : schedule.occurrences( after ) | std::views::take( 262 ) )
+            {
+                sum += value.ticks();
+            }
+            ::benchmark::DoNotOptimize( sum );
+        }
+        state.SetItemsProcessed( state.iterations() * 262 );
+    }
+
+    //----------------------------------------------
+    // Compilation
+    //----------------------------------------------
+
+    BENCHMARK( BM_Recurrence_FromCron );
+    BENCHMARK( BM_Recurrence_FromRRule );
+
+    //----------------------------------------------
+    // Next occurrence
+    //----------------------------------------------
+
+    BENCHMARK( BM_Loop_NextWeekdayAtTime );
+    BENCHMARK( BM_Recurrence_NextWeekdayAtTime );
+    BENCHMARK( BM_Loop_NextLastFridayOfMonth );
+    BENCHMARK( BM_Recurrence_NextLastFridayOfMonth );
+    BENCHMARK( BM_Recurrence_NextAfterYearsAhead );
+
+    //----------------------------------------------
+    // Ranges
+    //----------------------------------------------
+
+    BENCHMARK( BM_Recurrence_ExpandYearOfWeekdays );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
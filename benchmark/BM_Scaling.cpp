@@ -0,0 +1,201 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Scaling.cpp
+ * @brief Benchmark clock reads, zone lookups, parsing and formatting as thread count grows
+ * @details Every benchmark runs at 1, 2, 4, ... threads up to the hardware concurrency and
+ *          reports wall-clock time per operation, so flat lines mean no shared-state contention
+ *          (offset caches, allocator, zone registry) and rising lines expose it.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/Clock.h>
+#include <nfx/datetime/DateTime.h>
+#include <nfx/datetime/DateTimeOffset.h>
+#include <nfx/datetime/TimeZone.h>
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <thread>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // Thread scaling benchmark suite
+    //=====================================================================
+
+    /** @brief Highest thread count measured */
+    static const int MAX_THREADS{ static_cast<int>( std::max( 2u, std::thread::hardware_concurrency() ) ) };
+
+    /** @brief Timestamps cycled through by the parse benchmarks */
+    static constexpr std::array<std::string_view, 4> TIMESTAMPS{ "2024-01-15T12:30:45Z",
+        "2024-06-30T23:59:59.1234567+02:00", "2031-11-02T04:05:06.789-05:00", "1999-12-31T00:00:00.5Z" };
+
+    //----------------------------------------------
+    // Clock reads
+    //----------------------------------------------
+
+    static void BM_Scaling_DateTime_UtcNow( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dt{ DateTime::utcNow() };
+            ::benchmark::DoNotOptimize( dt );
+        }
+    }
+
+    static void BM_Scaling_DateTime_Now( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dt{ DateTime::now() };
+            ::benchmark::DoNotOptimize( dt );
+        }
+    }
+
+    static void BM_Scaling_DateTime_UtcNow_Coarse( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dt{ DateTime::utcNow<CoarseClock>() };
+            ::benchmark::DoNotOptimize( dt );
+        }
+    }
+
+    static void BM_Scaling_DateTime_UtcNow_Tsc( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dt{ DateTime::utcNow<TscClock>() };
+            ::benchmark::DoNotOptimize( dt );
+        }
+    }
+
+    static void BM_Scaling_DateTimeOffset_Now( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dto{ DateTimeOffset::now() };
+            ::benchmark::DoNotOptimize( dto );
+        }
+    }
+
+    static void BM_Scaling_DateTimeOffset_UtcNow( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto dto{ DateTimeOffset::utcNow() };
+            ::benchmark::DoNotOptimize( dto );
+        }
+    }
+
+    //----------------------------------------------
+    // Time zones
+    //----------------------------------------------
+
+    static void BM_Scaling_TimeZone_FindAndOffset( ::benchmark::State& state )
+    {
+        if( TimeZone::find( "Europe/Paris" ) == nullptr )
+        {
+            state.SkipWithError( "Europe/Paris not found (no zoneinfo database)" );
+            return;
+        }
+
+        std::int64_t ticks{ DateTime{ 2024, 1, 1 }.ticks() + state.thread_index() };
+        for( auto _ : state )
+        {
+            auto offset{ TimeZone::find( "Europe/Paris" )->offsetAt( ticks ) };
+            ::benchmark::DoNotOptimize( offset );
+            ticks += TimeSpan::fromHours( 7 ).ticks();
+        }
+    }
+
+    //----------------------------------------------
+    // Parsing and formatting
+    //----------------------------------------------
+
+    static void BM_Scaling_DateTimeOffset_FromString( ::benchmark::State& state )
+    {
+        std::size_t i{ static_cast<std::size_t>( state.thread_index() ) };
+        for( auto _ : state )
+        {
+            DateTimeOffset dto;
+            ::benchmark::DoNotOptimize( DateTimeOffset::fromString( TIMESTAMPS[i++ % TIMESTAMPS.size()], dto ) );
+            ::benchmark::DoNotOptimize( dto );
+        }
+    }
+
+    static void BM_Scaling_DateTime_ToString( ::benchmark::State& state )
+    {
+        DateTime dt{ 2024, 1, 15, 12, 30, 45, 123 };
+        for( auto _ : state )
+        {
+            auto text{ dt.toString( DateTime::Format::Iso8601Precise ) };
+            ::benchmark::DoNotOptimize( text );
+            dt += TimeSpan{ 12345679 };
+        }
+    }
+
+    static void BM_Scaling_DateTime_FormatTo( ::benchmark::State& state )
+    {
+        DateTime dt{ 2024, 1, 15, 12, 30, 45, 123 };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        for( auto _ : state )
+        {
+            ::benchmark::DoNotOptimize( dt.formatTo( buffer, sizeof( buffer ), DateTime::Format::Iso8601Precise ) );
+            ::benchmark::DoNotOptimize( buffer );
+            dt += TimeSpan{ 12345679 };
+        }
+    }
+
+    //----------------------------------------------
+    // Clock reads
+    //----------------------------------------------
+
+    BENCHMARK( BM_Scaling_DateTime_UtcNow )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+    BENCHMARK( BM_Scaling_DateTime_Now )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+    BENCHMARK( BM_Scaling_DateTime_UtcNow_Coarse )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+    BENCHMARK( BM_Scaling_DateTime_UtcNow_Tsc )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+    BENCHMARK( BM_Scaling_DateTimeOffset_Now )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+    BENCHMARK( BM_Scaling_DateTimeOffset_UtcNow )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+
+    //----------------------------------------------
+    // Time zones
+    //----------------------------------------------
+
+    BENCHMARK( BM_Scaling_TimeZone_FindAndOffset )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+
+    //----------------------------------------------
+    // Parsing and formatting
+    //----------------------------------------------
+
+    BENCHMARK( BM_Scaling_DateTimeOffset_FromString )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+    BENCHMARK( BM_Scaling_DateTime_ToString )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+    BENCHMARK( BM_Scaling_DateTime_FormatTo )->ThreadRange( 1, MAX_THREADS )->UseRealTime();
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,180 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Sort.cpp
+ * @brief Benchmark radix sort, Timeline search and hashing of DateTime arrays
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/Sort.h>
+#include <nfx/datetime/Timeline.h>
+
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // Sort and search benchmark suite
+    //=====================================================================
+
+    namespace
+    {
+        /** @brief Random second-aligned instants within 2024 */
+        std::vector<DateTime> randomValues( std::size_t count, std::uint64_t seed = 42 )
+        {
+            std::vector<DateTime> result;
+            result.reserve( count );
+            std::mt19937_64 rng{ seed };
+            std::uniform_int_distribution<std::int64_t> seconds{ 0, 366 * 86'400 - 1 };
+            const auto start{ DateTime{ 2024, 1, 1 }.ticks() };
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                result.emplace_back( start + seconds( rng ) * constants::TICKS_PER_SECOND );
+            }
+
+            return result;
+        }
+    } // namespace
+
+    //----------------------------------------------
+    // Sorting
+    //----------------------------------------------
+
+    static void BM_StdSort_DateTime( ::benchmark::State& state )
+    {
+        const auto values{ randomValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::vector<DateTime> work( values.size() );
+        for( auto _ : state )
+        {
+            std::copy( values.begin(), values.end(), work.begin() );
+            std::sort( work.begin(), work.end() );
+            ::benchmark::DoNotOptimize( work.data() );
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    static void BM_RadixSort_DateTime( ::benchmark::State& state )
+    {
+        const auto values{ randomValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::vector<DateTime> work( values.size() );
+        std::vector<DateTime> scratch( values.size() );
+        for( auto _ : state )
+        {
+            std::copy( values.begin(), values.end(), work.begin() );
+            radixSort( work, scratch );
+            ::benchmark::DoNotOptimize( work.data() );
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    //----------------------------------------------
+    // Search
+    //----------------------------------------------
+
+    static void BM_StdLowerBound_DateTime( ::benchmark::State& state )
+    {
+        auto values{ randomValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        std::sort( values.begin(), values.end() );
+        const auto keys{ randomValues( 4096, 7 ) };
+        std::size_t i{ 0 };
+        for( auto _ : state )
+        {
+            const auto& key{ keys[i++ & 4095] };
+            ::benchmark::DoNotOptimize( std::lower_bound( values.begin(), values.end(), key ) );
+        }
+        state.SetItemsProcessed( state.iterations() );
+    }
+
+    static void BM_Timeline_LowerBound( ::benchmark::State& state )
+    {
+        const Timeline timeline{ randomValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const auto keys{ randomValues( 4096, 7 ) };
+        std::size_t i{ 0 };
+        for( auto _ : state )
+        {
+            const auto& key{ keys[i++ & 4095] };
+            ::benchmark::DoNotOptimize( timeline.lowerBound( key ) );
+        }
+        state.SetItemsProcessed( state.iterations() );
+    }
+
+    static void BM_Timeline_CountHour( ::benchmark::State& state )
+    {
+        const Timeline timeline{ randomValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        const auto keys{ randomValues( 4096, 7 ) };
+        std::size_t i{ 0 };
+        for( auto _ : state )
+        {
+            const auto& key{ keys[i++ & 4095] };
+            ::benchmark::DoNotOptimize( timeline.count( key, key + TimeSpan::fromHours( 1 ) ) );
+        }
+        state.SetItemsProcessed( state.iterations() );
+    }
+
+    //----------------------------------------------
+    // Hashing
+    //----------------------------------------------
+
+    static void BM_UnorderedSet_Insert( ::benchmark::State& state )
+    {
+        const auto values{ randomValues( static_cast<std::size_t>( state.range( 0 ) ) ) };
+        for( auto _ : state )
+        {
+            std::unordered_set<DateTime> set;
+            set.reserve( values.size() );
+            set.insert( values.begin(), values.end() );
+            ::benchmark::DoNotOptimize( set.size() );
+        }
+        state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+    }
+
+    //----------------------------------------------
+    // Sorting
+    //----------------------------------------------
+
+    // 16K values fit in L2; 4M values (32 MB) are memory-bound
+    BENCHMARK( BM_StdSort_DateTime )->Arg( 1 << 14 )->Arg( 1 << 22 )->Unit( ::benchmark::kMillisecond );
+    BENCHMARK( BM_RadixSort_DateTime )->Arg( 1 << 14 )->Arg( 1 << 22 )->Unit( ::benchmark::kMillisecond );
+
+    //----------------------------------------------
+    // Search
+    //----------------------------------------------
+
+    BENCHMARK( BM_StdLowerBound_DateTime )->Arg( 1 << 14 )->Arg( 1 << 22 );
+    BENCHMARK( BM_Timeline_LowerBound )->Arg( 1 << 14 )->Arg( 1 << 22 );
+    BENCHMARK( BM_Timeline_CountHour )->Arg( 1 << 22 );
+
+    //----------------------------------------------
+    // Hashing
+    //----------------------------------------------
+
+    BENCHMARK( BM_UnorderedSet_Insert )->Arg( 1 << 16 );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
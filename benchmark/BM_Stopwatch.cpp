@@ -0,0 +1,147 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Stopwatch.cpp
+ * @brief Benchmark Stopwatch intervals against utcNow() differences, and histogram recording
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/DateTime.h>
+#include <nfx/datetime/Stopwatch.h>
+#include <nfx/datetime/TimeSpanHistogram.h>
+
+#include <memory>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // Stopwatch benchmark suite
+    //=====================================================================
+
+    //----------------------------------------------
+    // Measuring an interval
+    //----------------------------------------------
+
+    static void BM_Interval_UtcNowDifference( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            const auto start{ DateTime::utcNow() };
+            auto elapsed{ DateTime::utcNow() - start };
+            ::benchmark::DoNotOptimize( elapsed );
+        }
+    }
+
+    static void BM_Interval_Stopwatch( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto watch{ Stopwatch::startNew() };
+            auto elapsed{ watch.elapsed() };
+            ::benchmark::DoNotOptimize( elapsed );
+        }
+    }
+
+    static void BM_Interval_TscStopwatch( ::benchmark::State& state )
+    {
+        for( auto _ : state )
+        {
+            auto watch{ TscStopwatch::startNew() };
+            auto elapsed{ watch.elapsed() };
+            ::benchmark::DoNotOptimize( elapsed );
+        }
+    }
+
+    static void BM_Interval_TscStopwatchLap( ::benchmark::State& state )
+    {
+        auto watch{ TscStopwatch::startNew() };
+        for( auto _ : state )
+        {
+            auto elapsed{ watch.lap() };
+            ::benchmark::DoNotOptimize( elapsed );
+        }
+    }
+
+    //----------------------------------------------
+    // Recording
+    //----------------------------------------------
+
+    static void BM_Histogram_Record( ::benchmark::State& state )
+    {
+        auto histogram{ std::make_unique<TimeSpanHistogram>() };
+        std::int64_t ticks{ 1 };
+        for( auto _ : state )
+        {
+            histogram->record( TimeSpan{ ticks } );
+            ticks = ( ticks * 5 + 3 ) & 0xFFFFF;
+        }
+        ::benchmark::DoNotOptimize( histogram->count() );
+    }
+
+    static void BM_ConcurrentHistogram_Record( ::benchmark::State& state )
+    {
+        static ConcurrentTimeSpanHistogram histogram;
+        std::int64_t ticks{ 1 + state.thread_index() };
+        for( auto _ : state )
+        {
+            histogram.record( TimeSpan{ ticks } );
+            ticks = ( ticks * 5 + 3 ) & 0xFFFFF;
+        }
+    }
+
+    static void BM_Histogram_Percentile( ::benchmark::State& state )
+    {
+        auto histogram{ std::make_unique<TimeSpanHistogram>() };
+        for( std::int64_t ticks{ 1 }; ticks < 1'000'000; ticks += 7 )
+        {
+            histogram->record( TimeSpan{ ticks } );
+        }
+        for( auto _ : state )
+        {
+            auto p99{ histogram->percentile( 99.0 ) };
+            ::benchmark::DoNotOptimize( p99 );
+        }
+    }
+
+    //----------------------------------------------
+    // Measuring an interval
+    //----------------------------------------------
+
+    BENCHMARK( BM_Interval_UtcNowDifference );
+    BENCHMARK( BM_Interval_Stopwatch );
+    BENCHMARK( BM_Interval_TscStopwatch );
+    BENCHMARK( BM_Interval_TscStopwatchLap );
+
+    //----------------------------------------------
+    // Recording
+    //----------------------------------------------
+
+    BENCHMARK( BM_Histogram_Record );
+    BENCHMARK( BM_ConcurrentHistogram_Record )->ThreadRange( 1, 8 );
+    BENCHMARK( BM_Histogram_Percentile );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
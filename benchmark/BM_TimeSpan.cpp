@@ -103,6 +103,19 @@ namespace nfx::time::benchmark
         }
     }
 
+    static void BM_TimeSpan_ParseISOFraction( ::benchmark::State& state )
+    {
+        const std::string duration{ "PT1H30M45.1234567S" };
+
+        for( auto _ : state )
+        {
+            TimeSpan ts;
+            auto ok{ TimeSpan::fromString( duration, ts ) };
+            ::benchmark::DoNotOptimize( ok );
+            ::benchmark::DoNotOptimize( ts );
+        }
+    }
+
     static void BM_TimeSpan_Parse( ::benchmark::State& state )
     {
         const std::string duration{ "3600.5" };
@@ -129,6 +142,19 @@ namespace nfx::time::benchmark
         }
     }
 
+    static void BM_TimeSpan_FormatTo_ISO8601( ::benchmark::State& state )
+    {
+        auto ts{ TimeSpan::fromHours( 25.5 ) };
+        char buffer[constants::MAX_ISO8601_DURATION_LENGTH];
+
+        for( auto _ : state )
+        {
+            auto length{ ts.formatTo( buffer, sizeof( buffer ) ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+        }
+    }
+
     //----------------------------------------------
     // Arithmetic
     //----------------------------------------------
@@ -237,6 +263,7 @@ namespace nfx::time::benchmark
 
     BENCHMARK( BM_TimeSpan_ParseISO );
     BENCHMARK( BM_TimeSpan_ParseISOComplex );
+    BENCHMARK( BM_TimeSpan_ParseISOFraction );
     BENCHMARK( BM_TimeSpan_Parse );
 
     //----------------------------------------------
@@ -244,6 +271,7 @@ namespace nfx::time::benchmark
     //----------------------------------------------
 
     BENCHMARK( BM_TimeSpan_ToString_ISO8601 );
+    BENCHMARK( BM_TimeSpan_FormatTo_ISO8601 );
 
     //----------------------------------------------
     // Arithmetic
@@ -0,0 +1,161 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_TimeZone.cpp
+ * @brief Benchmark TimeZone lookup, offset resolution, and zone conversion
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/TimeZone.h>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // TimeZone benchmark suite
+    //=====================================================================
+
+    //----------------------------------------------
+    // Lookup
+    //----------------------------------------------
+
+    static void BM_TimeZone_Find( ::benchmark::State& state )
+    {
+        if( TimeZone::find( "America/New_York" ) == nullptr )
+        {
+            state.SkipWithError( "zoneinfo database not available" );
+            return;
+        }
+
+        for( auto _ : state )
+        {
+            auto zone{ TimeZone::find( "America/New_York" ) };
+            ::benchmark::DoNotOptimize( zone );
+        }
+    }
+
+    //----------------------------------------------
+    // Offset lookup
+    //----------------------------------------------
+
+    static void BM_TimeZone_OffsetAt( ::benchmark::State& state )
+    {
+        const auto* zone{ TimeZone::find( "America/New_York" ) };
+        if( zone == nullptr )
+        {
+            state.SkipWithError( "zoneinfo database not available" );
+            return;
+        }
+
+        const auto ticks{ DateTime{ 2024, 6, 15, 12, 0, 0 }.ticks() };
+        for( auto _ : state )
+        {
+            auto offset{ zone->offsetAt( ticks ) };
+            ::benchmark::DoNotOptimize( offset );
+        }
+    }
+
+    static void BM_TimeZone_OffsetAt_Scan( ::benchmark::State& state )
+    {
+        const auto* zone{ TimeZone::find( "Europe/Paris" ) };
+        if( zone == nullptr )
+        {
+            state.SkipWithError( "zoneinfo database not available" );
+            return;
+        }
+
+        // Walk 1900-2030 in steps of about 37 days to touch every part of the transition array
+        const auto first{ DateTime{ 1900, 1, 1 }.ticks() };
+        const auto last{ DateTime{ 2030, 1, 1 }.ticks() };
+        const auto step{ 37 * constants::TICKS_PER_DAY + 12345 };
+        auto ticks{ first };
+        for( auto _ : state )
+        {
+            auto offset{ zone->offsetAt( ticks ) };
+            ::benchmark::DoNotOptimize( offset );
+            ticks = ticks + step < last ? ticks + step : first;
+        }
+    }
+
+    static void BM_TimeZone_OffsetAt_FooterRule( ::benchmark::State& state )
+    {
+        const auto* zone{ TimeZone::find( "America/New_York" ) };
+        if( zone == nullptr )
+        {
+            state.SkipWithError( "zoneinfo database not available" );
+            return;
+        }
+
+        const auto ticks{ DateTime{ 2150, 6, 15, 12, 0, 0 }.ticks() };
+        for( auto _ : state )
+        {
+            auto offset{ zone->offsetAt( ticks ) };
+            ::benchmark::DoNotOptimize( offset );
+        }
+    }
+
+    //----------------------------------------------
+    // Zone conversion
+    //----------------------------------------------
+
+    static void BM_TimeZone_ToZone( ::benchmark::State& state )
+    {
+        const auto* zone{ TimeZone::find( "Asia/Tokyo" ) };
+        if( zone == nullptr )
+        {
+            state.SkipWithError( "zoneinfo database not available" );
+            return;
+        }
+
+        const DateTimeOffset value{ DateTime{ 2024, 6, 15, 12, 0, 0 }, TimeSpan::fromHours( 2 ) };
+        for( auto _ : state )
+        {
+            auto converted{ toZone( value, *zone ) };
+            ::benchmark::DoNotOptimize( converted );
+        }
+    }
+
+    //----------------------------------------------
+    // Lookup
+    //----------------------------------------------
+
+    BENCHMARK( BM_TimeZone_Find );
+
+    //----------------------------------------------
+    // Offset lookup
+    //----------------------------------------------
+
+    BENCHMARK( BM_TimeZone_OffsetAt );
+    BENCHMARK( BM_TimeZone_OffsetAt_Scan );
+    BENCHMARK( BM_TimeZone_OffsetAt_FooterRule );
+
+    //----------------------------------------------
+    // Zone conversion
+    //----------------------------------------------
+
+    BENCHMARK( BM_TimeZone_ToZone );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
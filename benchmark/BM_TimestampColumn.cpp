@@ -0,0 +1,216 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_TimestampColumn.cpp
+ * @brief Benchmark delta-of-delta timestamp column encoding and decoding throughput
+ * @details Reports the compression ratio (raw 8-byte ticks / encoded bytes) as a counter and
+ *          decode throughput as bytes of decoded ticks per second
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/TimestampColumn.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // TimestampColumn benchmark suite
+    //=====================================================================
+
+    namespace
+    {
+        /** @brief Number of values per column */
+        constexpr std::size_t COLUMN_SIZE{ 1 << 16 };
+
+        /** @brief One sample per second */
+        std::vector<std::int64_t> regularSeries()
+        {
+            std::vector<std::int64_t> ticks( COLUMN_SIZE );
+            const auto start{ DateTime{ 2025, 1, 1 }.ticks() };
+            for( std::size_t i{ 0 }; i < ticks.size(); ++i )
+            {
+                ticks[i] = start + static_cast<std::int64_t>( i ) * constants::TICKS_PER_SECOND;
+            }
+            return ticks;
+        }
+
+        /** @brief One sample every 10 ms with up to 0.5 ms of jitter */
+        std::vector<std::int64_t> jitteredSeries()
+        {
+            std::vector<std::int64_t> ticks( COLUMN_SIZE );
+            std::mt19937_64 rng{ 42 };
+            std::uniform_int_distribution<std::int64_t> jitter{ -5'000, 5'000 };
+            auto current{ DateTime{ 2025, 1, 1 }.ticks() };
+            for( auto& value : ticks )
+            {
+                current += 10 * constants::TICKS_PER_MILLISECOND;
+                value = current + jitter( rng );
+            }
+            return ticks;
+        }
+
+        /** @brief Sorted random instants within one year (irregular event log) */
+        std::vector<std::int64_t> irregularSeries()
+        {
+            std::vector<std::int64_t> ticks( COLUMN_SIZE );
+            std::mt19937_64 rng{ 42 };
+            const auto start{ DateTime{ 2025, 1, 1 }.ticks() };
+            std::uniform_int_distribution<std::int64_t> instant{ start, start + 365 * constants::TICKS_PER_DAY };
+            for( auto& value : ticks )
+            {
+                value = instant( rng );
+            }
+            std::sort( ticks.begin(), ticks.end() );
+            return ticks;
+        }
+
+        /** @brief Encode a whole column */
+        std::vector<std::byte> encodeColumn( const std::vector<std::int64_t>& ticks )
+        {
+            TimestampColumnEncoder encoder;
+            encoder.append( ticks );
+            encoder.flush();
+
+            return { encoder.data().begin(), encoder.data().end() };
+        }
+
+        void encodeBenchmark( ::benchmark::State& state, const std::vector<std::int64_t>& ticks )
+        {
+            TimestampColumnEncoder encoder;
+            for( auto _ : state )
+            {
+                encoder.clear();
+                encoder.append( ticks );
+                encoder.flush();
+                ::benchmark::DoNotOptimize( encoder.data().data() );
+            }
+
+            const auto rawBytes{ ticks.size() * sizeof( std::int64_t ) };
+            state.SetBytesProcessed( state.iterations() * static_cast<std::int64_t>( rawBytes ) );
+            state.counters["ratio"] = static_cast<double>( rawBytes ) /
+                                      static_cast<double>( encoder.data().size() );
+        }
+
+        void decodeBenchmark( ::benchmark::State& state, const std::vector<std::int64_t>& ticks )
+        {
+            const auto data{ encodeColumn( ticks ) };
+            const auto decoder{ TimestampColumnDecoder::open( data ) };
+            std::vector<std::int64_t> out( ticks.size() );
+
+            for( auto _ : state )
+            {
+                auto count{ decoder->decode( out ) };
+                ::benchmark::DoNotOptimize( count );
+                ::benchmark::ClobberMemory();
+            }
+
+            const auto rawBytes{ ticks.size() * sizeof( std::int64_t ) };
+            state.SetBytesProcessed( state.iterations() * static_cast<std::int64_t>( rawBytes ) );
+            state.counters["ratio"] = static_cast<double>( rawBytes ) /
+                                      static_cast<double>( data.size() );
+        }
+    } // namespace
+
+    //----------------------------------------------
+    // Encoding
+    //----------------------------------------------
+
+    static void BM_TimestampColumn_Encode_Regular( ::benchmark::State& state )
+    {
+        encodeBenchmark( state, regularSeries() );
+    }
+
+    static void BM_TimestampColumn_Encode_Jittered( ::benchmark::State& state )
+    {
+        encodeBenchmark( state, jitteredSeries() );
+    }
+
+    static void BM_TimestampColumn_Encode_Irregular( ::benchmark::State& state )
+    {
+        encodeBenchmark( state, irregularSeries() );
+    }
+
+    //----------------------------------------------
+    // Decoding
+    //----------------------------------------------
+
+    static void BM_TimestampColumn_Decode_Regular( ::benchmark::State& state )
+    {
+        decodeBenchmark( state, regularSeries() );
+    }
+
+    static void BM_TimestampColumn_Decode_Jittered( ::benchmark::State& state )
+    {
+        decodeBenchmark( state, jitteredSeries() );
+    }
+
+    static void BM_TimestampColumn_Decode_Irregular( ::benchmark::State& state )
+    {
+        decodeBenchmark( state, irregularSeries() );
+    }
+
+    static void BM_TimestampColumn_DecodeBlock_RandomAccess( ::benchmark::State& state )
+    {
+        const auto data{ encodeColumn( jitteredSeries() ) };
+        const auto decoder{ TimestampColumnDecoder::open( data ) };
+        std::vector<std::int64_t> out( TimestampColumnDecoder::BLOCK_SIZE );
+        std::mt19937_64 rng{ 42 };
+        std::uniform_int_distribution<std::size_t> block{ 0, decoder->blockCount() - 1 };
+
+        for( auto _ : state )
+        {
+            auto count{ decoder->decodeBlock( block( rng ), out ) };
+            ::benchmark::DoNotOptimize( count );
+            ::benchmark::ClobberMemory();
+        }
+    }
+
+    //=====================================================================
+    // Benchmarks registration
+    //=====================================================================
+
+    //----------------------------------------------
+    // Encoding
+    //----------------------------------------------
+
+    BENCHMARK( BM_TimestampColumn_Encode_Regular );
+    BENCHMARK( BM_TimestampColumn_Encode_Jittered );
+    BENCHMARK( BM_TimestampColumn_Encode_Irregular );
+
+    //----------------------------------------------
+    // Decoding
+    //----------------------------------------------
+
+    BENCHMARK( BM_TimestampColumn_Decode_Regular );
+    BENCHMARK( BM_TimestampColumn_Decode_Jittered );
+    BENCHMARK( BM_TimestampColumn_Decode_Irregular );
+    BENCHMARK( BM_TimestampColumn_DecodeBlock_RandomAccess );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_TimestampFormatter.cpp
+ * @brief Benchmark incremental TimestampFormatter against stateless formatTo() on a monotonic stream
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/TimestampFormatter.h>
+
+#include <random>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // TimestampFormatter benchmark suite
+    //=====================================================================
+
+    namespace
+    {
+        /** @brief Log-like stream: monotonic, 0-50 microseconds apart, so most values share a second */
+        const std::vector<DateTime>& monotonicStream()
+        {
+            static const std::vector<DateTime> stream{ [] {
+                std::vector<DateTime> values;
+                values.reserve( 65536 );
+                std::mt19937_64 rng{ 42 };
+                std::uniform_int_distribution<std::int64_t> step{ 0, 50 * constants::TICKS_PER_MICROSECOND };
+                auto ticks{ DateTime{ 2025, 1, 24, 23, 59, 0 }.ticks() };
+                for( std::size_t i{ 0 }; i < 65536; ++i )
+                {
+                    ticks += step( rng );
+                    values.emplace_back( ticks );
+                }
+                return values;
+            }() };
+
+            return stream;
+        }
+    } // namespace
+
+    //----------------------------------------------
+    // DateTime
+    //----------------------------------------------
+
+    static void BM_Stateless_FormatTo( ::benchmark::State& state )
+    {
+        const auto format{ static_cast<DateTime::Format>( state.range( 0 ) ) };
+        const auto& stream{ monotonicStream() };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto length{ stream[i].formatTo( buffer, sizeof( buffer ), format ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+            i = ( i + 1 ) & ( stream.size() - 1 );
+        }
+    }
+
+    static void BM_TimestampFormatter_Format( ::benchmark::State& state )
+    {
+        const auto format{ static_cast<DateTime::Format>( state.range( 0 ) ) };
+        const auto& stream{ monotonicStream() };
+        TimestampFormatter formatter{ format };
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            auto text{ formatter.format( stream[i] ) };
+            ::benchmark::DoNotOptimize( text );
+            i = ( i + 1 ) & ( stream.size() - 1 );
+        }
+    }
+
+    //----------------------------------------------
+    // DateTimeOffset
+    //----------------------------------------------
+
+    static void BM_Stateless_FormatTo_Offset( ::benchmark::State& state )
+    {
+        const auto& stream{ monotonicStream() };
+        const auto offset{ TimeSpan::fromHours( 2 ) };
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            const DateTimeOffset value{ stream[i], offset };
+            auto length{ value.formatTo( buffer, sizeof( buffer ), DateTime::Format::Iso8601Millis ) };
+            ::benchmark::DoNotOptimize( length );
+            ::benchmark::DoNotOptimize( buffer );
+            i = ( i + 1 ) & ( stream.size() - 1 );
+        }
+    }
+
+    static void BM_TimestampFormatter_Format_Offset( ::benchmark::State& state )
+    {
+        const auto& stream{ monotonicStream() };
+        const auto offset{ TimeSpan::fromHours( 2 ) };
+        TimestampFormatter formatter{ DateTime::Format::Iso8601Millis };
+        std::size_t i{ 0 };
+
+        for( auto _ : state )
+        {
+            const DateTimeOffset value{ stream[i], offset };
+            auto text{ formatter.format( value ) };
+            ::benchmark::DoNotOptimize( text );
+            i = ( i + 1 ) & ( stream.size() - 1 );
+        }
+    }
+
+    //----------------------------------------------
+    // DateTime
+    //----------------------------------------------
+
+    BENCHMARK( BM_Stateless_FormatTo )
+        ->Arg( static_cast<int>( DateTime::Format::Iso8601 ) )
+        ->Arg( static_cast<int>( DateTime::Format::Iso8601Millis ) )
+        ->Arg( static_cast<int>( DateTime::Format::Iso8601Precise ) );
+    BENCHMARK( BM_TimestampFormatter_Format )
+        ->Arg( static_cast<int>( DateTime::Format::Iso8601 ) )
+        ->Arg( static_cast<int>( DateTime::Format::Iso8601Millis ) )
+        ->Arg( static_cast<int>( DateTime::Format::Iso8601Precise ) );
+
+    //----------------------------------------------
+    // DateTimeOffset
+    //----------------------------------------------
+
+    BENCHMARK( BM_Stateless_FormatTo_Offset );
+    BENCHMARK( BM_TimestampFormatter_Format_Offset );
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_TimestampPipeline.cpp
+ * @brief Benchmark the parallel conversion pipeline against a single-threaded parseMany() loop
+ * @details Converts one million newline-separated DateTimeOffset records into UTC, packed,
+ *          hourly bucket and ok columns. Pipeline runs are measured for 1, 2, 4, ... threads up
+ *          to the hardware concurrency in wall-clock time.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datetime/Bulk.h>
+#include <nfx/datetime/DateTimeOffset.h>
+#include <nfx/datetime/TimestampPipeline.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace nfx::time::benchmark
+{
+    //=====================================================================
+    // TimestampPipeline benchmark suite
+    //=====================================================================
+
+    /** @brief Records per run */
+    static constexpr std::size_t RECORD_COUNT{ 1'000'000 };
+
+    /** @brief Highest pipeline thread count measured */
+    static const int MAX_THREADS{ static_cast<int>( std::max( 2u, std::thread::hardware_concurrency() ) ) };
+
+    /** @brief Newline-separated records with millisecond precision and varying offsets */
+    static const std::string& recordBuffer()
+    {
+        static const std::string buffer{ [] {
+            std::string text;
+            DateTimeOffset value{ DateTime{ 2024, 1, 1 }, TimeSpan::fromHours( 2 ) };
+            for( std::size_t i{ 0 }; i < RECORD_COUNT; ++i )
+            {
+                text += value.toString( DateTime::Format::Iso8601Millis );
+                text += '\n';
+                value = DateTimeOffset{ value.dateTime() + TimeSpan{ 1'234'567'891 },
+                    TimeSpan::fromMinutes( static_cast<int>( i % 8 ) * 60 - 240 ) };
+            }
+
+            return text;
+        }() };
+
+        return buffer;
+    }
+
+    /** @brief Output columns of one run */
+    struct Columns
+    {
+        std::vector<DateTime> utc = std::vector<DateTime>( RECORD_COUNT );
+        std::vector<PackedDateTimeOffset> packed = std::vector<PackedDateTimeOffset>( RECORD_COUNT );
+        std::vector<DateTime> hours = std::vector<DateTime>( RECORD_COUNT );
+        std::vector<std::uint8_t> ok = std::vector<std::uint8_t>( RECORD_COUNT );
+    };
+
+    //----------------------------------------------
+    // Single-threaded baseline
+    //----------------------------------------------
+
+    static void BM_Pipeline_SequentialParseMany( ::benchmark::State& state )
+    {
+        const auto& buffer{ recordBuffer() };
+        Columns columns;
+        std::vector<std::string_view> views;
+        std::vector<DateTimeOffset> values( RECORD_COUNT );
+        views.reserve( RECORD_COUNT );
+
+        for( auto _ : state )
+        {
+            views.clear();
+            for( std::size_t begin{ 0 }; begin < buffer.size(); )
+            {
+                const auto end{ buffer.find( '\n', begin ) };
+                views.emplace_back( buffer.data() + begin, end - begin );
+                begin = end + 1;
+            }
+
+            DateTimeOffset::parseMany( views, values, columns.ok );
+            bulk::utcTicks( values, { reinterpret_cast<std::int64_t*>( columns.utc.data() ), RECORD_COUNT } );
+            bulk::pack( values, columns.packed );
+            bulk::floor( columns.utc, TimeSpan::fromHours( 1 ), columns.hours );
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * static_cast<std::int64_t>( RECORD_COUNT ) );
+        state.SetBytesProcessed( state.iterations() * static_cast<std::int64_t>( buffer.size() ) );
+    }
+
+    //----------------------------------------------
+    // Pipeline
+    //----------------------------------------------
+
+    static void BM_Pipeline_Run( ::benchmark::State& state )
+    {
+        const auto& buffer{ recordBuffer() };
+        Columns columns;
+        TimestampPipeline pipeline{ static_cast<unsigned>( state.range( 0 ) ) };
+
+        for( auto _ : state )
+        {
+            auto result{ pipeline.run(
+                buffer, { columns.utc, columns.packed, columns.hours, columns.ok } ) };
+            ::benchmark::DoNotOptimize( result );
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed( state.iterations() * static_cast<std::int64_t>( RECORD_COUNT ) );
+        state.SetBytesProcessed( state.iterations() * static_cast<std::int64_t>( buffer.size() ) );
+    }
+
+    //----------------------------------------------
+    // Single-threaded baseline
+    //----------------------------------------------
+
+    BENCHMARK( BM_Pipeline_SequentialParseMany )->Unit( ::benchmark::kMillisecond )->UseRealTime();
+
+    //----------------------------------------------
+    // Pipeline
+    //----------------------------------------------
+
+    BENCHMARK( BM_Pipeline_Run )
+        ->RangeMultiplier( 2 )
+        ->Range( 1, MAX_THREADS )
+        ->ArgName( "threads" )
+        ->Unit( ::benchmark::kMillisecond )
+        ->UseRealTime();
+} // namespace nfx::time::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+#==============================================================================
+# nfx-datetime - Benchmark baseline comparison
+#==============================================================================
+#
+# Compares two JSON baselines (from run_benchmarks.py, or any single
+# --benchmark_out=... --benchmark_out_format=json report) and flags every
+# benchmark whose time grew by more than the threshold:
+#
+#   compare_benchmarks.py baseline.json new.json --threshold 5
+#
+# With repetitions the median aggregate is compared, otherwise the mean of the
+# runs. Exits with status 1 when a regression is found (0 with --no-fail).
+
+import argparse
+import json
+import sys
+
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path, metric):
+    """Map "executable/name" to the time per iteration in nanoseconds."""
+    with open(path, encoding="utf-8") as report:
+        benchmarks = json.load(report).get("benchmarks", [])
+
+    medians = {}
+    runs = {}
+    for benchmark in benchmarks:
+        if benchmark.get("error_occurred"):
+            continue
+        key = f"{benchmark.get('executable', '')}/{benchmark['run_name']}".lstrip("/")
+        value = benchmark[metric] * TIME_UNIT_NS[benchmark.get("time_unit", "ns")]
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") == "median":
+                medians[key] = value
+        else:
+            runs.setdefault(key, []).append(value)
+
+    times = {key: sum(values) / len(values) for key, values in runs.items()}
+    times.update(medians)
+
+    return times
+
+
+def format_ns(value):
+    """Render nanoseconds with a readable unit."""
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if value >= scale:
+            return f"{value / scale:.3g} {unit}"
+    return f"{value:.3g} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flag benchmark regressions between two JSON baselines")
+    parser.add_argument("baseline", help="reference JSON results")
+    parser.add_argument("contender", help="JSON results to check")
+    parser.add_argument("--threshold", type=float, default=5.0, help="allowed slowdown in percent (default 5)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time")
+    parser.add_argument("--filter", default="", help="only compare benchmarks containing this text")
+    parser.add_argument("--no-fail", action="store_true", help="always exit with status 0")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric)
+    contender = load_times(args.contender, args.metric)
+    keys = sorted(key for key in baseline.keys() & contender.keys() if args.filter in key)
+
+    regressions = 0
+    width = max((len(key) for key in keys), default=9)
+    print(f"{'Benchmark':<{width}}  {'Baseline':>10}  {'Contender':>10}  {'Change':>8}")
+    for key in keys:
+        old, new = baseline[key], contender[key]
+        change = (new - old) / old * 100.0 if old > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  improved"
+        print(f"{key:<{width}}  {format_ns(old):>10}  {format_ns(new):>10}  {change:>+7.1f}%{flag}")
+
+    for key in sorted(baseline.keys() - contender.keys()):
+        if args.filter in key:
+            print(f"missing from contender: {key}")
+    for key in sorted(contender.keys() - baseline.keys()):
+        if args.filter in key:
+            print(f"new in contender: {key}")
+
+    print(f"\n{regressions} regression(s) above {args.threshold:g}% in {len(keys)} compared benchmark(s)")
+
+    return 1 if regressions and not args.no_fail else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+#==============================================================================
+# nfx-datetime - Benchmark baseline recorder
+#==============================================================================
+#
+# Runs Google Benchmark executables and merges their JSON reports into one
+# baseline file, tagged with the current git commit:
+#
+#   run_benchmarks.py --output baseline.json build/bin/benchmarks/BM_*
+#   run_benchmarks.py --output new.json BM_Corpus -- --benchmark_repetitions=5
+#
+# Arguments after "--" are passed to every executable (filters, repetitions,
+# --benchmark_perf_counters=CYCLES,INSTRUCTIONS with libpfm, ...).
+# Compare two baselines with compare_benchmarks.py.
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def git_output(*args):
+    """Return the output of a git command in the source tree, or None outside a checkout."""
+    try:
+        return subprocess.run(
+            ["git", *args],
+            cwd=os.path.dirname(os.path.abspath(__file__)),
+            capture_output=True,
+            text=True,
+            check=True,
+        ).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def run_executable(executable, extra_args):
+    """Run one benchmark executable and return its parsed JSON report."""
+    with tempfile.TemporaryDirectory() as directory:
+        report_path = os.path.join(directory, "report.json")
+        command = [executable, f"--benchmark_out={report_path}", "--benchmark_out_format=json", *extra_args]
+        print(f"==> {' '.join(command)}", flush=True)
+        subprocess.run(command, check=True)
+        # No report is written when a filter matches nothing in this executable
+        if not os.path.exists(report_path) or os.path.getsize(report_path) == 0:
+            return {}
+        with open(report_path, encoding="utf-8") as report:
+            return json.load(report)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run benchmarks and record a merged JSON baseline")
+    parser.add_argument("--output", required=True, help="merged JSON baseline to write")
+    parser.add_argument("executables", nargs="+", help="benchmark executables to run")
+    argv = sys.argv[1:]
+    split = argv.index("--") if "--" in argv else len(argv)
+    args = parser.parse_args(argv[:split])
+    extra_args = argv[split + 1 :]
+
+    merged = {"context": None, "benchmarks": []}
+    for executable in args.executables:
+        report = run_executable(executable, extra_args)
+        name = os.path.splitext(os.path.basename(executable))[0]
+        if merged["context"] is None:
+            merged["context"] = report.get("context", {})
+        for benchmark in report.get("benchmarks", []):
+            benchmark["executable"] = name
+            merged["benchmarks"].append(benchmark)
+
+    merged["context"] = merged["context"] or {}
+    merged["context"]["git_commit"] = git_output("rev-parse", "HEAD")
+    merged["context"]["git_describe"] = git_output("describe", "--always", "--dirty")
+
+    with open(args.output, "w", encoding="utf-8") as output:
+        json.dump(merged, output, indent=2)
+        output.write("\n")
+
+    print(f"Wrote {len(merged['benchmarks'])} results to {args.output}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -41,6 +41,10 @@ if(NFX_DATETIME_BUILD_STATIC)
     list(APPEND install_targets ${PROJECT_NAME}-static)
 endif()
 
+if(NFX_DATETIME_HEADER_ONLY)
+    list(APPEND install_targets ${PROJECT_NAME}-header-only)
+endif()
+
 if(install_targets)
     install(
         TARGETS ${install_targets}
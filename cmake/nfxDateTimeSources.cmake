@@ -9,7 +9,25 @@
 set(private_sources)
 
 list(APPEND private_sources
+    ${NFX_DATETIME_SOURCE_DIR}/Binary.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/Bulk.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/CachedClock.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/Clock.cpp
     ${NFX_DATETIME_SOURCE_DIR}/DateTime.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/DateTimeInterval.cpp
     ${NFX_DATETIME_SOURCE_DIR}/DateTimeOffset.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/DateTimePattern.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/IntervalIndex.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/Iso8601Decode.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/Recurrence.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/Sort.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/Stats.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/SystemTimeZone.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/Timeline.cpp
     ${NFX_DATETIME_SOURCE_DIR}/TimeSpan.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/TimeSpanHistogram.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/TimestampColumn.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/TimestampFormatter.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/TimestampPipeline.cpp
+    ${NFX_DATETIME_SOURCE_DIR}/TimeZone.cpp
 )
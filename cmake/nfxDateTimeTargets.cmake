@@ -38,6 +38,25 @@ if(NFX_DATETIME_BUILD_STATIC)
     add_library(${PROJECT_NAME}::static ALIAS ${PROJECT_NAME}-static)
 endif()
 
+# --- Create header-only interface target if requested ---
+# Covers the inline/constexpr API (construction, components, accessors, calendar arithmetic,
+# formatting, constexpr parsing and literals); clocks, time zones, runtime parsing and the bulk
+# kernels need one of the compiled libraries.
+if(NFX_DATETIME_HEADER_ONLY)
+    add_library(${PROJECT_NAME}-header-only INTERFACE)
+    target_include_directories(${PROJECT_NAME}-header-only
+        INTERFACE
+            $<BUILD_INTERFACE:${NFX_DATETIME_INCLUDE_DIR}>
+            $<INSTALL_INTERFACE:include>
+    )
+    target_compile_features(${PROJECT_NAME}-header-only
+        INTERFACE
+            cxx_std_20
+    )
+
+    add_library(${PROJECT_NAME}::header-only ALIAS ${PROJECT_NAME}-header-only)
+endif()
+
 #----------------------------------------------
 # Targets properties
 #----------------------------------------------
@@ -54,8 +73,8 @@ function(configure_target target_name)
 
     # --- Link libraries ---
     target_link_libraries(${target_name}
-        PRIVATE
-            $<BUILD_INTERFACE:nfx-stringbuilder-static>
+        PUBLIC
+            Threads::Threads
     )
 
     # --- Properties ---
@@ -70,8 +89,29 @@ function(configure_target target_name)
             POSITION_INDEPENDENT_CODE ON
     )
 
+    # --- System time zone transition table range ---
+    target_compile_definitions(${target_name}
+        PRIVATE
+            NFX_DATETIME_TZ_TABLE_FIRST_YEAR=${NFX_DATETIME_TZ_TABLE_FIRST_YEAR}
+            NFX_DATETIME_TZ_TABLE_LAST_YEAR=${NFX_DATETIME_TZ_TABLE_LAST_YEAR}
+    )
+
+    # --- Hot-path instrumentation (public: inline formatters count in consumer code too) ---
+    if(NFX_DATETIME_ENABLE_STATS)
+        target_compile_definitions(${target_name}
+            PUBLIC
+                NFX_DATETIME_ENABLE_STATS
+        )
+    endif()
+
     # --- CPU optimizations (Release/RelWithDebInfo only) ---
     if(NFX_DATETIME_ENABLE_SIMD)
+        # Vectorized ISO 8601 decoding kernels with runtime dispatch (all configurations)
+        target_compile_definitions(${target_name}
+            PRIVATE
+                NFX_DATETIME_ENABLE_SIMD
+        )
+
         target_compile_options(${target_name}
             PRIVATE
                 $<$<AND:$<CXX_COMPILER_ID:MSVC>,$<OR:$<CONFIG:Release>,$<CONFIG:RelWithDebInfo>>>:/arch:AVX2>
@@ -115,6 +155,14 @@ endif()
 # Build configuration summary
 #----------------------------------------------
 
+if(NFX_DATETIME_HEADER_ONLY)
+    message(STATUS "nfx-datetime: Header-only interface target enabled (nfx-datetime::header-only)")
+endif()
+
+if(NFX_DATETIME_ENABLE_STATS)
+    message(STATUS "nfx-datetime: Hot-path instrumentation enabled (nfx::time::stats())")
+endif()
+
 if(NFX_DATETIME_ENABLE_SIMD)
     message(STATUS "nfx-datetime: Native CPU optimizations enabled (Release/RelWithDebInfo builds)")
 else()
@@ -25,13 +25,38 @@
 /**
  * @file DateTime.h
  * @brief Main umbrella header for nfx-datetime library
- * @details Includes all temporal types: DateTime, DateTimeOffset, and TimeSpan.
+ * @details Includes all temporal types: DateTime, DateTimeOffset, TimeSpan, and TimeZone, plus
+ *          clock sources, CachedClock, TimestampFormatter, custom patterns (DateTimePattern), the
+ *          binary wire format, packed 8-byte offsets (PackedDateTimeOffset), compressed timestamp
+ *          columns, span kernels (Bulk), recurring schedules (Recurrence), radix sort (Sort),
+ *          hot-path instrumentation counters (Stats), elapsed-time measurement (Stopwatch) with
+ *          latency histograms (TimeSpanHistogram), the parallel text-to-column TimestampPipeline,
+ *          sorted instant indexes (Timeline) and time intervals with an overlap index
+ *          (DateTimeInterval, IntervalIndex).
  *          This single header provides convenient access to the entire nfx::time namespace.
  *          For selective includes, use individual headers from nfx/datetime/ subdirectory.
  */
 
 #pragma once
 
+#include "datetime/Binary.h"
+#include "datetime/Bulk.h"
+#include "datetime/CachedClock.h"
+#include "datetime/Clock.h"
 #include "datetime/DateTime.h"
+#include "datetime/DateTimeInterval.h"
 #include "datetime/DateTimeOffset.h"
+#include "datetime/DateTimePattern.h"
+#include "datetime/IntervalIndex.h"
+#include "datetime/PackedDateTimeOffset.h"
+#include "datetime/Recurrence.h"
+#include "datetime/Sort.h"
+#include "datetime/Stats.h"
+#include "datetime/Stopwatch.h"
+#include "datetime/Timeline.h"
 #include "datetime/TimeSpan.h"
+#include "datetime/TimeSpanHistogram.h"
+#include "datetime/TimestampColumn.h"
+#include "datetime/TimestampFormatter.h"
+#include "datetime/TimestampPipeline.h"
+#include "datetime/TimeZone.h"
@@ -0,0 +1,283 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Binary.h
+ * @brief Compact, stable binary wire format for DateTime, DateTimeOffset and TimeSpan
+ * @details Encodes values into caller-provided byte spans and decodes them back without any
+ *          text formatting or parsing. The layouts below are part of the public contract and
+ *          do not change between releases.
+ *
+ * @section binary_layouts Layouts
+ *
+ * @code
+ * ┌──────────────────────────┬───────┬─────────────────────────────────────────────────────┐
+ * │  Encoding                │ Bytes │ Content                                             │
+ * ├──────────────────────────┼───────┼─────────────────────────────────────────────────────┤
+ * │  DateTime    fixed       │  8    │ ticks, int64 little-endian                          │
+ * │  TimeSpan    fixed       │  8    │ ticks, int64 little-endian                          │
+ * │  DateTimeOffset fixed    │  10   │ local ticks, int64 LE + offset minutes, int16 LE    │
+ * │  DateTime    varint      │  1-9  │ ticks, unsigned LEB128                              │
+ * │  TimeSpan    varint      │  1-10 │ ticks, zigzag + unsigned LEB128                     │
+ * │  DateTimeOffset varint   │  2-11 │ local ticks LEB128 + offset minutes zigzag LEB128   │
+ * └──────────────────────────┴───────┴─────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * Ticks are 100-nanosecond units (DateTime: since 0001-01-01T00:00:00Z; DateTimeOffset: local
+ * clock time, so the UTC instant is ticks - offset). Zigzag maps signed n to (n << 1) ^ (n >> 63)
+ * and LEB128 writes 7 bits per byte, least significant group first, with the high bit set on
+ * every byte except the last.
+ *
+ * @note Offsets are stored in whole minutes (DateTimeOffset::totalOffsetMinutes()); sub-minute
+ *       offsets are truncated. Decoding rejects ticks outside the DateTime range and offsets
+ *       outside ±14:00.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "TimeSpan.h"
+
+namespace nfx::time::binary
+{
+    //=====================================================================
+    // Encoded sizes
+    //=====================================================================
+
+    /** @brief Size of a fixed DateTime or TimeSpan encoding */
+    inline constexpr std::size_t FIXED_SIZE{ 8 };
+
+    /** @brief Size of a fixed DateTimeOffset encoding */
+    inline constexpr std::size_t OFFSET_FIXED_SIZE{ 10 };
+
+    /** @brief Maximum size of a varint DateTime encoding */
+    inline constexpr std::size_t MAX_VARINT_SIZE{ 9 };
+
+    /** @brief Maximum size of a varint TimeSpan encoding */
+    inline constexpr std::size_t MAX_VARINT_TIMESPAN_SIZE{ 10 };
+
+    /** @brief Maximum size of a varint DateTimeOffset encoding */
+    inline constexpr std::size_t MAX_VARINT_OFFSET_SIZE{ 11 };
+
+    //=====================================================================
+    // Fixed-width encoding
+    //=====================================================================
+
+    /**
+     * @brief Encode a DateTime as 8 little-endian bytes
+     * @param value Value to encode
+     * @param out Destination bytes
+     * @return Number of bytes written (FIXED_SIZE), or 0 if out is too small
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t encode( const DateTime& value, std::span<std::byte> out ) noexcept;
+
+    /**
+     * @brief Encode a TimeSpan as 8 little-endian bytes
+     * @param value Value to encode
+     * @param out Destination bytes
+     * @return Number of bytes written (FIXED_SIZE), or 0 if out is too small
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t encode( const TimeSpan& value, std::span<std::byte> out ) noexcept;
+
+    /**
+     * @brief Encode a DateTimeOffset as 8 bytes of local ticks and 2 bytes of offset minutes
+     * @param value Value to encode
+     * @param out Destination bytes
+     * @return Number of bytes written (OFFSET_FIXED_SIZE), or 0 if out is too small
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t encode( const DateTimeOffset& value, std::span<std::byte> out ) noexcept;
+
+    /**
+     * @brief Decode a fixed-width DateTime
+     * @param in Source bytes
+     * @param value Receives the decoded value
+     * @return Number of bytes consumed (FIXED_SIZE), or 0 if in is too short or the ticks are out of range
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t decode( std::span<const std::byte> in, DateTime& value ) noexcept;
+
+    /**
+     * @brief Decode a fixed-width TimeSpan
+     * @param in Source bytes
+     * @param value Receives the decoded value
+     * @return Number of bytes consumed (FIXED_SIZE), or 0 if in is too short
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t decode( std::span<const std::byte> in, TimeSpan& value ) noexcept;
+
+    /**
+     * @brief Decode a fixed-width DateTimeOffset
+     * @param in Source bytes
+     * @param value Receives the decoded value
+     * @return Number of bytes consumed (OFFSET_FIXED_SIZE), or 0 if in is too short or the
+     *         ticks or offset are out of range
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t decode( std::span<const std::byte> in, DateTimeOffset& value ) noexcept;
+
+    //=====================================================================
+    // Variable-length encoding
+    //=====================================================================
+
+    /**
+     * @brief Encode a DateTime as unsigned LEB128 ticks
+     * @param value Value to encode
+     * @param out Destination bytes (MAX_VARINT_SIZE is always sufficient)
+     * @return Number of bytes written, or 0 if out is too small
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t encodeVarint( const DateTime& value, std::span<std::byte> out ) noexcept;
+
+    /**
+     * @brief Encode a TimeSpan as zigzag LEB128 ticks
+     * @param value Value to encode
+     * @param out Destination bytes (MAX_VARINT_TIMESPAN_SIZE is always sufficient)
+     * @return Number of bytes written, or 0 if out is too small
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t encodeVarint( const TimeSpan& value, std::span<std::byte> out ) noexcept;
+
+    /**
+     * @brief Encode a DateTimeOffset as LEB128 local ticks followed by zigzag LEB128 offset minutes
+     * @param value Value to encode
+     * @param out Destination bytes (MAX_VARINT_OFFSET_SIZE is always sufficient)
+     * @return Number of bytes written, or 0 if out is too small
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t encodeVarint( const DateTimeOffset& value, std::span<std::byte> out ) noexcept;
+
+    /**
+     * @brief Decode a varint DateTime
+     * @param in Source bytes
+     * @param value Receives the decoded value
+     * @return Number of bytes consumed, or 0 if the varint is truncated, overlong or out of range
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t decodeVarint( std::span<const std::byte> in, DateTime& value ) noexcept;
+
+    /**
+     * @brief Decode a varint TimeSpan
+     * @param in Source bytes
+     * @param value Receives the decoded value
+     * @return Number of bytes consumed, or 0 if the varint is truncated or overlong
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t decodeVarint( std::span<const std::byte> in, TimeSpan& value ) noexcept;
+
+    /**
+     * @brief Decode a varint DateTimeOffset
+     * @param in Source bytes
+     * @param value Receives the decoded value
+     * @return Number of bytes consumed, or 0 if a varint is truncated, overlong or out of range
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline std::size_t decodeVarint( std::span<const std::byte> in, DateTimeOffset& value ) noexcept;
+
+    //=====================================================================
+    // Bulk encoding
+    //=====================================================================
+
+    /**
+     * @brief Encode consecutive values with the fixed-width layout
+     * @param values Values to encode
+     * @param out Destination bytes (values.size() * FIXED_SIZE)
+     * @return Number of bytes written, or 0 if out is too small (nothing is written then)
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] std::size_t encode( std::span<const DateTime> values, std::span<std::byte> out ) noexcept;
+
+    /** @copydoc encode(std::span<const DateTime>, std::span<std::byte>) */
+    [[nodiscard]] std::size_t encode( std::span<const TimeSpan> values, std::span<std::byte> out ) noexcept;
+
+    /**
+     * @brief Encode consecutive values with the fixed-width layout
+     * @param values Values to encode
+     * @param out Destination bytes (values.size() * OFFSET_FIXED_SIZE)
+     * @return Number of bytes written, or 0 if out is too small (nothing is written then)
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] std::size_t encode( std::span<const DateTimeOffset> values, std::span<std::byte> out ) noexcept;
+
+    /**
+     * @brief Decode consecutive fixed-width values
+     * @param in Source bytes
+     * @param values Destination values
+     * @return Number of values decoded: min(values.size(), whole records in in), stopping
+     *         early at the first invalid record
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] std::size_t decode( std::span<const std::byte> in, std::span<DateTime> values ) noexcept;
+
+    /** @copydoc decode(std::span<const std::byte>, std::span<DateTime>) */
+    [[nodiscard]] std::size_t decode( std::span<const std::byte> in, std::span<TimeSpan> values ) noexcept;
+
+    /** @copydoc decode(std::span<const std::byte>, std::span<DateTime>) */
+    [[nodiscard]] std::size_t decode( std::span<const std::byte> in, std::span<DateTimeOffset> values ) noexcept;
+
+    /**
+     * @brief Encode consecutive values with the varint layout
+     * @param values Values to encode
+     * @param out Destination bytes (values.size() * MAX_VARINT_SIZE is always sufficient)
+     * @return Number of bytes written, or 0 if out is too small (out contents are then unspecified)
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] std::size_t encodeVarint( std::span<const DateTime> values, std::span<std::byte> out ) noexcept;
+
+    /** @copydoc encodeVarint(std::span<const DateTime>, std::span<std::byte>) */
+    [[nodiscard]] std::size_t encodeVarint( std::span<const TimeSpan> values, std::span<std::byte> out ) noexcept;
+
+    /** @copydoc encodeVarint(std::span<const DateTime>, std::span<std::byte>) */
+    [[nodiscard]] std::size_t encodeVarint(
+        std::span<const DateTimeOffset> values, std::span<std::byte> out ) noexcept;
+
+    /**
+     * @brief Decode consecutive varint values
+     * @param in Source bytes
+     * @param values Destination values
+     * @param consumed Receives the number of bytes consumed
+     * @return Number of values decoded, stopping at the end of in, the end of values or the
+     *         first invalid record
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] std::size_t decodeVarint(
+        std::span<const std::byte> in, std::span<DateTime> values, std::size_t& consumed ) noexcept;
+
+    /** @copydoc decodeVarint(std::span<const std::byte>, std::span<DateTime>, std::size_t&) */
+    [[nodiscard]] std::size_t decodeVarint(
+        std::span<const std::byte> in, std::span<TimeSpan> values, std::size_t& consumed ) noexcept;
+
+    /** @copydoc decodeVarint(std::span<const std::byte>, std::span<DateTime>, std::size_t&) */
+    [[nodiscard]] std::size_t decodeVarint(
+        std::span<const std::byte> in, std::span<DateTimeOffset> values, std::size_t& consumed ) noexcept;
+} // namespace nfx::time::binary
+
+#include "nfx/detail/datetime/Binary.inl"
@@ -0,0 +1,296 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Bulk.h
+ * @brief Span kernels for DateTime, DateTimeOffset and TimeSpan columns
+ * @details Element-wise arithmetic, calendar arithmetic, epoch conversion, calendar field
+ *          extraction, bucketing, packing, min/max and sort key computation over contiguous
+ *          spans. Each function is the bulk equivalent of the matching member function and
+ *          produces identical results; they operate on the underlying ticks so loops vectorize,
+ *          and calendar field extraction uses an AVX2 kernel (runtime dispatch) when
+ *          NFX_DATETIME_ENABLE_SIMD is set.
+ *
+ * @par Output spans
+ * Every function processes min(input size, output size) elements and returns that count. An
+ * output span may be the input span itself (in-place update) but must not partially overlap it.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "PackedDateTimeOffset.h"
+#include "TimeSpan.h"
+
+namespace nfx::time::bulk
+{
+    //=====================================================================
+    // Arithmetic
+    //=====================================================================
+
+    /**
+     * @brief Add a duration to every value (DateTime::operator+)
+     * @param values Input values
+     * @param duration Duration to add
+     * @param out Receives the shifted values
+     * @return Number of elements processed
+     */
+    std::size_t add( std::span<const DateTime> values, const TimeSpan& duration, std::span<DateTime> out ) noexcept;
+
+    /**
+     * @brief Subtract a duration from every value (DateTime::operator-)
+     * @param values Input values
+     * @param duration Duration to subtract
+     * @param out Receives the shifted values
+     * @return Number of elements processed
+     */
+    std::size_t subtract(
+        std::span<const DateTime> values, const TimeSpan& duration, std::span<DateTime> out ) noexcept;
+
+    /**
+     * @brief Compute element-wise differences left[i] - right[i]
+     * @param left Minuends
+     * @param right Subtrahends
+     * @param out Receives the differences
+     * @return Number of elements processed (limited by all three spans)
+     */
+    std::size_t subtract(
+        std::span<const DateTime> left, std::span<const DateTime> right, std::span<TimeSpan> out ) noexcept;
+
+    /**
+     * @brief Add a duration to every duration (TimeSpan::operator+)
+     * @param values Input durations
+     * @param duration Duration to add
+     * @param out Receives the sums
+     * @return Number of elements processed
+     */
+    std::size_t add( std::span<const TimeSpan> values, const TimeSpan& duration, std::span<TimeSpan> out ) noexcept;
+
+    //=====================================================================
+    // Calendar arithmetic
+    //=====================================================================
+
+    /**
+     * @brief Add calendar months to every value (DateTime::addMonths)
+     * @param values Input values
+     * @param months Number of months to add (may be negative)
+     * @param out Receives the shifted values
+     * @return Number of elements processed
+     */
+    std::size_t addMonths( std::span<const DateTime> values, std::int32_t months, std::span<DateTime> out ) noexcept;
+
+    /**
+     * @brief Add calendar years to every value (DateTime::addYears)
+     * @param values Input values
+     * @param years Number of years to add (may be negative)
+     * @param out Receives the shifted values
+     * @return Number of elements processed
+     */
+    std::size_t addYears( std::span<const DateTime> values, std::int32_t years, std::span<DateTime> out ) noexcept;
+
+    /**
+     * @brief Add business days to every value (DateTime::addBusinessDays)
+     * @param values Input values
+     * @param days Number of business days to add (may be negative)
+     * @param out Receives the shifted values
+     * @return Number of elements processed
+     */
+    std::size_t addBusinessDays(
+        std::span<const DateTime> values, std::int32_t days, std::span<DateTime> out ) noexcept;
+
+    //=====================================================================
+    // Epoch conversion
+    //=====================================================================
+
+    /**
+     * @brief Convert to Unix seconds (DateTime::toEpochSeconds)
+     * @param values Input values
+     * @param out Receives seconds since 1970-01-01T00:00:00Z, truncated toward zero
+     * @return Number of elements processed
+     */
+    std::size_t toEpochSeconds( std::span<const DateTime> values, std::span<std::int64_t> out ) noexcept;
+
+    /**
+     * @brief Convert to Unix milliseconds (DateTime::toEpochMilliseconds)
+     * @param values Input values
+     * @param out Receives milliseconds since 1970-01-01T00:00:00Z, truncated toward zero
+     * @return Number of elements processed
+     */
+    std::size_t toEpochMilliseconds( std::span<const DateTime> values, std::span<std::int64_t> out ) noexcept;
+
+    /**
+     * @brief Convert from Unix seconds (DateTime::fromEpochSeconds)
+     * @param seconds Seconds since 1970-01-01T00:00:00Z
+     * @param out Receives the values
+     * @return Number of elements processed
+     */
+    std::size_t fromEpochSeconds( std::span<const std::int64_t> seconds, std::span<DateTime> out ) noexcept;
+
+    /**
+     * @brief Convert from Unix milliseconds (DateTime::fromEpochMilliseconds)
+     * @param milliseconds Milliseconds since 1970-01-01T00:00:00Z
+     * @param out Receives the values
+     * @return Number of elements processed
+     */
+    std::size_t fromEpochMilliseconds( std::span<const std::int64_t> milliseconds, std::span<DateTime> out ) noexcept;
+
+    /**
+     * @brief Get the UTC ticks of every value (DateTimeOffset::utcTicks)
+     * @param values Input values
+     * @param out Receives the UTC ticks
+     * @return Number of elements processed
+     */
+    std::size_t utcTicks( std::span<const DateTimeOffset> values, std::span<std::int64_t> out ) noexcept;
+
+    //=====================================================================
+    // Calendar fields
+    //=====================================================================
+
+    /**
+     * @brief Truncate every value to midnight (DateTime::date)
+     * @param values Input values
+     * @param out Receives the dates
+     * @return Number of elements processed
+     */
+    std::size_t date( std::span<const DateTime> values, std::span<DateTime> out ) noexcept;
+
+    /**
+     * @brief Get the day of week of every value (DateTime::dayOfWeek)
+     * @param values Input values
+     * @param out Receives the days of week (0=Sunday, 6=Saturday)
+     * @return Number of elements processed
+     */
+    std::size_t dayOfWeek( std::span<const DateTime> values, std::span<std::int32_t> out ) noexcept;
+
+    /**
+     * @brief Get the hour of every value (DateTime::hour)
+     * @param values Input values
+     * @param out Receives the hours (0-23)
+     * @return Number of elements processed
+     */
+    std::size_t hour( std::span<const DateTime> values, std::span<std::int32_t> out ) noexcept;
+
+    //=====================================================================
+    // Bucketing
+    //=====================================================================
+
+    /**
+     * @brief Round every value down to a multiple of a fixed interval (DateTime::floor)
+     * @param values Input values
+     * @param interval Bucket width
+     * @param out Receives the bucket starts
+     * @return Number of elements processed
+     * @details The interval is turned once into a multiply-and-shift reciprocal, so no element
+     *          pays a hardware 64-bit division.
+     */
+    std::size_t floor( std::span<const DateTime> values, const TimeSpan& interval, std::span<DateTime> out ) noexcept;
+
+    /**
+     * @brief Round every value up to a multiple of a fixed interval (DateTime::ceil)
+     * @param values Input values
+     * @param interval Bucket width
+     * @param out Receives the rounded values
+     * @return Number of elements processed
+     */
+    std::size_t ceil( std::span<const DateTime> values, const TimeSpan& interval, std::span<DateTime> out ) noexcept;
+
+    /**
+     * @brief Round every value to the nearest multiple of a fixed interval (DateTime::round)
+     * @param values Input values
+     * @param interval Bucket width
+     * @param out Receives the rounded values
+     * @return Number of elements processed
+     */
+    std::size_t round( std::span<const DateTime> values, const TimeSpan& interval, std::span<DateTime> out ) noexcept;
+
+    //=====================================================================
+    // Packing
+    //=====================================================================
+
+    /**
+     * @brief Pack every value into the 8-byte form (PackedDateTimeOffset constructor)
+     * @param values Input values
+     * @param out Receives the packed values
+     * @return Number of elements processed
+     */
+    std::size_t pack( std::span<const DateTimeOffset> values, std::span<PackedDateTimeOffset> out ) noexcept;
+
+    /**
+     * @brief Unpack every value (PackedDateTimeOffset::toDateTimeOffset)
+     * @param values Input values
+     * @param out Receives the unpacked values
+     * @return Number of elements processed
+     */
+    std::size_t unpack( std::span<const PackedDateTimeOffset> values, std::span<DateTimeOffset> out ) noexcept;
+
+    //=====================================================================
+    // Reductions and sort keys
+    //=====================================================================
+
+    /**
+     * @brief Find the earliest and latest value
+     * @param values Input values
+     * @return Pair (minimum, maximum), or std::nullopt if values is empty
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] std::optional<std::pair<DateTime, DateTime>> minMax( std::span<const DateTime> values ) noexcept;
+
+    /**
+     * @brief Find the shortest and longest duration
+     * @param values Input durations
+     * @return Pair (minimum, maximum), or std::nullopt if values is empty
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] std::optional<std::pair<TimeSpan, TimeSpan>> minMax( std::span<const TimeSpan> values ) noexcept;
+
+    /**
+     * @brief Compute unsigned sort keys
+     * @details Keys compare as unsigned integers in the same order as the values, so sorting
+     *          (key, index) pairs, e.g. with a radix sort, yields an argsort of the values.
+     * @param values Input values
+     * @param out Receives the keys
+     * @return Number of elements processed
+     */
+    std::size_t sortKeys( std::span<const DateTime> values, std::span<std::uint64_t> out ) noexcept;
+
+    /** @copydoc sortKeys(std::span<const DateTime>, std::span<std::uint64_t>) */
+    std::size_t sortKeys( std::span<const TimeSpan> values, std::span<std::uint64_t> out ) noexcept;
+
+    /**
+     * @brief Compute unsigned sort keys ordering values by UTC instant
+     * @details Keys compare as unsigned integers like the values compare (by utcTicks()), so
+     *          sorting (key, index) pairs yields an argsort of the values.
+     * @param values Input values
+     * @param out Receives the keys
+     * @return Number of elements processed
+     */
+    std::size_t sortKeys( std::span<const DateTimeOffset> values, std::span<std::uint64_t> out ) noexcept;
+} // namespace nfx::time::bulk
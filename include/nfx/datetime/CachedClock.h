@@ -0,0 +1,261 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CachedClock.h
+ * @brief Cached "now" clock service refreshed by a background thread or by the caller
+ * @details CachedClock periodically publishes the current UTC ticks, the system local
+ *          offset and a pre-rendered local ISO 8601 prefix ("YYYY-MM-DDTHH:mm:ss") into a
+ *          seqlock-protected slot. Threads that stamp many events per millisecond then read
+ *          "now" from that slot instead of querying the system clock and time zone each time.
+ *
+ * @section cached_clock_reads Read paths
+ *
+ * @code
+ * ┌────────────────────────────────────────────────────────────────────────┐
+ * │  writer: update() ──► seq odd ──► ticks, offset, prefix ──► seq even   │
+ * │                                                                        │
+ * │  utcTicks() / utcNow()   ──► one atomic load                           │
+ * │  offset()                ──► one atomic load                           │
+ * │  now() / snapshot()      ──► seqlock read (retried while a write runs) │
+ * └────────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @par Opt-in global hook
+ * After `CachedClock::install( &clock )`, `DateTime::now()`, `DateTime::utcNow()`,
+ * `DateTimeOffset::now()` and `DateTimeOffset::utcNow()` return the cached value. Explicit
+ * clock sources (`utcNow<PreciseClock>()` etc.) are never redirected. Values read through a
+ * cached clock lag the system clock by up to one refresh interval.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // CachedClock class
+    //=====================================================================
+
+    /**
+     * @brief Periodically refreshed snapshot of the current time
+     * @details One writer (the background thread started by start(), or the caller invoking
+     *          update()) publishes; any number of threads read without locking. Concurrent
+     *          update() calls are coalesced: a call that finds another update in progress
+     *          returns immediately.
+     */
+    class CachedClock final
+    {
+    public:
+        //----------------------------------------------
+        // Constants
+        //----------------------------------------------
+
+        /** @brief Length of the pre-rendered local prefix "YYYY-MM-DDTHH:mm:ss" */
+        static constexpr std::size_t PREFIX_LENGTH{ 19 };
+
+        //----------------------------------------------
+        // Snapshot
+        //----------------------------------------------
+
+        /** @brief Consistent copy of the published slot */
+        struct Snapshot
+        {
+            /** @brief UTC ticks at the last refresh */
+            std::int64_t utcTicks{ 0 };
+
+            /** @brief System local offset at the last refresh */
+            TimeSpan offset;
+
+            /** @brief Local "YYYY-MM-DDTHH:mm:ss" of the last refresh (padded, not null-terminated) */
+            std::array<char, 24> prefix{};
+
+            /**
+             * @brief Get the pre-rendered local ISO 8601 prefix
+             * @return View of the "YYYY-MM-DDTHH:mm:ss" characters (valid while the snapshot lives)
+             * @note This function is marked [[nodiscard]] - the return value should not be ignored
+             */
+            [[nodiscard]] std::string_view iso8601Prefix() const noexcept
+            {
+                return std::string_view{ prefix.data(), PREFIX_LENGTH };
+            }
+        };
+
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Construct a caller-driven clock, refreshed by update()
+         * @details Performs an initial update() so reads are valid immediately.
+         */
+        CachedClock() noexcept;
+
+        /**
+         * @brief Construct a clock refreshed by a background thread
+         * @param interval Refresh interval
+         * @throws std::system_error if the thread cannot be started
+         */
+        explicit CachedClock( std::chrono::microseconds interval );
+
+        /** @brief Copy constructor (deleted, readers hold references) */
+        CachedClock( const CachedClock& ) = delete;
+
+        /** @brief Move constructor (deleted, readers hold references) */
+        CachedClock( CachedClock&& ) = delete;
+
+        //----------------------------------------------
+        // Destruction
+        //----------------------------------------------
+
+        /**
+         * @brief Destructor
+         * @details Stops the background thread and uninstalls the clock if it is installed.
+         *          Threads must not be reading through the global hook while it is destroyed.
+         */
+        ~CachedClock();
+
+        //----------------------------------------------
+        // Assignment
+        //----------------------------------------------
+
+        /** @brief Copy assignment operator (deleted) */
+        CachedClock& operator=( const CachedClock& ) = delete;
+
+        /** @brief Move assignment operator (deleted) */
+        CachedClock& operator=( CachedClock&& ) = delete;
+
+        //----------------------------------------------
+        // Refresh
+        //----------------------------------------------
+
+        /** @brief Read the system clock and time zone and publish a new snapshot */
+        void update() noexcept;
+
+        /**
+         * @brief Start (or restart) the background refresh thread
+         * @param interval Refresh interval
+         * @throws std::system_error if the thread cannot be started
+         */
+        void start( std::chrono::microseconds interval );
+
+        /** @brief Stop the background refresh thread (no effect if not running) */
+        void stop() noexcept;
+
+        /**
+         * @brief Check whether the background refresh thread is running
+         * @return true if started and not stopped
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] bool isRunning() const noexcept;
+
+        //----------------------------------------------
+        // Reads
+        //----------------------------------------------
+
+        /**
+         * @brief Get the cached UTC ticks (one atomic load)
+         * @return UTC ticks since January 1, 0001 at the last refresh
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::int64_t utcTicks() const noexcept;
+
+        /**
+         * @brief Get the cached system local offset (one atomic load)
+         * @return Local offset at the last refresh
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline TimeSpan offset() const noexcept;
+
+        /**
+         * @brief Get the cached UTC time
+         * @return DateTime at the last refresh
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline DateTime utcNow() const noexcept;
+
+        /**
+         * @brief Get the cached local time with its offset
+         * @return DateTimeOffset at the last refresh, ticks and offset from the same snapshot
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline DateTimeOffset now() const noexcept;
+
+        /**
+         * @brief Get a consistent copy of the whole slot including the formatted prefix
+         * @return Snapshot of the last refresh
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline Snapshot snapshot() const noexcept;
+
+        //----------------------------------------------
+        // Global hook
+        //----------------------------------------------
+
+        /**
+         * @brief Route DateTime and DateTimeOffset now()/utcNow() through a cached clock
+         * @param clock Clock to install, or nullptr to restore direct system clock reads
+         * @details The clock must outlive every now()/utcNow() call made while installed.
+         */
+        static void install( const CachedClock* clock ) noexcept;
+
+        /**
+         * @brief Get the installed clock
+         * @return Installed clock, or nullptr if none
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static const CachedClock* installed() noexcept;
+
+    private:
+        /** @brief Number of 64-bit words holding the padded prefix */
+        static constexpr std::size_t PREFIX_WORDS{ 3 };
+
+        /** @brief Published slot, on its own cache line */
+        struct alignas( 64 ) Slot
+        {
+            std::atomic<std::uint64_t> sequence{ 0 };
+            std::atomic<std::int64_t> utcTicks{ 0 };
+            std::atomic<std::int64_t> offsetTicks{ 0 };
+            std::array<std::atomic<std::uint64_t>, PREFIX_WORDS> prefixWords{};
+        };
+
+        Slot m_slot;                                   ///< Reader-visible state
+        std::atomic<bool> m_updating{ false };         ///< Writer exclusion flag
+        std::int64_t m_renderedSecond{ -1 };           ///< Local second of m_renderedPrefix
+        std::array<std::uint64_t, PREFIX_WORDS> m_renderedPrefix{}; ///< Writer-side prefix cache
+        std::jthread m_thread;                         ///< Background refresh thread
+    };
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/CachedClock.inl"
@@ -0,0 +1,180 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Clock.h
+ * @brief Selectable wall-clock sources for DateTime::utcNow() and DateTimeOffset::utcNow()
+ * @details Clock policies trade accuracy for cost when reading the current UTC time. Each
+ *          policy exposes a static `utcTicks()` returning 100-nanosecond ticks since
+ *          January 1, 0001 UTC and can be passed as template argument to
+ *          `DateTime::utcNow<Clock>()`, `DateTimeOffset::utcNow<Clock>()` and
+ *          `DateTimeOffset::now<Clock>()`.
+ *
+ * @section clock_sources Clock sources
+ *
+ * @code
+ * ┌──────────────┬─────────────────────────────────────┬─────────────────────────────┐
+ * │  Policy      │  Source                             │  Resolution                 │
+ * ├──────────────┼─────────────────────────────────────┼─────────────────────────────┤
+ * │  PreciseClock│  std::chrono::system_clock          │  Tick (100 ns) or better    │
+ * │  CoarseClock │  CLOCK_REALTIME_COARSE (Linux)      │  Scheduler tick (1-4 ms)    │
+ * │              │  GetSystemTimeAsFileTime (Windows)  │  Timer interrupt (~0.5-16ms)│
+ * │  TscClock    │  Invariant CPU time-stamp counter   │  Tick (100 ns)              │
+ * └──────────────┴─────────────────────────────────────┴─────────────────────────────┘
+ * @endcode
+ *
+ * @note TscClock calibrates the counter against the system clock on first use (about 10 ms)
+ *       and re-anchors each thread to the system clock every 50 ms, so it follows clock
+ *       adjustments with that latency. Without an invariant time-stamp counter it falls
+ *       back to PreciseClock.
+ *
+ * @section steady_sources Steady sources
+ *
+ * Interval measurement (Stopwatch) uses monotonic sources instead: each exposes a static
+ * `ticks()` counting 100-nanosecond ticks from an unspecified origin, unaffected by wall-clock
+ * steps. SteadyClock reads std::chrono::steady_clock; TscSteadyClock scales the raw time-stamp
+ * counter with the same calibration as TscClock (falling back to SteadyClock without one).
+ */
+
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+
+namespace nfx::time
+{
+    //=====================================================================
+    // Clock source concept
+    //=====================================================================
+
+    /**
+     * @brief Requirements for a wall-clock source usable with utcNow<Clock>()
+     * @details A clock source provides `static std::int64_t utcTicks() noexcept` returning the
+     *          current UTC time in 100-nanosecond ticks since January 1, 0001.
+     */
+    template <typename T>
+    concept ClockSource = requires {
+        { T::utcTicks() } noexcept -> std::same_as<std::int64_t>;
+    };
+
+    //=====================================================================
+    // Clock policies
+    //=====================================================================
+
+    /** @brief Full-resolution system clock (std::chrono::system_clock), the default source */
+    struct PreciseClock final
+    {
+        /**
+         * @brief Read the current UTC time
+         * @return UTC ticks since January 1, 0001
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline static std::int64_t utcTicks() noexcept;
+    };
+
+    /**
+     * @brief Low-cost clock updated once per scheduler tick
+     * @details Reads the kernel's cached wall-clock time without querying the clock hardware.
+     *          Platforms without a coarse clock use the precise system clock.
+     */
+    struct CoarseClock final
+    {
+        /**
+         * @brief Read the current UTC time
+         * @return UTC ticks since January 1, 0001
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static std::int64_t utcTicks() noexcept;
+    };
+
+    /**
+     * @brief Clock derived from the CPU time-stamp counter (x86-64)
+     * @details Converts elapsed TSC cycles to ticks from a per-thread anchor taken on the system
+     *          clock, so a read costs one counter read and a multiply. Requires an invariant
+     *          (constant rate, non-stop) counter; otherwise every read uses PreciseClock.
+     */
+    struct TscClock final
+    {
+        /**
+         * @brief Read the current UTC time
+         * @return UTC ticks since January 1, 0001
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static std::int64_t utcTicks() noexcept;
+
+        /**
+         * @brief Check whether the time-stamp counter is used
+         * @return true if an invariant counter was detected and calibrated
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static bool isAvailable() noexcept;
+    };
+
+    //=====================================================================
+    // Steady clock source concept
+    //=====================================================================
+
+    /**
+     * @brief Requirements for a monotonic source usable with BasicStopwatch
+     * @details A steady source provides `static std::int64_t ticks() noexcept` returning
+     *          100-nanosecond ticks from an unspecified origin that never decrease.
+     */
+    template <typename T>
+    concept SteadyClockSource = requires {
+        { T::ticks() } noexcept -> std::same_as<std::int64_t>;
+    };
+
+    //=====================================================================
+    // Steady clock policies
+    //=====================================================================
+
+    /** @brief Monotonic clock (std::chrono::steady_clock), the default Stopwatch source */
+    struct SteadyClock final
+    {
+        /**
+         * @brief Read the monotonic clock
+         * @return Ticks from an unspecified origin
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline static std::int64_t ticks() noexcept;
+    };
+
+    /**
+     * @brief Monotonic clock derived from the invariant CPU time-stamp counter (x86-64)
+     * @details One counter read and two multiplies per read, without the per-thread anchor of
+     *          TscClock. Uses SteadyClock when no invariant counter is available.
+     */
+    struct TscSteadyClock final
+    {
+        /**
+         * @brief Read the time-stamp counter converted to ticks
+         * @return Ticks from an unspecified origin
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static std::int64_t ticks() noexcept;
+    };
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/Clock.inl"
@@ -201,10 +201,14 @@
 #include <compare>
 #include <cstdint>
 #include <format>
+#include <iterator>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
+#include "Clock.h"
 #include "TimeSpan.h"
 
 namespace nfx::time
@@ -269,6 +273,52 @@ namespace nfx::time
             UnixMilliseconds,
         };
 
+        //----------------------------------------------
+        // Calendar components
+        //----------------------------------------------
+
+        /**
+         * @brief Broken-down calendar and clock fields of a DateTime
+         * @details Trivially copyable aggregate filled in a single pass by components().
+         *          Prefer it over the individual accessors when several fields are needed,
+         *          since each accessor repeats the ticks-to-civil-date conversion.
+         */
+        struct Components
+        {
+            /** @brief Year (1-9999) */
+            std::int32_t year{};
+
+            /** @brief Month (1-12) */
+            std::int32_t month{};
+
+            /** @brief Day of month (1-31) */
+            std::int32_t day{};
+
+            /** @brief Hour (0-23) */
+            std::int32_t hour{};
+
+            /** @brief Minute (0-59) */
+            std::int32_t minute{};
+
+            /** @brief Second (0-59) */
+            std::int32_t second{};
+
+            /** @brief Fraction of the second in 100-nanosecond ticks (0-9999999) */
+            std::int32_t subsecondTicks{};
+
+            /** @brief Day of week (0=Sunday, 6=Saturday) */
+            std::int32_t dayOfWeek{};
+
+            /** @brief Day of year (1-366) */
+            std::int32_t dayOfYear{};
+
+            /**
+             * @brief Equality comparison
+             * @return true if all fields are equal, false otherwise
+             */
+            constexpr bool operator==( const Components& ) const noexcept = default;
+        };
+
         //----------------------------------------------
         // Construction
         //----------------------------------------------
@@ -294,7 +344,7 @@ namespace nfx::time
          * @param month Month component (1-12)
          * @param day Day component (1-31)
          */
-        DateTime( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept;
+        inline constexpr DateTime( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept;
 
         /**
          * @brief Construct from date and time components
@@ -305,7 +355,7 @@ namespace nfx::time
          * @param minute Minute component (0-59)
          * @param second Second component (0-59)
          */
-        DateTime(
+        inline constexpr DateTime(
             std::int32_t year,
             std::int32_t month,
             std::int32_t day,
@@ -323,7 +373,7 @@ namespace nfx::time
          * @param second Second component (0-59)
          * @param millisecond Millisecond component (0-999)
          */
-        DateTime(
+        inline constexpr DateTime(
             std::int32_t year,
             std::int32_t month,
             std::int32_t day,
@@ -335,20 +385,22 @@ namespace nfx::time
         /**
          * @brief Parse from ISO 8601 string
          * @param iso8601String ISO 8601 formatted string to parse
+         * @throws std::invalid_argument if the string is not a valid timestamp (a compile error in
+         *         constant expressions, where only the fixed layouts of the fast path are accepted)
          */
-        inline explicit DateTime( std::string_view iso8601String );
+        inline explicit constexpr DateTime( std::string_view iso8601String );
 
         /**
          * @brief Parse from C-string (convenience for string literals)
          * @param iso8601String ISO 8601 formatted C-string to parse
          */
-        inline explicit DateTime( const char* iso8601String );
+        inline explicit constexpr DateTime( const char* iso8601String );
 
         /**
          * @brief Initialize from initializer list (convenience for single string)
          * @param list Initializer list containing ISO 8601 string
          */
-        inline explicit DateTime( std::initializer_list<const char*> list );
+        inline explicit constexpr DateTime( std::initializer_list<const char*> list );
 
         /** @brief Copy constructor */
         DateTime( const DateTime& ) = default;
@@ -445,56 +497,56 @@ namespace nfx::time
          * @return The year component of this DateTime (1-9999)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t year() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t year() const noexcept;
 
         /**
          * @brief Get month component (1-12)
          * @return The month component of this DateTime (1-12)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t month() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t month() const noexcept;
 
         /**
          * @brief Get day component (1-31)
          * @return The day component of this DateTime (1-31)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t day() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t day() const noexcept;
 
         /**
          * @brief Get hour component (0-23)
          * @return The hour component of this DateTime (0-23)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t hour() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t hour() const noexcept;
 
         /**
          * @brief Get minute component (0-59)
          * @return The minute component of this DateTime (0-59)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t minute() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t minute() const noexcept;
 
         /**
          * @brief Get second component (0-59)
          * @return The second component of this DateTime (0-59)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t second() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t second() const noexcept;
 
         /**
          * @brief Get millisecond component (0-999)
          * @return The millisecond component of this DateTime (0-999)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t millisecond() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t millisecond() const noexcept;
 
         /**
          * @brief Get microsecond component (0-999)
          * @return The microsecond component of this DateTime (0-999)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t microsecond() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t microsecond() const noexcept;
 
         /**
          * @brief Get nanosecond component (0-900, in 100ns increments)
@@ -502,7 +554,7 @@ namespace nfx::time
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          * @note Due to 100-nanosecond tick precision, only values 0-900 in 100ns increments are possible
          */
-        [[nodiscard]] std::int32_t nanosecond() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t nanosecond() const noexcept;
 
         /**
          * @brief Get tick count (100-nanosecond units since year 1)
@@ -516,14 +568,23 @@ namespace nfx::time
          * @return The day of week as an integer (0=Sunday, 1=Monday, ..., 6=Saturday)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t dayOfWeek() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t dayOfWeek() const noexcept;
 
         /**
          * @brief Get day of year (1-366)
          * @return The day of year as an integer (1-366, where 366 occurs in leap years)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int32_t dayOfYear() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t dayOfYear() const noexcept;
+
+        /**
+         * @brief Get all calendar and clock components in one pass
+         * @return Components holding year, month, day, time of day, sub-second ticks,
+         *         day of week and day of year
+         * @details Performs the ticks-to-civil-date conversion once; usable in constant expressions.
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr Components components() const noexcept;
 
         //----------------------------------------------
         // Conversion methods
@@ -548,14 +609,107 @@ namespace nfx::time
          * @return New DateTime with the same date but time set to 00:00:00
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTime date() const noexcept;
+        [[nodiscard]] inline constexpr DateTime date() const noexcept;
 
         /**
          * @brief Get time of day as duration since midnight
          * @return TimeSpan representing the elapsed time since midnight (00:00:00)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] TimeSpan timeOfDay() const noexcept;
+        [[nodiscard]] inline constexpr TimeSpan timeOfDay() const noexcept;
+
+        //----------------------------------------------
+        // Bucketing
+        //----------------------------------------------
+
+        /**
+         * @brief Round down to a multiple of a fixed interval
+         * @param interval Bucket width (e.g. TimeSpan::fromMinutes( 5 ))
+         * @return Start of the bucket containing this value, or this value if interval is not positive
+         * @details Buckets are aligned on January 1, 0001 00:00:00, so intervals dividing a day
+         *          start at midnight (and at the Unix epoch) and 7-day buckets start on Mondays.
+         *          bulk::floor() buckets whole spans without a hardware division per element.
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime floor( const TimeSpan& interval ) const noexcept;
+
+        /**
+         * @brief Round up to a multiple of a fixed interval
+         * @param interval Bucket width
+         * @return Smallest bucket boundary not before this value, or this value if interval is not
+         *         positive; clamped to max() inside the last partial bucket
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime ceil( const TimeSpan& interval ) const noexcept;
+
+        /**
+         * @brief Round to the nearest multiple of a fixed interval (halfway rounds up)
+         * @param interval Bucket width
+         * @return Nearest bucket boundary, or this value if interval is not positive; clamped to
+         *         max() when rounding up inside the last partial bucket
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime round( const TimeSpan& interval ) const noexcept;
+
+        /**
+         * @brief Get midnight of the first day of the week containing this value
+         * @param firstDayOfWeek Day the week starts on (0=Sunday, 1=Monday, ..., 6=Saturday)
+         * @return Start of the week, clamped to min() for the first days of year 1
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime startOfWeek( std::int32_t firstDayOfWeek = 1 ) const noexcept;
+
+        /**
+         * @brief Get midnight of the first day of the month containing this value
+         * @return Start of the month
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime startOfMonth() const noexcept;
+
+        /**
+         * @brief Get midnight of January 1st of the year containing this value
+         * @return Start of the year
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime startOfYear() const noexcept;
+
+        //----------------------------------------------
+        // Calendar arithmetic
+        //----------------------------------------------
+
+        /**
+         * @brief Add calendar months
+         * @param months Number of months to add (may be negative)
+         * @return Same day and time of day in the target month, with the day clamped to the
+         *         month length (e.g. January 31 + 1 month = February 28/29); results outside
+         *         years 1-9999 clamp to min() or max()
+         * @details Constant time: one civil decomposition, floor-division month normalization
+         *          and one recomposition.
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime addMonths( std::int32_t months ) const noexcept;
+
+        /**
+         * @brief Add calendar years
+         * @param years Number of years to add (may be negative)
+         * @return Same month, day and time of day in the target year (February 29 becomes
+         *         February 28 in common years); results outside years 1-9999 clamp to min() or max()
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime addYears( std::int32_t years ) const noexcept;
+
+        /**
+         * @brief Add business days (Monday to Friday)
+         * @param days Number of business days to add (may be negative)
+         * @return The days-th weekday after (or before) this value, keeping the time of day;
+         *         a weekend start counts from the adjacent Friday (forward) or Monday
+         *         (backward), and 0 returns this value unchanged. Results outside the DateTime
+         *         range clamp to min() or max()
+         * @details Constant time: whole weeks are added as 7 days and the remainder is
+         *          adjusted for one weekend at most. Holidays are not considered.
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime addBusinessDays( std::int32_t days ) const noexcept;
 
         //----------------------------------------------
         // Validation methods
@@ -566,7 +720,7 @@ namespace nfx::time
          * @return true if this DateTime represents a valid date and time, false otherwise
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] bool isValid() const noexcept;
+        [[nodiscard]] inline constexpr bool isValid() const noexcept;
 
         /**
          * @brief Check if given year is a leap year
@@ -604,6 +758,17 @@ namespace nfx::time
          */
         [[nodiscard]] static DateTime utcNow() noexcept;
 
+        /**
+         * @brief Get current UTC time from a selectable clock source
+         * @tparam Clock Clock policy (PreciseClock, CoarseClock, TscClock or a user ClockSource)
+         * @return DateTime representing the current UTC date and time as read from Clock
+         * @details Use CoarseClock or TscClock where millisecond accuracy is enough and the
+         *          per-call cost matters, e.g. when stamping requests or log records.
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        template <ClockSource Clock>
+        [[nodiscard]] inline static DateTime utcNow() noexcept;
+
         /**
          * @brief Get current local date (time set to 00:00:00)
          * @return DateTime representing the current local date with time set to 00:00:00
@@ -649,6 +814,36 @@ namespace nfx::time
          */
         [[nodiscard]] static std::optional<DateTime> fromString( std::string_view iso8601String ) noexcept;
 
+        /**
+         * @brief Parse the longest ISO 8601 timestamp at the start of a character range
+         * @details In the spirit of std::from_chars: the ISO 8601 timestamp does not have to span the
+         *          whole range, so memory-mapped logs can be tokenized in place without slicing
+         *          a string_view to the exact extent first. Accepts the forms fromString() accepts
+         *          and leaves the first character after them unread (e.g. the space in
+         *          "2024-06-15T14:30:00Z GET /index").
+         * @param first Start of the character range
+         * @param last End of the character range
+         * @param result Receives the parsed value on success (unchanged on failure)
+         * @return Pointer past the last consumed character, or first if no ISO 8601 timestamp starts at first
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static const char* parsePrefix( const char* first, const char* last, DateTime& result ) noexcept;
+
+        /**
+         * @brief Parse a batch of ISO 8601 strings without throwing exceptions
+         * @details Detects the fixed-width layout of the first well-formed element once and parses
+         *          every matching element with a tight fixed-position loop; elements that do not
+         *          match the layout fall back to fromString(). Processes
+         *          min(inputs.size(), results.size(), ok.size()) elements.
+         * @param inputs ISO 8601 formatted strings to parse
+         * @param results Receives the parsed values (default-constructed for failed elements)
+         * @param ok Receives 1 for each successfully parsed element, 0 otherwise
+         * @return Number of successfully parsed elements
+         */
+        static std::size_t parseMany( std::span<const std::string_view> inputs,
+            std::span<DateTime> results,
+            std::span<std::uint8_t> ok ) noexcept;
+
         /**
          * @brief Create from Epoch timestamp (seconds since epoch)
          * @param seconds The number of seconds since Unix epoch (January 1, 1970 00:00:00 UTC)
@@ -675,7 +870,42 @@ namespace nfx::time
          * @return String representation using the specified format
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::string toString( Format format = Format::Iso8601 ) const;
+        [[nodiscard]] inline std::string toString( Format format = Format::Iso8601 ) const;
+
+        /**
+         * @brief Format into a caller-provided buffer without allocating
+         * @details Writes exactly the characters produced by toString() for the same format,
+         *          without a null terminator. A capacity of constants::MAX_ISO8601_LENGTH
+         *          is sufficient for every format.
+         * @param buffer Destination buffer
+         * @param capacity Size of the destination buffer in characters
+         * @param format The format to use for string conversion
+         * @return Number of characters written, or 0 if the buffer is too small (buffer contents are then unspecified)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t formatTo(
+            char* buffer, std::size_t capacity, Format format = Format::Iso8601 ) const noexcept;
+
+        /**
+         * @brief Format into a caller-provided span without allocating
+         * @param buffer Destination span
+         * @param format The format to use for string conversion
+         * @return Number of characters written, or 0 if the span is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t formatTo(
+            std::span<char> buffer, Format format = Format::Iso8601 ) const noexcept;
+
+        /**
+         * @brief Format through an output iterator without allocating
+         * @tparam OutputIt Output iterator accepting char (e.g. std::back_inserter, std::format_context::iterator)
+         * @param out Destination iterator
+         * @param format The format to use for string conversion
+         * @return Iterator one past the last character written
+         */
+        template <typename OutputIt>
+            requires( !std::is_pointer_v<OutputIt> && std::output_iterator<OutputIt, char> )
+        inline OutputIt formatTo( OutputIt out, Format format = Format::Iso8601 ) const;
 
         //----------------------------------------------
         // std::chrono interoperability
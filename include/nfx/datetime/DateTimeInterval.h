@@ -0,0 +1,366 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DateTimeInterval.h
+ * @brief Half-open time intervals over DateTime and DateTimeOffset
+ * @details DateTimeInterval and DateTimeOffsetInterval model sessions, maintenance windows and
+ *          reservations as [start, end) ranges. Set operations work on raw (UTC) ticks, so two
+ *          DateTimeOffsetInterval values in different offsets compare by the instants they cover.
+ *
+ * @section interval_semantics Semantics
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  [a, b)  contains t        a <= t < b                                │
+ * │  [a, b)  overlaps [c, d)   max(a, c) < min(b, d)                     │
+ * │  [a, b)  adjacent [c, d)   b == c  or  d == a                        │
+ * │  intersect                 [max(a, c), min(b, d)) if they overlap    │
+ * │  merge                     [min(a, c), max(b, d)) if they overlap    │
+ * │                            or are adjacent                           │
+ * │  hull                      [min(a, c), max(b, d)) always             │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note Intervals with start == end are empty: they contain no instant and overlap nothing.
+ *       Constructors order the endpoints, so an interval never has end < start.
+ */
+
+#pragma once
+
+#include <compare>
+#include <optional>
+#include <string>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // DateTimeInterval class
+    //=====================================================================
+
+    /**
+     * @brief Half-open interval [start, end) of UTC instants
+     * @details Ordered by start, then end, using the DateTime ordering operators.
+     */
+    class DateTimeInterval final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Default constructor (empty interval at the minimum DateTime) */
+        inline constexpr DateTimeInterval() noexcept = default;
+
+        /**
+         * @brief Construct from endpoints
+         * @param start Inclusive start
+         * @param end Exclusive end (swapped with start if it precedes it)
+         */
+        inline constexpr DateTimeInterval( const DateTime& start, const DateTime& end ) noexcept;
+
+        /**
+         * @brief Construct from a start and a duration
+         * @param start Inclusive start
+         * @param duration Length of the interval (a negative duration ends at start)
+         */
+        inline constexpr DateTimeInterval( const DateTime& start, const TimeSpan& duration ) noexcept;
+
+        //----------------------------------------------
+        // Comparison operators
+        //----------------------------------------------
+
+        /**
+         * @brief Three-way comparison by start, then end
+         * @param other Interval to compare with
+         * @return Ordering of the two intervals
+         */
+        constexpr std::strong_ordering operator<=>( const DateTimeInterval& other ) const noexcept = default;
+
+        /**
+         * @brief Equality comparison (same start and end)
+         * @param other Interval to compare with
+         * @return true if both endpoints are equal
+         */
+        constexpr bool operator==( const DateTimeInterval& other ) const noexcept = default;
+
+        //----------------------------------------------
+        // Property accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the inclusive start
+         * @return Start instant
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime start() const noexcept;
+
+        /**
+         * @brief Get the exclusive end
+         * @return End instant
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime end() const noexcept;
+
+        /**
+         * @brief Get the length of the interval
+         * @return end - start (never negative)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr TimeSpan duration() const noexcept;
+
+        /**
+         * @brief Check whether the interval is empty
+         * @return true if start == end
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr bool isEmpty() const noexcept;
+
+        //----------------------------------------------
+        // Set operations
+        //----------------------------------------------
+
+        /**
+         * @brief Check whether an instant lies inside the interval
+         * @param instant Instant to test
+         * @return true if start <= instant < end
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr bool contains( const DateTime& instant ) const noexcept;
+
+        /**
+         * @brief Check whether another interval lies entirely inside this one
+         * @param other Interval to test
+         * @return true if start <= other.start and other.end <= end
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr bool contains( const DateTimeInterval& other ) const noexcept;
+
+        /**
+         * @brief Check whether two intervals share at least one instant
+         * @param other Interval to test
+         * @return true if the intersection is not empty
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr bool overlaps( const DateTimeInterval& other ) const noexcept;
+
+        /**
+         * @brief Check whether one interval ends exactly where the other starts
+         * @param other Interval to test
+         * @return true if end == other.start or other.end == start
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr bool isAdjacent( const DateTimeInterval& other ) const noexcept;
+
+        /**
+         * @brief Get the instants shared by two intervals
+         * @param other Interval to intersect with
+         * @return Intersection, or std::nullopt if the intervals do not overlap
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr std::optional<DateTimeInterval> intersect(
+            const DateTimeInterval& other ) const noexcept;
+
+        /**
+         * @brief Get the union of two overlapping or adjacent intervals
+         * @param other Interval to merge with
+         * @return Union, or std::nullopt if a gap separates the intervals
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr std::optional<DateTimeInterval> merge(
+            const DateTimeInterval& other ) const noexcept;
+
+        /**
+         * @brief Get the smallest interval covering both intervals
+         * @param other Interval to cover
+         * @return [min(start, other.start), max(end, other.end))
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeInterval hull( const DateTimeInterval& other ) const noexcept;
+
+        //----------------------------------------------
+        // String formatting
+        //----------------------------------------------
+
+        /**
+         * @brief Format as an ISO 8601 time interval
+         * @param format Format of both endpoints
+         * @return "start/end", e.g. "2024-06-15T09:00:00Z/2024-06-15T12:00:00Z"
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::string toString( DateTime::Format format = DateTime::Format::Iso8601 ) const;
+
+    private:
+        DateTime m_start; ///< Inclusive start
+        DateTime m_end;   ///< Exclusive end
+    };
+
+    //=====================================================================
+    // DateTimeOffsetInterval class
+    //=====================================================================
+
+    /**
+     * @brief Half-open interval [start, end) of instants with UTC offsets
+     * @details Endpoints keep their own offsets (a flight departing at +01:00 and landing at
+     *          -05:00); every comparison and set operation uses the UTC instants. Intervals
+     *          computed by intersect(), merge() and hull() take each endpoint, offset included,
+     *          from the operand that supplied it.
+     */
+    class DateTimeOffsetInterval final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Default constructor (empty interval at the minimum DateTimeOffset) */
+        inline constexpr DateTimeOffsetInterval() noexcept = default;
+
+        /**
+         * @brief Construct from endpoints
+         * @param start Inclusive start
+         * @param end Exclusive end (swapped with start if its instant precedes it)
+         */
+        inline constexpr DateTimeOffsetInterval( const DateTimeOffset& start, const DateTimeOffset& end ) noexcept;
+
+        /**
+         * @brief Construct from a start and a duration
+         * @param start Inclusive start
+         * @param duration Length of the interval (a negative duration ends at start); the end
+         *                 keeps the start's offset
+         */
+        inline constexpr DateTimeOffsetInterval( const DateTimeOffset& start, const TimeSpan& duration ) noexcept;
+
+        //----------------------------------------------
+        // Comparison operators
+        //----------------------------------------------
+
+        /**
+         * @brief Three-way comparison by start instant, then end instant
+         * @param other Interval to compare with
+         * @return Ordering of the two intervals
+         */
+        constexpr std::strong_ordering operator<=>( const DateTimeOffsetInterval& other ) const noexcept = default;
+
+        /**
+         * @brief Equality comparison (same start and end instants, offsets ignored)
+         * @param other Interval to compare with
+         * @return true if both endpoints denote the same instants
+         */
+        constexpr bool operator==( const DateTimeOffsetInterval& other ) const noexcept = default;
+
+        //----------------------------------------------
+        // Property accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the inclusive start
+         * @return Start instant with its offset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset start() const noexcept;
+
+        /**
+         * @brief Get the exclusive end
+         * @return End instant with its offset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset end() const noexcept;
+
+        /**
+         * @brief Get the length of the interval
+         * @return Elapsed time between the start and end instants (never negative)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr TimeSpan duration() const noexcept;
+
+        /**
+         * @brief Check whether the interval is empty
+         * @return true if start and end denote the same instant
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr bool isEmpty() const noexcept;
+
+        //----------------------------------------------
+        // Set operations
+        //----------------------------------------------
+
+        /** @copydoc DateTimeInterval::contains(const DateTime&) const */
+        [[nodiscard]] inline constexpr bool contains( const DateTimeOffset& instant ) const noexcept;
+
+        /** @copydoc DateTimeInterval::contains(const DateTimeInterval&) const */
+        [[nodiscard]] inline constexpr bool contains( const DateTimeOffsetInterval& other ) const noexcept;
+
+        /** @copydoc DateTimeInterval::overlaps */
+        [[nodiscard]] inline constexpr bool overlaps( const DateTimeOffsetInterval& other ) const noexcept;
+
+        /** @copydoc DateTimeInterval::isAdjacent */
+        [[nodiscard]] inline constexpr bool isAdjacent( const DateTimeOffsetInterval& other ) const noexcept;
+
+        /** @copydoc DateTimeInterval::intersect */
+        [[nodiscard]] inline constexpr std::optional<DateTimeOffsetInterval> intersect(
+            const DateTimeOffsetInterval& other ) const noexcept;
+
+        /** @copydoc DateTimeInterval::merge */
+        [[nodiscard]] inline constexpr std::optional<DateTimeOffsetInterval> merge(
+            const DateTimeOffsetInterval& other ) const noexcept;
+
+        /** @copydoc DateTimeInterval::hull */
+        [[nodiscard]] inline constexpr DateTimeOffsetInterval hull(
+            const DateTimeOffsetInterval& other ) const noexcept;
+
+        //----------------------------------------------
+        // Conversion
+        //----------------------------------------------
+
+        /**
+         * @brief Get the same interval in UTC
+         * @return Interval between the UTC instants of both endpoints
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeInterval toUtc() const noexcept;
+
+        //----------------------------------------------
+        // String formatting
+        //----------------------------------------------
+
+        /**
+         * @brief Format as an ISO 8601 time interval
+         * @param format Format of both endpoints
+         * @return "start/end", e.g. "2024-06-15T09:00:00+02:00/2024-06-15T12:00:00+02:00"
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::string toString( DateTime::Format format = DateTime::Format::Iso8601 ) const;
+
+    private:
+        DateTimeOffset m_start; ///< Inclusive start
+        DateTimeOffset m_end;   ///< Exclusive end
+    };
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/DateTimeInterval.inl"
@@ -140,9 +140,12 @@
 #include <cstdint>
 #include <string>
 #include <format>
+#include <iterator>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 #include "DateTime.h"
 #include "TimeSpan.h"
@@ -273,20 +276,22 @@ namespace nfx::time
         /**
          * @brief Parse from ISO 8601 string with timezone offset
          * @param iso8601String ISO 8601 formatted string with timezone offset to parse
+         * @throws std::invalid_argument if the string is not a valid timestamp (a compile error in
+         *         constant expressions, where only the fixed layouts of the fast path are accepted)
          */
-        inline explicit DateTimeOffset( std::string_view iso8601String );
+        inline explicit constexpr DateTimeOffset( std::string_view iso8601String );
 
         /**
          * @brief Parse from C-string (convenience for string literals)
          * @param iso8601String ISO 8601 formatted C-string with timezone offset to parse
          */
-        inline explicit DateTimeOffset( const char* iso8601String );
+        inline explicit constexpr DateTimeOffset( const char* iso8601String );
 
         /**
          * @brief Initialize from initializer list (convenience for single string)
          * @param list Initializer list containing ISO 8601 string with timezone offset
          */
-        inline explicit DateTimeOffset( std::initializer_list<const char*> list );
+        inline explicit constexpr DateTimeOffset( std::initializer_list<const char*> list );
 
         /** @brief Copy constructor */
         DateTimeOffset( const DateTimeOffset& ) = default;
@@ -397,14 +402,14 @@ namespace nfx::time
          * @return The DateTime representing this time in UTC
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTime utcDateTime() const noexcept;
+        [[nodiscard]] inline constexpr DateTime utcDateTime() const noexcept;
 
         /**
          * @brief Get local DateTime equivalent
          * @return The DateTime representing this time in local timezone
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTime localDateTime() const noexcept;
+        [[nodiscard]] inline constexpr DateTime localDateTime() const noexcept;
 
         /**
          * @brief Get tick count (100-nanosecond units of local time)
@@ -425,77 +430,84 @@ namespace nfx::time
          * @return The year component of this DateTimeOffset (1-9999)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t year() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t year() const noexcept;
 
         /**
          * @brief Get month component (1-12)
          * @return The month component of this DateTimeOffset (1-12)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t month() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t month() const noexcept;
 
         /**
          * @brief Get day component (1-31)
          * @return The day component of this DateTimeOffset (1-31)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t day() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t day() const noexcept;
 
         /**
          * @brief Get hour component (0-23)
          * @return The hour component of this DateTimeOffset (0-23)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t hour() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t hour() const noexcept;
 
         /**
          * @brief Get minute component (0-59)
          * @return The minute component of this DateTimeOffset (0-59)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t minute() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t minute() const noexcept;
 
         /**
          * @brief Get second component (0-59)
          * @return The second component of this DateTimeOffset (0-59)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t second() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t second() const noexcept;
 
         /**
          * @brief Get millisecond component (0-999)
          * @return The millisecond component of this DateTimeOffset (0-999)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t millisecond() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t millisecond() const noexcept;
 
         /**
          * @brief Get microsecond component (0-999)
          * @return The microsecond component of this DateTimeOffset (0-999)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t microsecond() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t microsecond() const noexcept;
 
         /**
          * @brief Get nanosecond component (0-900, in hundreds)
          * @return The nanosecond component of this DateTimeOffset in hundreds (0-900)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t nanosecond() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t nanosecond() const noexcept;
 
         /**
          * @brief Get day of week (0=Sunday, 6=Saturday)
          * @return The day of week as an integer (0=Sunday, 1=Monday, ..., 6=Saturday)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t dayOfWeek() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t dayOfWeek() const noexcept;
 
         /**
          * @brief Get day of year (1-366)
          * @return The day of year as an integer (1-366, where 366 occurs in leap years)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int32_t dayOfYear() const noexcept;
+        [[nodiscard]] inline constexpr std::int32_t dayOfYear() const noexcept;
+
+        /**
+         * @brief Get all calendar and clock components of the local time in one pass
+         * @return DateTime::Components of the local (offset-adjusted) date and time
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTime::Components components() const noexcept;
 
         /**
          * @brief Get offset in total minutes
@@ -513,28 +525,28 @@ namespace nfx::time
          * @return Number of seconds since Unix epoch (January 1, 1970 00:00:00 UTC)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int64_t toEpochSeconds() const noexcept;
+        [[nodiscard]] inline constexpr std::int64_t toEpochSeconds() const noexcept;
 
         /**
          * @brief Convert to Epoch timestamp (milliseconds since epoch)
          * @return Number of milliseconds since Unix epoch (January 1, 1970 00:00:00 UTC)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline std::int64_t toEpochMilliseconds() const noexcept;
+        [[nodiscard]] inline constexpr std::int64_t toEpochMilliseconds() const noexcept;
 
         /**
          * @brief Get date component (time set to 00:00:00)
          * @return DateTimeOffset with the same date but time set to 00:00:00
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset date() const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset date() const noexcept;
 
         /**
          * @brief Get time of day as duration since midnight
          * @return TimeSpan representing the elapsed time since midnight (00:00:00)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] inline TimeSpan timeOfDay() const noexcept;
+        [[nodiscard]] inline constexpr TimeSpan timeOfDay() const noexcept;
 
         /**
          * @brief Convert to specified offset
@@ -542,14 +554,14 @@ namespace nfx::time
          * @return DateTimeOffset representing the same instant in time with the specified offset
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset toOffset( const TimeSpan& newOffset ) const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset toOffset( const TimeSpan& newOffset ) const noexcept;
 
         /**
          * @brief Convert to UTC (offset = 00:00:00)
          * @return DateTimeOffset representing the same instant in UTC (offset = 00:00:00)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset toUniversalTime() const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset toUniversalTime() const noexcept;
 
         /**
          * @brief Convert to local time (system timezone)
@@ -565,7 +577,61 @@ namespace nfx::time
          * @return 100-nanosecond intervals since January 1, 1601 UTC
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::int64_t toFILETIME() const noexcept;
+        [[nodiscard]] inline constexpr std::int64_t toFILETIME() const noexcept;
+
+        //----------------------------------------------
+        // Bucketing
+        //----------------------------------------------
+
+        /**
+         * @brief Round the local time down to a multiple of a fixed interval
+         * @param interval Bucket width (e.g. TimeSpan::fromHours( 1 ))
+         * @return Start of the local bucket containing this value, with the same offset
+         * @details Buckets follow local time, so a 1-day bucket starts at local midnight.
+         *          See DateTime::floor() for the alignment rules.
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset floor( const TimeSpan& interval ) const noexcept;
+
+        /**
+         * @brief Round the local time up to a multiple of a fixed interval
+         * @param interval Bucket width
+         * @return Smallest local bucket boundary not before this value, with the same offset
+         *         (local time clamped to DateTime::max() like DateTime::ceil())
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset ceil( const TimeSpan& interval ) const noexcept;
+
+        /**
+         * @brief Round the local time to the nearest multiple of a fixed interval (halfway rounds up)
+         * @param interval Bucket width
+         * @return Nearest local bucket boundary, with the same offset (local time clamped to
+         *         DateTime::max() like DateTime::round())
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset round( const TimeSpan& interval ) const noexcept;
+
+        /**
+         * @brief Get local midnight of the first day of the week containing this value
+         * @param firstDayOfWeek Day the week starts on (0=Sunday, 1=Monday, ..., 6=Saturday)
+         * @return Start of the local week, with the same offset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset startOfWeek( std::int32_t firstDayOfWeek = 1 ) const noexcept;
+
+        /**
+         * @brief Get local midnight of the first day of the month containing this value
+         * @return Start of the local month, with the same offset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset startOfMonth() const noexcept;
+
+        /**
+         * @brief Get local midnight of January 1st of the year containing this value
+         * @return Start of the local year, with the same offset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset startOfYear() const noexcept;
 
         //----------------------------------------------
         // Arithmetic methods
@@ -579,13 +645,22 @@ namespace nfx::time
          */
         [[nodiscard]] inline DateTimeOffset add( const TimeSpan& value ) const noexcept;
 
+        /**
+         * @brief Add business days (Monday to Friday) in local time
+         * @param days The number of business days to add (may be negative)
+         * @return DateTimeOffset representing this DateTimeOffset plus the specified business days,
+         *         with the same offset (see DateTime::addBusinessDays())
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset addBusinessDays( std::int32_t days ) const noexcept;
+
         /**
          * @brief Add days
          * @param days The number of days to add to this DateTimeOffset
          * @return DateTimeOffset representing this DateTimeOffset plus the specified days
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset addDays( double days ) const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset addDays( double days ) const noexcept;
 
         /**
          * @brief Add hours
@@ -593,7 +668,7 @@ namespace nfx::time
          * @return DateTimeOffset representing this DateTimeOffset plus the specified hours
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset addHours( double hours ) const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset addHours( double hours ) const noexcept;
 
         /**
          * @brief Add milliseconds
@@ -601,7 +676,7 @@ namespace nfx::time
          * @return DateTimeOffset representing this DateTimeOffset plus the specified milliseconds
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset addMilliseconds( double milliseconds ) const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset addMilliseconds( double milliseconds ) const noexcept;
 
         /**
          * @brief Add minutes
@@ -609,15 +684,16 @@ namespace nfx::time
          * @return DateTimeOffset representing this DateTimeOffset plus the specified minutes
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset addMinutes( double minutes ) const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset addMinutes( double minutes ) const noexcept;
 
         /**
          * @brief Add months
          * @param months The number of months to add to this DateTimeOffset
-         * @return DateTimeOffset representing this DateTimeOffset plus the specified months
+         * @return DateTimeOffset representing this DateTimeOffset plus the specified months, with
+         *         the day clamped to the target month length (constant time, see DateTime::addMonths())
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset addMonths( std::int32_t months ) const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset addMonths( std::int32_t months ) const noexcept;
 
         /**
          * @brief Add seconds
@@ -625,7 +701,7 @@ namespace nfx::time
          * @return DateTimeOffset representing this DateTimeOffset plus the specified seconds
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset addSeconds( double seconds ) const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset addSeconds( double seconds ) const noexcept;
 
         /**
          * @brief Add ticks
@@ -641,7 +717,7 @@ namespace nfx::time
          * @return DateTimeOffset representing this DateTimeOffset plus the specified years
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] DateTimeOffset addYears( std::int32_t years ) const noexcept;
+        [[nodiscard]] inline constexpr DateTimeOffset addYears( std::int32_t years ) const noexcept;
 
         /**
          * @brief Subtract DateTimeOffset and return TimeSpan
@@ -669,7 +745,42 @@ namespace nfx::time
          * @return String representation using the specified format
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::string toString( DateTime::Format format = DateTime::Format::Iso8601 ) const;
+        [[nodiscard]] inline std::string toString( DateTime::Format format = DateTime::Format::Iso8601 ) const;
+
+        /**
+         * @brief Format into a caller-provided buffer without allocating
+         * @details Writes exactly the characters produced by toString() for the same format,
+         *          without a null terminator. A capacity of constants::MAX_ISO8601_LENGTH
+         *          is sufficient for every format.
+         * @param buffer Destination buffer
+         * @param capacity Size of the destination buffer in characters
+         * @param format The format to use for string conversion
+         * @return Number of characters written, or 0 if the buffer is too small (buffer contents are then unspecified)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t formatTo(
+            char* buffer, std::size_t capacity, DateTime::Format format = DateTime::Format::Iso8601 ) const noexcept;
+
+        /**
+         * @brief Format into a caller-provided span without allocating
+         * @param buffer Destination span
+         * @param format The format to use for string conversion
+         * @return Number of characters written, or 0 if the span is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t formatTo(
+            std::span<char> buffer, DateTime::Format format = DateTime::Format::Iso8601 ) const noexcept;
+
+        /**
+         * @brief Format through an output iterator without allocating
+         * @tparam OutputIt Output iterator accepting char (e.g. std::back_inserter, std::format_context::iterator)
+         * @param out Destination iterator
+         * @param format The format to use for string conversion
+         * @return Iterator one past the last character written
+         */
+        template <typename OutputIt>
+            requires( !std::is_pointer_v<OutputIt> && std::output_iterator<OutputIt, char> )
+        inline OutputIt formatTo( OutputIt out, DateTime::Format format = DateTime::Format::Iso8601 ) const;
 
         //----------------------------------------------
         // Comparison methods
@@ -700,7 +811,7 @@ namespace nfx::time
          * @return true if this DateTimeOffset represents a valid date and time with valid offset, false otherwise
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] bool isValid() const noexcept;
+        [[nodiscard]] inline constexpr bool isValid() const noexcept;
 
         //----------------------------------------------
         // Static factory methods
@@ -720,6 +831,24 @@ namespace nfx::time
          */
         [[nodiscard]] static DateTimeOffset utcNow() noexcept;
 
+        /**
+         * @brief Get current local time with system timezone offset from a selectable clock source
+         * @tparam Clock Clock policy (PreciseClock, CoarseClock, TscClock or a user ClockSource)
+         * @return DateTimeOffset representing the current local date and time as read from Clock
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        template <ClockSource Clock>
+        [[nodiscard]] inline static DateTimeOffset now() noexcept;
+
+        /**
+         * @brief Get current UTC time (offset = 00:00:00) from a selectable clock source
+         * @tparam Clock Clock policy (PreciseClock, CoarseClock, TscClock or a user ClockSource)
+         * @return DateTimeOffset representing the current UTC date and time as read from Clock
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        template <ClockSource Clock>
+        [[nodiscard]] inline static DateTimeOffset utcNow() noexcept;
+
         /**
          * @brief Get current local date (time set to 00:00:00)
          * @return DateTimeOffset representing the current local date with time set to 00:00:00
@@ -733,7 +862,7 @@ namespace nfx::time
          * zero offset)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] static DateTimeOffset min() noexcept;
+        [[nodiscard]] inline static constexpr DateTimeOffset min() noexcept;
 
         /**
          * @brief Get maximum DateTimeOffset value
@@ -741,14 +870,14 @@ namespace nfx::time
          * zero offset)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] static DateTimeOffset max() noexcept;
+        [[nodiscard]] inline static constexpr DateTimeOffset max() noexcept;
 
         /**
          * @brief Get Unix epoch DateTimeOffset (January 1, 1970 00:00:00 UTC)
          * @return DateTimeOffset representing the Unix epoch (January 1, 1970 00:00:00 UTC with zero offset)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] static DateTimeOffset epoch() noexcept;
+        [[nodiscard]] inline static constexpr DateTimeOffset epoch() noexcept;
 
         /**
          * @brief Parse ISO 8601 string with timezone offset safely without throwing exceptions
@@ -767,13 +896,44 @@ namespace nfx::time
          */
         [[nodiscard]] static std::optional<DateTimeOffset> fromString( std::string_view iso8601String ) noexcept;
 
+        /**
+         * @brief Parse the longest ISO 8601 timestamp at the start of a character range
+         * @details In the spirit of std::from_chars: the ISO 8601 timestamp does not have to span the
+         *          whole range, so memory-mapped logs can be tokenized in place without slicing
+         *          a string_view to the exact extent first. Accepts the forms fromString() accepts
+         *          and leaves the first character after them unread (e.g. the bracket in
+         *          "2024-06-15T14:30:00+02:00] INFO").
+         * @param first Start of the character range
+         * @param last End of the character range
+         * @param result Receives the parsed value on success (unchanged on failure)
+         * @return Pointer past the last consumed character, or first if no ISO 8601 timestamp starts at first
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static const char* parsePrefix(
+            const char* first, const char* last, DateTimeOffset& result ) noexcept;
+
+        /**
+         * @brief Parse a batch of ISO 8601 strings with offsets without throwing exceptions
+         * @details Detects the fixed-width layout of the first well-formed element once and parses
+         *          every matching element with a tight fixed-position loop; elements that do not
+         *          match the layout fall back to fromString(). Processes
+         *          min(inputs.size(), results.size(), ok.size()) elements.
+         * @param inputs ISO 8601 formatted strings to parse
+         * @param results Receives the parsed values (default-constructed for failed elements)
+         * @param ok Receives 1 for each successfully parsed element, 0 otherwise
+         * @return Number of successfully parsed elements
+         */
+        static std::size_t parseMany( std::span<const std::string_view> inputs,
+            std::span<DateTimeOffset> results,
+            std::span<std::uint8_t> ok ) noexcept;
+
         /**
          * @brief Create from Epoch timestamp seconds with UTC offset
          * @param seconds The number of seconds since Unix epoch (January 1, 1970 00:00:00 UTC)
          * @return DateTimeOffset representing the specified Epoch timestamp in UTC (offset = 00:00:00)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] static DateTimeOffset fromEpochSeconds( std::int64_t seconds ) noexcept;
+        [[nodiscard]] inline static constexpr DateTimeOffset fromEpochSeconds( std::int64_t seconds ) noexcept;
 
         /**
          * @brief Create from Epoch timestamp milliseconds with UTC offset
@@ -781,7 +941,8 @@ namespace nfx::time
          * @return DateTimeOffset representing the specified Epoch timestamp in UTC (offset = 00:00:00)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] static DateTimeOffset fromEpochMilliseconds( std::int64_t milliseconds ) noexcept;
+        [[nodiscard]] inline static constexpr DateTimeOffset fromEpochMilliseconds(
+            std::int64_t milliseconds ) noexcept;
 
         /**
          * @brief Create DateTimeOffset from Windows FILETIME format
@@ -791,7 +952,7 @@ namespace nfx::time
          * @return DateTimeOffset representing the same instant in UTC (offset = 00:00:00)
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] static DateTimeOffset fromFILETIME( std::int64_t FILETIME ) noexcept;
+        [[nodiscard]] inline static constexpr DateTimeOffset fromFILETIME( std::int64_t FILETIME ) noexcept;
 
     private:
         /** @brief Local date and time */
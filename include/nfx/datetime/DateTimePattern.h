@@ -0,0 +1,400 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DateTimePattern.h
+ * @brief Custom fixed-width date/time patterns compiled at compile time or once at runtime
+ * @details Formats and parses layouts outside DateTime::Format, such as "dd/MM/yyyy HH:mm:ss.fff"
+ *          or "yyyyMMdd-HHmmss". A pattern is compiled into a literal skeleton and a list of
+ *          fixed-position fields, so formatting copies the skeleton and writes digits in place
+ *          and parsing checks the length, compares literals and decodes digits at known offsets.
+ *
+ * @section pattern_syntax Pattern syntax
+ *
+ * @code
+ * ┌────────────┬──────────────────────────────────────────────────────────┐
+ * │  yyyy      │  Four-digit year                                         │
+ * │  MM / dd   │  Two-digit month / day                                   │
+ * │  HH        │  Two-digit hour (00-23)                                  │
+ * │  mm / ss   │  Two-digit minute / second                               │
+ * │  f..fffffff│  Fraction of a second, 1 to 7 digits (truncated)         │
+ * │  K         │  "Z" for DateTime, "±HH:MM" for DateTimeOffset           │
+ * │            │  (a trailing K also parses "Z" as +00:00)                │
+ * │  zzz       │  "±HH:MM" (DateTime writes +00:00, parsing converts      │
+ * │            │  to UTC)                                                 │
+ * │  'text'    │  Quoted literal (letters allowed)                        │
+ * │  other     │  Non-letter characters are copied as is                  │
+ * └────────────┴──────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @section pattern_usage Usage
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────────┐
+ * │  // Compile time: typos are compile errors, no runtime interpretation    │
+ * │  auto text = format<"dd/MM/yyyy HH:mm:ss.fff">( dt );                    │
+ * │  DateTime parsed;                                                        │
+ * │  bool ok = tryParse<"yyyyMMdd-HHmmss">( "20240309-070503", parsed );     │
+ * │                                                                          │
+ * │  // Runtime (e.g. from configuration): compiled once, reused             │
+ * │  auto pattern = DateTimePattern::compile( config.timestampPattern );     │
+ * │  if( pattern ) { pattern->tryParse( field, parsed ); }                   │
+ * └──────────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note Missing date fields default to 0001-01-01 and missing time fields to zero when parsing.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "nfx/detail/datetime/Pattern.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // PatternString
+    //=====================================================================
+
+    /**
+     * @brief Pattern string literal usable as a template argument
+     * @details Constructed only in constant expressions; an invalid pattern fails to compile.
+     * @tparam N Literal size including the null terminator
+     */
+    template <std::size_t N>
+    struct PatternString
+    {
+        /**
+         * @brief Construct from a string literal
+         * @param pattern Pattern literal
+         * @throws std::invalid_argument at compile time if the pattern is invalid
+         */
+        consteval PatternString( const char ( &pattern )[N] )
+        {
+            for( std::size_t i{ 0 }; i < N; ++i )
+            {
+                value[i] = pattern[i];
+            }
+
+            if( !detail::isValidPattern( view() ) || detail::maxPatternOutputLength( N - 1 ) > 255 )
+            {
+                throw std::invalid_argument{ "Invalid DateTime pattern" };
+            }
+        }
+
+        /**
+         * @brief Get the pattern text
+         * @return Pattern without the null terminator
+         */
+        [[nodiscard]] constexpr std::string_view view() const noexcept
+        {
+            return { value, N - 1 };
+        }
+
+        /** @brief Pattern characters (public for use as a structural template argument) */
+        char value[N]{};
+    };
+
+    //=====================================================================
+    // FixedPattern class
+    //=====================================================================
+
+    /**
+     * @brief Pattern compiled at compile time
+     * @details Every field position is a constant; format and parse expand into straight-line
+     *          code with no pattern interpretation at runtime.
+     * @tparam Pattern Pattern literal (see @ref pattern_syntax)
+     */
+    template <PatternString Pattern>
+    class FixedPattern final
+    {
+        static constexpr std::size_t CAPACITY{ detail::maxPatternOutputLength( Pattern.view().size() ) };
+
+        static constexpr auto s_utcProgram{ detail::compilePattern<CAPACITY, CAPACITY>( Pattern.view(), false ) };
+        static constexpr auto s_offsetProgram{ detail::compilePattern<CAPACITY, CAPACITY>( Pattern.view(), true ) };
+
+        static_assert( s_utcProgram.valid && s_offsetProgram.valid, "Invalid DateTime pattern" );
+
+    public:
+        //----------------------------------------------
+        // Constants
+        //----------------------------------------------
+
+        /** @brief Length of a formatted DateTime */
+        static constexpr std::size_t LENGTH{ s_utcProgram.length };
+
+        /** @brief Length of a formatted DateTimeOffset */
+        static constexpr std::size_t OFFSET_LENGTH{ s_offsetProgram.length };
+
+        //----------------------------------------------
+        // Formatting
+        //----------------------------------------------
+
+        /**
+         * @brief Format a DateTime into a caller-provided buffer
+         * @param value Value to format
+         * @param buffer Destination buffer
+         * @param capacity Size of the destination buffer (LENGTH is sufficient)
+         * @return Number of characters written, or 0 if the buffer is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static inline std::size_t formatTo(
+            const DateTime& value, char* buffer, std::size_t capacity ) noexcept;
+
+        /**
+         * @brief Format a DateTimeOffset into a caller-provided buffer
+         * @param value Value to format
+         * @param buffer Destination buffer
+         * @param capacity Size of the destination buffer (OFFSET_LENGTH is sufficient)
+         * @return Number of characters written, or 0 if the buffer is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static inline std::size_t formatTo(
+            const DateTimeOffset& value, char* buffer, std::size_t capacity ) noexcept;
+
+        /**
+         * @brief Format a DateTime into a string
+         * @param value Value to format
+         * @return Formatted text
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static inline std::string format( const DateTime& value );
+
+        /**
+         * @brief Format a DateTimeOffset into a string
+         * @param value Value to format
+         * @return Formatted text
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static inline std::string format( const DateTimeOffset& value );
+
+        //----------------------------------------------
+        // Parsing
+        //----------------------------------------------
+
+        /**
+         * @brief Parse a DateTime laid out exactly as the pattern
+         * @param text Input text
+         * @param result Receives the parsed value (UTC; a zzz offset is subtracted)
+         * @return true if the text matches the pattern and holds a valid date and time
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static inline bool tryParse( std::string_view text, DateTime& result ) noexcept;
+
+        /**
+         * @brief Parse a DateTimeOffset laid out exactly as the pattern
+         * @param text Input text
+         * @param result Receives the parsed value (offset +00:00 if the pattern has none)
+         * @return true if the text matches the pattern and holds a valid date, time and offset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static inline bool tryParse( std::string_view text, DateTimeOffset& result ) noexcept;
+
+    private:
+        template <const auto& Program>
+        static inline void writeFields(
+            char* buffer, const DateTime::Components& components, std::int32_t offsetMinutes ) noexcept;
+
+        template <const auto& Program>
+        [[nodiscard]] static inline bool readFields(
+            std::string_view text, detail::PatternFields& fields ) noexcept;
+    };
+
+    //=====================================================================
+    // Compile-time pattern functions
+    //=====================================================================
+
+    /**
+     * @brief Format a DateTime or DateTimeOffset with a compile-time pattern
+     * @tparam Pattern Pattern literal (e.g. format<"dd/MM/yyyy HH:mm">( value ))
+     * @param value Value to format
+     * @return Formatted text
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    template <PatternString Pattern, typename T>
+        requires( std::same_as<T, DateTime> || std::same_as<T, DateTimeOffset> )
+    [[nodiscard]] inline std::string format( const T& value );
+
+    /**
+     * @brief Format a DateTime or DateTimeOffset with a compile-time pattern into a buffer
+     * @tparam Pattern Pattern literal
+     * @param value Value to format
+     * @param buffer Destination span
+     * @return Number of characters written, or 0 if the span is too small
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    template <PatternString Pattern, typename T>
+        requires( std::same_as<T, DateTime> || std::same_as<T, DateTimeOffset> )
+    [[nodiscard]] inline std::size_t formatTo( const T& value, std::span<char> buffer ) noexcept;
+
+    /**
+     * @brief Parse a DateTime or DateTimeOffset with a compile-time pattern
+     * @tparam Pattern Pattern literal
+     * @param text Input text
+     * @param result Receives the parsed value
+     * @return true if the text matches the pattern
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    template <PatternString Pattern, typename T>
+        requires( std::same_as<T, DateTime> || std::same_as<T, DateTimeOffset> )
+    [[nodiscard]] inline bool tryParse( std::string_view text, T& result ) noexcept;
+
+    //=====================================================================
+    // DateTimePattern class
+    //=====================================================================
+
+    /**
+     * @brief Pattern compiled once at runtime
+     * @details For patterns known only at runtime (configuration, schema metadata). compile()
+     *          does the tokenizing and layout work once; the resulting program is stored inline
+     *          (no allocation) and may be copied and shared between threads.
+     */
+    class DateTimePattern final
+    {
+    public:
+        //----------------------------------------------
+        // Constants
+        //----------------------------------------------
+
+        /** @brief Maximum formatted length supported by a runtime pattern */
+        static constexpr std::size_t MAX_LENGTH{ 64 };
+
+        //----------------------------------------------
+        // Static factory methods
+        //----------------------------------------------
+
+        /**
+         * @brief Compile a pattern
+         * @param pattern Pattern text (see @ref pattern_syntax)
+         * @return Compiled pattern, or std::nullopt if the pattern is invalid or its output
+         *         exceeds MAX_LENGTH
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static std::optional<DateTimePattern> compile( std::string_view pattern ) noexcept;
+
+        //----------------------------------------------
+        // Property accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the length of a formatted DateTime
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t length() const noexcept;
+
+        /**
+         * @brief Get the length of a formatted DateTimeOffset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t offsetLength() const noexcept;
+
+        //----------------------------------------------
+        // Formatting
+        //----------------------------------------------
+
+        /**
+         * @brief Format a DateTime into a caller-provided buffer
+         * @param value Value to format
+         * @param buffer Destination buffer
+         * @param capacity Size of the destination buffer (length() is sufficient)
+         * @return Number of characters written, or 0 if the buffer is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::size_t formatTo( const DateTime& value, char* buffer, std::size_t capacity ) const noexcept;
+
+        /**
+         * @brief Format a DateTimeOffset into a caller-provided buffer
+         * @param value Value to format
+         * @param buffer Destination buffer
+         * @param capacity Size of the destination buffer (offsetLength() is sufficient)
+         * @return Number of characters written, or 0 if the buffer is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::size_t formatTo(
+            const DateTimeOffset& value, char* buffer, std::size_t capacity ) const noexcept;
+
+        /**
+         * @brief Format a DateTime into a string
+         * @param value Value to format
+         * @return Formatted text
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::string format( const DateTime& value ) const;
+
+        /**
+         * @brief Format a DateTimeOffset into a string
+         * @param value Value to format
+         * @return Formatted text
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::string format( const DateTimeOffset& value ) const;
+
+        //----------------------------------------------
+        // Parsing
+        //----------------------------------------------
+
+        /**
+         * @brief Parse a DateTime laid out exactly as the pattern
+         * @param text Input text
+         * @param result Receives the parsed value (UTC; a zzz offset is subtracted)
+         * @return true if the text matches the pattern and holds a valid date and time
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] bool tryParse( std::string_view text, DateTime& result ) const noexcept;
+
+        /**
+         * @brief Parse a DateTimeOffset laid out exactly as the pattern
+         * @param text Input text
+         * @param result Receives the parsed value (offset +00:00 if the pattern has none)
+         * @return true if the text matches the pattern and holds a valid date, time and offset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] bool tryParse( std::string_view text, DateTimeOffset& result ) const noexcept;
+
+    private:
+        using Program = detail::PatternProgram<MAX_LENGTH, MAX_LENGTH>;
+
+        /** @brief Construct from compiled programs (see compile()) */
+        DateTimePattern( const Program& utcProgram, const Program& offsetProgram ) noexcept;
+
+        /** @brief Program used for DateTime values */
+        Program m_utcProgram;
+
+        /** @brief Program used for DateTimeOffset values */
+        Program m_offsetProgram;
+    };
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/DateTimePattern.inl"
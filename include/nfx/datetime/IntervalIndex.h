@@ -0,0 +1,202 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file IntervalIndex.h
+ * @brief Static overlap-query index over sets of DateTimeInterval values
+ * @details IntervalIndex is built once from a large set of intervals and answers stabbing
+ *          (which intervals contain an instant) and overlap (which intervals share an instant
+ *          with a query interval) queries in O(log n + k) instead of a linear scan. coalesce()
+ *          merges overlapping and adjacent intervals into a disjoint, sorted set.
+ *
+ * @section interval_index_layout Layout
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  intervals sorted by (start, end) ──► positions 0 .. n-1             │
+ * │  implicit binary tree over positions, each node = max end below it   │
+ * │                                                                      │
+ * │  overlap [qs, qe):  positions with start < qe  (binary search)       │
+ * │                     descend only into nodes with max end > qs        │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note Empty intervals are dropped at construction: they contain no instant and overlap
+ *       nothing, so no query reports them.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "DateTime.h"
+#include "DateTimeInterval.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // IntervalIndex class
+    //=====================================================================
+
+    /**
+     * @brief Immutable augmented interval tree in array form
+     * @details Query results identify intervals by their position in the span the index was
+     *          built from, so callers can map hits back to their own records. Instances are
+     *          immutable after construction and can be queried concurrently.
+     */
+    class IntervalIndex final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Construct an empty index */
+        IntervalIndex() = default;
+
+        /**
+         * @brief Bulk-build from intervals in any order
+         * @param intervals Intervals to index (copied)
+         * @throws std::bad_alloc if the index cannot be allocated
+         */
+        explicit IntervalIndex( std::span<const DateTimeInterval> intervals );
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the number of indexed (non-empty) intervals
+         * @return Interval count
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t size() const noexcept;
+
+        /**
+         * @brief Get the indexed intervals
+         * @return Non-empty intervals sorted by start, then end
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::span<const DateTimeInterval> intervals() const noexcept;
+
+        //----------------------------------------------
+        // Queries
+        //----------------------------------------------
+
+        /**
+         * @brief Visit every interval containing an instant
+         * @param instant Instant to stab
+         * @param visitor Called as visitor(interval, index) in ascending order of start, where
+         *                index is the interval's position in the construction span
+         */
+        template <typename Visitor>
+        inline void forEachStabbing( const DateTime& instant, Visitor&& visitor ) const;
+
+        /**
+         * @brief Visit every interval overlapping a query interval
+         * @param query Interval to intersect with (an empty query overlaps nothing)
+         * @param visitor Called as visitor(interval, index) in ascending order of start, where
+         *                index is the interval's position in the construction span
+         */
+        template <typename Visitor>
+        inline void forEachOverlapping( const DateTimeInterval& query, Visitor&& visitor ) const;
+
+        /**
+         * @brief Find the intervals containing an instant
+         * @param instant Instant to stab
+         * @return Construction-span positions of the matches, in ascending order of start
+         * @throws std::bad_alloc if the result cannot be allocated
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::vector<std::size_t> stabbing( const DateTime& instant ) const;
+
+        /**
+         * @brief Find the intervals overlapping a query interval
+         * @param query Interval to intersect with
+         * @return Construction-span positions of the matches, in ascending order of start
+         * @throws std::bad_alloc if the result cannot be allocated
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::vector<std::size_t> overlapping( const DateTimeInterval& query ) const;
+
+        /**
+         * @brief Find every pair of indexed intervals that overlap each other
+         * @details A single sweep over the sorted intervals, O(n + k) for k pairs.
+         * @return Pairs of construction-span positions, each pair once (first starts no later)
+         * @throws std::bad_alloc if the result cannot be allocated
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::vector<std::pair<std::size_t, std::size_t>> overlappingPairs() const;
+
+        /**
+         * @brief Merge the indexed intervals into a disjoint set
+         * @return Coalesced intervals, see coalesce()
+         * @throws std::bad_alloc if the result cannot be allocated
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::vector<DateTimeInterval> coalesced() const;
+
+    private:
+        /**
+         * @brief Visit the intervals with start < endTicks and end > startTicks
+         * @param startTicks Exclusive lower bound on interval ends
+         * @param endTicks Exclusive upper bound on interval starts
+         * @param visitor Called as visitor(interval, index)
+         */
+        template <typename Visitor>
+        inline void visit( std::int64_t startTicks, std::int64_t endTicks, Visitor& visitor ) const;
+
+        /**
+         * @brief Count the intervals starting before a tick
+         * @param ticks Exclusive bound
+         * @return Number of sorted positions with start < ticks
+         */
+        [[nodiscard]] std::size_t countStartingBefore( std::int64_t ticks ) const noexcept;
+
+        std::vector<DateTimeInterval> m_intervals; ///< Non-empty intervals sorted by (start, end)
+        std::vector<std::size_t> m_indices;        ///< Construction-span position of each sorted interval
+        std::vector<std::int64_t> m_maxEnds;       ///< Heap-ordered tree of max end ticks; leaves at m_leafCount
+        std::size_t m_leafCount{ 0 };              ///< Number of leaves (power of two, at least size())
+    };
+
+    //=====================================================================
+    // Coalescing
+    //=====================================================================
+
+    /**
+     * @brief Merge overlapping and adjacent intervals
+     * @param intervals Intervals in any order
+     * @return Disjoint, non-adjacent, non-empty intervals sorted by start covering exactly the
+     *         instants of the input
+     * @throws std::bad_alloc if the result cannot be allocated
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] std::vector<DateTimeInterval> coalesce( std::span<const DateTimeInterval> intervals );
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/IntervalIndex.inl"
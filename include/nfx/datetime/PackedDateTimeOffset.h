@@ -0,0 +1,194 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PackedDateTimeOffset.h
+ * @brief 8-byte DateTimeOffset representation ordered by a single integer compare
+ * @details Stores the UTC instant and the offset in one 64-bit unsigned integer, UTC first, so
+ *          arrays of values take half the memory of DateTimeOffset and compare, sort and join
+ *          with plain integer comparisons and no per-comparison utcTicks() computation.
+ *
+ * @section packed_layout Layout
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  bit 63                                     bit 12 bit 11      bit 0 │
+ * │  ┌────────────────────────────────────────────┬──────────────────┐   │
+ * │  │ UTC milliseconds + 1 day (52 bits)         │ offset min + 2048│   │
+ * │  └────────────────────────────────────────────┴──────────────────┘   │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note A full-precision instant (62 bits of 100-nanosecond ticks) and an offset (12 bits) do
+ *       not fit in 64 bits, so the packed form keeps millisecond precision: values whose UTC
+ *       instant is a whole millisecond and whose offset is a whole minute (every ISO 8601
+ *       offset) round-trip exactly, see isRepresentable(). Finer ticks are truncated toward
+ *       negative infinity and offset seconds toward zero.
+ */
+
+#pragma once
+
+#include <compare>
+#include <cstdint>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // PackedDateTimeOffset class
+    //=====================================================================
+
+    /**
+     * @brief DateTimeOffset packed into 8 bytes, ordered by UTC instant then offset
+     * @details Trivially copyable. Unlike DateTimeOffset, whose == and <=> compare the instant
+     *          only, equality is exact and values with the same instant are ordered by offset,
+     *          giving a strong order that agrees with integer comparison of raw().
+     */
+    class PackedDateTimeOffset final
+    {
+    public:
+        //----------------------------------------------
+        // Constants
+        //----------------------------------------------
+
+        /** @brief Ticks per unit of the packed instant (1 millisecond) */
+        static constexpr std::int64_t TICKS_PER_UNIT{ constants::TICKS_PER_MILLISECOND };
+
+        /** @brief Number of low bits holding the offset */
+        static constexpr std::int32_t OFFSET_BITS{ 12 };
+
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Default constructor (0001-01-01T00:00:00+00:00) */
+        inline constexpr PackedDateTimeOffset() noexcept;
+
+        /**
+         * @brief Pack a DateTimeOffset
+         * @param value Value to pack (sub-millisecond ticks are truncated, offsets clamped to ±24:00)
+         */
+        explicit inline constexpr PackedDateTimeOffset( const DateTimeOffset& value ) noexcept;
+
+        //----------------------------------------------
+        // Comparison
+        //----------------------------------------------
+
+        /**
+         * @brief Three-way comparison (UTC instant, then offset)
+         * @param other Value to compare with
+         * @return Ordering of the raw values
+         */
+        constexpr std::strong_ordering operator<=>( const PackedDateTimeOffset& other ) const noexcept = default;
+
+        /**
+         * @brief Exact equality (same instant and same offset)
+         * @param other Value to compare with
+         * @return true if both raw values are equal
+         */
+        constexpr bool operator==( const PackedDateTimeOffset& other ) const noexcept = default;
+
+        //----------------------------------------------
+        // Property accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the UTC instant in ticks (a whole number of milliseconds)
+         * @return UTC ticks
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr std::int64_t utcTicks() const noexcept;
+
+        /**
+         * @brief Get the offset from UTC in minutes
+         * @return Offset in minutes (positive for East)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr std::int32_t totalOffsetMinutes() const noexcept;
+
+        /**
+         * @brief Get the offset from UTC
+         * @return Offset as a TimeSpan
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr TimeSpan offset() const noexcept;
+
+        /**
+         * @brief Get the packed representation
+         * @return Raw 64-bit value (see @ref packed_layout)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr std::uint64_t raw() const noexcept;
+
+        //----------------------------------------------
+        // Conversion
+        //----------------------------------------------
+
+        /**
+         * @brief Unpack to a DateTimeOffset
+         * @return Value with the same instant and offset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline constexpr DateTimeOffset toDateTimeOffset() const noexcept;
+
+        //----------------------------------------------
+        // Static methods
+        //----------------------------------------------
+
+        /**
+         * @brief Check whether a value packs without loss
+         * @param value Value to check
+         * @return true if the UTC instant is a whole millisecond and the offset a whole minute
+         *         within ±24:00
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline static constexpr bool isRepresentable( const DateTimeOffset& value ) noexcept;
+
+        /**
+         * @brief Rebuild a value from its raw representation
+         * @param raw Value previously returned by raw()
+         * @return Packed value
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline static constexpr PackedDateTimeOffset fromRaw( std::uint64_t raw ) noexcept;
+
+    private:
+        /** @brief Bias keeping UTC instants up to one day before 0001-01-01 non-negative */
+        static constexpr std::int64_t UNIT_BIAS{ constants::TICKS_PER_DAY / TICKS_PER_UNIT };
+
+        /** @brief Bias keeping offsets non-negative */
+        static constexpr std::int32_t OFFSET_BIAS{ 1 << ( OFFSET_BITS - 1 ) };
+
+        /** @brief Largest packed offset in minutes */
+        static constexpr std::int32_t MAX_OFFSET_MINUTES{ 24 * 60 };
+
+        /** @brief UTC milliseconds (biased) above OFFSET_BITS bits of offset minutes (biased) */
+        std::uint64_t m_value;
+    };
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/PackedDateTimeOffset.inl"
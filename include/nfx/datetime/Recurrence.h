@@ -0,0 +1,350 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Recurrence.h
+ * @brief Recurring schedules compiled from cron expressions or RFC 5545 RRULEs
+ * @details A Recurrence is a set of calendar field masks (seconds, minutes, hours, days of the
+ *          month, weekdays with optional ordinals, months) plus an optional repeat interval
+ *          anchored at a start time. nextAfter() walks the calendar from the coarsest field to
+ *          the finest, jumping straight to the next matching month, day, hour, minute and
+ *          second; its cost depends on how many months and days fail to match, never on the
+ *          number of occurrences skipped. occurrences() exposes the same search as a lazy
+ *          forward range that composes with std::views.
+ *
+ * @section recurrence_cron Cron expressions
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────────┐
+ * │  [second] minute hour day-of-month month day-of-week                     │
+ * │                                                                          │
+ * │  *  a  a-b  a,b,...        any, value, range, list                       │
+ * │  a-b/n  a/n  * then /n     steps over a range, from a, over all values   │
+ * │  JAN-DEC, SUN-SAT (0-7, 0 and 7 are Sunday)   names (case-insensitive)   │
+ * │  L  L-n          (day of month) last day, n days before the last day     │
+ * │  5L  5#2         (day of week) last Friday, second Friday of the month   │
+ * │  ?               same as * in the day fields                             │
+ * │  @yearly @monthly @weekly @daily @hourly                                 │
+ * │                                                                          │
+ * │  When both day fields are restricted a day matches if either matches.    │
+ * └──────────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @section recurrence_rrule RRULE subset
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────────┐
+ * │  FREQ      SECONDLY, MINUTELY, HOURLY, DAILY, WEEKLY, MONTHLY, YEARLY    │
+ * │  INTERVAL  every n-th period, counted from the start time                │
+ * │  COUNT / UNTIL   (one or the other) UNTIL as YYYYMMDD[THHMMSS[Z]]        │
+ * │  BYMONTH, BYMONTHDAY (-31..31), BYDAY (MO..SU, ordinals -5..5 in         │
+ * │  MONTHLY and YEARLY with BYMONTH), BYHOUR, BYMINUTE, BYSECOND, WKST      │
+ * │                                                                          │
+ * │  BYYEARDAY, BYWEEKNO and BYSETPOS are not supported.                     │
+ * └──────────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @section recurrence_usage Usage
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────────┐
+ * │  auto weekdays = Recurrence::fromCron( "30 9 * * MON-FRI" );             │
+ * │  auto next = weekdays->nextAfter( DateTimeOffset::now(), *paris );       │
+ * │                                                                          │
+ * │  auto lastFriday = Recurrence::fromRRule(                                │
+ * │      "FREQ=MONTHLY;BYDAY=-1FR;BYHOUR=17;BYMINUTE=0", start );            │
+ * │  for( const auto& t : lastFriday->occurrences( start )                   │
+ * │                           | std::views::take( 12 ) ) { ... }             │
+ * └──────────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note Occurrences have one-second resolution. Times are wall-clock times: DateTime queries are
+ *       evaluated as given, DateTimeOffset queries in the value's own offset or in a TimeZone.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "TimeZone.h"
+
+namespace nfx::time
+{
+    template <typename T>
+    class RecurrenceView;
+
+    //=====================================================================
+    // Recurrence class
+    //=====================================================================
+
+    /**
+     * @brief Compiled recurring schedule
+     * @details Immutable after construction; copies are cheap (no allocation) and may be shared
+     *          between threads.
+     */
+    class Recurrence final
+    {
+    public:
+        //----------------------------------------------
+        // Static factory methods
+        //----------------------------------------------
+
+        /**
+         * @brief Compile a cron expression
+         * @param expression Five fields (minute to day of week), six fields (leading seconds) or
+         *        a macro (see @ref recurrence_cron)
+         * @return Compiled schedule, or std::nullopt if the expression is invalid
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static std::optional<Recurrence> fromCron( std::string_view expression ) noexcept;
+
+        /**
+         * @brief Compile an RFC 5545 recurrence rule
+         * @param rule Rule text, with or without the "RRULE:" prefix (see @ref recurrence_rrule)
+         * @param start Start time (DTSTART); fields not given by the rule default to its fields
+         *        and no occurrence precedes it
+         * @return Compiled schedule, or std::nullopt if the rule is invalid or uses an
+         *         unsupported part
+         * @details A COUNT rule is resolved once here to the time of its last occurrence, which
+         *          costs COUNT searches; every later query is independent of COUNT.
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static std::optional<Recurrence> fromRRule(
+            std::string_view rule, const DateTime& start ) noexcept;
+
+        //----------------------------------------------
+        // Occurrence search
+        //----------------------------------------------
+
+        /**
+         * @brief Find the first occurrence strictly after a wall-clock time
+         * @param after Reference time
+         * @return Next occurrence, or std::nullopt if the schedule has ended
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::optional<DateTime> nextAfter( const DateTime& after ) const noexcept;
+
+        /**
+         * @brief Find the first occurrence strictly after a time, in that time's offset
+         * @param after Reference time; the schedule is evaluated on its local date and time
+         * @return Next occurrence with the same offset, or std::nullopt if the schedule has ended
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::optional<DateTimeOffset> nextAfter( const DateTimeOffset& after ) const noexcept;
+
+        /**
+         * @brief Find the first occurrence strictly after an instant, in a zone's local time
+         * @param after Reference instant
+         * @param zone Zone whose local time the schedule follows
+         * @return Next occurrence in the zone's local time and offset, or std::nullopt if the
+         *         schedule has ended
+         * @details A local time skipped by a forward transition is taken with the offset in
+         *          effect before the gap (it is shifted forward by the gap length); a local time
+         *          repeated by a backward transition occurs once, at its first instance.
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::optional<DateTimeOffset> nextAfter(
+            const DateTimeOffset& after, const TimeZone& zone ) const noexcept;
+
+        //----------------------------------------------
+        // Ranges
+        //----------------------------------------------
+
+        /**
+         * @brief Lazy range of the occurrences strictly after a wall-clock time
+         * @param after Reference time
+         * @return Forward range of DateTime (unbounded unless the schedule ends)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline RecurrenceView<DateTime> occurrences( const DateTime& after ) const noexcept;
+
+        /**
+         * @brief Lazy range of the occurrences strictly after a time, in that time's offset
+         * @param after Reference time
+         * @return Forward range of DateTimeOffset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline RecurrenceView<DateTimeOffset> occurrences( const DateTimeOffset& after ) const noexcept;
+
+        /**
+         * @brief Lazy range of the occurrences strictly after an instant, in a zone's local time
+         * @param after Reference instant
+         * @param zone Zone whose local time the schedule follows (must outlive the range)
+         * @return Forward range of DateTimeOffset
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline RecurrenceView<DateTimeOffset> occurrences(
+            const DateTimeOffset& after, const TimeZone& zone ) const noexcept;
+
+    private:
+        /** @brief Repeat period (RRULE FREQ), finest first */
+        enum class Frequency : std::uint8_t
+        {
+            Secondly,
+            Minutely,
+            Hourly,
+            Daily,
+            Weekly,
+            Monthly,
+            Yearly
+        };
+
+        /** @brief Construct an empty schedule (filled in by the factories) */
+        Recurrence() noexcept = default;
+
+        /**
+         * @brief Find the first occurrence at or after a tick count, ignoring the end time
+         * @param fromTicks Ticks on a whole second
+         * @return Ticks of the occurrence, or -1 if there is none before the end of year 9999
+         */
+        [[nodiscard]] std::int64_t nextTicks( std::int64_t fromTicks ) const noexcept;
+
+        /** @brief Mask of the matching days of a month (bit 0 is the first day) */
+        [[nodiscard]] std::uint32_t dayMask(
+            std::int32_t year, std::int32_t month, std::int64_t firstDay ) const noexcept;
+
+        std::uint64_t m_seconds{};                   ///< Matching seconds (bit n is second n)
+        std::uint64_t m_minutes{};                   ///< Matching minutes (bit n is minute n)
+        std::uint32_t m_hours{};                     ///< Matching hours (bit n is hour n)
+        std::uint32_t m_monthDays{};                 ///< Matching days of the month (bit 0 is day 1)
+        std::uint32_t m_lastMonthDays{};             ///< Days counted from the end (bit 0 is the last day)
+        std::uint16_t m_months{};                    ///< Matching months (bit 0 is January)
+        std::uint8_t m_weekdays{};                   ///< Weekdays matching every week (bit 0 is Sunday)
+        std::array<std::uint16_t, 7> m_ordinals{};   ///< Per weekday: bits 0-4 first to fifth, 5-9 last to fifth last
+        std::uint8_t m_ordinalWeekdays{};            ///< Weekdays with ordinals (bit 0 is Sunday)
+        bool m_hasMonthDayRule{};                    ///< Days of the month restrict the day
+        bool m_hasWeekdayRule{};                     ///< Weekdays restrict the day
+        bool m_dayUnion{};                           ///< Either day rule suffices (cron) instead of both (RRULE)
+        Frequency m_frequency{ Frequency::Secondly }; ///< Period the interval counts
+        std::int32_t m_weekStart{ 1 };               ///< First day of the week for weekly intervals (0=Sunday)
+        std::int64_t m_interval{ 1 };                ///< Every n-th period matches
+        std::int64_t m_anchor{};                     ///< Period index of the start time
+        std::int64_t m_startTicks{};                 ///< Earliest occurrence
+        std::int64_t m_endTicks{ constants::MAX_DATETIME_TICKS }; ///< Latest occurrence
+    };
+
+    //=====================================================================
+    // RecurrenceView class
+    //=====================================================================
+
+    /**
+     * @brief Lazy forward range of occurrences
+     * @details Holds a copy of the schedule; each increment performs one nextAfter() search.
+     *          Iterators refer to the view and must not outlive it.
+     * @tparam T DateTime or DateTimeOffset
+     */
+    template <typename T>
+    class RecurrenceView : public std::ranges::view_interface<RecurrenceView<T>>
+    {
+    public:
+        /** @brief Iterator over the occurrences */
+        class Iterator
+        {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+
+            /** @brief Construct an end iterator */
+            Iterator() noexcept = default;
+
+            /** @brief Get the current occurrence */
+            [[nodiscard]] T operator*() const noexcept { return *m_current; }
+
+            /** @brief Access the current occurrence */
+            [[nodiscard]] const T* operator->() const noexcept { return &*m_current; }
+
+            /** @brief Advance to the next occurrence */
+            inline Iterator& operator++() noexcept;
+
+            /** @brief Advance to the next occurrence (postfix) */
+            Iterator operator++( int ) noexcept
+            {
+                auto previous{ *this };
+                ++*this;
+
+                return previous;
+            }
+
+            /** @brief Compare positions */
+            [[nodiscard]] bool operator==( const Iterator& other ) const noexcept
+            {
+                return m_current == other.m_current;
+            }
+
+            /** @brief Check for the end of the schedule */
+            [[nodiscard]] bool operator==( std::default_sentinel_t ) const noexcept { return !m_current.has_value(); }
+
+        private:
+            friend class RecurrenceView;
+
+            Iterator( const RecurrenceView* view, std::optional<T> current ) noexcept
+                : m_view{ view },
+                  m_current{ current }
+            {
+            }
+
+            const RecurrenceView* m_view{};
+            std::optional<T> m_current;
+        };
+
+        /**
+         * @brief Construct from a schedule and a reference time
+         * @param recurrence Schedule to enumerate (copied)
+         * @param after Occurrences start strictly after this time
+         * @param zone Zone for DateTimeOffset local time, or nullptr to keep the offset of after
+         */
+        RecurrenceView( const Recurrence& recurrence, const T& after, const TimeZone* zone = nullptr ) noexcept
+            : m_recurrence{ recurrence },
+              m_after{ after },
+              m_zone{ zone }
+        {
+        }
+
+        /** @brief Get an iterator to the first occurrence */
+        [[nodiscard]] Iterator begin() const noexcept { return Iterator{ this, next( m_after ) }; }
+
+        /** @brief Get the end sentinel */
+        [[nodiscard]] std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    private:
+        [[nodiscard]] inline std::optional<T> next( const T& after ) const noexcept;
+
+        Recurrence m_recurrence;
+        T m_after;
+        const TimeZone* m_zone;
+    };
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/Recurrence.inl"
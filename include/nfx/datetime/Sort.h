@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Sort.h
+ * @brief Radix sort for DateTime, TimeSpan and PackedDateTimeOffset arrays
+ * @details Sorts contiguous arrays of 8-byte temporal values with a least-significant-digit
+ *          radix sort on their 64-bit keys: one read pass builds the histograms of all eight
+ *          byte digits, then each digit that is not shared by every key is scattered in turn.
+ *          Timestamps from one period share their high bytes, so a day of values typically
+ *          needs five passes instead of eight.
+ *
+ * @section radix_passes Passes
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  values ──► key = ticks ^ sign bit (raw() for PackedDateTimeOffset)  │
+ * │         ──► 8 histograms of 256 counts (single read pass)            │
+ * │         ──► for digit 0..7: skip if one bucket holds every value,    │
+ * │             else scatter values <-> scratch (stable)                 │
+ * │         ──► copy back if the result ended in scratch                 │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note The sort is stable and runs in O(n) time. Arrays of fewer than 256 values are sorted
+ *       with std::sort (equal keys are indistinguishable, so stability is unaffected).
+ */
+
+#pragma once
+
+#include <span>
+
+#include "DateTime.h"
+#include "PackedDateTimeOffset.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // Radix sort
+    //=====================================================================
+
+    /**
+     * @brief Sort values in ascending order
+     * @param values Values to sort in place
+     * @throws std::bad_alloc if the scratch buffer cannot be allocated
+     */
+    void radixSort( std::span<DateTime> values );
+
+    /** @copydoc radixSort(std::span<DateTime>) */
+    void radixSort( std::span<TimeSpan> values );
+
+    /**
+     * @brief Sort values in ascending order of instant, then offset
+     * @details Orders like PackedDateTimeOffset::operator<=>.
+     * @param values Values to sort in place
+     * @throws std::bad_alloc if the scratch buffer cannot be allocated
+     */
+    void radixSort( std::span<PackedDateTimeOffset> values );
+
+    /**
+     * @brief Sort values in ascending order using a caller-provided scratch buffer
+     * @details Does not allocate. Scratch contents are unspecified on return.
+     * @param values Values to sort in place
+     * @param scratch Buffer of at least values.size() elements (must not overlap values);
+     *                if it is smaller, std::sort is used instead
+     */
+    void radixSort( std::span<DateTime> values, std::span<DateTime> scratch ) noexcept;
+
+    /** @copydoc radixSort(std::span<DateTime>, std::span<DateTime>) */
+    void radixSort( std::span<TimeSpan> values, std::span<TimeSpan> scratch ) noexcept;
+
+    /** @copydoc radixSort(std::span<DateTime>, std::span<DateTime>) */
+    void radixSort( std::span<PackedDateTimeOffset> values, std::span<PackedDateTimeOffset> scratch ) noexcept;
+} // namespace nfx::time
@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Stats.h
+ * @brief Opt-in hot-path instrumentation: parser paths, time zone cache and formatting counts
+ * @details When the library is built with the NFX_DATETIME_ENABLE_STATS CMake option, parsers,
+ *          the system time zone offset cache and the named formatters bump per-thread counters
+ *          (a relaxed load and store on a thread-owned cache line, no shared writes). stats()
+ *          sums the counters of every live thread plus those of threads that have exited.
+ *          Without the option the counting sites compile to nothing and stats() returns zeros.
+ *
+ * @section stats_counters Counters
+ *
+ * @code
+ * ┌─────────────────────────────────────────────────────────────────────────┐
+ * │  fromString() / parseMany() / parsePrefix() / operator>> / string ctors │
+ * │      fixed-layout fast path ──► fastPath                                │
+ * │      flexible parser        ──► fallback                                │
+ * │      rejected               ──► failures                                │
+ * │  system offset lookup (now(), toLocalTime(), DateTimeOffset(DateTime))  │
+ * │      slot cached            ──► timezoneCacheHits                       │
+ * │      slot recomputed        ──► timezoneCacheMisses                     │
+ * │      outside the table      ──► timezoneLibraryCalls (localtime_r)      │
+ * │  formatTo() / toString() / std::format                                  │
+ * │      per DateTime::Format   ──► formatCalls[format]                     │
+ * │      TimeSpan               ──► timeSpanFormatCalls                     │
+ * └─────────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note Counts are approximate while other threads run: stats() does not stop writers, and an
+ *       increment concurrent with resetStats() may be counted on either side of the reset.
+ *       Compile-time parsing is not counted.
+ *       stats() is part of the compiled library and not available from the header-only target.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "DateTime.h"
+#include "nfx/detail/datetime/Stats.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // Instrumentation snapshot
+    //=====================================================================
+
+    /** @brief True when the library counts hot-path events (NFX_DATETIME_ENABLE_STATS) */
+#if defined( NFX_DATETIME_ENABLE_STATS )
+    inline constexpr bool STATS_ENABLED{ true };
+#else
+    inline constexpr bool STATS_ENABLED{ false };
+#endif
+
+    /** @brief Outcome counts of one parser */
+    struct ParseStats
+    {
+        /** @brief Inputs accepted by the fixed-layout fast path */
+        std::uint64_t fastPath{ 0 };
+
+        /** @brief Inputs accepted by the flexible fallback parser */
+        std::uint64_t fallback{ 0 };
+
+        /** @brief Rejected inputs */
+        std::uint64_t failures{ 0 };
+
+        /**
+         * @brief Get the number of parse calls
+         * @return Sum of all outcomes
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] constexpr std::uint64_t total() const noexcept
+        {
+            return fastPath + fallback + failures;
+        }
+    };
+
+    /** @brief Snapshot of every instrumentation counter */
+    struct Stats
+    {
+        /** @brief DateTime string parsing */
+        ParseStats dateTime;
+
+        /** @brief DateTimeOffset string parsing */
+        ParseStats dateTimeOffset;
+
+        /** @brief TimeSpan string parsing (fast path: ISO 8601 durations, fallback: numeric seconds) */
+        ParseStats timeSpan;
+
+        /** @brief System time zone offset lookups served from the per-thread slot cache */
+        std::uint64_t timezoneCacheHits{ 0 };
+
+        /** @brief System time zone offset lookups that recomputed the offset */
+        std::uint64_t timezoneCacheMisses{ 0 };
+
+        /** @brief Misses outside the transition table, resolved through localtime_r */
+        std::uint64_t timezoneLibraryCalls{ 0 };
+
+        /** @brief DateTime and DateTimeOffset formatting calls, indexed by DateTime::Format */
+        std::array<std::uint64_t, detail::FORMAT_STAT_COUNT> formatCalls{};
+
+        /** @brief TimeSpan formatting calls */
+        std::uint64_t timeSpanFormatCalls{ 0 };
+
+        /**
+         * @brief Get the formatting calls of one format
+         * @param format Format to look up
+         * @return Number of DateTime and DateTimeOffset values formatted with it
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] constexpr std::uint64_t formatCount( DateTime::Format format ) const noexcept
+        {
+            return formatCalls[static_cast<std::size_t>( format )];
+        }
+    };
+
+    /**
+     * @brief Aggregate the counters of all threads
+     * @return Counters accumulated since process start or the last resetStats()
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] Stats stats() noexcept;
+
+    /**
+     * @brief Reset all counters to zero
+     * @details Live threads' counters are not written; the current values become the baseline
+     *          that stats() subtracts.
+     */
+    void resetStats() noexcept;
+} // namespace nfx::time
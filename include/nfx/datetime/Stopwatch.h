@@ -0,0 +1,162 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Stopwatch.h
+ * @brief Interval timer on a monotonic clock, reporting elapsed time as TimeSpan
+ * @details Measures elapsed time on a steady source instead of subtracting two
+ *          DateTime::utcNow() readings, which can jump with wall-clock (NTP) steps and cost a
+ *          full system clock query each. Start, stop and read are a single clock read each.
+ *
+ * @section stopwatch_usage Usage
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  auto watch{ Stopwatch::startNew() };                                │
+ * │  handle( request );                                                  │
+ * │  histogram.record( watch.elapsed() );     // TimeSpan, 100 ns ticks  │
+ * │                                                                      │
+ * │  auto timer{ TscStopwatch::startNew() };  // time-stamp counter      │
+ * │  for( auto& item : batch )                                           │
+ * │  {                                                                   │
+ * │      process( item );                                                │
+ * │      histogram.record( timer.lap() );      // back-to-back intervals │
+ * │  }                                                                   │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note A stopwatch is not synchronized; share results, not instances, across threads.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "Clock.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // BasicStopwatch class
+    //=====================================================================
+
+    /**
+     * @brief Accumulating interval timer
+     * @tparam Clock Steady source (SteadyClock or TscSteadyClock)
+     * @details Elapsed time accumulates over start()/stop() pairs until reset() or restart().
+     */
+    template <SteadyClockSource Clock = SteadyClock>
+    class BasicStopwatch final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Construct a stopped stopwatch with zero elapsed time */
+        constexpr BasicStopwatch() noexcept = default;
+
+        /**
+         * @brief Construct a running stopwatch
+         * @return Stopwatch started at the current clock reading
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline static BasicStopwatch startNew() noexcept;
+
+        //----------------------------------------------
+        // Control
+        //----------------------------------------------
+
+        /** @brief Start or resume measuring; no effect while running */
+        inline void start() noexcept;
+
+        /** @brief Stop measuring and keep the elapsed time; no effect while stopped */
+        inline void stop() noexcept;
+
+        /** @brief Stop and clear the elapsed time */
+        inline void reset() noexcept;
+
+        /** @brief Clear the elapsed time and start measuring */
+        inline void restart() noexcept;
+
+        /**
+         * @brief Read the elapsed time and restart from zero
+         * @details One clock read; consecutive laps cover the timeline without gaps.
+         * @return Elapsed time before the restart
+         */
+        inline TimeSpan lap() noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Check whether the stopwatch is measuring
+         * @return true between start() and stop()
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline bool isRunning() const noexcept;
+
+        /**
+         * @brief Get the total elapsed time
+         * @return Accumulated time, including the current run if running
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline TimeSpan elapsed() const noexcept;
+
+        /**
+         * @brief Get the total elapsed time in 100-nanosecond ticks
+         * @return elapsed().ticks()
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::int64_t elapsedTicks() const noexcept;
+
+    private:
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        /** @brief Clock reading at the last start, valid while running */
+        std::int64_t m_startTicks{ 0 };
+
+        /** @brief Elapsed ticks of completed runs */
+        std::int64_t m_accumulatedTicks{ 0 };
+
+        /** @brief Running state */
+        bool m_running{ false };
+    };
+
+    //=====================================================================
+    // Type aliases
+    //=====================================================================
+
+    /** @brief Stopwatch on std::chrono::steady_clock */
+    using Stopwatch = BasicStopwatch<SteadyClock>;
+
+    /** @brief Stopwatch on the invariant time-stamp counter */
+    using TscStopwatch = BasicStopwatch<TscSteadyClock>;
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/Stopwatch.inl"
@@ -103,9 +103,12 @@
 #include <compare>
 #include <cstdint>
 #include <format>
+#include <iterator>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace nfx::time
 {
@@ -154,8 +157,10 @@ namespace nfx::time
         /**
          * @brief Parse from ISO 8601 string
          * @param iso8601String ISO 8601 formatted string to parse
+         * @throws std::invalid_argument if the string is not a valid duration (a compile error
+         *         in constant expressions, where only ISO 8601 durations are accepted)
          */
-        explicit TimeSpan( std::string_view iso8601String );
+        inline explicit constexpr TimeSpan( std::string_view iso8601String );
 
         /** @brief Copy constructor */
         TimeSpan( const TimeSpan& ) = default;
@@ -343,7 +348,36 @@ namespace nfx::time
          * @return String representation in ISO 8601 duration format (e.g., "PT1H30M45S")
          * @note This function is marked [[nodiscard]] - the return value should not be ignored
          */
-        [[nodiscard]] std::string toString() const;
+        [[nodiscard]] inline std::string toString() const;
+
+        /**
+         * @brief Format ISO 8601 duration into a caller-provided buffer without allocating
+         * @details Writes exactly the characters produced by toString(), without a null terminator.
+         *          A capacity of constants::MAX_ISO8601_DURATION_LENGTH is sufficient for every value.
+         * @param buffer Destination buffer
+         * @param capacity Size of the destination buffer in characters
+         * @return Number of characters written, or 0 if the buffer is too small (buffer contents are then unspecified)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t formatTo( char* buffer, std::size_t capacity ) const noexcept;
+
+        /**
+         * @brief Format ISO 8601 duration into a caller-provided span without allocating
+         * @param buffer Destination span
+         * @return Number of characters written, or 0 if the span is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t formatTo( std::span<char> buffer ) const noexcept;
+
+        /**
+         * @brief Format ISO 8601 duration through an output iterator without allocating
+         * @tparam OutputIt Output iterator accepting char (e.g. std::back_inserter, std::format_context::iterator)
+         * @param out Destination iterator
+         * @return Iterator one past the last character written
+         */
+        template <typename OutputIt>
+            requires( !std::is_pointer_v<OutputIt> && std::output_iterator<OutputIt, char> )
+        inline OutputIt formatTo( OutputIt out ) const;
 
         //----------------------------------------------
         // String parsing
@@ -374,6 +408,32 @@ namespace nfx::time
          */
         [[nodiscard]] static std::optional<TimeSpan> fromString( std::string_view iso8601DurationString ) noexcept;
 
+        /**
+         * @brief Parse the longest duration at the start of a character range
+         * @details In the spirit of std::from_chars: the duration does not have to span the
+         *          whole range, so memory-mapped logs can be tokenized in place without slicing
+         *          a string_view to the exact extent first. Accepts the forms fromString() accepts
+         *          and leaves the first character after them unread (e.g. the comma in "PT1H30M,retry").
+         * @param first Start of the character range
+         * @param last End of the character range
+         * @param result Receives the parsed value on success (unchanged on failure)
+         * @return Pointer past the last consumed character, or first if no duration starts at first
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static const char* parsePrefix( const char* first, const char* last, TimeSpan& result ) noexcept;
+
+        /**
+         * @brief Parse a batch of ISO 8601 duration strings without throwing exceptions
+         * @details Processes min(inputs.size(), results.size(), ok.size()) elements.
+         * @param inputs ISO 8601 duration strings to parse
+         * @param results Receives the parsed values (zero for failed elements)
+         * @param ok Receives 1 for each successfully parsed element, 0 otherwise
+         * @return Number of successfully parsed elements
+         */
+        static std::size_t parseMany( std::span<const std::string_view> inputs,
+            std::span<TimeSpan> results,
+            std::span<std::uint8_t> ok ) noexcept;
+
         //----------------------------------------------
         // std::chrono interoperability
         //----------------------------------------------
@@ -0,0 +1,331 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimeSpanHistogram.h
+ * @brief Log-linear (HDR-style) latency histograms over TimeSpan ticks
+ * @details Values are counted in buckets whose width grows with magnitude: durations below
+ *          128 ticks (12.8 us) get one bucket per tick, and every further power of two is split
+ *          into 64 equal buckets. The relative error of any reported value is therefore at most
+ *          1/64 (1.6%) over the whole TimeSpan range, in a fixed 3712-bucket array.
+ *
+ * @section histogram_layout Bucket layout
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  ticks < 128             ──► index = ticks           (exact)         │
+ * │  2^(g+6) <= ticks < 2^(g+7), g = 1..56                               │
+ * │                          ──► index = 128 + 64 * (g - 1)              │
+ * │                                    + (ticks >> g) - 64               │
+ * │                              bucket width 2^g ticks                  │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @section histogram_threads Threads
+ *
+ * TimeSpanHistogram is a plain value with a single writer; histograms merge by adding
+ * buckets. ConcurrentTimeSpanHistogram gives each recording thread its own shard (written
+ * without read-modify-write instructions or locks) and merges the shards into a
+ * TimeSpanHistogram on snapshot().
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // TimeSpanHistogram class
+    //=====================================================================
+
+    /**
+     * @brief Mergeable latency histogram with bounded relative error
+     * @details Records non-negative durations (negative values count as zero). Percentiles
+     *          report the highest value of the selected bucket, clamped to the recorded
+     *          minimum and maximum, which are tracked exactly.
+     */
+    class TimeSpanHistogram final
+    {
+    public:
+        //----------------------------------------------
+        // Constants
+        //----------------------------------------------
+
+        /** @brief Bits of each value kept exactly (relative error 2^-(SUB_BUCKET_BITS - 1)) */
+        static constexpr unsigned SUB_BUCKET_BITS{ 7 };
+
+        /** @brief Number of exact buckets at the bottom of the range */
+        static constexpr std::size_t SUB_BUCKET_COUNT{ std::size_t{ 1 } << SUB_BUCKET_BITS };
+
+        /** @brief Buckets per power of two above the exact range */
+        static constexpr std::size_t HALF_SUB_BUCKET_COUNT{ SUB_BUCKET_COUNT / 2 };
+
+        /** @brief Total number of buckets, covering every non-negative 64-bit tick count */
+        static constexpr std::size_t BUCKET_COUNT{
+            SUB_BUCKET_COUNT + ( 63 - SUB_BUCKET_BITS ) * HALF_SUB_BUCKET_COUNT };
+
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Construct an empty histogram */
+        TimeSpanHistogram() noexcept = default;
+
+        //----------------------------------------------
+        // Recording
+        //----------------------------------------------
+
+        /**
+         * @brief Record one duration
+         * @param value Duration to count
+         */
+        inline void record( const TimeSpan& value ) noexcept;
+
+        /**
+         * @brief Record a duration several times
+         * @param value Duration to count
+         * @param count Number of occurrences
+         */
+        inline void record( const TimeSpan& value, std::uint64_t count ) noexcept;
+
+        /**
+         * @brief Add the counts of another histogram
+         * @param other Histogram to merge into this one
+         */
+        void merge( const TimeSpanHistogram& other ) noexcept;
+
+        /** @brief Remove all recorded values */
+        void reset() noexcept;
+
+        //----------------------------------------------
+        // Queries
+        //----------------------------------------------
+
+        /**
+         * @brief Get the number of recorded values
+         * @return Total count
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::uint64_t count() const noexcept;
+
+        /**
+         * @brief Get the smallest recorded value
+         * @return Exact minimum, or zero if empty
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline TimeSpan min() const noexcept;
+
+        /**
+         * @brief Get the largest recorded value
+         * @return Exact maximum, or zero if empty
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline TimeSpan max() const noexcept;
+
+        /**
+         * @brief Get the arithmetic mean of the recorded values
+         * @return Mean rounded to ticks, or zero if empty
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] TimeSpan mean() const noexcept;
+
+        /**
+         * @brief Get the value at a percentile
+         * @param percentile Percentile in [0, 100]; 0 gives min(), 100 gives max()
+         * @return Highest value of the bucket holding the requested rank, or zero if empty
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] TimeSpan percentile( double percentile ) const noexcept;
+
+        /**
+         * @brief Get the per-bucket counts
+         * @return View of BUCKET_COUNT counts, indexed by bucketIndex()
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::span<const std::uint64_t, BUCKET_COUNT> buckets() const noexcept;
+
+        //----------------------------------------------
+        // Bucket layout
+        //----------------------------------------------
+
+        /**
+         * @brief Get the bucket counting a tick value
+         * @param ticks Duration in ticks (negative values map to bucket 0)
+         * @return Bucket index in [0, BUCKET_COUNT)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline static constexpr std::size_t bucketIndex( std::int64_t ticks ) noexcept;
+
+        /**
+         * @brief Get the smallest tick value counted by a bucket
+         * @param index Bucket index in [0, BUCKET_COUNT)
+         * @return Lowest tick value of the bucket
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline static constexpr std::int64_t bucketLowerBound( std::size_t index ) noexcept;
+
+        /**
+         * @brief Get the largest tick value counted by a bucket
+         * @param index Bucket index in [0, BUCKET_COUNT)
+         * @return Highest tick value of the bucket
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline static constexpr std::int64_t bucketUpperBound( std::size_t index ) noexcept;
+
+        //----------------------------------------------
+        // String formatting
+        //----------------------------------------------
+
+        /**
+         * @brief Summarize the distribution with ISO 8601 durations
+         * @return "count=N min=... mean=... p50=... p90=... p99=... p99.9=... max=..."
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::string toString() const;
+
+    private:
+        friend class ConcurrentTimeSpanHistogram;
+
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        /** @brief Count per bucket */
+        std::array<std::uint64_t, BUCKET_COUNT> m_buckets{};
+
+        /** @brief Number of recorded values */
+        std::uint64_t m_count{ 0 };
+
+        /** @brief Sum of recorded ticks (floating point: cannot overflow) */
+        double m_sum{ 0.0 };
+
+        /** @brief Smallest recorded ticks (INT64_MAX while empty) */
+        std::int64_t m_min{ INT64_MAX };
+
+        /** @brief Largest recorded ticks */
+        std::int64_t m_max{ 0 };
+    };
+
+    //=====================================================================
+    // ConcurrentTimeSpanHistogram class
+    //=====================================================================
+
+    /**
+     * @brief Thread-sharded TimeSpanHistogram for recording from many threads
+     * @details record() writes to a shard owned by the calling thread (created on its first
+     *          record, about 30 KB). Each shard has a single writer, so counters are bumped
+     *          with relaxed loads and stores; no lock or locked instruction is involved. A
+     *          shard outlives its thread, so its counts stay in later snapshots. reset() only
+     *          advances a generation: snapshot() skips shards of older generations and each owner
+     *          clears its own shard on its next record.
+     * @note snapshot() reads shards while owners may be writing, so it may miss in-flight records;
+     *       a record concurrent with reset() may be dropped.
+     */
+    class ConcurrentTimeSpanHistogram final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Construct an empty histogram */
+        ConcurrentTimeSpanHistogram() noexcept;
+
+        /** @brief Free all shards (no thread may be recording) */
+        ~ConcurrentTimeSpanHistogram();
+
+        ConcurrentTimeSpanHistogram( const ConcurrentTimeSpanHistogram& ) = delete;
+        ConcurrentTimeSpanHistogram& operator=( const ConcurrentTimeSpanHistogram& ) = delete;
+
+        //----------------------------------------------
+        // Recording
+        //----------------------------------------------
+
+        /**
+         * @brief Record one duration from the calling thread
+         * @param value Duration to count
+         * @note Lock-free; a value is dropped if the thread's first shard cannot be allocated
+         */
+        inline void record( const TimeSpan& value ) noexcept;
+
+        /** @brief Remove all recorded values */
+        void reset() noexcept;
+
+        //----------------------------------------------
+        // Queries
+        //----------------------------------------------
+
+        /**
+         * @brief Merge all shards
+         * @return Histogram of every value recorded so far
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] TimeSpanHistogram snapshot() const noexcept;
+
+    private:
+        //----------------------------------------------
+        // Shards
+        //----------------------------------------------
+
+        /** @brief Counters of one recording thread */
+        struct Shard;
+
+        /**
+         * @brief Find or create the calling thread's shard
+         * @return Shard owned by the calling thread, or nullptr if allocation failed
+         */
+        [[nodiscard]] Shard* acquireShard() noexcept;
+
+        /**
+         * @brief Count one value in a shard
+         * @param shard Shard owned by the calling thread
+         * @param ticks Duration in ticks
+         * @param generation Current reset generation; a shard of an older one is cleared first
+         */
+        inline static void recordTo( Shard& shard, std::int64_t ticks, std::uint64_t generation ) noexcept;
+
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        /** @brief Process-unique identifier keying the per-thread shard caches */
+        std::uint64_t m_id;
+
+        /** @brief Singly linked list of shards, pushed with compare-and-swap */
+        std::atomic<Shard*> m_shards{ nullptr };
+
+        /** @brief Incremented by reset(); shards of older generations hold no values */
+        std::atomic<std::uint64_t> m_generation{ 0 };
+    };
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/TimeSpanHistogram.inl"
@@ -0,0 +1,183 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimeZone.h
+ * @brief Named IANA time zones backed by memory-mapped TZif files
+ * @details Provides lookup of IANA time zones by name (e.g. "America/New_York"), UTC offset
+ *          resolution for any instant and conversion of DateTimeOffset values between zones.
+ *          Zone files are memory-mapped from the system zoneinfo directory and searched in
+ *          place; a process-wide registry interns each zone so it is loaded only once.
+ *
+ * @section tzif_lookup Offset lookup
+ *
+ * @par Each zone is resolved from the TZif (RFC 8536) version 2+ data block:
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  utcTicks ──► binary search over mapped 64-bit transition times ──┐  │
+ * │                                                                   │  │
+ * │  before first transition ──► local time type 0                    │  │
+ * │  between transitions     ──► type index ──► UT offset  ◄──────────┘  │
+ * │  after last transition   ──► POSIX TZ footer rule (e.g. DST rules)   │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note The zoneinfo directory is taken from the TZDIR environment variable, falling back to
+ *       /usr/share/zoneinfo. Zones with leap second tables ("right/" zones) are not supported.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // TimeZone class
+    //=====================================================================
+
+    /**
+     * @brief Named IANA time zone
+     * @details Instances are owned by a process-wide registry and live until the process exits,
+     *          so the references and pointers handed out by utc() and find() never dangle and
+     *          can be shared freely between threads. Offset lookups are lock-free and read-only.
+     */
+    class TimeZone final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Copy constructor (deleted, zones are interned) */
+        TimeZone( const TimeZone& ) = delete;
+
+        /** @brief Move constructor (deleted, zones are interned) */
+        TimeZone( TimeZone&& ) = delete;
+
+        //----------------------------------------------
+        // Destruction
+        //----------------------------------------------
+
+        /** @brief Destructor */
+        ~TimeZone();
+
+        //----------------------------------------------
+        // Assignment
+        //----------------------------------------------
+
+        /** @brief Copy assignment operator (deleted, zones are interned) */
+        TimeZone& operator=( const TimeZone& ) = delete;
+
+        /** @brief Move assignment operator (deleted, zones are interned) */
+        TimeZone& operator=( TimeZone&& ) = delete;
+
+        //----------------------------------------------
+        // Property accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the IANA name of this zone
+         * @return Zone name (e.g. "Europe/Paris")
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::string_view name() const noexcept;
+
+        //----------------------------------------------
+        // Offset lookup
+        //----------------------------------------------
+
+        /**
+         * @brief Get the UTC offset in effect at a UTC instant
+         * @param utcTicks UTC instant in 100-nanosecond ticks since January 1, 0001
+         * @return Offset from UTC (positive for East, negative for West)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] TimeSpan offsetAt( std::int64_t utcTicks ) const noexcept;
+
+        /**
+         * @brief Get the UTC offset in effect at a UTC instant
+         * @param utcDateTime UTC instant
+         * @return Offset from UTC (positive for East, negative for West)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline TimeSpan offsetAt( const DateTime& utcDateTime ) const noexcept;
+
+        //----------------------------------------------
+        // Static factory methods
+        //----------------------------------------------
+
+        /**
+         * @brief Get the built-in UTC zone
+         * @return UTC zone, available without any zoneinfo files
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static const TimeZone& utc() noexcept;
+
+        /**
+         * @brief Find a zone by IANA name, loading and interning it on first use
+         * @param name IANA zone name (e.g. "America/New_York")
+         * @return Pointer to the interned zone, or nullptr if the name is invalid or the zone
+         *         file is missing or malformed
+         * @details The first lookup of a name maps its TZif file; later lookups of the same
+         *          name return the same instance. Keep the returned pointer on hot paths.
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static const TimeZone* find( std::string_view name ) noexcept;
+
+    private:
+        /** @brief Mapped zone data and parsed footer rule */
+        struct Data;
+
+        /**
+         * @brief Construct from loaded zone data
+         * @param data Zone data (ownership transferred)
+         */
+        explicit TimeZone( std::unique_ptr<Data> data ) noexcept;
+
+        /** @brief Zone data */
+        std::unique_ptr<Data> m_data;
+    };
+
+    //=====================================================================
+    // Zone conversion
+    //=====================================================================
+
+    /**
+     * @brief Convert a DateTimeOffset to the local time of a zone
+     * @param value The instant to convert
+     * @param zone Target time zone
+     * @return Same instant expressed in the zone's local time and offset
+     * @note This function is marked [[nodiscard]] - the return value should not be ignored
+     */
+    [[nodiscard]] inline DateTimeOffset toZone( const DateTimeOffset& value, const TimeZone& zone ) noexcept;
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/TimeZone.inl"
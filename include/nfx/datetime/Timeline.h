@@ -0,0 +1,170 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Timeline.h
+ * @brief Read-only sorted index of DateTime values with cache-friendly search
+ * @details Timeline sorts a set of instants once and answers lowerBound, upperBound and
+ *          half-open range queries in O(log n) with one cache-line pair touched per level.
+ *          Binary search over a large sorted array misses the cache on nearly every probe;
+ *          Timeline instead searches an implicit B+ tree whose nodes are NODE_SIZE contiguous
+ *          keys, so a level costs one memory access and the nodes scan branch-free.
+ *
+ * @section timeline_layout Layout
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  level 2:  [ max of each level 1 node ... ]          (one node)      │
+ * │  level 1:  [ max of each level 0 node ... ]                          │
+ * │  level 0:  sorted values, padded to a multiple of NODE_SIZE          │
+ * │                                                                      │
+ * │  search: child = node * NODE_SIZE + (number of keys < value)         │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note The upper levels add one key per NODE_SIZE values (about 6% memory overhead).
+ *       Query results are positions in values(), i.e. in ascending order.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "DateTime.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // Timeline class
+    //=====================================================================
+
+    /**
+     * @brief Immutable sorted index of instants
+     * @details Duplicate values are kept. Instances are immutable after construction and can be
+     *          queried concurrently from any number of threads.
+     */
+    class Timeline final
+    {
+    public:
+        /** @brief Number of keys per search node (two 64-byte cache lines) */
+        static constexpr std::size_t NODE_SIZE{ 16 };
+
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Construct an empty timeline */
+        Timeline() = default;
+
+        /**
+         * @brief Construct from values in any order
+         * @param values Instants to index (copied and radix sorted)
+         * @throws std::bad_alloc if the index cannot be allocated
+         */
+        explicit Timeline( std::span<const DateTime> values );
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the number of indexed values
+         * @return Value count
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t size() const noexcept;
+
+        /**
+         * @brief Get the indexed values
+         * @return Values in ascending order
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::span<const DateTime> values() const noexcept;
+
+        //----------------------------------------------
+        // Search
+        //----------------------------------------------
+
+        /**
+         * @brief Find the first value not before an instant
+         * @param value Instant to search for
+         * @return Position of the first value >= value, or size() if there is none
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::size_t lowerBound( const DateTime& value ) const noexcept;
+
+        /**
+         * @brief Find the first value after an instant
+         * @param value Instant to search for
+         * @return Position of the first value > value, or size() if there is none
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t upperBound( const DateTime& value ) const noexcept;
+
+        /**
+         * @brief Get the values inside a half-open interval
+         * @param from Inclusive start
+         * @param until Exclusive end
+         * @return Values v with from <= v < until, in ascending order (empty if until <= from)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::span<const DateTime> range(
+            const DateTime& from, const DateTime& until ) const noexcept;
+
+        /**
+         * @brief Count the values inside a half-open interval
+         * @param from Inclusive start
+         * @param until Exclusive end
+         * @return Number of values v with from <= v < until
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t count( const DateTime& from, const DateTime& until ) const noexcept;
+
+        /**
+         * @brief Check whether an instant is indexed
+         * @param value Instant to look up
+         * @return true if at least one value equals value
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline bool contains( const DateTime& value ) const noexcept;
+
+    private:
+        /**
+         * @brief Find the first position whose ticks are not less than a key
+         * @param ticks Key to search for
+         * @return Position in values(), at most size()
+         */
+        [[nodiscard]] std::size_t lowerBoundTicks( std::int64_t ticks ) const noexcept;
+
+        std::vector<DateTime> m_values;           ///< Sorted values followed by padding to a multiple of NODE_SIZE
+        std::size_t m_size{ 0 };                  ///< Number of real values in m_values
+        std::vector<std::int64_t> m_index;        ///< Upper levels, bottom (level 1) first, each padded to NODE_SIZE
+        std::vector<std::size_t> m_levelOffsets;  ///< Start of each upper level in m_index
+    };
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/Timeline.inl"
@@ -0,0 +1,278 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampColumn.h
+ * @brief Delta-of-delta compressed columns of DateTime ticks
+ * @details TimestampColumnEncoder appends sorted or mostly sorted ticks and seals them into
+ *          independent blocks of up to BLOCK_SIZE values; TimestampColumnDecoder indexes the
+ *          blocks of an encoded column and decodes any block by index. Regular series (fixed
+ *          sampling interval) compress to a block header per BLOCK_SIZE values.
+ *
+ * @section timestamp_column_layout Block layout
+ *
+ * @code
+ * ┌────────┬───────┬───────────────────────────────────────────────────────────────────┐
+ * │ Offset │ Bytes │ Content                                                           │
+ * ├────────┼───────┼───────────────────────────────────────────────────────────────────┤
+ * │  0     │  2    │ value count n (1 - BLOCK_SIZE), uint16 little-endian              │
+ * │  2     │  1    │ bit width w (0 - 64) of each packed delta-of-delta                │
+ * │  3     │  1    │ reserved, 0                                                       │
+ * │  4     │  8    │ first ticks t0, int64 little-endian                               │
+ * │  12    │  8    │ first delta t1 - t0 (0 when n = 1), int64 little-endian           │
+ * │  20    │  8k   │ n - 2 zigzag delta-of-deltas, w bits each, packed least           │
+ * │        │       │ significant bit first into k = ceil((n - 2) * w / 64) uint64 LE   │
+ * └────────┴───────┴───────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * A column is a plain concatenation of blocks. Delta-of-delta i is
+ * (t[i + 2] - t[i + 1]) - (t[i + 1] - t[i]) in wrapping 64-bit arithmetic, so any int64
+ * sequence round-trips exactly; out-of-order values only widen their block.
+ *
+ * @note Unlike Gorilla's per-value prefix codes, every value of a block uses the same bit
+ *       width, which keeps decoding branch-free and lets it run on AVX2 (runtime dispatch)
+ *       when NFX_DATETIME_ENABLE_SIMD is set.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "DateTime.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // TimestampColumnEncoder class
+    //=====================================================================
+
+    /**
+     * @brief Append-only encoder producing delta-of-delta compressed blocks
+     * @details Values are buffered until BLOCK_SIZE of them are pending, then sealed into
+     *          data(). Sealed bytes never change, so a streaming writer can ship the bytes
+     *          past its last written offset after every append.
+     */
+    class TimestampColumnEncoder final
+    {
+    public:
+        /** @brief Maximum number of values per block */
+        static constexpr std::size_t BLOCK_SIZE{ 128 };
+
+        /** @brief Size of a block header in bytes */
+        static constexpr std::size_t BLOCK_HEADER_SIZE{ 20 };
+
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /** @brief Construct an empty encoder */
+        TimestampColumnEncoder() = default;
+
+        //----------------------------------------------
+        // Appending
+        //----------------------------------------------
+
+        /**
+         * @brief Append one value
+         * @param ticks Ticks to append
+         * @throws std::bad_alloc if sealing a block fails to grow the output
+         */
+        inline void append( std::int64_t ticks );
+
+        /**
+         * @brief Append one value
+         * @param value DateTime to append
+         * @throws std::bad_alloc if sealing a block fails to grow the output
+         */
+        inline void append( const DateTime& value );
+
+        /**
+         * @brief Append consecutive values
+         * @param ticks Ticks to append
+         * @throws std::bad_alloc if sealing a block fails to grow the output
+         */
+        void append( std::span<const std::int64_t> ticks );
+
+        /**
+         * @brief Seal pending values into a (possibly short) block
+         * @details Call before handing data() to a decoder; appending afterwards starts a new block.
+         * @throws std::bad_alloc if growing the output fails
+         */
+        void flush();
+
+        /** @brief Discard all sealed and pending values */
+        void clear() noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the sealed blocks
+         * @return Encoded bytes of all sealed blocks (pending values are not included)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::span<const std::byte> data() const noexcept;
+
+        /**
+         * @brief Get the number of appended values
+         * @return Sealed plus pending values
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t size() const noexcept;
+
+        /**
+         * @brief Get the number of sealed blocks
+         * @return Block count of data()
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t blockCount() const noexcept;
+
+    private:
+        /** @brief Encode the pending values as one block */
+        void sealBlock();
+
+        std::array<std::int64_t, BLOCK_SIZE> m_pending{}; ///< Values of the open block
+        std::size_t m_pendingCount{ 0 };                  ///< Number of values in m_pending
+        std::size_t m_sealedCount{ 0 };                   ///< Number of values in sealed blocks
+        std::size_t m_blockCount{ 0 };                    ///< Number of sealed blocks
+        std::vector<std::byte> m_data;                    ///< Sealed blocks
+    };
+
+    //=====================================================================
+    // TimestampColumnDecoder class
+    //=====================================================================
+
+    /**
+     * @brief Random-access decoder over an encoded column
+     * @details open() validates the block headers once and records where each block starts;
+     *          blocks are then decoded independently. The decoder does not own the bytes,
+     *          which must outlive it.
+     */
+    class TimestampColumnDecoder final
+    {
+    public:
+        /** @brief Maximum number of values per block */
+        static constexpr std::size_t BLOCK_SIZE{ TimestampColumnEncoder::BLOCK_SIZE };
+
+        //----------------------------------------------
+        // Static factory methods
+        //----------------------------------------------
+
+        /**
+         * @brief Index an encoded column
+         * @param data Concatenated blocks, as produced by TimestampColumnEncoder::data()
+         * @return Decoder, or std::nullopt if a block header is invalid or a block is truncated
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static std::optional<TimestampColumnDecoder> open( std::span<const std::byte> data );
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the number of encoded values
+         * @return Sum of all block sizes
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t size() const noexcept;
+
+        /**
+         * @brief Get the number of blocks
+         * @return Block count
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t blockCount() const noexcept;
+
+        /**
+         * @brief Get the number of values in a block
+         * @param block Block index (must be less than blockCount())
+         * @return Value count (1 - BLOCK_SIZE)
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t blockSize( std::size_t block ) const noexcept;
+
+        /**
+         * @brief Get the index of the first value of a block
+         * @param block Block index (at most blockCount(); blockCount() yields size())
+         * @return Index of the block's first value in the column
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] inline std::size_t blockFirstRow( std::size_t block ) const noexcept;
+
+        /**
+         * @brief Find the block containing a value
+         * @param row Value index (must be less than size())
+         * @return Index of the block holding the value
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::size_t findBlock( std::size_t row ) const noexcept;
+
+        //----------------------------------------------
+        // Decoding
+        //----------------------------------------------
+
+        /**
+         * @brief Decode one block
+         * @param block Block index
+         * @param out Destination (at least blockSize( block ) values)
+         * @return Number of values written, or 0 if block is out of range or out is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::size_t decodeBlock( std::size_t block, std::span<std::int64_t> out ) const noexcept;
+
+        /**
+         * @brief Decode one block
+         * @param block Block index
+         * @param out Destination (at least blockSize( block ) values)
+         * @return Number of values written, or 0 if block is out of range or out is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::size_t decodeBlock( std::size_t block, std::span<DateTime> out ) const noexcept;
+
+        /**
+         * @brief Decode the whole column
+         * @param out Destination (at least size() values)
+         * @return Number of values written, or 0 if out is too small
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::size_t decode( std::span<std::int64_t> out ) const noexcept;
+
+    private:
+        /** @brief Construct from validated data */
+        explicit TimestampColumnDecoder( std::span<const std::byte> data ) noexcept;
+
+        std::span<const std::byte> m_data;       ///< Encoded column (not owned)
+        std::vector<std::size_t> m_blockOffsets; ///< Byte offset of each block in m_data
+        std::vector<std::size_t> m_firstRows;    ///< First value index of each block, plus size()
+    };
+} // namespace nfx::time
+
+#include "nfx/detail/datetime/TimestampColumn.inl"
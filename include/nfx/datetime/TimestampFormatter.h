@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampFormatter.h
+ * @brief Stateful incremental formatter for monotonic timestamp streams
+ * @details TimestampFormatter keeps the last rendered timestamp in a reusable buffer and,
+ *          for the next value, rewrites only the characters that changed. Log sinks and
+ *          tracers that format mostly increasing timestamps skip the calendar conversion
+ *          and the date digits for every value that falls on an already rendered day.
+ *
+ * @section timestamp_formatter_tiers Update tiers
+ *
+ * @code
+ * ┌───────────────────────────────────────────────────────────────────────┐
+ * │  same second, same offset ──► fraction only                           │
+ * │  same minute              ──► seconds + fraction                      │
+ * │  same day                 ──► HH, mm, ss + fraction                   │
+ * │  new day or offset        ──► full render (calendar conversion)       │
+ * └───────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * @note Output is identical to DateTime::toString() / DateTimeOffset::toString() for every
+ *       DateTime::Format. Instances are not thread-safe; use one per thread or per sink.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+#include "DateTime.h"
+#include "DateTimeOffset.h"
+#include "nfx/detail/datetime/Constants.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // TimestampFormatter class
+    //=====================================================================
+
+    /**
+     * @brief Incremental formatter reusing the rendered date and second prefix across calls
+     * @details The returned views point into the formatter's buffer and stay valid until the
+     *          next format() call or the formatter's destruction.
+     */
+    class TimestampFormatter final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Construct a formatter for one output format
+         * @param format Output format (same meaning as in DateTime::toString())
+         */
+        explicit TimestampFormatter( DateTime::Format format = DateTime::Format::Iso8601Millis ) noexcept;
+
+        //----------------------------------------------
+        // Formatting
+        //----------------------------------------------
+
+        /**
+         * @brief Format a DateTime
+         * @param dateTime Value to format
+         * @return View of the formatted text, valid until the next call
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::string_view format( const DateTime& dateTime ) noexcept;
+
+        /**
+         * @brief Format a DateTimeOffset (local time with its offset)
+         * @param dateTimeOffset Value to format
+         * @return View of the formatted text, valid until the next call
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] std::string_view format( const DateTimeOffset& dateTimeOffset ) noexcept;
+
+        /** @brief Discard the cached rendering; the next call performs a full render */
+        void reset() noexcept;
+
+        //----------------------------------------------
+        // Property accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the output format
+         * @return Format passed at construction
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] DateTime::Format outputFormat() const noexcept;
+
+    private:
+        /** @brief Offset marker meaning "DateTime value" (no numeric offset) */
+        static constexpr std::int32_t NO_OFFSET{ std::numeric_limits<std::int32_t>::min() };
+
+        /** @brief Render localTicks, patching the cached text where possible */
+        [[nodiscard]] std::string_view render(
+            std::int64_t localTicks, std::int32_t offsetMinutes, const DateTimeOffset* source ) noexcept;
+
+        /** @brief Render from scratch and record the field positions */
+        void renderFull( std::int64_t localTicks, std::int32_t offsetMinutes, const DateTimeOffset* source ) noexcept;
+
+        /** @brief Write the fractional seconds and the cached suffix after the prefix */
+        void writeTail( std::int64_t localTicks ) noexcept;
+
+        char m_buffer[constants::MAX_ISO8601_LENGTH]{};   ///< Last rendered text
+        char m_suffix[8]{};                               ///< Text after the fraction ("Z", "+02:00", ...)
+        std::int64_t m_secondTicks{ -1 };                 ///< Local ticks of the rendered second (-1 = none)
+        std::int32_t m_offsetMinutes{ NO_OFFSET };        ///< Offset of the rendered value
+        std::uint8_t m_length{ 0 };                       ///< Length of the rendered text
+        std::uint8_t m_prefixLength{ 0 };                 ///< Length up to and including the seconds
+        std::uint8_t m_suffixLength{ 0 };                 ///< Length of m_suffix
+        std::int8_t m_hourPosition{ -1 };                 ///< Position of HH (-1 if not patchable)
+        std::int8_t m_minutePosition{ -1 };               ///< Position of mm
+        std::int8_t m_secondPosition{ -1 };               ///< Position of ss
+        DateTime::Format m_format;                        ///< Output format
+    };
+} // namespace nfx::time
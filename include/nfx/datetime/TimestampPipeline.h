@@ -0,0 +1,248 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampPipeline.h
+ * @brief Parallel conversion of delimiter-separated timestamp text into output columns
+ * @details TimestampPipeline owns a fixed set of worker threads and converts a raw buffer of
+ *          records (one ISO 8601 timestamp per line, or per delimiter) into caller-provided
+ *          columns: parsed with DateTimeOffset::parseMany(), normalized with toUniversalTime(),
+ *          packed into PackedDateTimeOffset and bucketed with bulk::floor(). Row i of every
+ *          column is record i of the buffer, whatever thread converted it.
+ *
+ * @section pipeline_stages Stages
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  1. split   buffer ──► chunks of ~chunkBytes ending on a delimiter   │
+ * │  2. count   records per chunk (parallel) ──► first row of each chunk │
+ * │  3. convert chunks (parallel, self-scheduled) in blocks of records:  │
+ * │             parseMany ──► utc / packed / buckets / ok columns        │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * Threads pull the next chunk from a shared counter, so fast threads take more chunks and
+ * stragglers do not hold the run back. Chunks default to 256 KB of text, sized to stay in L2
+ * while their records are tokenized, parsed and scattered into the columns.
+ *
+ * @section pipeline_usage Usage
+ *
+ * @code
+ * ┌──────────────────────────────────────────────────────────────────────┐
+ * │  TimestampPipeline pipeline;   // hardware_concurrency() threads     │
+ * │  const auto rows{ TimestampPipeline::countRecords( text ) };         │
+ * │  std::vector<DateTime> utc( rows ), hours( rows );                   │
+ * │  std::vector<std::uint8_t> ok( rows );                               │
+ * │  auto result{ pipeline.run( text, { .utc = utc, .buckets = hours,    │
+ * │                                     .ok = ok } ) };                  │
+ * └──────────────────────────────────────────────────────────────────────┘
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "DateTime.h"
+#include "PackedDateTimeOffset.h"
+#include "TimeSpan.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // TimestampPipeline class
+    //=====================================================================
+
+    /**
+     * @brief Reusable thread pool converting timestamp text buffers into columns
+     * @details Records are separated by a single delimiter character; with the default '\n' a
+     *          trailing '\r' is dropped as well. A delimiter at the very end of the buffer does
+     *          not start another record, but empty records elsewhere do (they fail to parse,
+     *          keeping row numbers aligned with the source). Records accept every layout
+     *          DateTimeOffset::fromString() accepts.
+     */
+    class TimestampPipeline final
+    {
+    public:
+        //----------------------------------------------
+        // Configuration
+        //----------------------------------------------
+
+        /** @brief Per-run settings */
+        struct Options
+        {
+            /** @brief Record separator */
+            char delimiter{ '\n' };
+
+            /** @brief Target chunk size in bytes (chunks extend to the next delimiter) */
+            std::size_t chunkBytes{ 256 * 1024 };
+
+            /** @brief Width of the buckets column (DateTime::floor of the UTC value) */
+            TimeSpan bucket{ TimeSpan::fromHours( 1 ) };
+        };
+
+        /**
+         * @brief Caller-provided output columns, all optional (empty spans are skipped)
+         * @details Rows beyond the size of the smallest non-empty column are not converted.
+         *          Rows of records that fail to parse get default values and ok = 0.
+         */
+        struct Columns
+        {
+            /** @brief Parsed value normalized with toUniversalTime() */
+            std::span<DateTime> utc{};
+
+            /** @brief Parsed value with its offset, in the 8-byte form */
+            std::span<PackedDateTimeOffset> packed{};
+
+            /** @brief UTC value rounded down to Options::bucket */
+            std::span<DateTime> buckets{};
+
+            /** @brief 1 for each parsed record, 0 otherwise */
+            std::span<std::uint8_t> ok{};
+        };
+
+        /** @brief Outcome of a run */
+        struct Result
+        {
+            /** @brief Records found in the buffer */
+            std::size_t records{ 0 };
+
+            /** @brief Records converted (at most the size of the smallest non-empty column) */
+            std::size_t converted{ 0 };
+
+            /** @brief Converted records that parsed successfully */
+            std::size_t parsed{ 0 };
+        };
+
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Start the worker threads
+         * @param threads Threads converting a run, including the calling thread
+         *                (0 = std::thread::hardware_concurrency())
+         * @throws std::system_error if a worker thread cannot be started
+         */
+        explicit TimestampPipeline( unsigned threads = 0 );
+
+        /** @brief Stop and join the worker threads */
+        ~TimestampPipeline();
+
+        TimestampPipeline( const TimestampPipeline& ) = delete;
+        TimestampPipeline& operator=( const TimestampPipeline& ) = delete;
+
+        //----------------------------------------------
+        // Conversion
+        //----------------------------------------------
+
+        /**
+         * @brief Convert every record of a buffer into the output columns
+         * @param buffer Delimiter-separated timestamp text
+         * @param columns Output columns, indexed by record number
+         * @param options Delimiter, chunk size and bucket width
+         * @return Record, conversion and parse counts
+         * @details The calling thread works alongside the pool and returns once every chunk is
+         *          done. Concurrent runs on one pipeline are serialized. A single-thread pipeline
+         *          converts the buffer in one pass, without chunking or the counting stage.
+         * @throws std::bad_alloc if the chunk table cannot be allocated
+         */
+        Result run( std::string_view buffer, const Columns& columns, const Options& options );
+
+        /**
+         * @brief Convert every record of a buffer with the default Options
+         * @param buffer Newline-separated timestamp text
+         * @param columns Output columns, indexed by record number
+         * @return Record, conversion and parse counts
+         * @throws std::bad_alloc if the chunk table cannot be allocated
+         */
+        Result run( std::string_view buffer, const Columns& columns );
+
+        /**
+         * @brief Count the records run() would find, to size the output columns
+         * @param buffer Delimiter-separated timestamp text
+         * @param delimiter Record separator
+         * @return Number of records
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] static std::size_t countRecords( std::string_view buffer, char delimiter = '\n' ) noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the number of threads converting a run
+         * @return Worker threads plus the calling thread
+         * @note This function is marked [[nodiscard]] - the return value should not be ignored
+         */
+        [[nodiscard]] unsigned threadCount() const noexcept;
+
+    private:
+        //----------------------------------------------
+        // Scheduling
+        //----------------------------------------------
+
+        /**
+         * @brief Run task( i ) for every i in [0, count) on the pool and the calling thread
+         * @param count Number of work items
+         * @param task Work item body (must not throw)
+         */
+        void parallelFor( std::size_t count, const std::function<void( std::size_t )>& task );
+
+        /**
+         * @brief Take and run work items of the current task until none remain
+         * @param task Work item body
+         * @param count Number of work items
+         */
+        void drain( const std::function<void( std::size_t )>& task, std::size_t count ) noexcept;
+
+        /** @brief Worker thread body */
+        void workerLoop( std::stop_token stopToken ) noexcept;
+
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        std::mutex m_runMutex;                                  ///< Serializes run() calls
+        std::mutex m_mutex;                                     ///< Guards the task hand-off below
+        std::condition_variable_any m_wakeUp;                   ///< Signals a new task or shutdown
+        std::condition_variable m_done;                         ///< Signals the last worker finishing
+        const std::function<void( std::size_t )>* m_task{ nullptr }; ///< Current task body
+        std::size_t m_taskCount{ 0 };                           ///< Work items of the current task
+        std::uint64_t m_generation{ 0 };                        ///< Incremented per task
+        unsigned m_busyWorkers{ 0 };                            ///< Workers still on the current task
+        std::atomic<std::size_t> m_nextItem{ 0 };               ///< Next unclaimed work item
+        std::vector<std::jthread> m_workers;                    ///< Pool threads (threadCount() - 1)
+    };
+} // namespace nfx::time
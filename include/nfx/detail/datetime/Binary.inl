@@ -0,0 +1,350 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Binary.inl
+ * @brief Inline implementations for single-value binary encoding and decoding
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "Constants.h"
+
+namespace nfx::time
+{
+    namespace detail
+    {
+        //=====================================================================
+        // Byte order helpers
+        //=====================================================================
+
+        /**
+         * @brief Store a 64-bit value in little-endian byte order
+         * @param out Destination (at least 8 bytes)
+         * @param value Value to store
+         */
+        inline void storeLittleEndian64( std::byte* out, std::uint64_t value ) noexcept
+        {
+            if constexpr( std::endian::native == std::endian::little )
+            {
+                std::memcpy( out, &value, sizeof( value ) );
+            }
+            else
+            {
+                for( std::size_t i{ 0 }; i < sizeof( value ); ++i )
+                {
+                    out[i] = static_cast<std::byte>( value >> ( i * 8 ) );
+                }
+            }
+        }
+
+        /**
+         * @brief Load a 64-bit value stored in little-endian byte order
+         * @param in Source (at least 8 bytes)
+         * @return Loaded value
+         */
+        [[nodiscard]] inline std::uint64_t loadLittleEndian64( const std::byte* in ) noexcept
+        {
+            std::uint64_t value{ 0 };
+            if constexpr( std::endian::native == std::endian::little )
+            {
+                std::memcpy( &value, in, sizeof( value ) );
+            }
+            else
+            {
+                for( std::size_t i{ 0 }; i < sizeof( value ); ++i )
+                {
+                    value |= static_cast<std::uint64_t>( in[i] ) << ( i * 8 );
+                }
+            }
+
+            return value;
+        }
+
+        //=====================================================================
+        // Varint helpers
+        //=====================================================================
+
+        /** @brief Map a signed value to unsigned so that small magnitudes stay small */
+        [[nodiscard]] inline constexpr std::uint64_t zigzagEncode( std::int64_t value ) noexcept
+        {
+            return ( static_cast<std::uint64_t>( value ) << 1 ) ^ static_cast<std::uint64_t>( value >> 63 );
+        }
+
+        /** @brief Inverse of zigzagEncode */
+        [[nodiscard]] inline constexpr std::int64_t zigzagDecode( std::uint64_t value ) noexcept
+        {
+            return static_cast<std::int64_t>( ( value >> 1 ) ^ ( ~( value & 1 ) + 1 ) );
+        }
+
+        /**
+         * @brief Write an unsigned LEB128 varint
+         * @param out Destination bytes
+         * @param value Value to write
+         * @return Number of bytes written, or 0 if out is too small
+         */
+        [[nodiscard]] inline std::size_t writeVarint( std::span<std::byte> out, std::uint64_t value ) noexcept
+        {
+            std::size_t length{ 0 };
+            while( value >= 0x80 )
+            {
+                if( length == out.size() )
+                {
+                    return 0;
+                }
+                out[length++] = static_cast<std::byte>( value | 0x80 );
+                value >>= 7;
+            }
+
+            if( length == out.size() )
+            {
+                return 0;
+            }
+            out[length++] = static_cast<std::byte>( value );
+
+            return length;
+        }
+
+        /**
+         * @brief Read an unsigned LEB128 varint
+         * @param in Source bytes
+         * @param value Receives the decoded value
+         * @return Number of bytes consumed, or 0 if the varint is truncated, overlong (padded with
+         *         a zero final byte) or exceeds 64 bits
+         */
+        [[nodiscard]] inline std::size_t readVarint( std::span<const std::byte> in, std::uint64_t& value ) noexcept
+        {
+            std::uint64_t result{ 0 };
+            const auto limit{ std::min<std::size_t>( in.size(), 10 ) };
+            for( std::size_t i{ 0 }; i < limit; ++i )
+            {
+                const auto byte{ static_cast<std::uint64_t>( in[i] ) };
+                if( i == 9 && byte > 1 )
+                {
+                    return 0; // Bits beyond 64
+                }
+
+                result |= ( byte & 0x7F ) << ( i * 7 );
+                if( ( byte & 0x80 ) == 0 )
+                {
+                    if( i > 0 && byte == 0 )
+                    {
+                        return 0; // Overlong: the minimal encoding is shorter
+                    }
+                    value = result;
+
+                    return i + 1;
+                }
+            }
+
+            return 0;
+        }
+
+        /** @brief Check that ticks are within the DateTime range */
+        [[nodiscard]] inline constexpr bool isValidBinaryTicks( std::int64_t ticks ) noexcept
+        {
+            return ticks >= constants::MIN_DATETIME_TICKS && ticks <= constants::MAX_DATETIME_TICKS;
+        }
+
+        /** @brief Check that an offset in minutes is within ±14:00 */
+        [[nodiscard]] inline constexpr bool isValidBinaryOffset( std::int64_t minutes ) noexcept
+        {
+            return minutes >= constants::MIN_OFFSET_MINUTES && minutes <= constants::MAX_OFFSET_MINUTES;
+        }
+    } // namespace detail
+
+    namespace binary
+    {
+        //=====================================================================
+        // Fixed-width encoding
+        //=====================================================================
+
+        inline std::size_t encode( const DateTime& value, std::span<std::byte> out ) noexcept
+        {
+            if( out.size() < FIXED_SIZE )
+            {
+                return 0;
+            }
+            detail::storeLittleEndian64( out.data(), static_cast<std::uint64_t>( value.ticks() ) );
+
+            return FIXED_SIZE;
+        }
+
+        inline std::size_t encode( const TimeSpan& value, std::span<std::byte> out ) noexcept
+        {
+            if( out.size() < FIXED_SIZE )
+            {
+                return 0;
+            }
+            detail::storeLittleEndian64( out.data(), static_cast<std::uint64_t>( value.ticks() ) );
+
+            return FIXED_SIZE;
+        }
+
+        inline std::size_t encode( const DateTimeOffset& value, std::span<std::byte> out ) noexcept
+        {
+            if( out.size() < OFFSET_FIXED_SIZE )
+            {
+                return 0;
+            }
+            detail::storeLittleEndian64( out.data(), static_cast<std::uint64_t>( value.dateTime().ticks() ) );
+
+            const auto minutes{ static_cast<std::uint16_t>( value.totalOffsetMinutes() ) };
+            out[8] = static_cast<std::byte>( minutes );
+            out[9] = static_cast<std::byte>( minutes >> 8 );
+
+            return OFFSET_FIXED_SIZE;
+        }
+
+        inline std::size_t decode( std::span<const std::byte> in, DateTime& value ) noexcept
+        {
+            if( in.size() < FIXED_SIZE )
+            {
+                return 0;
+            }
+
+            const auto ticks{ static_cast<std::int64_t>( detail::loadLittleEndian64( in.data() ) ) };
+            if( !detail::isValidBinaryTicks( ticks ) )
+            {
+                return 0;
+            }
+            value = DateTime{ ticks };
+
+            return FIXED_SIZE;
+        }
+
+        inline std::size_t decode( std::span<const std::byte> in, TimeSpan& value ) noexcept
+        {
+            if( in.size() < FIXED_SIZE )
+            {
+                return 0;
+            }
+            value = TimeSpan{ static_cast<std::int64_t>( detail::loadLittleEndian64( in.data() ) ) };
+
+            return FIXED_SIZE;
+        }
+
+        inline std::size_t decode( std::span<const std::byte> in, DateTimeOffset& value ) noexcept
+        {
+            if( in.size() < OFFSET_FIXED_SIZE )
+            {
+                return 0;
+            }
+
+            const auto ticks{ static_cast<std::int64_t>( detail::loadLittleEndian64( in.data() ) ) };
+            const auto minutes{ static_cast<std::int16_t>(
+                static_cast<std::uint16_t>( in[8] ) | static_cast<std::uint16_t>( in[9] ) << 8 ) };
+            if( !detail::isValidBinaryTicks( ticks ) || !detail::isValidBinaryOffset( minutes ) )
+            {
+                return 0;
+            }
+            value = DateTimeOffset{ ticks, TimeSpan{ minutes * constants::TICKS_PER_MINUTE } };
+
+            return OFFSET_FIXED_SIZE;
+        }
+
+        //=====================================================================
+        // Variable-length encoding
+        //=====================================================================
+
+        inline std::size_t encodeVarint( const DateTime& value, std::span<std::byte> out ) noexcept
+        {
+            return detail::writeVarint( out, static_cast<std::uint64_t>( value.ticks() ) );
+        }
+
+        inline std::size_t encodeVarint( const TimeSpan& value, std::span<std::byte> out ) noexcept
+        {
+            return detail::writeVarint( out, detail::zigzagEncode( value.ticks() ) );
+        }
+
+        inline std::size_t encodeVarint( const DateTimeOffset& value, std::span<std::byte> out ) noexcept
+        {
+            const auto tickLength{ detail::writeVarint( out, static_cast<std::uint64_t>( value.dateTime().ticks() ) ) };
+            if( tickLength == 0 )
+            {
+                return 0;
+            }
+
+            const auto offsetLength{ detail::writeVarint(
+                out.subspan( tickLength ), detail::zigzagEncode( value.totalOffsetMinutes() ) ) };
+
+            return offsetLength == 0 ? 0 : tickLength + offsetLength;
+        }
+
+        inline std::size_t decodeVarint( std::span<const std::byte> in, DateTime& value ) noexcept
+        {
+            std::uint64_t ticks;
+            const auto length{ detail::readVarint( in, ticks ) };
+            if( length == 0 || ticks > static_cast<std::uint64_t>( constants::MAX_DATETIME_TICKS ) )
+            {
+                return 0;
+            }
+            value = DateTime{ static_cast<std::int64_t>( ticks ) };
+
+            return length;
+        }
+
+        inline std::size_t decodeVarint( std::span<const std::byte> in, TimeSpan& value ) noexcept
+        {
+            std::uint64_t ticks;
+            const auto length{ detail::readVarint( in, ticks ) };
+            if( length == 0 )
+            {
+                return 0;
+            }
+            value = TimeSpan{ detail::zigzagDecode( ticks ) };
+
+            return length;
+        }
+
+        inline std::size_t decodeVarint( std::span<const std::byte> in, DateTimeOffset& value ) noexcept
+        {
+            std::uint64_t ticks;
+            const auto tickLength{ detail::readVarint( in, ticks ) };
+            if( tickLength == 0 || ticks > static_cast<std::uint64_t>( constants::MAX_DATETIME_TICKS ) )
+            {
+                return 0;
+            }
+
+            std::uint64_t zigzagMinutes;
+            const auto offsetLength{ detail::readVarint( in.subspan( tickLength ), zigzagMinutes ) };
+            if( offsetLength == 0 )
+            {
+                return 0;
+            }
+
+            const auto minutes{ detail::zigzagDecode( zigzagMinutes ) };
+            if( !detail::isValidBinaryOffset( minutes ) )
+            {
+                return 0;
+            }
+            value = DateTimeOffset{
+                static_cast<std::int64_t>( ticks ), TimeSpan{ minutes * constants::TICKS_PER_MINUTE } };
+
+            return tickLength + offsetLength;
+        }
+    } // namespace binary
+} // namespace nfx::time
@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CachedClock.inl
+ * @brief Inline implementations for CachedClock lock-free reads
+ */
+
+#include <cstring>
+
+namespace nfx::time
+{
+    //=====================================================================
+    // CachedClock class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Reads
+    //----------------------------------------------
+
+    inline std::int64_t CachedClock::utcTicks() const noexcept
+    {
+        return m_slot.utcTicks.load( std::memory_order_relaxed );
+    }
+
+    inline TimeSpan CachedClock::offset() const noexcept
+    {
+        return TimeSpan{ m_slot.offsetTicks.load( std::memory_order_relaxed ) };
+    }
+
+    inline DateTime CachedClock::utcNow() const noexcept
+    {
+        return DateTime{ utcTicks() };
+    }
+
+    inline DateTimeOffset CachedClock::now() const noexcept
+    {
+        std::int64_t ticks, offsetTicks;
+        std::uint64_t sequence;
+        do
+        {
+            sequence = m_slot.sequence.load( std::memory_order_acquire );
+            ticks = m_slot.utcTicks.load( std::memory_order_relaxed );
+            offsetTicks = m_slot.offsetTicks.load( std::memory_order_relaxed );
+            std::atomic_thread_fence( std::memory_order_acquire );
+        } while( ( sequence & 1 ) != 0 || sequence != m_slot.sequence.load( std::memory_order_relaxed ) );
+
+        return DateTimeOffset{ DateTime{ ticks + offsetTicks }, TimeSpan{ offsetTicks } };
+    }
+
+    inline CachedClock::Snapshot CachedClock::snapshot() const noexcept
+    {
+        Snapshot result;
+        std::array<std::uint64_t, PREFIX_WORDS> words;
+        std::uint64_t sequence;
+        do
+        {
+            sequence = m_slot.sequence.load( std::memory_order_acquire );
+            result.utcTicks = m_slot.utcTicks.load( std::memory_order_relaxed );
+            result.offset = TimeSpan{ m_slot.offsetTicks.load( std::memory_order_relaxed ) };
+            for( std::size_t i{ 0 }; i < PREFIX_WORDS; ++i )
+            {
+                words[i] = m_slot.prefixWords[i].load( std::memory_order_relaxed );
+            }
+            std::atomic_thread_fence( std::memory_order_acquire );
+        } while( ( sequence & 1 ) != 0 || sequence != m_slot.sequence.load( std::memory_order_relaxed ) );
+
+        static_assert( sizeof( words ) == sizeof( result.prefix ) );
+        std::memcpy( result.prefix.data(), words.data(), sizeof( words ) );
+
+        return result;
+    }
+} // namespace nfx::time
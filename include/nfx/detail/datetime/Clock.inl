@@ -0,0 +1,65 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Clock.inl
+ * @brief Inline implementations for clock policies
+ */
+
+#include "Constants.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // Clock policies
+    //=====================================================================
+
+    //----------------------------------------------
+    // PreciseClock
+    //----------------------------------------------
+
+    inline std::int64_t PreciseClock::utcTicks() noexcept
+    {
+        using ticks_duration = std::chrono::duration<std::int64_t, std::ratio<1, 10000000>>;
+        const auto sinceEpoch{ std::chrono::system_clock::now().time_since_epoch() };
+
+        return constants::UNIX_EPOCH_TICKS + std::chrono::duration_cast<ticks_duration>( sinceEpoch ).count();
+    }
+
+    //=====================================================================
+    // Steady clock policies
+    //=====================================================================
+
+    //----------------------------------------------
+    // SteadyClock
+    //----------------------------------------------
+
+    inline std::int64_t SteadyClock::ticks() noexcept
+    {
+        using ticks_duration = std::chrono::duration<std::int64_t, std::ratio<1, 10000000>>;
+
+        return std::chrono::duration_cast<ticks_duration>( std::chrono::steady_clock::now().time_since_epoch() )
+            .count();
+    }
+} // namespace nfx::time
@@ -152,6 +152,9 @@ namespace nfx::time::constants
     /** @brief Days per year (non-leap) */
     inline constexpr std::int32_t DAYS_PER_YEAR{ 365 };
 
+    /** @brief Days from 0000-03-01 (March-based civil calendar origin) to 0001-01-01 */
+    inline constexpr std::int32_t DAYS_FROM_MARCH_0000_TO_JANUARY_0001{ 306 };
+
     //=====================================================================
     // ISO 8601 string formats
     //=====================================================================
@@ -188,6 +191,12 @@ namespace nfx::time::constants
      */
     inline constexpr std::size_t MIN_ISO8601_LENGTH{ 20 };
 
+    /**
+     * @brief Maximum length of ISO 8601 duration string
+     * @details "-P10675199DT2H48M5.4775808S" format (TimeSpan minimum value)
+     */
+    inline constexpr std::size_t MAX_ISO8601_DURATION_LENGTH{ 32 };
+
     //----------------------------------------------
     // Unix epoch format limits
     //----------------------------------------------
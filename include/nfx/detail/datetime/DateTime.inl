@@ -30,9 +30,16 @@
  *          main header to improve compilation times while maintaining zero-cost abstractions.
  */
 
+#include <algorithm>
+#include <ostream>
 #include <stdexcept>
 
 #include "Constants.h"
+#include "Format.h"
+#include "Hash.h"
+#include "Iso8601.h"
+#include "Pattern.h"
+#include "Stats.h"
 
 namespace nfx::time
 {
@@ -74,26 +81,6 @@ namespace nfx::time
         }
     }
 
-    inline DateTime::DateTime( std::string_view iso8601String )
-    {
-        DateTime result;
-        if( !fromString( iso8601String, result ) )
-        {
-            throw std::invalid_argument{ "Invalid ISO 8601 DateTime string" };
-        }
-        m_ticks = result.m_ticks;
-    }
-
-    inline DateTime::DateTime( const char* iso8601String )
-        : DateTime{ std::string_view{ iso8601String } }
-    {
-    }
-
-    inline DateTime::DateTime( std::initializer_list<const char*> list )
-        : DateTime{ list.size() > 0 ? std::string_view{ *list.begin() } : std::string_view{} }
-    {
-    }
-
     //----------------------------------------------
     // Comparison operators
     //----------------------------------------------
@@ -159,6 +146,109 @@ namespace nfx::time
         return m_ticks;
     }
 
+    inline constexpr DateTime::Components DateTime::components() const noexcept
+    {
+        // Civil-from-days after H. Hinnant, counting years from March 1st so that the
+        // leap day falls at the end of each computational year (valid ticks are non-negative)
+        const std::uint64_t totalDays{ static_cast<std::uint64_t>( m_ticks / constants::TICKS_PER_DAY ) };
+        const std::uint64_t days{ totalDays + constants::DAYS_FROM_MARCH_0000_TO_JANUARY_0001 };
+
+        const std::uint64_t era{ days / constants::DAYS_PER_400_YEARS };
+        const std::uint64_t dayOfEra{ days - era * constants::DAYS_PER_400_YEARS }; // [0, 146096]
+        const std::uint64_t yearOfEra{ ( dayOfEra - dayOfEra / ( constants::DAYS_PER_4_YEARS - 1 ) +
+                                           dayOfEra / constants::DAYS_PER_100_YEARS -
+                                           dayOfEra / ( constants::DAYS_PER_400_YEARS - 1 ) ) /
+                                       constants::DAYS_PER_YEAR }; // [0, 399]
+        const std::uint64_t marchDayOfYear{ dayOfEra - ( constants::DAYS_PER_YEAR * yearOfEra + yearOfEra / 4 -
+                                                           yearOfEra / 100 ) }; // [0, 365], March 1st = 0
+        const std::uint64_t monthIndex{ ( 5 * marchDayOfYear + 2 ) / 153 };    // [0, 11], March = 0
+
+        // January and February belong to the next civil year
+        const std::int32_t isJanuaryOrFebruary{ monthIndex >= 10 };
+
+        Components c;
+        c.year = static_cast<std::int32_t>( era * 400 + yearOfEra ) + isJanuaryOrFebruary;
+        c.month = static_cast<std::int32_t>( monthIndex + 3 ) - 12 * isJanuaryOrFebruary;
+        c.day = static_cast<std::int32_t>( marchDayOfYear - ( 153 * monthIndex + 2 ) / 5 + 1 );
+
+        // March 1st is day 60 (61 in leap years); January 1st is March-based day 306
+        const std::int32_t leapDay{ isLeapYear( c.year ) };
+        c.dayOfYear = static_cast<std::int32_t>( marchDayOfYear ) + 60 + leapDay -
+                      isJanuaryOrFebruary * ( constants::DAYS_PER_YEAR + leapDay );
+
+        // January 1, 0001 was a Monday
+        c.dayOfWeek = static_cast<std::int32_t>( ( totalDays + 1 ) % 7 );
+
+        const std::int64_t timeTicks{ m_ticks % constants::TICKS_PER_DAY };
+        c.hour = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_HOUR );
+        c.minute = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_MINUTE % constants::MINUTES_PER_HOUR );
+        c.second = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_SECOND % constants::SECONDS_PER_MINUTE );
+        c.subsecondTicks = static_cast<std::int32_t>( timeTicks % constants::TICKS_PER_SECOND );
+
+        return c;
+    }
+
+    inline constexpr std::int32_t DateTime::year() const noexcept
+    {
+        return components().year;
+    }
+
+    inline constexpr std::int32_t DateTime::month() const noexcept
+    {
+        return components().month;
+    }
+
+    inline constexpr std::int32_t DateTime::day() const noexcept
+    {
+        return components().day;
+    }
+
+    inline constexpr std::int32_t DateTime::hour() const noexcept
+    {
+        return static_cast<std::int32_t>( m_ticks % constants::TICKS_PER_DAY / constants::TICKS_PER_HOUR );
+    }
+
+    inline constexpr std::int32_t DateTime::minute() const noexcept
+    {
+        return static_cast<std::int32_t>( m_ticks / constants::TICKS_PER_MINUTE % constants::MINUTES_PER_HOUR );
+    }
+
+    inline constexpr std::int32_t DateTime::second() const noexcept
+    {
+        return static_cast<std::int32_t>( m_ticks / constants::TICKS_PER_SECOND % constants::SECONDS_PER_MINUTE );
+    }
+
+    inline constexpr std::int32_t DateTime::millisecond() const noexcept
+    {
+        return static_cast<std::int32_t>(
+            m_ticks % constants::TICKS_PER_SECOND / constants::TICKS_PER_MILLISECOND );
+    }
+
+    inline constexpr std::int32_t DateTime::microsecond() const noexcept
+    {
+        const auto remainderTicks{ m_ticks % 10000 };
+
+        return static_cast<std::int32_t>( remainderTicks / 10 );
+    }
+
+    inline constexpr std::int32_t DateTime::nanosecond() const noexcept
+    {
+        const auto remainderTicks{ m_ticks % 10 };
+
+        return static_cast<std::int32_t>( remainderTicks * 100 );
+    }
+
+    inline constexpr std::int32_t DateTime::dayOfWeek() const noexcept
+    {
+        // January 1, 0001 was a Monday
+        return static_cast<std::int32_t>( ( m_ticks / constants::TICKS_PER_DAY + 1 ) % 7 );
+    }
+
+    inline constexpr std::int32_t DateTime::dayOfYear() const noexcept
+    {
+        return components().dayOfYear;
+    }
+
     //----------------------------------------------
     // Conversion methods
     //----------------------------------------------
@@ -173,10 +263,104 @@ namespace nfx::time
         return ( m_ticks - constants::UNIX_EPOCH_TICKS ) / constants::TICKS_PER_MILLISECOND;
     }
 
+    inline constexpr DateTime DateTime::date() const noexcept
+    {
+        return DateTime{ ( m_ticks / constants::TICKS_PER_DAY ) * constants::TICKS_PER_DAY };
+    }
+
+    inline constexpr TimeSpan DateTime::timeOfDay() const noexcept
+    {
+        return TimeSpan{ m_ticks % constants::TICKS_PER_DAY };
+    }
+
+    //----------------------------------------------
+    // Bucketing
+    //----------------------------------------------
+
+    inline constexpr DateTime DateTime::floor( const TimeSpan& interval ) const noexcept
+    {
+        const auto width{ interval.ticks() };
+        if( width <= 0 )
+        {
+            return *this;
+        }
+
+        auto remainder{ m_ticks % width };
+        remainder += remainder < 0 ? width : 0;
+
+        return DateTime{ m_ticks - remainder };
+    }
+
+    inline constexpr DateTime DateTime::ceil( const TimeSpan& interval ) const noexcept
+    {
+        const auto start{ floor( interval ) };
+        if( start.m_ticks == m_ticks )
+        {
+            return start;
+        }
+
+        // The bucket after the last one would exceed max(): clamp like addMonths()
+        if( interval.ticks() > constants::MAX_DATETIME_TICKS - start.m_ticks )
+        {
+            return max();
+        }
+
+        return DateTime{ start.m_ticks + interval.ticks() };
+    }
+
+    inline constexpr DateTime DateTime::round( const TimeSpan& interval ) const noexcept
+    {
+        const auto start{ floor( interval ) };
+        const auto remainder{ m_ticks - start.m_ticks };
+
+        // remainder >= width - remainder, written without overflow
+        if( remainder == 0 || remainder < interval.ticks() - remainder )
+        {
+            return start;
+        }
+
+        if( interval.ticks() > constants::MAX_DATETIME_TICKS - start.m_ticks )
+        {
+            return max();
+        }
+
+        return DateTime{ start.m_ticks + interval.ticks() };
+    }
+
+    inline constexpr DateTime DateTime::startOfWeek( std::int32_t firstDayOfWeek ) const noexcept
+    {
+        const std::int64_t days{ m_ticks / constants::TICKS_PER_DAY };
+
+        // January 1, 0001 was a Monday
+        const std::int64_t dayOfWeek{ ( days + 1 ) % 7 };
+        const std::int64_t daysBack{ ( dayOfWeek - firstDayOfWeek % 7 + 14 ) % 7 };
+
+        return DateTime{ std::max( days - daysBack, std::int64_t{ 0 } ) * constants::TICKS_PER_DAY };
+    }
+
+    inline constexpr DateTime DateTime::startOfMonth() const noexcept
+    {
+        const auto c{ components() };
+
+        return DateTime{ ( m_ticks / constants::TICKS_PER_DAY - ( c.day - 1 ) ) * constants::TICKS_PER_DAY };
+    }
+
+    inline constexpr DateTime DateTime::startOfYear() const noexcept
+    {
+        const auto c{ components() };
+
+        return DateTime{ ( m_ticks / constants::TICKS_PER_DAY - ( c.dayOfYear - 1 ) ) * constants::TICKS_PER_DAY };
+    }
+
     //----------------------------------------------
     // Validation methods
     //----------------------------------------------
 
+    inline constexpr bool DateTime::isValid() const noexcept
+    {
+        return m_ticks >= constants::MIN_DATETIME_TICKS && m_ticks <= constants::MAX_DATETIME_TICKS;
+    }
+
     inline constexpr bool DateTime::isLeapYear( std::int32_t year ) noexcept
     {
         return ( year % 4 == 0 && year % 100 != 0 ) || ( year % 400 == 0 );
@@ -189,127 +373,689 @@ namespace nfx::time
             return 0;
         }
 
-        if( month == 2 && isLeapYear( year ) )
+        // Months with 31 days have their bit set (January = bit 0)
+        const std::int32_t isLongMonth{ ( 0xAD5 >> ( month - 1 ) ) & 1 };
+
+        return month == 2 ? 28 + isLeapYear( year ) : 30 + isLongMonth;
+    }
+
+    //----------------------------------------------
+    // Static factory methods
+    //----------------------------------------------
+
+    inline constexpr DateTime DateTime::min() noexcept
+    {
+        return DateTime{ constants::MIN_DATETIME_TICKS };
+    }
+
+    inline constexpr DateTime DateTime::max() noexcept
+    {
+        return DateTime{ constants::MAX_DATETIME_TICKS };
+    }
+
+    inline constexpr DateTime DateTime::epoch() noexcept
+    {
+        return DateTime{ constants::UNIX_EPOCH_TICKS };
+    }
+
+    template <ClockSource Clock>
+    inline DateTime DateTime::utcNow() noexcept
+    {
+        return DateTime{ Clock::utcTicks() };
+    }
+
+    inline constexpr DateTime DateTime::fromEpochSeconds( std::int64_t seconds ) noexcept
+    {
+        std::int64_t ticks{ constants::UNIX_EPOCH_TICKS + ( seconds * constants::TICKS_PER_SECOND ) };
+
+        return DateTime{ ticks };
+    }
+
+    inline constexpr DateTime DateTime::fromEpochMilliseconds( std::int64_t milliseconds ) noexcept
+    {
+        std::int64_t ticks{ constants::UNIX_EPOCH_TICKS + ( milliseconds * constants::TICKS_PER_MILLISECOND ) };
+
+        return DateTime{ ticks };
+    }
+
+    //----------------------------------------------
+    // String formatting
+    //----------------------------------------------
+
+    inline std::size_t DateTime::formatTo( std::span<char> buffer, Format format ) const noexcept
+    {
+        return formatTo( buffer.data(), buffer.size(), format );
+    }
+
+    template <typename OutputIt>
+        requires( !std::is_pointer_v<OutputIt> && std::output_iterator<OutputIt, char> )
+    inline OutputIt DateTime::formatTo( OutputIt out, Format format ) const
+    {
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        const auto length{ formatTo( buffer, sizeof( buffer ), format ) };
+
+        return std::copy_n( buffer, length, out );
+    }
+
+    //=====================================================================
+    // Stream operators
+    //=====================================================================
+
+    inline std::ostream& operator<<( std::ostream& os, const DateTime& dateTime )
+    {
+        os << dateTime.toString( nfx::time::DateTime::Format::Iso8601 );
+
+        return os;
+    }
+
+
+    std::istream& operator>>( std::istream& is, DateTime& dateTime );
+} // namespace nfx::time
+
+namespace nfx::time::detail
+{
+    //=====================================================================
+    // Civil calendar conversion
+    //=====================================================================
+
+    /*
+        Civil calendar conversions:
+        Branch-free days-from-civil after H. Hinnant ("chrono-Compatible Low-Level Date
+        Algorithms"). Years are counted from March 1st so that the leap day falls at the
+        end of each computational year; month lengths then follow the fixed
+        (153 * m + 2) / 5 pattern and no per-month loop is needed. The inverse
+        conversion lives in DateTime::components() so it is usable in constant expressions.
+    */
+
+    /** @brief Convert date components to ticks */
+    [[nodiscard]] constexpr std::int64_t dateToTicks( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
+    {
+        // Clamp month to valid range to prevent out-of-range month arithmetic
+        const std::int64_t validMonth{ std::clamp( month, 1, 12 ) };
+
+        // January and February belong to the previous computational (March-based) year
+        const std::int64_t isJanuaryOrFebruary{ validMonth <= 2 };
+        const std::int64_t y{ year - isJanuaryOrFebruary };
+
+        const std::int64_t era{ y / 400 };
+        const std::int64_t yearOfEra{ y - era * 400 };                             // [0, 399]
+        const std::int64_t monthIndex{ validMonth - 3 + 12 * isJanuaryOrFebruary }; // [0, 11], March = 0
+        const std::int64_t dayOfYear{ ( 153 * monthIndex + 2 ) / 5 + day - 1 };   // [0, 365]
+        const std::int64_t dayOfEra{ yearOfEra * constants::DAYS_PER_YEAR + yearOfEra / 4 - yearOfEra / 100 +
+                                     dayOfYear }; // [0, 146096]
+
+        const std::int64_t totalDays{ era * constants::DAYS_PER_400_YEARS + dayOfEra -
+                                      constants::DAYS_FROM_MARCH_0000_TO_JANUARY_0001 };
+
+        return totalDays * constants::TICKS_PER_DAY;
+    }
+
+    /** @brief Convert time components to ticks */
+    [[nodiscard]] constexpr std::int64_t timeToTicks(
+        std::int32_t hour, std::int32_t minute, std::int32_t second, std::int32_t millisecond ) noexcept
+    {
+        return ( static_cast<std::int64_t>( hour ) * constants::TICKS_PER_HOUR ) +
+               ( static_cast<std::int64_t>( minute ) * constants::TICKS_PER_MINUTE ) +
+               ( static_cast<std::int64_t>( second ) * constants::TICKS_PER_SECOND ) +
+               ( static_cast<std::int64_t>( millisecond ) * constants::TICKS_PER_MILLISECOND );
+    }
+
+    /** @brief Validate date components */
+    [[nodiscard]] constexpr bool isValidDate( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
+    {
+        if( year < constants::MIN_YEAR || year > constants::MAX_YEAR )
         {
-            return 29;
+            return false;
         }
+        if( month < 1 || month > 12 )
+        {
+            return false;
+        }
+        if( day < 1 || day > DateTime::daysInMonth( year, month ) )
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    /** @brief Validate time components */
+    [[nodiscard]] constexpr bool isValidTime(
+        std::int32_t hour, std::int32_t minute, std::int32_t second, std::int32_t millisecond ) noexcept
+    {
+        return hour >= 0 && hour <= constants::HOURS_PER_DAY - 1 && minute >= 0 &&
+               minute <= constants::MINUTES_PER_HOUR - 1 && second >= 0 &&
+               second <= constants::SECONDS_PER_MINUTE - 1 && millisecond >= 0 &&
+               millisecond <= constants::MILLISECONDS_PER_SECOND - 1;
+    }
+} // namespace nfx::time::detail
+
+namespace nfx::time::detail
+{
+    /** @brief Add a number of months to a DateTime, clamping the day and the result range */
+    [[nodiscard]] constexpr DateTime addCalendarMonths( const DateTime& value, std::int64_t months ) noexcept
+    {
+        const auto c{ value.components() };
 
-        switch( month )
+        // Months since January of year 0, normalized with one floor division
+        const std::int64_t monthIndex{ std::int64_t{ c.year } * 12 + ( c.month - 1 ) + months };
+        const std::int64_t year{ ( monthIndex >= 0 ? monthIndex : monthIndex - 11 ) / 12 };
+        if( year < constants::MIN_YEAR )
         {
-            case 1:
-            {
-                return 31;
-            }
-            case 2:
-            {
-                return 28; // Non-leap year February
-            }
-            case 3:
+            return DateTime::min();
+        }
+        if( year > constants::MAX_YEAR )
+        {
+            return DateTime::max();
+        }
+
+        const auto targetYear{ static_cast<std::int32_t>( year ) };
+        const auto targetMonth{ static_cast<std::int32_t>( monthIndex - year * 12 ) + 1 };
+        const auto targetDay{ std::min( c.day, DateTime::daysInMonth( targetYear, targetMonth ) ) };
+
+        return DateTime{ dateToTicks( targetYear, targetMonth, targetDay ) + value.ticks() % constants::TICKS_PER_DAY };
+    }
+} // namespace nfx::time::detail
+
+namespace nfx::time::detail
+{
+    //=====================================================================
+    // ISO 8601 parsing
+    //=====================================================================
+
+    /**
+     * @brief Validate decoded date/time fields and convert them to ticks
+     * @param fields Decoded fields
+     * @param fractionTicks Sub-second ticks to add
+     * @param ticks Receives the DateTime ticks
+     * @return false if a component is out of range
+     */
+    [[nodiscard]] constexpr bool iso8601FieldsToTicks(
+        const Iso8601DateTimeFields& fields, std::int32_t fractionTicks, std::int64_t& ticks ) noexcept
+    {
+        if( fields.year < constants::MIN_YEAR || fields.year > constants::MAX_YEAR || fields.month < 1 ||
+            fields.month > 12 || fields.day < 1 || fields.day > DateTime::daysInMonth( fields.year, fields.month ) ||
+            fields.hour >= constants::HOURS_PER_DAY || fields.minute >= constants::MINUTES_PER_HOUR ||
+            fields.second >= constants::SECONDS_PER_MINUTE )
+        {
+            return false;
+        }
+
+        ticks = dateToTicks( fields.year, fields.month, fields.day ) + fields.hour * constants::TICKS_PER_HOUR +
+                fields.minute * constants::TICKS_PER_MINUTE + fields.second * constants::TICKS_PER_SECOND +
+                fractionTicks;
+
+        return true;
+    }
+
+    /**
+     * @brief Finish a fixed-layout DateTime parse after the 19-character block was decoded
+     * @details Accepts nothing, "Z", or ".f" (one or more digits) optionally followed by "Z".
+     * @param str The complete string (at least 19 characters)
+     * @param fields Fields decoded from the first 19 characters
+     * @param ticks Receives the DateTime ticks
+     * @return false if the tail is malformed or a component is out of range
+     */
+    [[nodiscard]] constexpr bool parseIso8601DateTimeTail(
+        std::string_view str, const Iso8601DateTimeFields& fields, std::int64_t& ticks ) noexcept
+    {
+        const char* p{ str.data() + 19 };
+        const char* const end{ str.data() + str.size() };
+
+        std::int32_t fractionTicks{ 0 };
+        if( p != end && *p == '.' && !decodeIso8601Fraction( ++p, end, fractionTicks ) )
+        {
+            return false;
+        }
+        p += ( p != end && *p == 'Z' );
+
+        return p == end && iso8601FieldsToTicks( fields, fractionTicks, ticks );
+    }
+
+    /**
+     * @brief Parse the fixed ISO 8601 layouts behind DateTime::fromString()'s fast path
+     * @details Accepts "YYYY-MM-DD" and "YYYY-MM-DDTHH:mm:ss" with an optional fraction and
+     *          an optional trailing 'Z'.
+     * @param str The complete string
+     * @param ticks Receives the DateTime ticks
+     * @return false if the string does not match a fixed layout or is out of range
+     */
+    [[nodiscard]] constexpr bool parseIso8601DateTime( std::string_view str, std::int64_t& ticks ) noexcept
+    {
+        Iso8601DateTimeFields fields{};
+        if( str.size() == 10 )
+        {
+            return decodeIso8601Date( str.data(), fields ) && iso8601FieldsToTicks( fields, 0, ticks );
+        }
+
+        return str.size() >= 19 && decodeIso8601DateTimeScalar( str.data(), fields ) &&
+               parseIso8601DateTimeTail( str, fields, ticks );
+    }
+
+    //=====================================================================
+    // ISO 8601 formatting
+    //=====================================================================
+
+    /**
+     * @brief Write a value in one of the named formats, without bounds checking
+     * @details Shared by DateTime (utc = true: ISO 8601 forms end in 'Z', Iso8601Extended in
+     *          "+00:00" and the time-only form has no designator) and DateTimeOffset (every
+     *          form except the date-only one ends in the offset).
+     * @param out Destination with room for constants::MAX_ISO8601_LENGTH characters
+     * @param c Calendar components of the (local) value
+     * @param utcTicks UTC instant, used by the Unix timestamp formats
+     * @param offsetMinutes UTC offset in minutes (0 for DateTime)
+     * @param utc true to write the 'Z' designator instead of an offset
+     * @param format Named format
+     * @return Position one past the last character written
+     */
+    inline char* formatNamed( char* out,
+        const DateTime::Components& c,
+        std::int64_t utcTicks,
+        std::int32_t offsetMinutes,
+        bool utc,
+        DateTime::Format format ) noexcept
+    {
+        switch( format )
+        {
+            case DateTime::Format::Iso8601Basic:
             {
-                return 31;
+                out = appendIso8601BasicDateTime( out, c.year, c.month, c.day, c.hour, c.minute, c.second );
+                if( !utc )
+                {
+                    return appendOffset( out, offsetMinutes, false );
+                }
+                break;
             }
-            case 4:
+            case DateTime::Format::Iso8601Date:
             {
-                return 30;
+                return appendIso8601Date( out, c.year, c.month, c.day );
             }
-            case 5:
+            case DateTime::Format::Iso8601Time:
             {
-                return 31;
+                out = appendIso8601Time( out, c.hour, c.minute, c.second );
+
+                return utc ? out : appendOffset( out, offsetMinutes );
             }
-            case 6:
+            case DateTime::Format::UnixSeconds:
             {
-                return 30;
+                return appendInteger( out, ( utcTicks - constants::UNIX_EPOCH_TICKS ) / constants::TICKS_PER_SECOND );
             }
-            case 7:
+            case DateTime::Format::UnixMilliseconds:
             {
-                return 31;
+                return appendInteger(
+                    out, ( utcTicks - constants::UNIX_EPOCH_TICKS ) / constants::TICKS_PER_MILLISECOND );
             }
-            case 8:
+            case DateTime::Format::Iso8601Extended:
             {
-                return 31;
+                out = appendIso8601DateTime( out, c.year, c.month, c.day, c.hour, c.minute, c.second );
+
+                return appendOffset( out, offsetMinutes );
             }
-            case 9:
+            case DateTime::Format::Iso8601Precise:
             {
-                return 30;
+                out = appendIso8601DateTime( out, c.year, c.month, c.day, c.hour, c.minute, c.second );
+                out = appendFractionalSeconds( out, c.subsecondTicks, 7 );
+                break;
             }
-            case 10:
+            case DateTime::Format::Iso8601PreciseTrimmed:
             {
-                return 31;
+                out = appendIso8601DateTime( out, c.year, c.month, c.day, c.hour, c.minute, c.second );
+                out = appendFractionalSecondsTrimmed( out, c.subsecondTicks );
+                break;
             }
-            case 11:
+            case DateTime::Format::Iso8601Millis:
             {
-                return 30;
+                out = appendIso8601DateTime( out, c.year, c.month, c.day, c.hour, c.minute, c.second );
+                out = appendFractionalSeconds(
+                    out, static_cast<std::int32_t>( c.subsecondTicks / constants::TICKS_PER_MILLISECOND ), 3 );
+                break;
             }
-            case 12:
+            case DateTime::Format::Iso8601Micros:
             {
-                return 31;
+                out = appendIso8601DateTime( out, c.year, c.month, c.day, c.hour, c.minute, c.second );
+                out = appendFractionalSeconds(
+                    out, static_cast<std::int32_t>( c.subsecondTicks / constants::TICKS_PER_MICROSECOND ), 6 );
+                break;
             }
             default:
             {
-                return 0;
+                out = appendIso8601DateTime( out, c.year, c.month, c.day, c.hour, c.minute, c.second );
+                break;
             }
         }
+
+        if( !utc )
+        {
+            return appendOffset( out, offsetMinutes );
+        }
+        *out++ = 'Z';
+
+        return out;
     }
+} // namespace nfx::time::detail
+
+namespace nfx::time
+{
+    //=====================================================================
+    // DateTime class
+    //=====================================================================
 
     //----------------------------------------------
-    // Static factory methods
+    // Component construction
     //----------------------------------------------
 
-    inline constexpr DateTime DateTime::min() noexcept
+    inline constexpr DateTime::DateTime( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
+        : m_ticks{ constants::MIN_DATETIME_TICKS }
     {
-        return DateTime{ constants::MIN_DATETIME_TICKS };
+        if( detail::isValidDate( year, month, day ) )
+        {
+            m_ticks = detail::dateToTicks( year, month, day );
+        }
     }
 
-    inline constexpr DateTime DateTime::max() noexcept
+    inline constexpr DateTime::DateTime(
+        std::int32_t year,
+        std::int32_t month,
+        std::int32_t day,
+        std::int32_t hour,
+        std::int32_t minute,
+        std::int32_t second ) noexcept
+        : m_ticks{ constants::MIN_DATETIME_TICKS }
     {
-        return DateTime{ constants::MAX_DATETIME_TICKS };
+        if( detail::isValidDate( year, month, day ) && detail::isValidTime( hour, minute, second, 0 ) )
+        {
+            m_ticks = detail::dateToTicks( year, month, day ) + detail::timeToTicks( hour, minute, second, 0 );
+        }
     }
 
-    inline constexpr DateTime DateTime::epoch() noexcept
+    inline constexpr DateTime::DateTime(
+        std::int32_t year,
+        std::int32_t month,
+        std::int32_t day,
+        std::int32_t hour,
+        std::int32_t minute,
+        std::int32_t second,
+        std::int32_t millisecond ) noexcept
+        : m_ticks{ constants::MIN_DATETIME_TICKS }
     {
-        return DateTime{ constants::UNIX_EPOCH_TICKS };
+        if( detail::isValidDate( year, month, day ) && detail::isValidTime( hour, minute, second, millisecond ) )
+        {
+            m_ticks =
+                detail::dateToTicks( year, month, day ) + detail::timeToTicks( hour, minute, second, millisecond );
+        }
     }
 
-    inline constexpr DateTime DateTime::fromEpochSeconds( std::int64_t seconds ) noexcept
+    //----------------------------------------------
+    // String parsing
+    //----------------------------------------------
+
+    inline constexpr DateTime::DateTime( std::string_view iso8601String )
+        : m_ticks{ constants::MIN_DATETIME_TICKS }
     {
-        std::int64_t ticks{ constants::UNIX_EPOCH_TICKS + ( seconds * constants::TICKS_PER_SECOND ) };
+        // Constant evaluation accepts the fixed layouts only, the flexible fallback needs std::from_chars
+        if( std::is_constant_evaluated() )
+        {
+            if( !detail::parseIso8601DateTime( iso8601String, m_ticks ) )
+            {
+                throw std::invalid_argument{ "Invalid ISO 8601 DateTime string" };
+            }
+            return;
+        }
 
-        return DateTime{ ticks };
+        DateTime result;
+        if( !fromString( iso8601String, result ) )
+        {
+            throw std::invalid_argument{ "Invalid ISO 8601 DateTime string" };
+        }
+        m_ticks = result.m_ticks;
     }
 
-    inline constexpr DateTime DateTime::fromEpochMilliseconds( std::int64_t milliseconds ) noexcept
+    inline constexpr DateTime::DateTime( const char* iso8601String )
+        : DateTime{ std::string_view{ iso8601String } }
     {
-        std::int64_t ticks{ constants::UNIX_EPOCH_TICKS + ( milliseconds * constants::TICKS_PER_MILLISECOND ) };
+    }
 
-        return DateTime{ ticks };
+    inline constexpr DateTime::DateTime( std::initializer_list<const char*> list )
+        : DateTime{ list.size() > 0 ? std::string_view{ *list.begin() } : std::string_view{} }
+    {
+    }
+
+    //----------------------------------------------
+    // String formatting
+    //----------------------------------------------
+
+    inline std::string DateTime::toString( Format format ) const
+    {
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        const auto length{ formatTo( buffer, sizeof( buffer ), format ) };
+
+        return std::string{ buffer, length };
+    }
+
+    inline std::size_t DateTime::formatTo( char* buffer, std::size_t capacity, Format format ) const noexcept
+    {
+        NFX_DATETIME_COUNT_STAT( detail::StatCounter::Format, static_cast<std::size_t>( format ) );
+
+        return detail::formatInto<constants::MAX_ISO8601_LENGTH>(
+            buffer,
+            capacity,
+            [this, format]( char* out ) noexcept {
+                return detail::formatNamed( out, components(), m_ticks, 0, true, format );
+            } );
+    }
+
+    //----------------------------------------------
+    // Calendar arithmetic
+    //----------------------------------------------
+
+    inline constexpr DateTime DateTime::addMonths( std::int32_t months ) const noexcept
+    {
+        return detail::addCalendarMonths( *this, months );
+    }
+
+    inline constexpr DateTime DateTime::addYears( std::int32_t years ) const noexcept
+    {
+        return detail::addCalendarMonths( *this, std::int64_t{ years } * 12 );
+    }
+
+    inline constexpr DateTime DateTime::addBusinessDays( std::int32_t days ) const noexcept
+    {
+        if( days == 0 )
+        {
+            return *this;
+        }
+
+        // Weekday index with Monday = 0 (January 1, 0001 was a Monday)
+        const std::int64_t totalDays{ m_ticks / constants::TICKS_PER_DAY };
+        std::int64_t weekday{ totalDays % 7 };
+        std::int64_t offsetDays{ 0 };
+
+        // A weekend start counts from the adjacent business day in the direction of travel
+        if( weekday >= 5 )
+        {
+            offsetDays = days > 0 ? 4 - weekday : 7 - weekday;
+            weekday = days > 0 ? 4 : 0;
+        }
+
+        const std::int64_t count{ days > 0 ? std::int64_t{ days } : -std::int64_t{ days } };
+        const std::int64_t weeks{ count / 5 };
+        const std::int64_t remainder{ count % 5 };
+
+        // The remainder crosses one weekend when it runs past Friday (or before Monday)
+        std::int64_t span{ weeks * 7 + remainder };
+        if( days > 0 )
+        {
+            span += weekday + remainder > 4 ? 2 : 0;
+        }
+        else
+        {
+            span += weekday - remainder < 0 ? 2 : 0;
+            span = -span;
+        }
+
+        // Bound the shift before scaling to ticks so huge counts cannot overflow
+        constexpr std::int64_t maxDays{ constants::MAX_DATETIME_TICKS / constants::TICKS_PER_DAY + 1 };
+        const std::int64_t shift{ std::clamp( offsetDays + span, -maxDays, maxDays ) };
+        const std::int64_t ticks{ m_ticks + shift * constants::TICKS_PER_DAY };
+
+        return DateTime{ std::clamp( ticks, constants::MIN_DATETIME_TICKS, constants::MAX_DATETIME_TICKS ) };
     }
 
     //=====================================================================
-    // Stream operators
+    // User-defined literals
     //=====================================================================
 
-    std::ostream& operator<<( std::ostream& os, const DateTime& dateTime );
+    namespace literals
+    {
+        /**
+         * @brief ISO 8601 DateTime literal, e.g. "2024-01-15T12:30:45Z"_dt
+         * @details Parsed at compile time; a malformed or out-of-range timestamp is a compile error.
+         *          Accepts the fixed layouts of DateTime::fromString()'s fast path.
+         */
+        consteval DateTime operator""_dt( const char* str, std::size_t length )
+        {
+            std::int64_t ticks{ 0 };
+            if( !detail::parseIso8601DateTime( std::string_view{ str, length }, ticks ) )
+            {
+                throw std::invalid_argument{ "Invalid ISO 8601 DateTime literal" };
+            }
 
-    std::istream& operator>>( std::istream& is, DateTime& dateTime );
+            return DateTime{ ticks };
+        }
+    } // namespace literals
 } // namespace nfx::time
 
 //=====================================================================
 // std::formatter specialization
 //=====================================================================
 
+namespace nfx::time::detail
+{
+    /**
+     * @brief Map a named format specifier to a DateTime::Format
+     * @param name Specifier text (e.g. "ms", "basic", "unix")
+     * @param format Receives the format on success
+     * @return true if name is a known specifier
+     */
+    [[nodiscard]] constexpr bool tryParseFormatName( std::string_view name, DateTime::Format& format ) noexcept
+    {
+        struct NamedFormat
+        {
+            std::string_view name;
+            DateTime::Format format;
+        };
+
+        constexpr NamedFormat names[]{
+            { "iso", DateTime::Format::Iso8601 },
+            { "precise", DateTime::Format::Iso8601Precise },
+            { "trimmed", DateTime::Format::Iso8601PreciseTrimmed },
+            { "ms", DateTime::Format::Iso8601Millis },
+            { "us", DateTime::Format::Iso8601Micros },
+            { "ext", DateTime::Format::Iso8601Extended },
+            { "extended", DateTime::Format::Iso8601Extended },
+            { "basic", DateTime::Format::Iso8601Basic },
+            { "date", DateTime::Format::Iso8601Date },
+            { "time", DateTime::Format::Iso8601Time },
+            { "unix", DateTime::Format::UnixSeconds },
+            { "unixms", DateTime::Format::UnixMilliseconds },
+        };
+
+        for( const auto& entry : names )
+        {
+            if( entry.name == name )
+            {
+                format = entry.format;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Parse a DateTime / DateTimeOffset format specifier
+     * @param ctx Format parse context positioned after the ':'
+     * @param format Receives the named format (unchanged for an empty spec or a pattern)
+     * @param pattern Receives the custom pattern, or stays empty for a named format
+     * @return Iterator to the closing '}'
+     * @throws std::format_error if the spec is neither a named format nor a valid pattern
+     */
+    template <typename ParseContext>
+    constexpr auto parseDateTimeFormatSpec( ParseContext& ctx, DateTime::Format& format, std::string_view& pattern )
+    {
+        auto it{ ctx.begin() };
+        while( it != ctx.end() && *it != '}' )
+        {
+            ++it;
+        }
+
+        const std::string_view spec{ ctx.begin(), it };
+        if( spec.empty() || tryParseFormatName( spec, format ) )
+        {
+            return it;
+        }
+
+        if( !isValidPattern( spec ) )
+        {
+            throw std::format_error{ "Invalid DateTime format specifier" };
+        }
+
+        pattern = spec;
+
+        return it;
+    }
+} // namespace nfx::time::detail
+
 namespace std
 {
+    /**
+     * @brief Formatter for DateTime
+     * @details Accepts a named format ({:iso}, {:precise}, {:trimmed}, {:ms}, {:us}, {:ext},
+     *          {:basic}, {:date}, {:time}, {:unix}, {:unixms}) or a custom pattern such as
+     *          {:yyyy-MM-dd HH:mm:ss.fff}. An empty spec formats as Iso8601.
+     */
     template <>
     struct formatter<nfx::time::DateTime>
     {
         constexpr auto parse( std::format_parse_context& ctx )
         {
-            return ctx.begin();
+            return nfx::time::detail::parseDateTimeFormatSpec( ctx, m_format, m_pattern );
         }
 
         auto format( const nfx::time::DateTime& dt, std::format_context& ctx ) const
         {
-            return format_to( ctx.out(), "{}", dt.toString( nfx::time::DateTime::Format::Iso8601 ) );
+            if( m_pattern.empty() )
+            {
+                return dt.formatTo( ctx.out(), m_format );
+            }
+
+            return nfx::time::detail::writePattern( ctx.out(), m_pattern, dt.components(), 0, false );
+        }
+
+    private:
+        nfx::time::DateTime::Format m_format{ nfx::time::DateTime::Format::Iso8601 };
+        std::string_view m_pattern;
+    };
+} // namespace std
+
+//=====================================================================
+// std::hash specialization
+//=====================================================================
+
+namespace std
+{
+    /**
+     * @brief Hash for DateTime
+     * @details Mixes the tick count, so second- or day-aligned instants spread over every bucket.
+     */
+    template <>
+    struct hash<nfx::time::DateTime>
+    {
+        std::size_t operator()( const nfx::time::DateTime& value ) const noexcept
+        {
+            return nfx::time::detail::hashTicks( static_cast<std::uint64_t>( value.ticks() ) );
         }
     };
 } // namespace std
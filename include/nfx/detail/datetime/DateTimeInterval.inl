@@ -0,0 +1,241 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DateTimeInterval.inl
+ * @brief Inline implementations for DateTimeInterval and DateTimeOffsetInterval
+ */
+
+#include <algorithm>
+
+namespace nfx::time
+{
+    //=====================================================================
+    // DateTimeInterval class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    inline constexpr DateTimeInterval::DateTimeInterval( const DateTime& start, const DateTime& end ) noexcept
+        : m_start{ std::min( start, end ) },
+          m_end{ std::max( start, end ) }
+    {
+    }
+
+    inline constexpr DateTimeInterval::DateTimeInterval( const DateTime& start, const TimeSpan& duration ) noexcept
+        : DateTimeInterval{ start, start + duration }
+    {
+    }
+
+    //----------------------------------------------
+    // Property accessors
+    //----------------------------------------------
+
+    inline constexpr DateTime DateTimeInterval::start() const noexcept
+    {
+        return m_start;
+    }
+
+    inline constexpr DateTime DateTimeInterval::end() const noexcept
+    {
+        return m_end;
+    }
+
+    inline constexpr TimeSpan DateTimeInterval::duration() const noexcept
+    {
+        return m_end - m_start;
+    }
+
+    inline constexpr bool DateTimeInterval::isEmpty() const noexcept
+    {
+        return m_start.ticks() == m_end.ticks();
+    }
+
+    //----------------------------------------------
+    // Set operations
+    //----------------------------------------------
+
+    inline constexpr bool DateTimeInterval::contains( const DateTime& instant ) const noexcept
+    {
+        return m_start.ticks() <= instant.ticks() && instant.ticks() < m_end.ticks();
+    }
+
+    inline constexpr bool DateTimeInterval::contains( const DateTimeInterval& other ) const noexcept
+    {
+        return m_start.ticks() <= other.m_start.ticks() && other.m_end.ticks() <= m_end.ticks();
+    }
+
+    inline constexpr bool DateTimeInterval::overlaps( const DateTimeInterval& other ) const noexcept
+    {
+        return std::max( m_start.ticks(), other.m_start.ticks() ) < std::min( m_end.ticks(), other.m_end.ticks() );
+    }
+
+    inline constexpr bool DateTimeInterval::isAdjacent( const DateTimeInterval& other ) const noexcept
+    {
+        return m_end.ticks() == other.m_start.ticks() || other.m_end.ticks() == m_start.ticks();
+    }
+
+    inline constexpr std::optional<DateTimeInterval> DateTimeInterval::intersect(
+        const DateTimeInterval& other ) const noexcept
+    {
+        const auto start{ std::max( m_start.ticks(), other.m_start.ticks() ) };
+        const auto end{ std::min( m_end.ticks(), other.m_end.ticks() ) };
+        if( start >= end )
+        {
+            return std::nullopt;
+        }
+
+        return DateTimeInterval{ DateTime{ start }, DateTime{ end } };
+    }
+
+    inline constexpr std::optional<DateTimeInterval> DateTimeInterval::merge(
+        const DateTimeInterval& other ) const noexcept
+    {
+        if( std::max( m_start.ticks(), other.m_start.ticks() ) > std::min( m_end.ticks(), other.m_end.ticks() ) )
+        {
+            return std::nullopt;
+        }
+
+        return hull( other );
+    }
+
+    inline constexpr DateTimeInterval DateTimeInterval::hull( const DateTimeInterval& other ) const noexcept
+    {
+        return DateTimeInterval{ DateTime{ std::min( m_start.ticks(), other.m_start.ticks() ) },
+            DateTime{ std::max( m_end.ticks(), other.m_end.ticks() ) } };
+    }
+
+    //=====================================================================
+    // DateTimeOffsetInterval class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    inline constexpr DateTimeOffsetInterval::DateTimeOffsetInterval(
+        const DateTimeOffset& start, const DateTimeOffset& end ) noexcept
+        : m_start{ end.utcTicks() < start.utcTicks() ? end : start },
+          m_end{ end.utcTicks() < start.utcTicks() ? start : end }
+    {
+    }
+
+    inline constexpr DateTimeOffsetInterval::DateTimeOffsetInterval(
+        const DateTimeOffset& start, const TimeSpan& duration ) noexcept
+        : DateTimeOffsetInterval{ start, start + duration }
+    {
+    }
+
+    //----------------------------------------------
+    // Property accessors
+    //----------------------------------------------
+
+    inline constexpr DateTimeOffset DateTimeOffsetInterval::start() const noexcept
+    {
+        return m_start;
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffsetInterval::end() const noexcept
+    {
+        return m_end;
+    }
+
+    inline constexpr TimeSpan DateTimeOffsetInterval::duration() const noexcept
+    {
+        return TimeSpan{ m_end.utcTicks() - m_start.utcTicks() };
+    }
+
+    inline constexpr bool DateTimeOffsetInterval::isEmpty() const noexcept
+    {
+        return m_start.utcTicks() == m_end.utcTicks();
+    }
+
+    //----------------------------------------------
+    // Set operations
+    //----------------------------------------------
+
+    inline constexpr bool DateTimeOffsetInterval::contains( const DateTimeOffset& instant ) const noexcept
+    {
+        return m_start.utcTicks() <= instant.utcTicks() && instant.utcTicks() < m_end.utcTicks();
+    }
+
+    inline constexpr bool DateTimeOffsetInterval::contains( const DateTimeOffsetInterval& other ) const noexcept
+    {
+        return m_start.utcTicks() <= other.m_start.utcTicks() && other.m_end.utcTicks() <= m_end.utcTicks();
+    }
+
+    inline constexpr bool DateTimeOffsetInterval::overlaps( const DateTimeOffsetInterval& other ) const noexcept
+    {
+        return std::max( m_start.utcTicks(), other.m_start.utcTicks() ) <
+               std::min( m_end.utcTicks(), other.m_end.utcTicks() );
+    }
+
+    inline constexpr bool DateTimeOffsetInterval::isAdjacent( const DateTimeOffsetInterval& other ) const noexcept
+    {
+        return m_end.utcTicks() == other.m_start.utcTicks() || other.m_end.utcTicks() == m_start.utcTicks();
+    }
+
+    inline constexpr std::optional<DateTimeOffsetInterval> DateTimeOffsetInterval::intersect(
+        const DateTimeOffsetInterval& other ) const noexcept
+    {
+        const auto& start{ m_start.utcTicks() < other.m_start.utcTicks() ? other.m_start : m_start };
+        const auto& end{ other.m_end.utcTicks() < m_end.utcTicks() ? other.m_end : m_end };
+        if( start.utcTicks() >= end.utcTicks() )
+        {
+            return std::nullopt;
+        }
+
+        return DateTimeOffsetInterval{ start, end };
+    }
+
+    inline constexpr std::optional<DateTimeOffsetInterval> DateTimeOffsetInterval::merge(
+        const DateTimeOffsetInterval& other ) const noexcept
+    {
+        if( std::max( m_start.utcTicks(), other.m_start.utcTicks() ) >
+            std::min( m_end.utcTicks(), other.m_end.utcTicks() ) )
+        {
+            return std::nullopt;
+        }
+
+        return hull( other );
+    }
+
+    inline constexpr DateTimeOffsetInterval DateTimeOffsetInterval::hull(
+        const DateTimeOffsetInterval& other ) const noexcept
+    {
+        return DateTimeOffsetInterval{ other.m_start.utcTicks() < m_start.utcTicks() ? other.m_start : m_start,
+            m_end.utcTicks() < other.m_end.utcTicks() ? other.m_end : m_end };
+    }
+
+    //----------------------------------------------
+    // Conversion
+    //----------------------------------------------
+
+    inline constexpr DateTimeInterval DateTimeOffsetInterval::toUtc() const noexcept
+    {
+        return DateTimeInterval{ DateTime{ m_start.utcTicks() }, DateTime{ m_end.utcTicks() } };
+    }
+} // namespace nfx::time
@@ -31,9 +31,83 @@
  *          performance for UTC conversion and comparison operations.
  */
 
+#include <algorithm>
+#include <ostream>
 #include <stdexcept>
 
 #include "Constants.h"
+#include "Format.h"
+#include "Hash.h"
+#include "Stats.h"
+
+namespace nfx::time::detail
+{
+    //=====================================================================
+    // Validation
+    //=====================================================================
+
+    /** @brief Validate timezone offset is within valid range (±14:00:00) */
+    [[nodiscard]] constexpr bool isValidOffset( const TimeSpan& offset ) noexcept
+    {
+        // Use integer tick comparison to avoid floating-point precision issues
+        const auto offsetTicks{ offset.ticks() };
+
+        // ±14 hours = ±840 minutes = ±50,400 seconds = ±504,000,000,000 ticks
+        constexpr std::int64_t MAX_OFFSET_TICKS{ static_cast<std::int64_t>( constants::HOURS_PER_DAY ) *
+                                                 constants::SECONDS_PER_HOUR * constants::TICKS_PER_SECOND };
+
+        return offsetTicks >= -MAX_OFFSET_TICKS && offsetTicks <= MAX_OFFSET_TICKS;
+    }
+
+    //=====================================================================
+    // ISO 8601 parsing
+    //=====================================================================
+
+    /**
+     * @brief Finish a fixed-layout DateTimeOffset parse after the 19-character block was decoded
+     * @details Accepts an optional ".f" fraction followed by a required "Z", "±HH:MM", "±HHMM"
+     *          or "±HH" offset.
+     * @param str The complete string (at least 19 characters)
+     * @param fields Fields decoded from the first 19 characters
+     * @param ticks Receives the local DateTime ticks
+     * @param offsetTicks Receives the offset ticks
+     * @return false if the tail is malformed or a component is out of range
+     */
+    [[nodiscard]] constexpr bool parseIso8601DateTimeOffsetTail( std::string_view str,
+        const Iso8601DateTimeFields& fields,
+        std::int64_t& ticks,
+        std::int64_t& offsetTicks ) noexcept
+    {
+        const char* p{ str.data() + 19 };
+        const char* const end{ str.data() + str.size() };
+
+        std::int32_t fractionTicks{ 0 };
+        if( p != end && *p == '.' && !decodeIso8601Fraction( ++p, end, fractionTicks ) )
+        {
+            return false;
+        }
+
+        return decodeIso8601Offset( std::string_view{ p, static_cast<std::size_t>( end - p ) }, offsetTicks ) &&
+               iso8601FieldsToTicks( fields, fractionTicks, ticks );
+    }
+
+    /**
+     * @brief Parse the fixed ISO 8601 layouts behind DateTimeOffset::fromString()'s fast path
+     * @details Accepts "YYYY-MM-DDTHH:mm:ss" with an optional fraction and a required offset.
+     * @param str The complete string
+     * @param ticks Receives the local DateTime ticks
+     * @param offsetTicks Receives the offset ticks
+     * @return false if the string does not match a fixed layout or is out of range
+     */
+    [[nodiscard]] constexpr bool parseIso8601DateTimeOffset(
+        std::string_view str, std::int64_t& ticks, std::int64_t& offsetTicks ) noexcept
+    {
+        Iso8601DateTimeFields fields{};
+
+        return str.size() >= 20 && decodeIso8601DateTimeScalar( str.data(), fields ) &&
+               parseIso8601DateTimeOffsetTail( str, fields, ticks, offsetTicks );
+    }
+} // namespace nfx::time::detail
 
 namespace nfx::time
 {
@@ -114,22 +188,36 @@ namespace nfx::time
         m_dateTime += TimeSpan{ microsecond * 10 };
     }
 
-    inline DateTimeOffset::DateTimeOffset( std::string_view iso8601String )
+    inline constexpr DateTimeOffset::DateTimeOffset( std::string_view iso8601String )
         : m_dateTime{ DateTime::min() },
           m_offset{ 0 }
     {
+        // Constant evaluation accepts the fixed layouts only, the flexible fallback needs std::from_chars
+        if( std::is_constant_evaluated() )
+        {
+            std::int64_t ticks{ 0 };
+            std::int64_t offsetTicks{ 0 };
+            if( !detail::parseIso8601DateTimeOffset( iso8601String, ticks, offsetTicks ) )
+            {
+                throw std::invalid_argument{ "Invalid ISO 8601 DateTimeOffset string format" };
+            }
+            m_dateTime = DateTime{ ticks };
+            m_offset = TimeSpan{ offsetTicks };
+            return;
+        }
+
         if( !fromString( iso8601String, *this ) )
         {
             throw std::invalid_argument{ "Invalid ISO 8601 DateTimeOffset string format" };
         }
     }
 
-    inline DateTimeOffset::DateTimeOffset( const char* iso8601String )
+    inline constexpr DateTimeOffset::DateTimeOffset( const char* iso8601String )
         : DateTimeOffset{ std::string_view{ iso8601String } }
     {
     }
 
-    inline DateTimeOffset::DateTimeOffset( std::initializer_list<const char*> list )
+    inline constexpr DateTimeOffset::DateTimeOffset( std::initializer_list<const char*> list )
         : DateTimeOffset{ list.size() > 0 ? std::string_view{ *list.begin() } : std::string_view{} }
     {
     }
@@ -219,42 +307,52 @@ namespace nfx::time
         return m_dateTime.ticks() - m_offset.ticks();
     }
 
-    inline std::int32_t DateTimeOffset::year() const noexcept
+    inline constexpr DateTime DateTimeOffset::utcDateTime() const noexcept
+    {
+        return DateTime{ utcTicks() };
+    }
+
+    inline constexpr DateTime DateTimeOffset::localDateTime() const noexcept
+    {
+        return m_dateTime;
+    }
+
+    inline constexpr std::int32_t DateTimeOffset::year() const noexcept
     {
         return m_dateTime.year();
     }
 
-    inline std::int32_t DateTimeOffset::month() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::month() const noexcept
     {
         return m_dateTime.month();
     }
 
-    inline std::int32_t DateTimeOffset::day() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::day() const noexcept
     {
         return m_dateTime.day();
     }
 
-    inline std::int32_t DateTimeOffset::hour() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::hour() const noexcept
     {
         return m_dateTime.hour();
     }
 
-    inline std::int32_t DateTimeOffset::minute() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::minute() const noexcept
     {
         return m_dateTime.minute();
     }
 
-    inline std::int32_t DateTimeOffset::second() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::second() const noexcept
     {
         return m_dateTime.second();
     }
 
-    inline std::int32_t DateTimeOffset::millisecond() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::millisecond() const noexcept
     {
         return m_dateTime.millisecond();
     }
 
-    inline std::int32_t DateTimeOffset::microsecond() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::microsecond() const noexcept
     {
         // Extract microseconds from ticks (1 microsecond = 10 ticks)
         const auto remainderTicks{ m_dateTime.ticks() % 10000 };
@@ -262,7 +360,7 @@ namespace nfx::time
         return static_cast<std::int32_t>( remainderTicks / 10 );
     }
 
-    inline std::int32_t DateTimeOffset::nanosecond() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::nanosecond() const noexcept
     {
         // Extract nanosecond component (in hundreds of nanoseconds since ticks are 100ns units)
         const auto remainderTicks{ m_dateTime.ticks() % 10 };
@@ -270,16 +368,21 @@ namespace nfx::time
         return static_cast<std::int32_t>( remainderTicks * 100 );
     }
 
-    inline std::int32_t DateTimeOffset::dayOfWeek() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::dayOfWeek() const noexcept
     {
         return m_dateTime.dayOfWeek();
     }
 
-    inline std::int32_t DateTimeOffset::dayOfYear() const noexcept
+    inline constexpr std::int32_t DateTimeOffset::dayOfYear() const noexcept
     {
         return m_dateTime.dayOfYear();
     }
 
+    inline constexpr DateTime::Components DateTimeOffset::components() const noexcept
+    {
+        return m_dateTime.components();
+    }
+
     inline std::int32_t DateTimeOffset::totalOffsetMinutes() const noexcept
     {
         return static_cast<std::int32_t>( m_offset.minutes() );
@@ -289,21 +392,85 @@ namespace nfx::time
     // Conversion methods
     //----------------------------------------------
 
-    inline std::int64_t DateTimeOffset::toEpochSeconds() const noexcept
+    inline constexpr std::int64_t DateTimeOffset::toEpochSeconds() const noexcept
     {
         return utcDateTime().toEpochSeconds();
     }
 
-    inline std::int64_t DateTimeOffset::toEpochMilliseconds() const noexcept
+    inline constexpr std::int64_t DateTimeOffset::toEpochMilliseconds() const noexcept
     {
         return utcDateTime().toEpochMilliseconds();
     }
 
-    inline TimeSpan DateTimeOffset::timeOfDay() const noexcept
+    inline constexpr TimeSpan DateTimeOffset::timeOfDay() const noexcept
     {
         return m_dateTime.timeOfDay();
     }
 
+    inline constexpr DateTimeOffset DateTimeOffset::date() const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.date(), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::toOffset( const TimeSpan& newOffset ) const noexcept
+    {
+        // Convert to UTC, then apply new offset
+        return DateTimeOffset{ utcDateTime() + newOffset, newOffset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::toUniversalTime() const noexcept
+    {
+        return DateTimeOffset{ utcDateTime(), TimeSpan{ 0 } };
+    }
+
+    inline constexpr std::int64_t DateTimeOffset::toFILETIME() const noexcept
+    {
+        // Windows file time: 100-nanosecond intervals since January 1, 1601 UTC
+        const auto utcTicksValue{ utcTicks() };
+
+        // Guard against underflow for dates before FILETIME epoch (Jan 1, 1601)
+        if( utcTicksValue < constants::MICROSOFT_FILETIME_EPOCH_TICKS )
+        {
+            return 0; // Return 0 for dates before FILETIME epoch
+        }
+
+        return utcTicksValue - constants::MICROSOFT_FILETIME_EPOCH_TICKS;
+    }
+
+    //----------------------------------------------
+    // Bucketing
+    //----------------------------------------------
+
+    inline constexpr DateTimeOffset DateTimeOffset::floor( const TimeSpan& interval ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.floor( interval ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::ceil( const TimeSpan& interval ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.ceil( interval ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::round( const TimeSpan& interval ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.round( interval ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::startOfWeek( std::int32_t firstDayOfWeek ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.startOfWeek( firstDayOfWeek ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::startOfMonth() const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.startOfMonth(), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::startOfYear() const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.startOfYear(), m_offset };
+    }
+
     //----------------------------------------------
     // Arithmetic methods
     //----------------------------------------------
@@ -328,6 +495,46 @@ namespace nfx::time
         return *this + TimeSpan{ ticks };
     }
 
+    inline constexpr DateTimeOffset DateTimeOffset::addBusinessDays( std::int32_t days ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.addBusinessDays( days ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::addDays( double days ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime + TimeSpan::fromDays( days ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::addHours( double hours ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime + TimeSpan::fromHours( hours ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::addMilliseconds( double milliseconds ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime + TimeSpan::fromMilliseconds( milliseconds ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::addMinutes( double minutes ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime + TimeSpan::fromMinutes( minutes ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::addMonths( std::int32_t months ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.addMonths( months ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::addSeconds( double seconds ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime + TimeSpan::fromSeconds( seconds ), m_offset };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::addYears( std::int32_t years ) const noexcept
+    {
+        return DateTimeOffset{ m_dateTime.addYears( years ), m_offset };
+    }
+
     inline bool DateTimeOffset::equals( const DateTimeOffset& other ) const noexcept
     {
         return *this == other;
@@ -338,13 +545,138 @@ namespace nfx::time
         return m_dateTime == other.m_dateTime && m_offset == other.m_offset;
     }
 
+    //----------------------------------------------
+    // Validation methods
+    //----------------------------------------------
+
+    inline constexpr bool DateTimeOffset::isValid() const noexcept
+    {
+        return m_dateTime.isValid() && detail::isValidOffset( m_offset );
+    }
+
+    //----------------------------------------------
+    // Static factory methods
+    //----------------------------------------------
+
+    inline constexpr DateTimeOffset DateTimeOffset::min() noexcept
+    {
+        return DateTimeOffset{ DateTime::min(), TimeSpan{ 0 } };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::max() noexcept
+    {
+        return DateTimeOffset{ DateTime::max(), TimeSpan{ 0 } };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::epoch() noexcept
+    {
+        return DateTimeOffset{ DateTime::epoch(), TimeSpan{ 0 } };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::fromEpochSeconds( std::int64_t seconds ) noexcept
+    {
+        return DateTimeOffset{ DateTime::fromEpochSeconds( seconds ), TimeSpan{ 0 } };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::fromEpochMilliseconds( std::int64_t milliseconds ) noexcept
+    {
+        return DateTimeOffset{ DateTime::fromEpochMilliseconds( milliseconds ), TimeSpan{ 0 } };
+    }
+
+    inline constexpr DateTimeOffset DateTimeOffset::fromFILETIME( std::int64_t FILETIME ) noexcept
+    {
+        const auto ticks{ FILETIME + constants::MICROSOFT_FILETIME_EPOCH_TICKS };
+
+        return DateTimeOffset{ DateTime{ ticks }, TimeSpan{ 0 } };
+    }
+
+    template <ClockSource Clock>
+    inline DateTimeOffset DateTimeOffset::now() noexcept
+    {
+        return DateTimeOffset{ DateTime::utcNow<Clock>(), TimeSpan{ 0 } }.toLocalTime();
+    }
+
+    template <ClockSource Clock>
+    inline DateTimeOffset DateTimeOffset::utcNow() noexcept
+    {
+        return DateTimeOffset{ DateTime::utcNow<Clock>(), TimeSpan{ 0 } };
+    }
+
+    //----------------------------------------------
+    // String formatting
+    //----------------------------------------------
+
+    inline std::string DateTimeOffset::toString( DateTime::Format format ) const
+    {
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        const auto length{ formatTo( buffer, sizeof( buffer ), format ) };
+
+        return std::string{ buffer, length };
+    }
+
+    inline std::size_t DateTimeOffset::formatTo(
+        char* buffer, std::size_t capacity, DateTime::Format format ) const noexcept
+    {
+        NFX_DATETIME_COUNT_STAT( detail::StatCounter::Format, static_cast<std::size_t>( format ) );
+
+        return detail::formatInto<constants::MAX_ISO8601_LENGTH>(
+            buffer,
+            capacity,
+            [this, format]( char* out ) noexcept {
+                return detail::formatNamed( out, components(), utcTicks(), totalOffsetMinutes(), false, format );
+            } );
+    }
+
+    inline std::size_t DateTimeOffset::formatTo( std::span<char> buffer, DateTime::Format format ) const noexcept
+    {
+        return formatTo( buffer.data(), buffer.size(), format );
+    }
+
+    template <typename OutputIt>
+        requires( !std::is_pointer_v<OutputIt> && std::output_iterator<OutputIt, char> )
+    inline OutputIt DateTimeOffset::formatTo( OutputIt out, DateTime::Format format ) const
+    {
+        char buffer[constants::MAX_ISO8601_LENGTH];
+        const auto length{ formatTo( buffer, sizeof( buffer ), format ) };
+
+        return std::copy_n( buffer, length, out );
+    }
+
     //=====================================================================
     // Stream operators
     //=====================================================================
 
-    std::ostream& operator<<( std::ostream& os, const DateTimeOffset& dateTimeOffset );
+    inline std::ostream& operator<<( std::ostream& os, const DateTimeOffset& dateTimeOffset )
+    {
+        return os << dateTimeOffset.toString();
+    }
+
 
     std::istream& operator>>( std::istream& is, DateTimeOffset& dateTimeOffset );
+
+    //=====================================================================
+    // User-defined literals
+    //=====================================================================
+
+    namespace literals
+    {
+        /**
+         * @brief ISO 8601 DateTimeOffset literal, e.g. "2024-01-15T12:30:45+02:00"_dto
+         * @details Parsed at compile time; a malformed or out-of-range timestamp is a compile error.
+         *          Accepts the fixed layouts of DateTimeOffset::fromString()'s fast path.
+         */
+        consteval DateTimeOffset operator""_dto( const char* str, std::size_t length )
+        {
+            std::int64_t ticks{ 0 };
+            std::int64_t offsetTicks{ 0 };
+            if( !detail::parseIso8601DateTimeOffset( std::string_view{ str, length }, ticks, offsetTicks ) )
+            {
+                throw std::invalid_argument{ "Invalid ISO 8601 DateTimeOffset literal" };
+            }
+
+            return DateTimeOffset{ DateTime{ ticks }, TimeSpan{ offsetTicks } };
+        }
+    } // namespace literals
 } // namespace nfx::time
 
 //=====================================================================
@@ -353,17 +685,53 @@ namespace nfx::time
 
 namespace std
 {
+    /**
+     * @brief Formatter for DateTimeOffset
+     * @details Accepts the same specs as the DateTime formatter. In custom patterns, K and zzz
+     *          both write the offset as ±HH:MM. An empty spec formats as Iso8601.
+     */
     template <>
     struct formatter<nfx::time::DateTimeOffset>
     {
         constexpr auto parse( std::format_parse_context& ctx )
         {
-            return ctx.begin();
+            return nfx::time::detail::parseDateTimeFormatSpec( ctx, m_format, m_pattern );
         }
 
         auto format( const nfx::time::DateTimeOffset& dto, std::format_context& ctx ) const
         {
-            return format_to( ctx.out(), "{}", dto.toString() );
+            if( m_pattern.empty() )
+            {
+                return dto.formatTo( ctx.out(), m_format );
+            }
+
+            return nfx::time::detail::writePattern(
+                ctx.out(), m_pattern, dto.dateTime().components(), dto.totalOffsetMinutes(), true );
+        }
+
+    private:
+        nfx::time::DateTime::Format m_format{ nfx::time::DateTime::Format::Iso8601 };
+        std::string_view m_pattern;
+    };
+} // namespace std
+
+//=====================================================================
+// std::hash specialization
+//=====================================================================
+
+namespace std
+{
+    /**
+     * @brief Hash for DateTimeOffset
+     * @details Hashes the UTC instant only, consistent with operator== (the same instant under
+     *          different offsets hashes equally).
+     */
+    template <>
+    struct hash<nfx::time::DateTimeOffset>
+    {
+        std::size_t operator()( const nfx::time::DateTimeOffset& value ) const noexcept
+        {
+            return nfx::time::detail::hashTicks( static_cast<std::uint64_t>( value.utcTicks() ) );
         }
     };
 } // namespace std
@@ -0,0 +1,243 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DateTimePattern.inl
+ * @brief Inline implementations for compile-time patterns and DateTimePattern accessors
+ */
+
+#include <algorithm>
+
+#include "Constants.h"
+
+namespace nfx::time
+{
+    namespace detail
+    {
+        //=====================================================================
+        // Decoded field conversion
+        //=====================================================================
+
+        /**
+         * @brief Convert decoded fields to local ticks
+         * @param fields Decoded fields
+         * @param ticks Receives the local ticks (offset not applied)
+         * @return false if the fields do not form a valid date and time
+         */
+        [[nodiscard]] inline bool patternFieldsToTicks( const PatternFields& fields, std::int64_t& ticks ) noexcept
+        {
+            if( !isValidPatternFields( fields ) )
+            {
+                return false;
+            }
+
+            ticks = dateToTicks( fields.year, fields.month, fields.day ) +
+                    fields.hour * constants::TICKS_PER_HOUR + fields.minute * constants::TICKS_PER_MINUTE +
+                    fields.second * constants::TICKS_PER_SECOND + fields.subsecondTicks;
+
+            return true;
+        }
+
+        /** @brief Convert decoded fields to a UTC DateTime, subtracting the decoded offset */
+        [[nodiscard]] inline bool patternFieldsToDateTime( const PatternFields& fields, DateTime& result ) noexcept
+        {
+            std::int64_t ticks{};
+            if( !patternFieldsToTicks( fields, ticks ) )
+            {
+                return false;
+            }
+
+            ticks -= fields.offsetMinutes * constants::TICKS_PER_MINUTE;
+            if( ticks < constants::MIN_DATETIME_TICKS || ticks > constants::MAX_DATETIME_TICKS )
+            {
+                return false;
+            }
+            result = DateTime{ ticks };
+
+            return true;
+        }
+
+        /** @brief Convert decoded fields to a DateTimeOffset */
+        [[nodiscard]] inline bool patternFieldsToDateTimeOffset(
+            const PatternFields& fields, DateTimeOffset& result ) noexcept
+        {
+            std::int64_t ticks{};
+            if( !patternFieldsToTicks( fields, ticks ) )
+            {
+                return false;
+            }
+            result = DateTimeOffset{
+                DateTime{ ticks }, TimeSpan{ fields.offsetMinutes * constants::TICKS_PER_MINUTE } };
+
+            return true;
+        }
+    } // namespace detail
+
+    //=====================================================================
+    // FixedPattern class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Formatting
+    //----------------------------------------------
+
+    template <PatternString Pattern>
+    inline std::size_t FixedPattern<Pattern>::formatTo(
+        const DateTime& value, char* buffer, std::size_t capacity ) noexcept
+    {
+        if( capacity < LENGTH )
+        {
+            return 0;
+        }
+        writeFields<s_utcProgram>( buffer, value.components(), 0 );
+
+        return LENGTH;
+    }
+
+    template <PatternString Pattern>
+    inline std::size_t FixedPattern<Pattern>::formatTo(
+        const DateTimeOffset& value, char* buffer, std::size_t capacity ) noexcept
+    {
+        if( capacity < OFFSET_LENGTH )
+        {
+            return 0;
+        }
+        writeFields<s_offsetProgram>( buffer, value.dateTime().components(), value.totalOffsetMinutes() );
+
+        return OFFSET_LENGTH;
+    }
+
+    template <PatternString Pattern>
+    inline std::string FixedPattern<Pattern>::format( const DateTime& value )
+    {
+        std::string result( LENGTH, '\0' );
+        writeFields<s_utcProgram>( result.data(), value.components(), 0 );
+
+        return result;
+    }
+
+    template <PatternString Pattern>
+    inline std::string FixedPattern<Pattern>::format( const DateTimeOffset& value )
+    {
+        std::string result( OFFSET_LENGTH, '\0' );
+        writeFields<s_offsetProgram>( result.data(), value.dateTime().components(), value.totalOffsetMinutes() );
+
+        return result;
+    }
+
+    //----------------------------------------------
+    // Parsing
+    //----------------------------------------------
+
+    template <PatternString Pattern>
+    inline bool FixedPattern<Pattern>::tryParse( std::string_view text, DateTime& result ) noexcept
+    {
+        detail::PatternFields fields;
+
+        return readFields<s_utcProgram>( text, fields ) && detail::patternFieldsToDateTime( fields, result );
+    }
+
+    template <PatternString Pattern>
+    inline bool FixedPattern<Pattern>::tryParse( std::string_view text, DateTimeOffset& result ) noexcept
+    {
+        detail::PatternFields fields;
+
+        return readFields<s_offsetProgram>( text, fields ) && detail::patternFieldsToDateTimeOffset( fields, result );
+    }
+
+    //----------------------------------------------
+    // Program expansion
+    //----------------------------------------------
+
+    template <PatternString Pattern>
+    template <const auto& Program>
+    inline void FixedPattern<Pattern>::writeFields(
+        char* buffer, const DateTime::Components& components, std::int32_t offsetMinutes ) noexcept
+    {
+        std::copy_n( Program.text.data(), Program.length, buffer );
+
+        // One expansion per field with constant kind, position and width
+        [&]<std::size_t... I>( std::index_sequence<I...> ) {
+            ( detail::writeFixedField<Program.ops[I]>( buffer, components, offsetMinutes ), ... );
+        }( std::make_index_sequence<Program.opCount>{} );
+    }
+
+    template <PatternString Pattern>
+    template <const auto& Program>
+    inline bool FixedPattern<Pattern>::readFields( std::string_view text, detail::PatternFields& fields ) noexcept
+    {
+        bool zulu{};
+        if( !detail::matchProgramLength( Program, text, zulu ) )
+        {
+            return false;
+        }
+
+        return [&]<std::size_t... I>( std::index_sequence<I...> ) {
+            return ( detail::readFixedField<Program.ops[I]>( text.data(), Program.text.data(), zulu, fields ) & ... );
+        }( std::make_index_sequence<Program.opCount>{} );
+    }
+
+    //=====================================================================
+    // Compile-time pattern functions
+    //=====================================================================
+
+    template <PatternString Pattern, typename T>
+        requires( std::same_as<T, DateTime> || std::same_as<T, DateTimeOffset> )
+    inline std::string format( const T& value )
+    {
+        return FixedPattern<Pattern>::format( value );
+    }
+
+    template <PatternString Pattern, typename T>
+        requires( std::same_as<T, DateTime> || std::same_as<T, DateTimeOffset> )
+    inline std::size_t formatTo( const T& value, std::span<char> buffer ) noexcept
+    {
+        return FixedPattern<Pattern>::formatTo( value, buffer.data(), buffer.size() );
+    }
+
+    template <PatternString Pattern, typename T>
+        requires( std::same_as<T, DateTime> || std::same_as<T, DateTimeOffset> )
+    inline bool tryParse( std::string_view text, T& result ) noexcept
+    {
+        return FixedPattern<Pattern>::tryParse( text, result );
+    }
+
+    //=====================================================================
+    // DateTimePattern class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Property accessors
+    //----------------------------------------------
+
+    inline std::size_t DateTimePattern::length() const noexcept
+    {
+        return m_utcProgram.length;
+    }
+
+    inline std::size_t DateTimePattern::offsetLength() const noexcept
+    {
+        return m_offsetProgram.length;
+    }
+} // namespace nfx::time
@@ -0,0 +1,232 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Format.h
+ * @brief Allocation-free text writers shared by the DateTime, DateTimeOffset and TimeSpan formatters
+ * @details Each writer stores at the given position without bounds checking and returns the
+ *          position one past the last character written; callers guarantee sufficient capacity.
+ *          Kept inline so formatTo() and toString() compile into the caller together with
+ *          components().
+ *
+ * @note Implementation detail, not part of the public API.
+ */
+
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "Constants.h"
+
+namespace nfx::time::detail
+{
+    //=====================================================================
+    // Text writers
+    //=====================================================================
+
+    /** @brief Write two-digit zero-padded integer */
+    inline char* appendTwoDigits( char* out, std::int32_t value ) noexcept
+    {
+        out[0] = static_cast<char>( '0' + ( value / 10 ) );
+        out[1] = static_cast<char>( '0' + ( value % 10 ) );
+
+        return out + 2;
+    }
+
+    /** @brief Write four-digit zero-padded integer */
+    inline char* appendFourDigits( char* out, std::int32_t value ) noexcept
+    {
+        out[0] = static_cast<char>( '0' + ( value / 1000 ) );
+        out[1] = static_cast<char>( '0' + ( ( value / 100 ) % 10 ) );
+        out[2] = static_cast<char>( '0' + ( ( value / 10 ) % 10 ) );
+        out[3] = static_cast<char>( '0' + ( value % 10 ) );
+
+        return out + 4;
+    }
+
+    /** @brief Write ISO 8601 date part: YYYY-MM-DD */
+    inline char* appendIso8601Date( char* out, std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
+    {
+        out = appendFourDigits( out, year );
+        *out++ = '-';
+        out = appendTwoDigits( out, month );
+        *out++ = '-';
+
+        return appendTwoDigits( out, day );
+    }
+
+    /** @brief Write ISO 8601 time part: HH:mm:ss */
+    inline char* appendIso8601Time( char* out, std::int32_t hour, std::int32_t minute, std::int32_t second ) noexcept
+    {
+        out = appendTwoDigits( out, hour );
+        *out++ = ':';
+        out = appendTwoDigits( out, minute );
+        *out++ = ':';
+
+        return appendTwoDigits( out, second );
+    }
+
+    /** @brief Write ISO 8601 datetime part: YYYY-MM-DDTHH:mm:ss */
+    inline char* appendIso8601DateTime(
+        char* out,
+        std::int32_t year,
+        std::int32_t month,
+        std::int32_t day,
+        std::int32_t hour,
+        std::int32_t minute,
+        std::int32_t second ) noexcept
+    {
+        out = appendIso8601Date( out, year, month, day );
+        *out++ = 'T';
+
+        return appendIso8601Time( out, hour, minute, second );
+    }
+
+    /** @brief Write ISO 8601 basic (compact) datetime part: YYYYMMDDTHHMMSS */
+    inline char* appendIso8601BasicDateTime(
+        char* out,
+        std::int32_t year,
+        std::int32_t month,
+        std::int32_t day,
+        std::int32_t hour,
+        std::int32_t minute,
+        std::int32_t second ) noexcept
+    {
+        out = appendFourDigits( out, year );
+        out = appendTwoDigits( out, month );
+        out = appendTwoDigits( out, day );
+        *out++ = 'T';
+        out = appendTwoDigits( out, hour );
+        out = appendTwoDigits( out, minute );
+
+        return appendTwoDigits( out, second );
+    }
+
+    /** @brief Write fixed-width zero-padded digits (most significant first) */
+    inline char* appendPaddedDigits( char* out, std::int32_t value, std::int32_t digits ) noexcept
+    {
+        for( std::int32_t i{ digits - 1 }; i >= 0; --i )
+        {
+            out[i] = static_cast<char>( '0' + ( value % 10 ) );
+            value /= 10;
+        }
+
+        return out + digits;
+    }
+
+    /** @brief Write zero-padded fractional seconds with specific precision: .fff */
+    inline char* appendFractionalSeconds( char* out, std::int32_t fractionalValue, std::int32_t digits ) noexcept
+    {
+        *out++ = '.';
+
+        return appendPaddedDigits( out, fractionalValue, digits );
+    }
+
+    /** @brief Write fractional seconds with trimmed trailing zeros (".0" when there is no fraction) */
+    inline char* appendFractionalSecondsTrimmed( char* out, std::int32_t fractionalTicks ) noexcept
+    {
+        *out++ = '.';
+        if( fractionalTicks == 0 )
+        {
+            *out++ = '0';
+            return out;
+        }
+
+        std::int32_t digits{ 7 };
+        while( fractionalTicks % 10 == 0 )
+        {
+            fractionalTicks /= 10;
+            --digits;
+        }
+
+        return appendPaddedDigits( out, fractionalTicks, digits );
+    }
+
+    /** @brief Write timezone offset: ±HH:MM (extended) or ±HHMM (basic) */
+    inline char* appendOffset( char* out, std::int32_t offsetMinutes, bool extended = true ) noexcept
+    {
+        const auto absMinutes{ std::abs( offsetMinutes ) };
+
+        *out++ = offsetMinutes >= 0 ? '+' : '-';
+        out = appendTwoDigits( out, absMinutes / constants::MINUTES_PER_HOUR );
+        if( extended )
+        {
+            *out++ = ':';
+        }
+
+        return appendTwoDigits( out, absMinutes % constants::MINUTES_PER_HOUR );
+    }
+
+    /** @brief Write signed decimal integer */
+    inline char* appendInteger( char* out, std::int64_t value ) noexcept
+    {
+        // Duration hour/minute/second fields are below 100; keep them off the generic path
+        if( static_cast<std::uint64_t>( value ) < 100 )
+        {
+            if( value >= 10 )
+            {
+                return appendTwoDigits( out, static_cast<std::int32_t>( value ) );
+            }
+            *out++ = static_cast<char>( '0' + value );
+
+            return out;
+        }
+
+        // 20 characters always hold a signed 64-bit value
+        return std::to_chars( out, out + 20, value ).ptr;
+    }
+
+    /**
+     * @brief Copy a formatted value into a caller buffer, going through scratch storage when it may not fit
+     * @tparam MaxLength Upper bound on the formatted length
+     * @param buffer Destination buffer
+     * @param capacity Destination capacity in characters
+     * @param write Callable writing the value at a position and returning the end position
+     * @return Number of characters written, or 0 if the value does not fit
+     */
+    template <std::size_t MaxLength, typename Writer>
+    inline std::size_t formatInto( char* buffer, std::size_t capacity, Writer&& write ) noexcept
+    {
+        // Fast path: caller buffer is large enough for any value
+        if( capacity >= MaxLength )
+        {
+            return static_cast<std::size_t>( write( buffer ) - buffer );
+        }
+
+        char scratch[MaxLength];
+        const auto length{ static_cast<std::size_t>( write( scratch ) - scratch ) };
+        if( length > capacity )
+        {
+            return 0;
+        }
+
+        std::memcpy( buffer, scratch, length );
+
+        return length;
+    }
+} // namespace nfx::time::detail
@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Hash.h
+ * @brief Tick mixer shared by the std::hash specializations
+ * @details Timestamps are rarely uniform in their low bits: values taken at whole seconds,
+ *          minutes or days are multiples of 10^7, 6 * 10^8 or 8.64 * 10^11 ticks, so an identity
+ *          hash leaves most buckets of a power-of-two table empty. Every key is passed through
+ *          the 64-bit finalizer of MurmurHash3, which makes each output bit depend on every
+ *          input bit.
+ *
+ * @note Implementation detail, not part of the public API.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace nfx::time::detail
+{
+    //=====================================================================
+    // Tick mixer
+    //=====================================================================
+
+    /**
+     * @brief Mix a 64-bit key into a well-distributed hash value
+     * @param key Ticks or packed representation to hash
+     * @return Avalanched hash (a bijection of key, so distinct keys never collide before reduction)
+     */
+    [[nodiscard]] inline constexpr std::size_t hashTicks( std::uint64_t key ) noexcept
+    {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33;
+
+        return static_cast<std::size_t>( key );
+    }
+} // namespace nfx::time::detail
@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file IntervalIndex.inl
+ * @brief Inline implementations for IntervalIndex accessors and query traversal
+ */
+
+#include <array>
+#include <bit>
+#include <limits>
+
+namespace nfx::time
+{
+    //=====================================================================
+    // IntervalIndex class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    inline std::size_t IntervalIndex::size() const noexcept
+    {
+        return m_intervals.size();
+    }
+
+    inline std::span<const DateTimeInterval> IntervalIndex::intervals() const noexcept
+    {
+        return m_intervals;
+    }
+
+    //----------------------------------------------
+    // Queries
+    //----------------------------------------------
+
+    template <typename Visitor>
+    inline void IntervalIndex::forEachStabbing( const DateTime& instant, Visitor&& visitor ) const
+    {
+        const auto ticks{ instant.ticks() };
+        if( ticks == std::numeric_limits<std::int64_t>::max() )
+        {
+            return;
+        }
+
+        // start <= ticks < end, i.e. overlap with [ticks, ticks + 1)
+        visit( ticks, ticks + 1, visitor );
+    }
+
+    template <typename Visitor>
+    inline void IntervalIndex::forEachOverlapping( const DateTimeInterval& query, Visitor&& visitor ) const
+    {
+        if( query.isEmpty() )
+        {
+            return;
+        }
+
+        visit( query.start().ticks(), query.end().ticks(), visitor );
+    }
+
+    template <typename Visitor>
+    inline void IntervalIndex::visit( std::int64_t startTicks, std::int64_t endTicks, Visitor& visitor ) const
+    {
+        // Only sorted positions below limit can start before endTicks
+        const auto limit{ countStartingBefore( endTicks ) };
+        if( limit == 0 )
+        {
+            return;
+        }
+
+        // Depth-first, left child first, so matches come out in sorted order; the stack never
+        // holds more than one pending right sibling per level
+        std::array<std::size_t, 2 * std::numeric_limits<std::size_t>::digits> stack;
+        std::size_t depth{ 0 };
+        stack[depth++] = 1;
+        while( depth != 0 )
+        {
+            const auto node{ stack[--depth] };
+
+            // First sorted position covered by the node
+            const auto level{ static_cast<std::size_t>( std::bit_width( node ) - 1 ) };
+            const auto width{ m_leafCount >> level };
+            const auto first{ ( node - ( std::size_t{ 1 } << level ) ) * width };
+            if( first >= limit || m_maxEnds[node] <= startTicks )
+            {
+                continue;
+            }
+
+            if( node >= m_leafCount )
+            {
+                visitor( m_intervals[first], m_indices[first] );
+                continue;
+            }
+
+            stack[depth++] = 2 * node + 1;
+            stack[depth++] = 2 * node;
+        }
+    }
+} // namespace nfx::time
@@ -0,0 +1,406 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Iso8601.h
+ * @brief Constant-evaluable ISO 8601 field decoders shared by the parsers and the literals
+ * @details Decodes the fixed "YYYY-MM-DDTHH:mm:ss" block, fractional seconds, UTC offsets and
+ *          durations without library calls, so the same code runs behind fromString() at runtime
+ *          and behind the user-defined literals at compile time. Calendar validation and the
+ *          conversion to ticks live next to DateTime in DateTime.inl.
+ *
+ * @note Implementation detail, not part of the public API.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+#include "Constants.h"
+
+namespace nfx::time::detail
+{
+    //=====================================================================
+    // Character helpers
+    //=====================================================================
+
+    /** @brief Check if character is a decimal digit */
+    [[nodiscard]] constexpr bool isIso8601Digit( char c ) noexcept
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    /** @brief Check that count characters are decimal digits */
+    [[nodiscard]] constexpr bool areIso8601Digits( const char* p, std::size_t count ) noexcept
+    {
+        for( std::size_t i = 0; i < count; ++i )
+        {
+            if( !isIso8601Digit( p[i] ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** @brief Parse 2 digits without validation */
+    [[nodiscard]] constexpr std::int32_t parseIso8601Digits2( const char* p ) noexcept
+    {
+        return ( p[0] - '0' ) * 10 + ( p[1] - '0' );
+    }
+
+    //=====================================================================
+    // Date and time fields
+    //=====================================================================
+
+    /** @brief Raw date/time fields decoded from "YYYY-MM-DDTHH:mm:ss" */
+    struct Iso8601DateTimeFields
+    {
+        std::int32_t year;
+        std::int32_t month;
+        std::int32_t day;
+        std::int32_t hour;
+        std::int32_t minute;
+        std::int32_t second;
+    };
+
+    /**
+     * @brief Decode the fixed 10-character "YYYY-MM-DD" block
+     * @param data Pointer to at least 10 readable characters
+     * @param fields Receives the decoded date; the time fields are set to zero
+     * @return true if all separators and digits are well-formed (ranges are not validated)
+     */
+    [[nodiscard]] constexpr bool decodeIso8601Date( const char* data, Iso8601DateTimeFields& fields ) noexcept
+    {
+        if( data[4] != '-' || data[7] != '-' || !areIso8601Digits( data, 4 ) || !areIso8601Digits( data + 5, 2 ) ||
+            !areIso8601Digits( data + 8, 2 ) )
+        {
+            return false;
+        }
+
+        fields = Iso8601DateTimeFields{ parseIso8601Digits2( data ) * 100 + parseIso8601Digits2( data + 2 ),
+            parseIso8601Digits2( data + 5 ),
+            parseIso8601Digits2( data + 8 ),
+            0,
+            0,
+            0 };
+
+        return true;
+    }
+
+    /**
+     * @brief Decode the fixed 19-character "YYYY-MM-DDTHH:mm:ss" block (scalar kernel)
+     * @param data Pointer to at least 19 readable characters
+     * @param fields Receives the decoded fields
+     * @return true if all separators and digits are well-formed (ranges are not validated)
+     */
+    [[nodiscard]] constexpr bool decodeIso8601DateTimeScalar( const char* data, Iso8601DateTimeFields& fields ) noexcept
+    {
+        if( data[10] != 'T' || data[13] != ':' || data[16] != ':' || !decodeIso8601Date( data, fields ) ||
+            !areIso8601Digits( data + 11, 2 ) || !areIso8601Digits( data + 14, 2 ) ||
+            !areIso8601Digits( data + 17, 2 ) )
+        {
+            return false;
+        }
+
+        fields.hour = parseIso8601Digits2( data + 11 );
+        fields.minute = parseIso8601Digits2( data + 14 );
+        fields.second = parseIso8601Digits2( data + 17 );
+
+        return true;
+    }
+
+    /**
+     * @brief Decode fractional seconds following a '.'
+     * @param p First character after the '.', advanced past every fraction digit
+     * @param end One past the last readable character
+     * @param fractionTicks Receives the fraction in ticks (digits beyond the seventh are truncated)
+     * @return false if no digit follows the '.'
+     */
+    [[nodiscard]] constexpr bool decodeIso8601Fraction(
+        const char*& p, const char* end, std::int32_t& fractionTicks ) noexcept
+    {
+        std::int32_t value{ 0 };
+        std::int32_t digits{ 0 };
+        while( p != end && isIso8601Digit( *p ) )
+        {
+            if( digits < 7 )
+            {
+                value = value * 10 + ( *p - '0' );
+                ++digits;
+            }
+            ++p;
+        }
+
+        if( digits == 0 )
+        {
+            return false;
+        }
+
+        // Pad to 7 digits (100-nanosecond ticks)
+        for( ; digits < 7; ++digits )
+        {
+            value *= 10;
+        }
+        fractionTicks = value;
+
+        return true;
+    }
+
+    //=====================================================================
+    // UTC offsets
+    //=====================================================================
+
+    /**
+     * @brief Decode a complete UTC offset designator
+     * @details Accepts "Z", "±HH:MM", "±HHMM" and "±HH", up to ±14:00.
+     * @param str The designator, with nothing before or after it
+     * @param offsetTicks Receives the offset in ticks (positive for East)
+     * @return false on syntax errors or out-of-range offsets
+     */
+    [[nodiscard]] constexpr bool decodeIso8601Offset( std::string_view str, std::int64_t& offsetTicks ) noexcept
+    {
+        if( str.size() == 1 && str[0] == 'Z' )
+        {
+            offsetTicks = 0;
+            return true;
+        }
+
+        if( str.size() < 3 || ( str[0] != '+' && str[0] != '-' ) || !areIso8601Digits( str.data() + 1, 2 ) )
+        {
+            return false;
+        }
+
+        const std::int32_t hours{ parseIso8601Digits2( str.data() + 1 ) };
+        std::int32_t minutes{ 0 };
+        if( str.size() == 6 && str[3] == ':' && areIso8601Digits( str.data() + 4, 2 ) )
+        {
+            minutes = parseIso8601Digits2( str.data() + 4 );
+        }
+        else if( str.size() == 5 && areIso8601Digits( str.data() + 3, 2 ) )
+        {
+            minutes = parseIso8601Digits2( str.data() + 3 );
+        }
+        else if( str.size() != 3 )
+        {
+            return false;
+        }
+
+        const std::int32_t totalMinutes{ hours * constants::MINUTES_PER_HOUR + minutes };
+        if( minutes >= constants::MINUTES_PER_HOUR || totalMinutes > constants::MAX_OFFSET_MINUTES )
+        {
+            return false;
+        }
+
+        offsetTicks = ( str[0] == '-' ? -totalMinutes : totalMinutes ) * constants::TICKS_PER_MINUTE;
+
+        return true;
+    }
+
+    //=====================================================================
+    // Durations
+    //=====================================================================
+
+    /** @brief Seconds per duration component, indexed D, H, M, S */
+    inline constexpr std::uint64_t DURATION_UNIT_SECONDS[4]{ static_cast<std::uint64_t>( constants::SECONDS_PER_DAY ),
+        static_cast<std::uint64_t>( constants::SECONDS_PER_HOUR ),
+        static_cast<std::uint64_t>( constants::SECONDS_PER_MINUTE ),
+        1 };
+
+    /**
+     * @brief Largest integer value per component that fits in TimeSpan, indexed D, H, M, S
+     * @details Tick counts per unit contain a factor of 5, so the bound is the same for
+     *          int64 max and for the magnitude of int64 min.
+     */
+    inline constexpr std::uint64_t DURATION_UNIT_MAX_VALUE[4]{
+        static_cast<std::uint64_t>( std::numeric_limits<std::int64_t>::max() / constants::TICKS_PER_DAY ),
+        static_cast<std::uint64_t>( std::numeric_limits<std::int64_t>::max() / constants::TICKS_PER_HOUR ),
+        static_cast<std::uint64_t>( std::numeric_limits<std::int64_t>::max() / constants::TICKS_PER_MINUTE ),
+        static_cast<std::uint64_t>( std::numeric_limits<std::int64_t>::max() / constants::TICKS_PER_SECOND ) };
+
+    /** @brief Powers of ten up to 10^12 */
+    inline constexpr std::uint64_t DURATION_POWERS_OF_TEN[13]{ 1ULL,
+        10ULL,
+        100ULL,
+        1000ULL,
+        10000ULL,
+        100000ULL,
+        1000000ULL,
+        10000000ULL,
+        100000000ULL,
+        1000000000ULL,
+        10000000000ULL,
+        100000000000ULL,
+        1000000000000ULL };
+
+    /** @brief Fraction digits kept per component (further digits are below one tick and are truncated) */
+    inline constexpr std::size_t MAX_DURATION_FRACTION_DIGITS{ 12 };
+
+    /** @brief Integer digits accepted per component (any more overflow the tick range) */
+    inline constexpr std::size_t MAX_DURATION_INTEGER_DIGITS{ 18 };
+
+    /**
+     * @brief Single-pass ISO 8601 duration parser accumulating exact 100-nanosecond ticks
+     * @details Accepts [-]P[nD][T[nH][nM][nS]], where every value may carry a decimal fraction
+     *          ('.' or ','). Components must appear in order, at most once, and a 'T' must be
+     *          followed by at least one time component. Fractions finer than one tick are
+     *          truncated toward zero, like TimeSpan::fromSeconds().
+     * @param str The complete duration string
+     * @param ticks Receives the duration in ticks
+     * @return false on syntax errors or if the value does not fit in TimeSpan
+     */
+    [[nodiscard]] constexpr bool parseIso8601Duration( std::string_view str, std::int64_t& ticks ) noexcept
+    {
+        const char* p{ str.data() };
+        const char* const end{ p + str.size() };
+
+        const bool isNegative{ p != end && *p == '-' };
+        p += isNegative;
+        if( p == end || *p != 'P' )
+        {
+            return false;
+        }
+        ++p;
+
+        // Magnitude limit: |int64 min| for negative values, int64 max otherwise
+        const std::uint64_t limit{ static_cast<std::uint64_t>( std::numeric_limits<std::int64_t>::max() ) +
+                                   isNegative };
+
+        std::uint64_t totalTicks{ 0 };
+        int lastUnit{ -1 };
+        bool inTimePart{ false };
+
+        while( p != end )
+        {
+            if( *p == 'T' )
+            {
+                if( inTimePart )
+                {
+                    return false;
+                }
+                inTimePart = true;
+                ++p;
+                continue;
+            }
+
+            // Integer part
+            std::uint64_t integer{ 0 };
+            const char* const integerStart{ p };
+            while( p != end && isIso8601Digit( *p ) )
+            {
+                integer = integer * 10 + static_cast<std::uint64_t>( *p - '0' );
+                ++p;
+            }
+            const auto integerDigits{ static_cast<std::size_t>( p - integerStart ) };
+            if( integerDigits == 0 || integerDigits > MAX_DURATION_INTEGER_DIGITS )
+            {
+                return false;
+            }
+
+            // Optional fraction
+            std::uint64_t fraction{ 0 };
+            std::size_t fractionDigits{ 0 };
+            if( p != end && ( *p == '.' || *p == ',' ) )
+            {
+                ++p;
+                const char* const fractionStart{ p };
+                while( p != end && isIso8601Digit( *p ) )
+                {
+                    if( fractionDigits < MAX_DURATION_FRACTION_DIGITS )
+                    {
+                        fraction = fraction * 10 + static_cast<std::uint64_t>( *p - '0' );
+                        ++fractionDigits;
+                    }
+                    ++p;
+                }
+                if( p == fractionStart )
+                {
+                    return false;
+                }
+            }
+
+            if( p == end )
+            {
+                return false;
+            }
+
+            // Designator: D in the date part, H/M/S in the time part, strictly in order
+            int unit{};
+            switch( *p++ )
+            {
+                case 'D':
+                    unit = 0;
+                    break;
+                case 'H':
+                    unit = 1;
+                    break;
+                case 'M':
+                    unit = 2;
+                    break;
+                case 'S':
+                    unit = 3;
+                    break;
+                default:
+                    return false;
+            }
+            if( ( unit == 0 ) == inTimePart || unit <= lastUnit )
+            {
+                return false;
+            }
+            lastUnit = unit;
+
+            const std::uint64_t unitSeconds{ DURATION_UNIT_SECONDS[unit] };
+            const std::uint64_t unitTicks{ unitSeconds * constants::TICKS_PER_SECOND };
+            if( integer > DURATION_UNIT_MAX_VALUE[unit] )
+            {
+                return false;
+            }
+
+            // unitTicks = unitSeconds * 10^7, so the fraction scales exactly up to 7 digits
+            const std::uint64_t fractionSeconds{ fraction * unitSeconds };
+            const std::uint64_t fractionTicks{ fractionDigits <= 7
+                                                   ? fractionSeconds * DURATION_POWERS_OF_TEN[7 - fractionDigits]
+                                                   : fractionSeconds / DURATION_POWERS_OF_TEN[fractionDigits - 7] };
+            const std::uint64_t componentTicks{ integer * unitTicks };
+            if( componentTicks > limit - totalTicks || fractionTicks > limit - totalTicks - componentTicks )
+            {
+                return false;
+            }
+            totalTicks += componentTicks + fractionTicks;
+        }
+
+        // At least one component, and a 'T' must introduce a time component
+        if( lastUnit < 0 || ( inTimePart && lastUnit == 0 ) )
+        {
+            return false;
+        }
+
+        ticks = static_cast<std::int64_t>( isNegative ? 0 - totalTicks : totalTicks );
+
+        return true;
+    }
+} // namespace nfx::time::detail
@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PackedDateTimeOffset.inl
+ * @brief Inline implementations for PackedDateTimeOffset
+ */
+
+#include <algorithm>
+
+#include "Hash.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // PackedDateTimeOffset class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    inline constexpr PackedDateTimeOffset::PackedDateTimeOffset() noexcept
+        : m_value{ static_cast<std::uint64_t>( UNIT_BIAS ) << OFFSET_BITS | static_cast<std::uint64_t>( OFFSET_BIAS ) }
+    {
+    }
+
+    inline constexpr PackedDateTimeOffset::PackedDateTimeOffset( const DateTimeOffset& value ) noexcept
+        : m_value{}
+    {
+        // Floor division keeps instants before 0001-01-01 UTC ordered
+        const auto ticks{ value.utcTicks() };
+        const auto units{ ticks / TICKS_PER_UNIT - ( ticks % TICKS_PER_UNIT < 0 ? 1 : 0 ) };
+        const auto offsetMinutes{ static_cast<std::int32_t>( value.offset().ticks() / constants::TICKS_PER_MINUTE ) };
+        const auto minutes{ std::clamp( offsetMinutes, -MAX_OFFSET_MINUTES, MAX_OFFSET_MINUTES ) };
+
+        const auto high{ static_cast<std::uint64_t>( units + UNIT_BIAS ) << OFFSET_BITS };
+        m_value = high | static_cast<std::uint64_t>( minutes + OFFSET_BIAS );
+    }
+
+    //----------------------------------------------
+    // Property accessors
+    //----------------------------------------------
+
+    inline constexpr std::int64_t PackedDateTimeOffset::utcTicks() const noexcept
+    {
+        return ( static_cast<std::int64_t>( m_value >> OFFSET_BITS ) - UNIT_BIAS ) * TICKS_PER_UNIT;
+    }
+
+    inline constexpr std::int32_t PackedDateTimeOffset::totalOffsetMinutes() const noexcept
+    {
+        return static_cast<std::int32_t>( m_value & ( ( std::uint64_t{ 1 } << OFFSET_BITS ) - 1 ) ) - OFFSET_BIAS;
+    }
+
+    inline constexpr TimeSpan PackedDateTimeOffset::offset() const noexcept
+    {
+        return TimeSpan{ totalOffsetMinutes() * constants::TICKS_PER_MINUTE };
+    }
+
+    inline constexpr std::uint64_t PackedDateTimeOffset::raw() const noexcept
+    {
+        return m_value;
+    }
+
+    //----------------------------------------------
+    // Conversion
+    //----------------------------------------------
+
+    inline constexpr DateTimeOffset PackedDateTimeOffset::toDateTimeOffset() const noexcept
+    {
+        const auto offsetTicks{ totalOffsetMinutes() * constants::TICKS_PER_MINUTE };
+
+        return DateTimeOffset{ utcTicks() + offsetTicks, TimeSpan{ offsetTicks } };
+    }
+
+    //----------------------------------------------
+    // Static methods
+    //----------------------------------------------
+
+    inline constexpr bool PackedDateTimeOffset::isRepresentable( const DateTimeOffset& value ) noexcept
+    {
+        const auto offsetTicks{ value.offset().ticks() };
+
+        return value.utcTicks() % TICKS_PER_UNIT == 0 && offsetTicks % constants::TICKS_PER_MINUTE == 0 &&
+               offsetTicks >= -MAX_OFFSET_MINUTES * constants::TICKS_PER_MINUTE &&
+               offsetTicks <= MAX_OFFSET_MINUTES * constants::TICKS_PER_MINUTE;
+    }
+
+    inline constexpr PackedDateTimeOffset PackedDateTimeOffset::fromRaw( std::uint64_t raw ) noexcept
+    {
+        PackedDateTimeOffset result;
+        result.m_value = raw;
+
+        return result;
+    }
+} // namespace nfx::time
+
+//=====================================================================
+// std::hash specialization
+//=====================================================================
+
+namespace std
+{
+    /**
+     * @brief Hash for PackedDateTimeOffset
+     * @details Hashes the packed value, consistent with operator== (instant and offset).
+     */
+    template <>
+    struct hash<nfx::time::PackedDateTimeOffset>
+    {
+        std::size_t operator()( const nfx::time::PackedDateTimeOffset& value ) const noexcept
+        {
+            return nfx::time::detail::hashTicks( value.raw() );
+        }
+    };
+} // namespace std
@@ -0,0 +1,799 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Pattern.h
+ * @brief Custom date/time pattern tokenizer and writer shared by the std::formatter specializations
+ * @details Patterns use .NET-style field letters; every other letter must be quoted:
+ *
+ * @code
+ * ┌────────────┬──────────────────────────────────────────────────────────┐
+ * │  yyyy      │  Four-digit year                                         │
+ * │  MM / dd   │  Two-digit month / day                                   │
+ * │  HH        │  Two-digit hour (00-23)                                  │
+ * │  mm / ss   │  Two-digit minute / second                               │
+ * │  f..fffffff│  Fraction of a second, 1 to 7 digits (truncated)         │
+ * │  K         │  "Z" for DateTime, "±HH:MM" for DateTimeOffset           │
+ * │  zzz       │  "±HH:MM" (always numeric, "+00:00" for DateTime)        │
+ * │  'text'    │  Quoted literal (letters allowed)                        │
+ * │  other     │  Non-letter characters are copied as is                  │
+ * └────────────┴──────────────────────────────────────────────────────────┘
+ * @endcode
+ *
+ * Patterns are either interpreted directly (writePattern(), used by std::formatter) or compiled
+ * into a PatternProgram: a literal skeleton plus fixed-position field operations, used by
+ * FixedPattern (compiled at compile time) and DateTimePattern (compiled once at runtime).
+ *
+ * @note Implementation detail, not part of the public API.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace nfx::time::detail
+{
+    //=====================================================================
+    // Pattern tokenizer
+    //=====================================================================
+
+    /** @brief Kind of a pattern field */
+    enum class PatternFieldKind : std::uint8_t
+    {
+        Literal,       ///< Single non-letter character
+        QuotedLiteral, ///< 'text' (quotes excluded from the output)
+        Year,          ///< yyyy
+        Month,         ///< MM
+        Day,           ///< dd
+        Hour,          ///< HH
+        Minute,        ///< mm
+        Second,        ///< ss
+        Fraction,      ///< f to fffffff
+        OffsetOrUtc,   ///< K
+        Offset,        ///< zzz
+        Invalid,       ///< Unknown letter, wrong repeat count or unterminated quote
+    };
+
+    /** @brief One field of a pattern */
+    struct PatternField
+    {
+        PatternFieldKind kind;
+        std::size_t length; ///< Pattern characters consumed
+    };
+
+    /** @brief Check if character is an ASCII letter */
+    [[nodiscard]] constexpr bool isPatternLetter( char c ) noexcept
+    {
+        return ( c >= 'A' && c <= 'Z' ) || ( c >= 'a' && c <= 'z' );
+    }
+
+    /**
+     * @brief Read the field starting at pos
+     * @param pattern Pattern text
+     * @param pos Position of the field (must be < pattern.size())
+     * @return Field kind and length
+     */
+    [[nodiscard]] constexpr PatternField nextPatternField( std::string_view pattern, std::size_t pos ) noexcept
+    {
+        const char c{ pattern[pos] };
+
+        if( c == '\'' )
+        {
+            const auto close{ pattern.find( '\'', pos + 1 ) };
+            if( close == std::string_view::npos )
+            {
+                return { PatternFieldKind::Invalid, pattern.size() - pos };
+            }
+
+            return { PatternFieldKind::QuotedLiteral, close - pos + 1 };
+        }
+
+        if( !isPatternLetter( c ) )
+        {
+            return { PatternFieldKind::Literal, 1 };
+        }
+
+        std::size_t run{ 1 };
+        while( pos + run < pattern.size() && pattern[pos + run] == c )
+        {
+            ++run;
+        }
+
+        switch( c )
+        {
+            case 'y':
+                return { run == 4 ? PatternFieldKind::Year : PatternFieldKind::Invalid, run };
+            case 'M':
+                return { run == 2 ? PatternFieldKind::Month : PatternFieldKind::Invalid, run };
+            case 'd':
+                return { run == 2 ? PatternFieldKind::Day : PatternFieldKind::Invalid, run };
+            case 'H':
+                return { run == 2 ? PatternFieldKind::Hour : PatternFieldKind::Invalid, run };
+            case 'm':
+                return { run == 2 ? PatternFieldKind::Minute : PatternFieldKind::Invalid, run };
+            case 's':
+                return { run == 2 ? PatternFieldKind::Second : PatternFieldKind::Invalid, run };
+            case 'f':
+                return { run <= 7 ? PatternFieldKind::Fraction : PatternFieldKind::Invalid, run };
+            case 'K':
+                return { run == 1 ? PatternFieldKind::OffsetOrUtc : PatternFieldKind::Invalid, run };
+            case 'z':
+                return { run == 3 ? PatternFieldKind::Offset : PatternFieldKind::Invalid, run };
+            default:
+                return { PatternFieldKind::Invalid, run };
+        }
+    }
+
+    /**
+     * @brief Check that a pattern is non-empty and contains only valid fields
+     * @param pattern Pattern text
+     * @return true if the pattern can be written
+     */
+    [[nodiscard]] constexpr bool isValidPattern( std::string_view pattern ) noexcept
+    {
+        if( pattern.empty() )
+        {
+            return false;
+        }
+
+        for( std::size_t pos{ 0 }; pos < pattern.size(); )
+        {
+            const auto field{ nextPatternField( pattern, pos ) };
+            if( field.kind == PatternFieldKind::Invalid )
+            {
+                return false;
+            }
+            pos += field.length;
+        }
+
+        return true;
+    }
+
+    //=====================================================================
+    // Pattern writer
+    //=====================================================================
+
+    /** @brief Write a zero-padded number of fixed width (most significant digit first) */
+    constexpr char* writePatternDigits( char* out, std::int32_t value, std::size_t digits ) noexcept
+    {
+        for( std::size_t i{ digits }; i > 0; --i )
+        {
+            out[i - 1] = static_cast<char>( '0' + value % 10 );
+            value /= 10;
+        }
+
+        return out + digits;
+    }
+
+    /** @brief Write a numeric offset: ±HH:MM */
+    constexpr char* writePatternOffset( char* out, std::int32_t offsetMinutes ) noexcept
+    {
+        const auto absMinutes{ offsetMinutes < 0 ? -offsetMinutes : offsetMinutes };
+        *out++ = offsetMinutes < 0 ? '-' : '+';
+        out = writePatternDigits( out, absMinutes / 60, 2 );
+        *out++ = ':';
+
+        return writePatternDigits( out, absMinutes % 60, 2 );
+    }
+
+    /**
+     * @brief Write a validated pattern through an output iterator
+     * @tparam OutputIt Output iterator accepting char
+     * @tparam Components DateTime::Components (local fields)
+     * @param out Destination iterator
+     * @param pattern Pattern accepted by isValidPattern()
+     * @param c Calendar fields to write
+     * @param offsetMinutes UTC offset in minutes (ignored unless hasOffset or the pattern uses zzz)
+     * @param hasOffset true for DateTimeOffset values (K writes the offset instead of "Z")
+     * @return Iterator one past the last character written
+     */
+    template <typename OutputIt, typename Components>
+    constexpr OutputIt writePattern( OutputIt out,
+        std::string_view pattern,
+        const Components& c,
+        std::int32_t offsetMinutes,
+        bool hasOffset )
+    {
+        char field[8]{};
+        for( std::size_t pos{ 0 }; pos < pattern.size(); )
+        {
+            const auto token{ nextPatternField( pattern, pos ) };
+            const char* fieldEnd{ field };
+            switch( token.kind )
+            {
+                case PatternFieldKind::Literal:
+                {
+                    *out++ = pattern[pos];
+                    break;
+                }
+                case PatternFieldKind::QuotedLiteral:
+                {
+                    out = std::copy_n( pattern.data() + pos + 1, token.length - 2, out );
+                    break;
+                }
+                case PatternFieldKind::Year:
+                {
+                    fieldEnd = writePatternDigits( field, c.year, 4 );
+                    break;
+                }
+                case PatternFieldKind::Month:
+                {
+                    fieldEnd = writePatternDigits( field, c.month, 2 );
+                    break;
+                }
+                case PatternFieldKind::Day:
+                {
+                    fieldEnd = writePatternDigits( field, c.day, 2 );
+                    break;
+                }
+                case PatternFieldKind::Hour:
+                {
+                    fieldEnd = writePatternDigits( field, c.hour, 2 );
+                    break;
+                }
+                case PatternFieldKind::Minute:
+                {
+                    fieldEnd = writePatternDigits( field, c.minute, 2 );
+                    break;
+                }
+                case PatternFieldKind::Second:
+                {
+                    fieldEnd = writePatternDigits( field, c.second, 2 );
+                    break;
+                }
+                case PatternFieldKind::Fraction:
+                {
+                    std::int32_t value{ c.subsecondTicks };
+                    for( std::size_t i{ token.length }; i < 7; ++i )
+                    {
+                        value /= 10;
+                    }
+                    fieldEnd = writePatternDigits( field, value, token.length );
+                    break;
+                }
+                case PatternFieldKind::OffsetOrUtc:
+                {
+                    if( hasOffset )
+                    {
+                        fieldEnd = writePatternOffset( field, offsetMinutes );
+                    }
+                    else
+                    {
+                        *out++ = 'Z';
+                    }
+                    break;
+                }
+                case PatternFieldKind::Offset:
+                {
+                    fieldEnd = writePatternOffset( field, hasOffset ? offsetMinutes : 0 );
+                    break;
+                }
+                case PatternFieldKind::Invalid:
+                default:
+                {
+                    break;
+                }
+            }
+
+            out = std::copy( static_cast<const char*>( field ), fieldEnd, out );
+            pos += token.length;
+        }
+
+        return out;
+    }
+
+    //=====================================================================
+    // Compiled pattern programs
+    //=====================================================================
+
+    /** @brief Fixed-position field operation of a compiled pattern */
+    struct PatternOp
+    {
+        PatternFieldKind kind{ PatternFieldKind::Literal }; ///< Field kind (Literal covers merged literal runs)
+        std::uint8_t position{};                            ///< Offset of the field in the output text
+        std::uint8_t width{};                               ///< Field width in characters
+    };
+
+    /**
+     * @brief Pattern compiled into a literal skeleton and fixed-position field operations
+     * @tparam MaxLength Output text capacity
+     * @tparam MaxOps Operation capacity
+     */
+    template <std::size_t MaxLength, std::size_t MaxOps>
+    struct PatternProgram
+    {
+        std::array<char, MaxLength> text{};  ///< Output skeleton: literals in place, fields zero-filled
+        std::array<PatternOp, MaxOps> ops{}; ///< Operations in output order
+        std::size_t length{};                ///< Output length in characters
+        std::size_t opCount{};               ///< Number of operations
+        bool valid{};                        ///< false if the pattern is invalid or exceeds the capacities
+        bool zuluAtEnd{};                    ///< Final field is an offset K that also parses as 'Z'
+    };
+
+    /**
+     * @brief Upper bound of the output length of a pattern (each pattern character expands to at most 6)
+     * @param patternLength Pattern length in characters
+     */
+    [[nodiscard]] constexpr std::size_t maxPatternOutputLength( std::size_t patternLength ) noexcept
+    {
+        return patternLength * 6;
+    }
+
+    /**
+     * @brief Compile a pattern into a fixed-position program
+     * @tparam MaxLength Output text capacity (at most 255)
+     * @tparam MaxOps Operation capacity
+     * @param pattern Pattern text
+     * @param hasOffset true to compile for DateTimeOffset values (K is a ±HH:MM field), false for
+     *                  DateTime values (K is the literal 'Z')
+     * @return Compiled program, with valid set to false on error
+     */
+    template <std::size_t MaxLength, std::size_t MaxOps>
+    [[nodiscard]] constexpr PatternProgram<MaxLength, MaxOps> compilePattern(
+        std::string_view pattern, bool hasOffset ) noexcept
+    {
+        static_assert( MaxLength <= 255, "Pattern positions are stored in 8 bits" );
+
+        PatternProgram<MaxLength, MaxOps> program{};
+        if( !isValidPattern( pattern ) )
+        {
+            return program;
+        }
+
+        std::size_t length{ 0 };
+        std::size_t opCount{ 0 };
+        bool literalOpen{ false };
+
+        const auto appendLiteral{ [&]( std::string_view text ) noexcept {
+            for( const char c : text )
+            {
+                if( length == MaxLength )
+                {
+                    return false;
+                }
+                if( !literalOpen )
+                {
+                    if( opCount == MaxOps )
+                    {
+                        return false;
+                    }
+                    program.ops[opCount++] = { PatternFieldKind::Literal, static_cast<std::uint8_t>( length ), 0 };
+                    literalOpen = true;
+                }
+                program.text[length++] = c;
+                ++program.ops[opCount - 1].width;
+            }
+
+            return true;
+        } };
+
+        const auto appendField{ [&]( PatternFieldKind kind, std::size_t width ) noexcept {
+            if( length + width > MaxLength || opCount == MaxOps )
+            {
+                return false;
+            }
+            program.ops[opCount++] = {
+                kind, static_cast<std::uint8_t>( length ), static_cast<std::uint8_t>( width ) };
+            for( std::size_t i{ 0 }; i < width; ++i )
+            {
+                program.text[length++] = '0';
+            }
+            literalOpen = false;
+
+            return true;
+        } };
+
+        for( std::size_t pos{ 0 }; pos < pattern.size(); )
+        {
+            const auto token{ nextPatternField( pattern, pos ) };
+            bool appended{ false };
+            switch( token.kind )
+            {
+                case PatternFieldKind::Literal:
+                {
+                    appended = appendLiteral( pattern.substr( pos, 1 ) );
+                    break;
+                }
+                case PatternFieldKind::QuotedLiteral:
+                {
+                    appended = token.length == 2 || appendLiteral( pattern.substr( pos + 1, token.length - 2 ) );
+                    break;
+                }
+                case PatternFieldKind::Year:
+                {
+                    appended = appendField( token.kind, 4 );
+                    break;
+                }
+                case PatternFieldKind::Fraction:
+                {
+                    appended = appendField( token.kind, token.length );
+                    break;
+                }
+                case PatternFieldKind::OffsetOrUtc:
+                {
+                    appended = hasOffset ? appendField( PatternFieldKind::OffsetOrUtc, 6 ) : appendLiteral( "Z" );
+                    break;
+                }
+                case PatternFieldKind::Offset:
+                {
+                    appended = appendField( token.kind, 6 );
+                    break;
+                }
+                case PatternFieldKind::Invalid:
+                {
+                    break;
+                }
+                default:
+                {
+                    appended = appendField( token.kind, 2 );
+                    break;
+                }
+            }
+
+            if( !appended )
+            {
+                return program;
+            }
+            pos += token.length;
+        }
+
+        program.length = length;
+        program.opCount = opCount;
+        program.zuluAtEnd = opCount != 0 && program.ops[opCount - 1].kind == PatternFieldKind::OffsetOrUtc;
+        program.valid = true;
+
+        return program;
+    }
+
+    /** @brief Calendar fields decoded by a compiled pattern (missing date fields default to 0001-01-01) */
+    struct PatternFields
+    {
+        std::int32_t year{ 1 };
+        std::int32_t month{ 1 };
+        std::int32_t day{ 1 };
+        std::int32_t hour{};
+        std::int32_t minute{};
+        std::int32_t second{};
+        std::int32_t subsecondTicks{};
+        std::int32_t offsetMinutes{};
+    };
+
+    /** @brief Powers of ten used to scale fractions to 7 digits */
+    inline constexpr std::int32_t PATTERN_FRACTION_SCALE[8]{ 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1 };
+
+    /**
+     * @brief Write one field of a compiled program
+     * @param text Output text holding the program skeleton
+     * @param op Field operation (Literal operations are no-ops)
+     * @param c Calendar fields (DateTime::Components)
+     * @param offsetMinutes UTC offset in minutes
+     */
+    template <typename Components>
+    constexpr void writeProgramField(
+        char* text, const PatternOp& op, const Components& c, std::int32_t offsetMinutes ) noexcept
+    {
+        char* out{ text + op.position };
+        switch( op.kind )
+        {
+            case PatternFieldKind::Year:
+            {
+                writePatternDigits( out, c.year, 4 );
+                break;
+            }
+            case PatternFieldKind::Month:
+            {
+                writePatternDigits( out, c.month, 2 );
+                break;
+            }
+            case PatternFieldKind::Day:
+            {
+                writePatternDigits( out, c.day, 2 );
+                break;
+            }
+            case PatternFieldKind::Hour:
+            {
+                writePatternDigits( out, c.hour, 2 );
+                break;
+            }
+            case PatternFieldKind::Minute:
+            {
+                writePatternDigits( out, c.minute, 2 );
+                break;
+            }
+            case PatternFieldKind::Second:
+            {
+                writePatternDigits( out, c.second, 2 );
+                break;
+            }
+            case PatternFieldKind::Fraction:
+            {
+                writePatternDigits( out, c.subsecondTicks / PATTERN_FRACTION_SCALE[op.width], op.width );
+                break;
+            }
+            case PatternFieldKind::OffsetOrUtc:
+            case PatternFieldKind::Offset:
+            {
+                writePatternOffset( out, offsetMinutes );
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    /** @brief Read a fixed-width unsigned number, false if a character is not a digit */
+    [[nodiscard]] constexpr bool readPatternDigits( const char* in, std::size_t digits, std::int32_t& value ) noexcept
+    {
+        std::uint32_t result{ 0 };
+        bool ok{ true };
+        for( std::size_t i{ 0 }; i < digits; ++i )
+        {
+            const auto digit{ static_cast<std::uint32_t>( static_cast<unsigned char>( in[i] ) - '0' ) };
+            ok &= digit < 10;
+            result = result * 10 + digit;
+        }
+        value = static_cast<std::int32_t>( result );
+
+        return ok;
+    }
+
+    /** @brief Read a numeric offset ±HH:MM into minutes */
+    [[nodiscard]] constexpr bool readPatternOffset( const char* in, std::int32_t& offsetMinutes ) noexcept
+    {
+        if( ( in[0] != '+' && in[0] != '-' ) || in[3] != ':' )
+        {
+            return false;
+        }
+
+        std::int32_t hours{}, minutes{};
+        if( !readPatternDigits( in + 1, 2, hours ) || !readPatternDigits( in + 4, 2, minutes ) || hours > 14 ||
+            minutes > 59 )
+        {
+            return false;
+        }
+
+        const auto total{ hours * 60 + minutes };
+        offsetMinutes = in[0] == '-' ? -total : total;
+
+        return total <= 14 * 60;
+    }
+
+    /**
+     * @brief Read one field of a compiled program
+     * @param in Input text (length already checked against the program)
+     * @param skeleton Program skeleton (literals are compared against it)
+     * @param op Field operation
+     * @param zulu true if a trailing K field was written as 'Z'
+     * @param fields Receives the decoded value
+     * @return false if the input does not match the field
+     */
+    [[nodiscard]] constexpr bool readProgramField(
+        const char* in, const char* skeleton, const PatternOp& op, bool zulu, PatternFields& fields ) noexcept
+    {
+        const char* field{ in + op.position };
+        switch( op.kind )
+        {
+            case PatternFieldKind::Literal:
+            {
+                return std::equal( field, field + op.width, skeleton + op.position );
+            }
+            case PatternFieldKind::Year:
+            {
+                return readPatternDigits( field, 4, fields.year );
+            }
+            case PatternFieldKind::Month:
+            {
+                return readPatternDigits( field, 2, fields.month );
+            }
+            case PatternFieldKind::Day:
+            {
+                return readPatternDigits( field, 2, fields.day );
+            }
+            case PatternFieldKind::Hour:
+            {
+                return readPatternDigits( field, 2, fields.hour );
+            }
+            case PatternFieldKind::Minute:
+            {
+                return readPatternDigits( field, 2, fields.minute );
+            }
+            case PatternFieldKind::Second:
+            {
+                return readPatternDigits( field, 2, fields.second );
+            }
+            case PatternFieldKind::Fraction:
+            {
+                std::int32_t value{};
+                const bool ok{ readPatternDigits( field, op.width, value ) };
+                fields.subsecondTicks = value * PATTERN_FRACTION_SCALE[op.width];
+
+                return ok;
+            }
+            case PatternFieldKind::OffsetOrUtc:
+            {
+                if( zulu )
+                {
+                    fields.offsetMinutes = 0;
+
+                    return true;
+                }
+
+                return readPatternOffset( field, fields.offsetMinutes );
+            }
+            case PatternFieldKind::Offset:
+            {
+                return readPatternOffset( field, fields.offsetMinutes );
+            }
+            default:
+            {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * @brief Write one field with a compile-time operation (expands to the digit writes only)
+     * @see writeProgramField()
+     */
+    template <PatternOp Op, typename Components>
+    constexpr void writeFixedField( char* text, const Components& c, std::int32_t offsetMinutes ) noexcept
+    {
+        char* out{ text + Op.position };
+        if constexpr( Op.kind == PatternFieldKind::Year )
+        {
+            writePatternDigits( out, c.year, 4 );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Month )
+        {
+            writePatternDigits( out, c.month, 2 );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Day )
+        {
+            writePatternDigits( out, c.day, 2 );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Hour )
+        {
+            writePatternDigits( out, c.hour, 2 );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Minute )
+        {
+            writePatternDigits( out, c.minute, 2 );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Second )
+        {
+            writePatternDigits( out, c.second, 2 );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Fraction )
+        {
+            writePatternDigits( out, c.subsecondTicks / PATTERN_FRACTION_SCALE[Op.width], Op.width );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::OffsetOrUtc || Op.kind == PatternFieldKind::Offset )
+        {
+            writePatternOffset( out, offsetMinutes );
+        }
+    }
+
+    /**
+     * @brief Read one field with a compile-time operation
+     * @see readProgramField()
+     */
+    template <PatternOp Op>
+    [[nodiscard]] constexpr bool readFixedField(
+        const char* in, const char* skeleton, bool zulu, PatternFields& fields ) noexcept
+    {
+        const char* field{ in + Op.position };
+        if constexpr( Op.kind == PatternFieldKind::Literal )
+        {
+            bool equal{ true };
+            for( std::size_t i{ 0 }; i < Op.width; ++i )
+            {
+                equal &= field[i] == skeleton[Op.position + i];
+            }
+
+            return equal;
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Year )
+        {
+            return readPatternDigits( field, 4, fields.year );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Month )
+        {
+            return readPatternDigits( field, 2, fields.month );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Day )
+        {
+            return readPatternDigits( field, 2, fields.day );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Hour )
+        {
+            return readPatternDigits( field, 2, fields.hour );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Minute )
+        {
+            return readPatternDigits( field, 2, fields.minute );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Second )
+        {
+            return readPatternDigits( field, 2, fields.second );
+        }
+        else if constexpr( Op.kind == PatternFieldKind::Fraction )
+        {
+            std::int32_t value{};
+            const bool ok{ readPatternDigits( field, Op.width, value ) };
+            fields.subsecondTicks = value * PATTERN_FRACTION_SCALE[Op.width];
+
+            return ok;
+        }
+        else if constexpr( Op.kind == PatternFieldKind::OffsetOrUtc )
+        {
+            if( zulu )
+            {
+                fields.offsetMinutes = 0;
+
+                return true;
+            }
+
+            return readPatternOffset( field, fields.offsetMinutes );
+        }
+        else
+        {
+            return readPatternOffset( field, fields.offsetMinutes );
+        }
+    }
+
+    /**
+     * @brief Check if an input length matches a program, detecting a trailing 'Z' for K
+     * @param program Compiled program
+     * @param input Input text
+     * @param zulu Receives true if the trailing K field is written as 'Z'
+     */
+    template <typename Program>
+    [[nodiscard]] constexpr bool matchProgramLength(
+        const Program& program, std::string_view input, bool& zulu ) noexcept
+    {
+        zulu = program.zuluAtEnd && input.size() + 5 == program.length && input.back() == 'Z';
+
+        return input.size() == program.length || zulu;
+    }
+
+    /** @brief Validate decoded fields (calendar date, time of day) */
+    [[nodiscard]] constexpr bool isValidPatternFields( const PatternFields& f ) noexcept
+    {
+        if( f.year < 1 || f.month < 1 || f.month > 12 || f.day < 1 || f.hour > 23 || f.minute > 59 || f.second > 59 )
+        {
+            return false;
+        }
+
+        constexpr std::int32_t lengths[12]{ 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        const bool leap{ ( f.year % 4 == 0 && f.year % 100 != 0 ) || f.year % 400 == 0 };
+
+        return f.day <= lengths[f.month - 1] + ( f.month == 2 && leap );
+    }
+} // namespace nfx::time::detail
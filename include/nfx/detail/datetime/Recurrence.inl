@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Recurrence.inl
+ * @brief Inline implementations for Recurrence ranges
+ */
+
+namespace nfx::time
+{
+    //=====================================================================
+    // Recurrence class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Ranges
+    //----------------------------------------------
+
+    inline RecurrenceView<DateTime> Recurrence::occurrences( const DateTime& after ) const noexcept
+    {
+        return RecurrenceView<DateTime>{ *this, after };
+    }
+
+    inline RecurrenceView<DateTimeOffset> Recurrence::occurrences( const DateTimeOffset& after ) const noexcept
+    {
+        return RecurrenceView<DateTimeOffset>{ *this, after };
+    }
+
+    inline RecurrenceView<DateTimeOffset> Recurrence::occurrences(
+        const DateTimeOffset& after, const TimeZone& zone ) const noexcept
+    {
+        return RecurrenceView<DateTimeOffset>{ *this, after, &zone };
+    }
+
+    //=====================================================================
+    // RecurrenceView class
+    //=====================================================================
+
+    template <typename T>
+    inline typename RecurrenceView<T>::Iterator& RecurrenceView<T>::Iterator::operator++() noexcept
+    {
+        m_current = m_view->next( *m_current );
+
+        return *this;
+    }
+
+    template <typename T>
+    inline std::optional<T> RecurrenceView<T>::next( const T& after ) const noexcept
+    {
+        if constexpr( std::is_same_v<T, DateTimeOffset> )
+        {
+            if( m_zone != nullptr )
+            {
+                return m_recurrence.nextAfter( after, *m_zone );
+            }
+        }
+
+        return m_recurrence.nextAfter( after );
+    }
+} // namespace nfx::time
@@ -0,0 +1,111 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Stats.h
+ * @brief Per-thread instrumentation counters behind nfx::time::stats()
+ * @details Counters are compiled in only when NFX_DATETIME_ENABLE_STATS is defined (the
+ *          NFX_DATETIME_ENABLE_STATS CMake option sets it on the library targets and their
+ *          consumers). Otherwise NFX_DATETIME_COUNT_STAT() expands to nothing.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace nfx::time::detail
+{
+    //=====================================================================
+    // Instrumentation counters
+    //=====================================================================
+
+    /** @brief Index of each counter in a thread's counter block */
+    enum class StatCounter : std::uint8_t
+    {
+        DateTimeFastPath,
+        DateTimeFallback,
+        DateTimeFailure,
+        DateTimeOffsetFastPath,
+        DateTimeOffsetFallback,
+        DateTimeOffsetFailure,
+        TimeSpanFastPath,
+        TimeSpanFallback,
+        TimeSpanFailure,
+        TimezoneCacheHit,
+        TimezoneCacheMiss,
+        TimezoneLibraryCall,
+        TimeSpanFormat,
+
+        /** @brief First of the per-DateTime::Format counters, indexed by the format value */
+        Format
+    };
+
+    /** @brief Number of DateTime::Format values counted (checked against the enum in Stats.cpp) */
+    inline constexpr std::size_t FORMAT_STAT_COUNT{ 11 };
+
+    /** @brief Number of counters in a thread's counter block */
+    inline constexpr std::size_t STAT_COUNTER_COUNT{ static_cast<std::size_t>( StatCounter::Format ) +
+                                                     FORMAT_STAT_COUNT };
+
+#if defined( NFX_DATETIME_ENABLE_STATS )
+    /**
+     * @brief Register the calling thread's counter block on first use
+     * @return Array of STAT_COUNTER_COUNT counters, written only by the calling thread
+     */
+    [[nodiscard]] std::atomic<std::uint64_t>* threadStatCounters() noexcept;
+
+    /** @brief Calling thread's counter block; constant-initialized, so reads need no TLS guard */
+    inline thread_local std::atomic<std::uint64_t>* t_statCounters{ nullptr };
+
+    /**
+     * @brief Increment one of the calling thread's counters
+     * @param counter Counter to increment
+     * @param index Added to the counter index (DateTime::Format value for StatCounter::Format)
+     * @details The block has a single writer, so a relaxed load and store replace the locked
+     *          read-modify-write; stats() reads the counters with relaxed loads.
+     */
+    inline void countStat( StatCounter counter, std::size_t index = 0 ) noexcept
+    {
+        auto* counters{ t_statCounters };
+        if( counters == nullptr ) [[unlikely]]
+        {
+            counters = threadStatCounters();
+            t_statCounters = counters;
+        }
+
+        auto& value{ counters[static_cast<std::size_t>( counter ) + index] };
+        value.store( value.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+    }
+#endif
+} // namespace nfx::time::detail
+
+#if defined( NFX_DATETIME_ENABLE_STATS )
+/** @brief Increment an instrumentation counter */
+#    define NFX_DATETIME_COUNT_STAT( ... ) ::nfx::time::detail::countStat( __VA_ARGS__ )
+#else
+/** @brief Instrumentation disabled: counters compile to nothing */
+#    define NFX_DATETIME_COUNT_STAT( ... ) static_cast<void>( 0 )
+#endif
@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Stopwatch.inl
+ * @brief Inline implementations for BasicStopwatch
+ */
+
+namespace nfx::time
+{
+    //=====================================================================
+    // BasicStopwatch class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    template <SteadyClockSource Clock>
+    inline BasicStopwatch<Clock> BasicStopwatch<Clock>::startNew() noexcept
+    {
+        BasicStopwatch watch;
+        watch.start();
+
+        return watch;
+    }
+
+    //----------------------------------------------
+    // Control
+    //----------------------------------------------
+
+    template <SteadyClockSource Clock>
+    inline void BasicStopwatch<Clock>::start() noexcept
+    {
+        if( !m_running )
+        {
+            m_startTicks = Clock::ticks();
+            m_running = true;
+        }
+    }
+
+    template <SteadyClockSource Clock>
+    inline void BasicStopwatch<Clock>::stop() noexcept
+    {
+        if( m_running )
+        {
+            m_accumulatedTicks += Clock::ticks() - m_startTicks;
+            m_running = false;
+        }
+    }
+
+    template <SteadyClockSource Clock>
+    inline void BasicStopwatch<Clock>::reset() noexcept
+    {
+        m_accumulatedTicks = 0;
+        m_running = false;
+    }
+
+    template <SteadyClockSource Clock>
+    inline void BasicStopwatch<Clock>::restart() noexcept
+    {
+        m_accumulatedTicks = 0;
+        m_startTicks = Clock::ticks();
+        m_running = true;
+    }
+
+    template <SteadyClockSource Clock>
+    inline TimeSpan BasicStopwatch<Clock>::lap() noexcept
+    {
+        const auto now{ Clock::ticks() };
+        const auto elapsedTicks{ m_accumulatedTicks + ( m_running ? now - m_startTicks : 0 ) };
+
+        m_accumulatedTicks = 0;
+        m_startTicks = now;
+        m_running = true;
+
+        return TimeSpan{ elapsedTicks };
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    template <SteadyClockSource Clock>
+    inline bool BasicStopwatch<Clock>::isRunning() const noexcept
+    {
+        return m_running;
+    }
+
+    template <SteadyClockSource Clock>
+    inline TimeSpan BasicStopwatch<Clock>::elapsed() const noexcept
+    {
+        return TimeSpan{ elapsedTicks() };
+    }
+
+    template <SteadyClockSource Clock>
+    inline std::int64_t BasicStopwatch<Clock>::elapsedTicks() const noexcept
+    {
+        return m_accumulatedTicks + ( m_running ? Clock::ticks() - m_startTicks : 0 );
+    }
+} // namespace nfx::time
@@ -31,10 +31,98 @@
  *          for arithmetic operations and time unit conversions.
  */
 
+#include <algorithm>
+#include <ostream>
 #include <cmath>
 #include <stdexcept>
 
 #include "Constants.h"
+#include "Format.h"
+#include "Hash.h"
+#include "Iso8601.h"
+#include "Stats.h"
+
+namespace nfx::time::detail
+{
+    //=====================================================================
+    // ISO 8601 formatting
+    //=====================================================================
+
+    /** @brief Write ISO 8601 duration, without bounds checking */
+    inline char* formatIso8601Duration( char* out, std::int64_t ticks ) noexcept
+    {
+        // Handle negative durations
+        if( ticks < 0 )
+        {
+            *out++ = '-';
+        }
+
+        *out++ = 'P';
+
+        // Unsigned magnitude so that the minimum value does not overflow
+        const std::uint64_t absTicks{ ticks < 0 ? 0 - static_cast<std::uint64_t>( ticks )
+                                                : static_cast<std::uint64_t>( ticks ) };
+        const std::uint64_t totalSeconds{ absTicks / constants::TICKS_PER_SECOND };
+
+        // Break down into days, hours, minutes, seconds
+        const std::int64_t days{ static_cast<std::int64_t>( totalSeconds / constants::SECONDS_PER_DAY ) };
+        const std::int32_t remainingSeconds{ static_cast<std::int32_t>(
+            totalSeconds % constants::SECONDS_PER_DAY ) };
+        const std::int32_t hours{ remainingSeconds / constants::SECONDS_PER_HOUR };
+        const std::int32_t minutes{ ( remainingSeconds % constants::SECONDS_PER_HOUR ) /
+                                    constants::SECONDS_PER_MINUTE };
+        const std::int32_t seconds{ remainingSeconds % constants::SECONDS_PER_MINUTE };
+
+        // Output days if present
+        if( days > 0 )
+        {
+            out = appendInteger( out, days );
+            *out++ = 'D';
+        }
+
+        // Check if we have any time components
+        const std::int32_t fractionalTicks{ static_cast<std::int32_t>( absTicks % constants::TICKS_PER_SECOND ) };
+        const bool hasTimeComponent{ hours > 0 || minutes > 0 || seconds > 0 || fractionalTicks > 0 };
+
+        // Only output time component if present
+        if( hasTimeComponent )
+        {
+            *out++ = 'T';
+
+            if( hours > 0 )
+            {
+                out = appendInteger( out, hours );
+                *out++ = 'H';
+            }
+
+            if( minutes > 0 )
+            {
+                out = appendInteger( out, minutes );
+                *out++ = 'M';
+            }
+
+            // Include seconds with or without fractional part
+            if( seconds > 0 || fractionalTicks > 0 )
+            {
+                out = appendInteger( out, seconds );
+                if( fractionalTicks > 0 )
+                {
+                    out = appendFractionalSecondsTrimmed( out, fractionalTicks );
+                }
+                *out++ = 'S';
+            }
+        }
+        else if( days == 0 )
+        {
+            // No days and no time components: output PT0S for zero duration
+            *out++ = 'T';
+            *out++ = '0';
+            *out++ = 'S';
+        }
+
+        return out;
+    }
+} // namespace nfx::time::detail
 
 namespace nfx::time
 {
@@ -56,8 +144,19 @@ namespace nfx::time
     {
     }
 
-    inline TimeSpan::TimeSpan( std::string_view iso8601String )
+    inline constexpr TimeSpan::TimeSpan( std::string_view iso8601String )
+        : m_ticks{ 0 }
     {
+        // Constant evaluation accepts ISO 8601 durations only, numeric seconds need std::from_chars
+        if( std::is_constant_evaluated() )
+        {
+            if( !detail::parseIso8601Duration( iso8601String, m_ticks ) )
+            {
+                throw std::invalid_argument{ "Invalid ISO 8601 duration string format" };
+            }
+            return;
+        }
+
         TimeSpan result;
         if( !fromString( iso8601String, result ) )
         {
@@ -186,6 +285,41 @@ namespace nfx::time
         return m_ticks;
     }
 
+    //----------------------------------------------
+    // String formatting
+    //----------------------------------------------
+
+    inline std::string TimeSpan::toString() const
+    {
+        char buffer[constants::MAX_ISO8601_DURATION_LENGTH];
+        const auto length{ formatTo( buffer, sizeof( buffer ) ) };
+
+        return std::string{ buffer, length };
+    }
+
+    inline std::size_t TimeSpan::formatTo( char* buffer, std::size_t capacity ) const noexcept
+    {
+        NFX_DATETIME_COUNT_STAT( detail::StatCounter::TimeSpanFormat );
+
+        return detail::formatInto<constants::MAX_ISO8601_DURATION_LENGTH>(
+            buffer, capacity, [this]( char* out ) noexcept { return detail::formatIso8601Duration( out, m_ticks ); } );
+    }
+
+    inline std::size_t TimeSpan::formatTo( std::span<char> buffer ) const noexcept
+    {
+        return formatTo( buffer.data(), buffer.size() );
+    }
+
+    template <typename OutputIt>
+        requires( !std::is_pointer_v<OutputIt> && std::output_iterator<OutputIt, char> )
+    inline OutputIt TimeSpan::formatTo( OutputIt out ) const
+    {
+        char buffer[constants::MAX_ISO8601_DURATION_LENGTH];
+        const auto length{ formatTo( buffer, sizeof( buffer ) ) };
+
+        return std::copy_n( buffer, length, out );
+    }
+
     //----------------------------------------------
     // Static factory methods
     //----------------------------------------------
@@ -229,7 +363,13 @@ namespace nfx::time
     // Stream operators
     //=====================================================================
 
-    std::ostream& operator<<( std::ostream& os, const TimeSpan& timeSpan );
+    inline std::ostream& operator<<( std::ostream& os, const TimeSpan& timeSpan )
+    {
+        os << timeSpan.toString();
+
+        return os;
+    }
+
 
     std::istream& operator>>( std::istream& is, TimeSpan& timeSpan );
 
@@ -308,6 +448,36 @@ namespace nfx::time
         {
             return TimeSpan::fromTicks( std::round( static_cast<double>( nanoseconds ) / 100.0 ) );
         }
+
+        /**
+         * @brief ISO 8601 duration literal, e.g. "PT1H30M"_ts
+         * @details Parsed at compile time; a malformed duration is a compile error.
+         */
+        consteval TimeSpan operator""_ts( const char* str, std::size_t length )
+        {
+            std::int64_t ticks{ 0 };
+            if( !detail::parseIso8601Duration( std::string_view{ str, length }, ticks ) )
+            {
+                throw std::invalid_argument{ "Invalid ISO 8601 duration literal" };
+            }
+
+            return TimeSpan{ ticks };
+        }
+
+        /**
+         * @brief UTC offset literal ("Z", "±HH:MM", "±HHMM" or "±HH"), e.g. "+02:00"_offset
+         * @details Parsed at compile time; a malformed or out-of-range offset is a compile error.
+         */
+        consteval TimeSpan operator""_offset( const char* str, std::size_t length )
+        {
+            std::int64_t ticks{ 0 };
+            if( !detail::decodeIso8601Offset( std::string_view{ str, length }, ticks ) )
+            {
+                throw std::invalid_argument{ "Invalid UTC offset literal" };
+            }
+
+            return TimeSpan{ ticks };
+        }
     } // namespace literals
 } // namespace nfx::time
 
@@ -317,17 +487,54 @@ namespace nfx::time
 
 namespace std
 {
+    /**
+     * @brief Formatter for TimeSpan
+     * @details Writes the ISO 8601 duration produced by toString(). Accepts an empty spec or
+     *          {:iso}; any other spec is rejected.
+     */
     template <>
     struct formatter<nfx::time::TimeSpan>
     {
         constexpr auto parse( std::format_parse_context& ctx )
         {
-            return ctx.begin();
+            auto it{ ctx.begin() };
+            while( it != ctx.end() && *it != '}' )
+            {
+                ++it;
+            }
+
+            const std::string_view spec{ ctx.begin(), it };
+            if( !spec.empty() && spec != "iso" )
+            {
+                throw std::format_error{ "Invalid TimeSpan format specifier" };
+            }
+
+            return it;
         }
 
         auto format( const nfx::time::TimeSpan& ts, std::format_context& ctx ) const
         {
-            return format_to( ctx.out(), "{}", ts.toString() );
+            return ts.formatTo( ctx.out() );
+        }
+    };
+} // namespace std
+
+//=====================================================================
+// std::hash specialization
+//=====================================================================
+
+namespace std
+{
+    /**
+     * @brief Hash for TimeSpan
+     * @details Mixes the tick count, so durations of whole seconds or days spread over every bucket.
+     */
+    template <>
+    struct hash<nfx::time::TimeSpan>
+    {
+        std::size_t operator()( const nfx::time::TimeSpan& value ) const noexcept
+        {
+            return nfx::time::detail::hashTicks( static_cast<std::uint64_t>( value.ticks() ) );
         }
     };
 } // namespace std
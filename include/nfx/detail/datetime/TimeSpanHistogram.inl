@@ -0,0 +1,243 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimeSpanHistogram.inl
+ * @brief Inline implementations for TimeSpanHistogram and ConcurrentTimeSpanHistogram
+ */
+
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+namespace nfx::time
+{
+    namespace detail
+    {
+        //=====================================================================
+        // Per-thread shard cache
+        //=====================================================================
+
+        /** @brief One cached (histogram, shard) pairing of the calling thread */
+        struct HistogramShardSlot
+        {
+            /** @brief Histogram identifier (0 = empty; identifiers are never reused) */
+            std::uint64_t id{ 0 };
+
+            /** @brief The calling thread's shard of that histogram */
+            void* shard{ nullptr };
+        };
+
+        /** @brief Number of histograms each thread can alternate between without a list scan */
+        inline constexpr std::size_t HISTOGRAM_SHARD_CACHE_SIZE{ 4 };
+
+        /** @brief Direct-mapped cache of the calling thread's shards, indexed by histogram id */
+        inline thread_local std::array<HistogramShardSlot, HISTOGRAM_SHARD_CACHE_SIZE> t_histogramShards{};
+    } // namespace detail
+
+    //=====================================================================
+    // TimeSpanHistogram class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Recording
+    //----------------------------------------------
+
+    inline void TimeSpanHistogram::record( const TimeSpan& value ) noexcept
+    {
+        record( value, 1 );
+    }
+
+    inline void TimeSpanHistogram::record( const TimeSpan& value, std::uint64_t count ) noexcept
+    {
+        const auto ticks{ std::max<std::int64_t>( value.ticks(), 0 ) };
+
+        m_buckets[bucketIndex( ticks )] += count;
+        m_count += count;
+        m_sum += static_cast<double>( ticks ) * static_cast<double>( count );
+        m_min = std::min( m_min, ticks );
+        m_max = std::max( m_max, ticks );
+    }
+
+    //----------------------------------------------
+    // Queries
+    //----------------------------------------------
+
+    inline std::uint64_t TimeSpanHistogram::count() const noexcept
+    {
+        return m_count;
+    }
+
+    inline TimeSpan TimeSpanHistogram::min() const noexcept
+    {
+        return TimeSpan{ m_count == 0 ? 0 : m_min };
+    }
+
+    inline TimeSpan TimeSpanHistogram::max() const noexcept
+    {
+        return TimeSpan{ m_max };
+    }
+
+    inline std::span<const std::uint64_t, TimeSpanHistogram::BUCKET_COUNT> TimeSpanHistogram::buckets() const noexcept
+    {
+        return std::span<const std::uint64_t, BUCKET_COUNT>{ m_buckets };
+    }
+
+    //----------------------------------------------
+    // Bucket layout
+    //----------------------------------------------
+
+    inline constexpr std::size_t TimeSpanHistogram::bucketIndex( std::int64_t ticks ) noexcept
+    {
+        if( ticks < static_cast<std::int64_t>( SUB_BUCKET_COUNT ) )
+        {
+            return ticks < 0 ? 0 : static_cast<std::size_t>( ticks );
+        }
+
+        const auto value{ static_cast<std::uint64_t>( ticks ) };
+        const auto shift{ static_cast<unsigned>( std::bit_width( value ) ) - SUB_BUCKET_BITS };
+        const auto mantissa{ static_cast<std::size_t>( value >> shift ) };
+
+        return SUB_BUCKET_COUNT + ( shift - 1 ) * HALF_SUB_BUCKET_COUNT + ( mantissa - HALF_SUB_BUCKET_COUNT );
+    }
+
+    inline constexpr std::int64_t TimeSpanHistogram::bucketLowerBound( std::size_t index ) noexcept
+    {
+        if( index < SUB_BUCKET_COUNT )
+        {
+            return static_cast<std::int64_t>( index );
+        }
+
+        const auto offset{ index - SUB_BUCKET_COUNT };
+        const auto shift{ static_cast<unsigned>( offset / HALF_SUB_BUCKET_COUNT ) + 1 };
+        const auto mantissa{ static_cast<std::uint64_t>( offset % HALF_SUB_BUCKET_COUNT + HALF_SUB_BUCKET_COUNT ) };
+
+        return static_cast<std::int64_t>( mantissa << shift );
+    }
+
+    inline constexpr std::int64_t TimeSpanHistogram::bucketUpperBound( std::size_t index ) noexcept
+    {
+        if( index < SUB_BUCKET_COUNT )
+        {
+            return static_cast<std::int64_t>( index );
+        }
+
+        const auto shift{ static_cast<unsigned>( ( index - SUB_BUCKET_COUNT ) / HALF_SUB_BUCKET_COUNT ) + 1 };
+
+        return bucketLowerBound( index ) + static_cast<std::int64_t>( ( std::uint64_t{ 1 } << shift ) - 1 );
+    }
+
+    //=====================================================================
+    // ConcurrentTimeSpanHistogram class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Shards
+    //----------------------------------------------
+
+    struct ConcurrentTimeSpanHistogram::Shard
+    {
+        /** @brief Count per bucket */
+        std::array<std::atomic<std::uint64_t>, TimeSpanHistogram::BUCKET_COUNT> buckets{};
+
+        /** @brief Number of recorded values */
+        std::atomic<std::uint64_t> count{ 0 };
+
+        /** @brief Sum of recorded ticks */
+        std::atomic<double> sum{ 0.0 };
+
+        /** @brief Smallest recorded ticks */
+        std::atomic<std::int64_t> min{ INT64_MAX };
+
+        /** @brief Largest recorded ticks */
+        std::atomic<std::int64_t> max{ 0 };
+
+        /** @brief Reset generation the counters belong to; stale shards count as empty */
+        std::atomic<std::uint64_t> generation{ 0 };
+
+        /** @brief Recording thread */
+        std::thread::id owner;
+
+        /** @brief Next shard in the list */
+        Shard* next{ nullptr };
+    };
+
+    inline void ConcurrentTimeSpanHistogram::recordTo(
+        Shard& shard, std::int64_t ticks, std::uint64_t generation ) noexcept
+    {
+        // The owner clears its shard after a reset, so reset() never writes to shards it does not own
+        if( shard.generation.load( std::memory_order_relaxed ) != generation ) [[unlikely]]
+        {
+            for( auto& bucket : shard.buckets )
+            {
+                bucket.store( 0, std::memory_order_relaxed );
+            }
+            shard.count.store( 0, std::memory_order_relaxed );
+            shard.sum.store( 0.0, std::memory_order_relaxed );
+            shard.min.store( INT64_MAX, std::memory_order_relaxed );
+            shard.max.store( 0, std::memory_order_relaxed );
+            shard.generation.store( generation, std::memory_order_release );
+        }
+
+        // Single writer: plain load + store pairs instead of locked read-modify-write
+        auto& bucket{ shard.buckets[TimeSpanHistogram::bucketIndex( ticks )] };
+        bucket.store( bucket.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        shard.count.store( shard.count.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        shard.sum.store( shard.sum.load( std::memory_order_relaxed ) + static_cast<double>( ticks ),
+            std::memory_order_relaxed );
+
+        if( ticks < shard.min.load( std::memory_order_relaxed ) )
+        {
+            shard.min.store( ticks, std::memory_order_relaxed );
+        }
+        if( ticks > shard.max.load( std::memory_order_relaxed ) )
+        {
+            shard.max.store( ticks, std::memory_order_relaxed );
+        }
+    }
+
+    //----------------------------------------------
+    // Recording
+    //----------------------------------------------
+
+    inline void ConcurrentTimeSpanHistogram::record( const TimeSpan& value ) noexcept
+    {
+        auto& slot{ detail::t_histogramShards[m_id % detail::HISTOGRAM_SHARD_CACHE_SIZE] };
+        auto* shard{ static_cast<Shard*>( slot.shard ) };
+
+        if( slot.id != m_id ) [[unlikely]]
+        {
+            shard = acquireShard();
+            if( shard == nullptr )
+            {
+                return;
+            }
+
+            slot.id = m_id;
+            slot.shard = shard;
+        }
+
+        recordTo( *shard, std::max<std::int64_t>( value.ticks(), 0 ), m_generation.load( std::memory_order_acquire ) );
+    }
+} // namespace nfx::time
@@ -0,0 +1,56 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimeZone.inl
+ * @brief Inline implementations for TimeZone convenience overloads and zone conversion
+ */
+
+namespace nfx::time
+{
+    //=====================================================================
+    // TimeZone class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Offset lookup
+    //----------------------------------------------
+
+    inline TimeSpan TimeZone::offsetAt( const DateTime& utcDateTime ) const noexcept
+    {
+        return offsetAt( utcDateTime.ticks() );
+    }
+
+    //=====================================================================
+    // Zone conversion
+    //=====================================================================
+
+    inline DateTimeOffset toZone( const DateTimeOffset& value, const TimeZone& zone ) noexcept
+    {
+        const auto utcTicks{ value.utcTicks() };
+        const auto offset{ zone.offsetAt( utcTicks ) };
+
+        return DateTimeOffset{ DateTime{ utcTicks + offset.ticks() }, offset };
+    }
+} // namespace nfx::time
@@ -0,0 +1,87 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Timeline.inl
+ * @brief Inline implementations for Timeline accessors and range queries
+ */
+
+#include <limits>
+
+namespace nfx::time
+{
+    //=====================================================================
+    // Timeline class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    inline std::size_t Timeline::size() const noexcept
+    {
+        return m_size;
+    }
+
+    inline std::span<const DateTime> Timeline::values() const noexcept
+    {
+        return std::span<const DateTime>{ m_values.data(), m_size };
+    }
+
+    //----------------------------------------------
+    // Search
+    //----------------------------------------------
+
+    inline std::size_t Timeline::upperBound( const DateTime& value ) const noexcept
+    {
+        const auto ticks{ value.ticks() };
+
+        return ticks == std::numeric_limits<std::int64_t>::max() ? m_size : lowerBoundTicks( ticks + 1 );
+    }
+
+    inline std::span<const DateTime> Timeline::range( const DateTime& from, const DateTime& until ) const noexcept
+    {
+        if( until <= from )
+        {
+            return {};
+        }
+
+        const auto first{ lowerBoundTicks( from.ticks() ) };
+        const auto last{ lowerBoundTicks( until.ticks() ) };
+
+        return values().subspan( first, last - first );
+    }
+
+    inline std::size_t Timeline::count( const DateTime& from, const DateTime& until ) const noexcept
+    {
+        return range( from, until ).size();
+    }
+
+    inline bool Timeline::contains( const DateTime& value ) const noexcept
+    {
+        const auto position{ lowerBoundTicks( value.ticks() ) };
+
+        return position < m_size && m_values[position] == value;
+    }
+} // namespace nfx::time
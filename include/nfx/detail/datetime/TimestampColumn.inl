@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampColumn.inl
+ * @brief Inline implementations for TimestampColumnEncoder and TimestampColumnDecoder accessors
+ */
+
+namespace nfx::time
+{
+    //=====================================================================
+    // TimestampColumnEncoder class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Appending
+    //----------------------------------------------
+
+    inline void TimestampColumnEncoder::append( std::int64_t ticks )
+    {
+        m_pending[m_pendingCount++] = ticks;
+        if( m_pendingCount == BLOCK_SIZE )
+        {
+            sealBlock();
+        }
+    }
+
+    inline void TimestampColumnEncoder::append( const DateTime& value )
+    {
+        append( value.ticks() );
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    inline std::span<const std::byte> TimestampColumnEncoder::data() const noexcept
+    {
+        return m_data;
+    }
+
+    inline std::size_t TimestampColumnEncoder::size() const noexcept
+    {
+        return m_sealedCount + m_pendingCount;
+    }
+
+    inline std::size_t TimestampColumnEncoder::blockCount() const noexcept
+    {
+        return m_blockCount;
+    }
+
+    //=====================================================================
+    // TimestampColumnDecoder class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    inline std::size_t TimestampColumnDecoder::size() const noexcept
+    {
+        return m_firstRows.back();
+    }
+
+    inline std::size_t TimestampColumnDecoder::blockCount() const noexcept
+    {
+        return m_blockOffsets.size();
+    }
+
+    inline std::size_t TimestampColumnDecoder::blockSize( std::size_t block ) const noexcept
+    {
+        return m_firstRows[block + 1] - m_firstRows[block];
+    }
+
+    inline std::size_t TimestampColumnDecoder::blockFirstRow( std::size_t block ) const noexcept
+    {
+        return m_firstRows[block];
+    }
+} // namespace nfx::time
@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Binary.cpp
+ * @brief Bulk binary encoding and decoding of DateTime, DateTimeOffset and TimeSpan spans
+ */
+
+#include "nfx/datetime/Binary.h"
+
+#include <algorithm>
+
+namespace nfx::time::binary
+{
+    namespace
+    {
+        //=====================================================================
+        // Bulk helpers
+        //=====================================================================
+
+        /** @brief Encode every value with a fixed record size, writing nothing if out is too small */
+        template <typename T>
+        std::size_t encodeFixedRecords(
+            std::span<const T> values, std::span<std::byte> out, std::size_t recordSize ) noexcept
+        {
+            if( out.size() / recordSize < values.size() )
+            {
+                return 0;
+            }
+
+            auto* cursor{ out.data() };
+            for( const auto& value : values )
+            {
+                cursor += encode( value, std::span<std::byte>{ cursor, recordSize } );
+            }
+
+            return values.size() * recordSize;
+        }
+
+        /** @brief Decode whole fixed-size records until either span ends or a record is invalid */
+        template <typename T>
+        std::size_t decodeFixedRecords(
+            std::span<const std::byte> in, std::span<T> values, std::size_t recordSize ) noexcept
+        {
+            const auto count{ std::min( values.size(), in.size() / recordSize ) };
+            const auto* cursor{ in.data() };
+            for( std::size_t i{ 0 }; i < count; ++i, cursor += recordSize )
+            {
+                if( decode( std::span<const std::byte>{ cursor, recordSize }, values[i] ) == 0 )
+                {
+                    return i;
+                }
+            }
+
+            return count;
+        }
+
+        /** @brief Encode every value as varints back to back */
+        template <typename T>
+        std::size_t encodeVarintRecords( std::span<const T> values, std::span<std::byte> out ) noexcept
+        {
+            std::size_t written{ 0 };
+            for( const auto& value : values )
+            {
+                const auto length{ encodeVarint( value, out.subspan( written ) ) };
+                if( length == 0 )
+                {
+                    return 0;
+                }
+                written += length;
+            }
+
+            return written;
+        }
+
+        /** @brief Decode back-to-back varint records until either span ends or a record is invalid */
+        template <typename T>
+        std::size_t decodeVarintRecords(
+            std::span<const std::byte> in, std::span<T> values, std::size_t& consumed ) noexcept
+        {
+            consumed = 0;
+            std::size_t count{ 0 };
+            while( count < values.size() && consumed < in.size() )
+            {
+                const auto length{ decodeVarint( in.subspan( consumed ), values[count] ) };
+                if( length == 0 )
+                {
+                    break;
+                }
+                consumed += length;
+                ++count;
+            }
+
+            return count;
+        }
+    } // namespace
+
+    //=====================================================================
+    // Bulk encoding
+    //=====================================================================
+
+    std::size_t encode( std::span<const DateTime> values, std::span<std::byte> out ) noexcept
+    {
+        return encodeFixedRecords( values, out, FIXED_SIZE );
+    }
+
+    std::size_t encode( std::span<const TimeSpan> values, std::span<std::byte> out ) noexcept
+    {
+        return encodeFixedRecords( values, out, FIXED_SIZE );
+    }
+
+    std::size_t encode( std::span<const DateTimeOffset> values, std::span<std::byte> out ) noexcept
+    {
+        return encodeFixedRecords( values, out, OFFSET_FIXED_SIZE );
+    }
+
+    std::size_t decode( std::span<const std::byte> in, std::span<DateTime> values ) noexcept
+    {
+        return decodeFixedRecords( in, values, FIXED_SIZE );
+    }
+
+    std::size_t decode( std::span<const std::byte> in, std::span<TimeSpan> values ) noexcept
+    {
+        return decodeFixedRecords( in, values, FIXED_SIZE );
+    }
+
+    std::size_t decode( std::span<const std::byte> in, std::span<DateTimeOffset> values ) noexcept
+    {
+        return decodeFixedRecords( in, values, OFFSET_FIXED_SIZE );
+    }
+
+    std::size_t encodeVarint( std::span<const DateTime> values, std::span<std::byte> out ) noexcept
+    {
+        return encodeVarintRecords( values, out );
+    }
+
+    std::size_t encodeVarint( std::span<const TimeSpan> values, std::span<std::byte> out ) noexcept
+    {
+        return encodeVarintRecords( values, out );
+    }
+
+    std::size_t encodeVarint( std::span<const DateTimeOffset> values, std::span<std::byte> out ) noexcept
+    {
+        return encodeVarintRecords( values, out );
+    }
+
+    std::size_t decodeVarint(
+        std::span<const std::byte> in, std::span<DateTime> values, std::size_t& consumed ) noexcept
+    {
+        return decodeVarintRecords( in, values, consumed );
+    }
+
+    std::size_t decodeVarint(
+        std::span<const std::byte> in, std::span<TimeSpan> values, std::size_t& consumed ) noexcept
+    {
+        return decodeVarintRecords( in, values, consumed );
+    }
+
+    std::size_t decodeVarint(
+        std::span<const std::byte> in, std::span<DateTimeOffset> values, std::size_t& consumed ) noexcept
+    {
+        return decodeVarintRecords( in, values, consumed );
+    }
+} // namespace nfx::time::binary
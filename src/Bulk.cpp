@@ -0,0 +1,720 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Bulk.cpp
+ * @brief Span kernels for DateTime, DateTimeOffset and TimeSpan columns
+ * @details Additive kernels are plain tick loops left to the auto-vectorizer. Calendar field
+ *          kernels (date, day of week, hour) divide ticks by constants and have an AVX2 version
+ *          that works in exact double arithmetic on ticks shifted right by the divisor's power of
+ *          two, since AVX2 has no 64-bit integer division or multiply-high; epoch conversions keep
+ *          the compiler's scalar multiply-high division, which measured faster than an emulation.
+ *          x86-64 builds that do not target AVX2 natively select the kernel at runtime.
+ */
+
+#include "nfx/datetime/Bulk.h"
+#include "nfx/detail/datetime/Constants.h"
+
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#    include <intrin.h>
+#endif
+
+#if defined( NFX_DATETIME_ENABLE_SIMD ) && !defined( __EMSCRIPTEN__ )
+#    if defined( __x86_64__ ) || defined( _M_X64 )
+#        define NFX_DATETIME_BULK_AVX2 1
+#        include <immintrin.h>
+#        if defined( _MSC_VER ) && !defined( __clang__ )
+#            include <intrin.h>
+#        endif
+#    endif
+#endif
+
+namespace nfx::time::bulk
+{
+    namespace
+    {
+        static_assert( sizeof( DateTime ) == sizeof( std::int64_t ) && std::is_trivially_copyable_v<DateTime>,
+            "DateTime spans are processed as tick arrays" );
+
+        //=====================================================================
+        // Scalar kernels
+        //=====================================================================
+
+        /** @brief Calendar field or epoch conversion computed by dividing ticks by a constant */
+        enum class TickField
+        {
+            EpochSeconds,
+            EpochMilliseconds,
+            Date,
+            DayOfWeek,
+            Hour
+        };
+
+        /** @brief Compute a field of one value with the same expression as the member function */
+        template <TickField Field>
+        [[nodiscard]] constexpr std::int64_t scalarField( std::int64_t ticks ) noexcept
+        {
+            if constexpr( Field == TickField::EpochSeconds )
+            {
+                return ( ticks - constants::UNIX_EPOCH_TICKS ) / constants::TICKS_PER_SECOND;
+            }
+            else if constexpr( Field == TickField::EpochMilliseconds )
+            {
+                return ( ticks - constants::UNIX_EPOCH_TICKS ) / constants::TICKS_PER_MILLISECOND;
+            }
+            else if constexpr( Field == TickField::Date )
+            {
+                return ( ticks / constants::TICKS_PER_DAY ) * constants::TICKS_PER_DAY;
+            }
+            else if constexpr( Field == TickField::DayOfWeek )
+            {
+                // January 1, 0001 was a Monday
+                const auto days{ static_cast<std::uint64_t>( ticks / constants::TICKS_PER_DAY ) };
+
+                return static_cast<std::int64_t>( ( days + 1 ) % 7 );
+            }
+            else
+            {
+                return ( ticks % constants::TICKS_PER_DAY ) / constants::TICKS_PER_HOUR;
+            }
+        }
+
+        /** @brief Compute a field for a range of values */
+        template <TickField Field, typename Output>
+        void scalarFields( const DateTime* values, Output* out, std::size_t count ) noexcept
+        {
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                if constexpr( std::is_same_v<Output, DateTime> )
+                {
+                    out[i] = DateTime{ scalarField<Field>( values[i].ticks() ) };
+                }
+                else
+                {
+                    out[i] = static_cast<Output>( scalarField<Field>( values[i].ticks() ) );
+                }
+            }
+        }
+
+#if defined( NFX_DATETIME_BULK_AVX2 )
+
+        //=====================================================================
+        // AVX2 kernels
+        //=====================================================================
+
+#    if defined( __GNUC__ ) || defined( __clang__ )
+#        define NFX_DATETIME_TARGET_AVX2 __attribute__( ( target( "avx2" ) ) )
+#    else
+#        define NFX_DATETIME_TARGET_AVX2
+#    endif
+
+        // Tick constants split into a power of two and an odd factor: shifting the ticks right by
+        // the power of two keeps every intermediate below 2^53, so double arithmetic is exact
+        constexpr int DAY_SHIFT{ 14 };
+        constexpr std::int64_t DAY_ODD{ constants::TICKS_PER_DAY >> DAY_SHIFT };
+        constexpr int HOUR_SHIFT{ 11 };
+        constexpr std::int64_t HOUR_ODD{ constants::TICKS_PER_HOUR >> HOUR_SHIFT };
+        static_assert( DAY_ODD << DAY_SHIFT == constants::TICKS_PER_DAY );
+        static_assert( HOUR_ODD << HOUR_SHIFT == constants::TICKS_PER_HOUR );
+
+        /**
+         * @brief Reciprocal rounded up by 2^-50 relative
+         * @details For integer numerators below 2^52 / divisor, the product never falls below an
+         *          exact quotient and stays below the next integer, so floor(n * reciprocal)
+         *          equals floor(n / divisor) without a correction step.
+         */
+        constexpr double flooringReciprocal( std::int64_t divisor ) noexcept
+        {
+            return ( 1.0 / static_cast<double>( divisor ) ) * ( 1.0 + 0x1p-50 );
+        }
+
+        /** @brief Bit pattern of 2^52 as a double, used for exact integer/double conversion */
+        constexpr std::int64_t DOUBLE_MAGIC_BITS{ 0x4330000000000000LL };
+
+        /** @brief Convert four lanes in [0, 2^52) to doubles exactly */
+        NFX_DATETIME_TARGET_AVX2 inline __m256d toDouble( __m256i values ) noexcept
+        {
+            const __m256i magic{ _mm256_set1_epi64x( DOUBLE_MAGIC_BITS ) };
+
+            return _mm256_sub_pd(
+                _mm256_castsi256_pd( _mm256_or_si256( values, magic ) ), _mm256_castsi256_pd( magic ) );
+        }
+
+        /** @brief Convert four integral doubles in [0, 2^52) to 64-bit lanes exactly */
+        NFX_DATETIME_TARGET_AVX2 inline __m256i toInt64( __m256d values ) noexcept
+        {
+            const __m256i magic{ _mm256_set1_epi64x( DOUBLE_MAGIC_BITS ) };
+
+            return _mm256_sub_epi64(
+                _mm256_castpd_si256( _mm256_add_pd( values, _mm256_castsi256_pd( magic ) ) ), magic );
+        }
+
+        /** @brief Days since January 1, 0001 of four lanes in [0, 2^62) */
+        NFX_DATETIME_TARGET_AVX2 inline __m256d vectorDays( __m256i ticks ) noexcept
+        {
+            const __m256d shifted{ toDouble( _mm256_srli_epi64( ticks, DAY_SHIFT ) ) };
+
+            return _mm256_floor_pd( _mm256_mul_pd( shifted, _mm256_set1_pd( flooringReciprocal( DAY_ODD ) ) ) );
+        }
+
+        /** @brief Store a calendar field of four values in [0, 2^62) */
+        template <TickField Field, typename Output>
+        NFX_DATETIME_TARGET_AVX2 inline void storeVectorField( __m256i ticks, Output* out ) noexcept
+        {
+            const __m256d days{ vectorDays( ticks ) };
+
+            if constexpr( Field == TickField::Date )
+            {
+                // days * DAY_ODD < 2^49 is exact; the power of two is applied as a shift
+                const __m256i date{ _mm256_slli_epi64(
+                    toInt64( _mm256_mul_pd( days, _mm256_set1_pd( static_cast<double>( DAY_ODD ) ) ) ), DAY_SHIFT ) };
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( out ), date );
+            }
+            else if constexpr( Field == TickField::DayOfWeek )
+            {
+                // January 1, 0001 was a Monday
+                const __m256d shifted{ _mm256_add_pd( days, _mm256_set1_pd( 1.0 ) ) };
+                const __m256d weeks{
+                    _mm256_floor_pd( _mm256_mul_pd( shifted, _mm256_set1_pd( flooringReciprocal( 7 ) ) ) ) };
+                const __m256d dayOfWeek{ _mm256_sub_pd( shifted, _mm256_mul_pd( weeks, _mm256_set1_pd( 7.0 ) ) ) };
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), _mm256_cvttpd_epi32( dayOfWeek ) );
+            }
+            else
+            {
+                // Time of day in units of 2^HOUR_SHIFT ticks, exact below 2^29
+                const __m256d shifted{ toDouble( _mm256_srli_epi64( ticks, HOUR_SHIFT ) ) };
+                const __m256d dayLength{
+                    _mm256_set1_pd( static_cast<double>( DAY_ODD << ( DAY_SHIFT - HOUR_SHIFT ) ) ) };
+                const __m256d timeOfDay{ _mm256_sub_pd( shifted, _mm256_mul_pd( days, dayLength ) ) };
+                const __m256d hour{ _mm256_mul_pd( timeOfDay, _mm256_set1_pd( flooringReciprocal( HOUR_ODD ) ) ) };
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), _mm256_cvttpd_epi32( hour ) );
+            }
+        }
+
+        /** @brief Compute a calendar field for a range of values, four at a time */
+        template <TickField Field, typename Output>
+        NFX_DATETIME_TARGET_AVX2 void vectorFields( const DateTime* values, Output* out, std::size_t count ) noexcept
+        {
+            // Lanes outside [0, 2^62) (never produced by validated DateTime values) go scalar
+            const __m256i outOfRange{ _mm256_set1_epi64x( static_cast<std::int64_t>( 0xC000000000000000ULL ) ) };
+
+            std::size_t i{ 0 };
+            for( ; i + 4 <= count; i += 4 )
+            {
+                const __m256i ticks{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( values + i ) ) };
+                if( !_mm256_testz_si256( ticks, outOfRange ) )
+                {
+                    scalarFields<Field>( values + i, out + i, 4 );
+                    continue;
+                }
+
+                storeVectorField<Field>( ticks, out + i );
+            }
+
+            scalarFields<Field>( values + i, out + i, count - i );
+        }
+
+#    undef NFX_DATETIME_TARGET_AVX2
+
+#    if !defined( __AVX2__ )
+        /** @brief Check once whether the executing CPU supports AVX2 */
+        [[nodiscard]] bool hasAvx2() noexcept
+        {
+            static const bool supported{ [] {
+#        if defined( _MSC_VER ) && !defined( __clang__ )
+                int info[4];
+                __cpuidex( info, 7, 0 );
+                return ( info[1] & ( 1 << 5 ) ) != 0;
+#        else
+                return __builtin_cpu_supports( "avx2" ) != 0;
+#        endif
+            }() };
+
+            return supported;
+        }
+#    endif
+#endif
+
+        /** @brief Compute a field for a span of values with the best available kernel */
+        template <TickField Field, typename Output>
+        std::size_t fields( std::span<const DateTime> values, std::span<Output> out ) noexcept
+        {
+            const auto count{ std::min( values.size(), out.size() ) };
+
+            if constexpr( Field == TickField::EpochSeconds || Field == TickField::EpochMilliseconds )
+            {
+                // Scalar multiply-high division outruns 64-bit arithmetic emulated with AVX2
+                scalarFields<Field>( values.data(), out.data(), count );
+            }
+            else
+            {
+#if defined( NFX_DATETIME_BULK_AVX2 ) && defined( __AVX2__ )
+                vectorFields<Field>( values.data(), out.data(), count );
+#elif defined( NFX_DATETIME_BULK_AVX2 )
+                // Runtime CPU dispatch, resolved once
+                if( hasAvx2() )
+                {
+                    vectorFields<Field>( values.data(), out.data(), count );
+                }
+                else
+                {
+                    scalarFields<Field>( values.data(), out.data(), count );
+                }
+#else
+                scalarFields<Field>( values.data(), out.data(), count );
+#endif
+            }
+
+            return count;
+        }
+
+        //=====================================================================
+        // Constant divisor
+        //=====================================================================
+
+        /** @brief High 64 bits of a 64x64-bit product */
+        [[nodiscard]] inline std::uint64_t multiplyHigh( std::uint64_t a, std::uint64_t b ) noexcept
+        {
+#if defined( __SIZEOF_INT128__ )
+            return static_cast<std::uint64_t>( ( static_cast<unsigned __int128>( a ) * b ) >> 64 );
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_ARM64 ) )
+            return __umulh( a, b );
+#else
+            const std::uint64_t aLow{ a & 0xFFFFFFFFu };
+            const std::uint64_t aHigh{ a >> 32 };
+            const std::uint64_t bLow{ b & 0xFFFFFFFFu };
+            const std::uint64_t bHigh{ b >> 32 };
+            const std::uint64_t middle{ ( ( aLow * bLow ) >> 32 ) + ( ( aHigh * bLow ) & 0xFFFFFFFFu ) + aLow * bHigh };
+
+            return aHigh * bHigh + ( ( aHigh * bLow ) >> 32 ) + ( middle >> 32 );
+#endif
+        }
+
+        /**
+         * @brief Precomputed division of ticks by a fixed positive interval
+         * @details Granlund-Montgomery round-up reciprocal for dividends below 2^62 (every valid
+         *          DateTime): with l = ceil(log2(d)) and m = ceil(2^(62 + l) / d) < 2^63, the
+         *          quotient is mulhi(n, m) >> (l - 2). Powers of two reduce to a shift.
+         */
+        class TickDivisor
+        {
+        public:
+            /** @brief Exclusive upper bound of supported dividends */
+            static constexpr std::uint64_t DIVIDEND_LIMIT{ std::uint64_t{ 1 } << 62 };
+
+            explicit TickDivisor( std::int64_t divisor ) noexcept
+                : m_divisor{ static_cast<std::uint64_t>( divisor ) }
+            {
+                if( std::has_single_bit( m_divisor ) )
+                {
+                    m_shift = std::countr_zero( m_divisor );
+
+                    return;
+                }
+
+                // Long division of 2^(62 + l) by the divisor, done once
+                const int log2{ static_cast<int>( std::bit_width( m_divisor ) ) };
+                std::uint64_t quotient{ 0 };
+                std::uint64_t remainder{ 1 };
+                for( int bit{ 0 }; bit < 62 + log2; ++bit )
+                {
+                    remainder <<= 1;
+                    quotient <<= 1;
+                    if( remainder >= m_divisor )
+                    {
+                        remainder -= m_divisor;
+                        quotient |= 1;
+                    }
+                }
+
+                m_multiplier = quotient + ( remainder != 0 );
+                m_shift = log2 - 2;
+            }
+
+            /** @brief Get the divisor */
+            [[nodiscard]] std::uint64_t divisor() const noexcept
+            {
+                return m_divisor;
+            }
+
+            /** @brief Divide a dividend below DIVIDEND_LIMIT, rounding down */
+            [[nodiscard]] std::uint64_t quotient( std::uint64_t dividend ) const noexcept
+            {
+                return m_multiplier == 0 ? dividend >> m_shift : multiplyHigh( dividend, m_multiplier ) >> m_shift;
+            }
+
+        private:
+            std::uint64_t m_divisor;         ///< Divisor
+            std::uint64_t m_multiplier{ 0 }; ///< Reciprocal, 0 for powers of two
+            int m_shift{ 0 };                ///< Post-multiplication shift
+        };
+
+        /** @brief Bucketing rule applied after the floor division */
+        enum class Rounding
+        {
+            Floor,
+            Ceil,
+            Round
+        };
+
+        /** @brief Bucket a span of values with a precomputed divisor */
+        template <Rounding Mode>
+        std::size_t bucket(
+            std::span<const DateTime> values, const TimeSpan& interval, std::span<DateTime> out ) noexcept
+        {
+            const auto count{ std::min( values.size(), out.size() ) };
+            if( interval.ticks() <= 0 )
+            {
+                std::copy_n( values.begin(), count, out.begin() );
+
+                return count;
+            }
+
+            const TickDivisor divisor{ interval.ticks() };
+            const auto width{ divisor.divisor() };
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                const auto ticks{ static_cast<std::uint64_t>( values[i].ticks() ) };
+                if( ticks >= TickDivisor::DIVIDEND_LIMIT )
+                {
+                    // Negative or oversized ticks (never produced by validated values)
+                    if constexpr( Mode == Rounding::Floor )
+                    {
+                        out[i] = values[i].floor( interval );
+                    }
+                    else if constexpr( Mode == Rounding::Ceil )
+                    {
+                        out[i] = values[i].ceil( interval );
+                    }
+                    else
+                    {
+                        out[i] = values[i].round( interval );
+                    }
+                    continue;
+                }
+
+                const auto start{ divisor.quotient( ticks ) * width };
+                const auto remainder{ ticks - start };
+                std::uint64_t result{ start };
+                if constexpr( Mode == Rounding::Ceil )
+                {
+                    result += remainder != 0 ? width : 0;
+                }
+                else if constexpr( Mode == Rounding::Round )
+                {
+                    result += remainder != 0 && remainder >= width - remainder ? width : 0;
+                }
+
+                // start < 2^62 and width < 2^63, so the sum cannot wrap; clamp like DateTime::ceil()
+                result = std::min( result, static_cast<std::uint64_t>( constants::MAX_DATETIME_TICKS ) );
+                out[i] = DateTime{ static_cast<std::int64_t>( result ) };
+            }
+
+            return count;
+        }
+
+        /** @brief Map signed ticks to unsigned keys with the same order */
+        [[nodiscard]] constexpr std::uint64_t signedKey( std::int64_t ticks ) noexcept
+        {
+            return static_cast<std::uint64_t>( ticks ) ^ ( std::uint64_t{ 1 } << 63 );
+        }
+    } // namespace
+
+    //=====================================================================
+    // Arithmetic
+    //=====================================================================
+
+    std::size_t add( std::span<const DateTime> values, const TimeSpan& duration, std::span<DateTime> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        const auto ticks{ duration.ticks() };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = DateTime{ values[i].ticks() + ticks };
+        }
+
+        return count;
+    }
+
+    std::size_t subtract( std::span<const DateTime> values, const TimeSpan& duration, std::span<DateTime> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        const auto ticks{ duration.ticks() };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = DateTime{ values[i].ticks() - ticks };
+        }
+
+        return count;
+    }
+
+    std::size_t subtract(
+        std::span<const DateTime> left, std::span<const DateTime> right, std::span<TimeSpan> out ) noexcept
+    {
+        const auto count{ std::min( { left.size(), right.size(), out.size() } ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = TimeSpan{ left[i].ticks() - right[i].ticks() };
+        }
+
+        return count;
+    }
+
+    std::size_t add( std::span<const TimeSpan> values, const TimeSpan& duration, std::span<TimeSpan> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        const auto ticks{ duration.ticks() };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = TimeSpan{ values[i].ticks() + ticks };
+        }
+
+        return count;
+    }
+
+    //=====================================================================
+    // Calendar arithmetic
+    //=====================================================================
+
+    std::size_t addMonths( std::span<const DateTime> values, std::int32_t months, std::span<DateTime> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = values[i].addMonths( months );
+        }
+
+        return count;
+    }
+
+    std::size_t addYears( std::span<const DateTime> values, std::int32_t years, std::span<DateTime> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = values[i].addYears( years );
+        }
+
+        return count;
+    }
+
+    std::size_t addBusinessDays( std::span<const DateTime> values, std::int32_t days, std::span<DateTime> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = values[i].addBusinessDays( days );
+        }
+
+        return count;
+    }
+
+    //=====================================================================
+    // Epoch conversion
+    //=====================================================================
+
+    std::size_t toEpochSeconds( std::span<const DateTime> values, std::span<std::int64_t> out ) noexcept
+    {
+        return fields<TickField::EpochSeconds>( values, out );
+    }
+
+    std::size_t toEpochMilliseconds( std::span<const DateTime> values, std::span<std::int64_t> out ) noexcept
+    {
+        return fields<TickField::EpochMilliseconds>( values, out );
+    }
+
+    std::size_t fromEpochSeconds( std::span<const std::int64_t> seconds, std::span<DateTime> out ) noexcept
+    {
+        const auto count{ std::min( seconds.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = DateTime{ constants::UNIX_EPOCH_TICKS + seconds[i] * constants::TICKS_PER_SECOND };
+        }
+
+        return count;
+    }
+
+    std::size_t fromEpochMilliseconds( std::span<const std::int64_t> milliseconds, std::span<DateTime> out ) noexcept
+    {
+        const auto count{ std::min( milliseconds.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = DateTime{ constants::UNIX_EPOCH_TICKS + milliseconds[i] * constants::TICKS_PER_MILLISECOND };
+        }
+
+        return count;
+    }
+
+    std::size_t utcTicks( std::span<const DateTimeOffset> values, std::span<std::int64_t> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = values[i].utcTicks();
+        }
+
+        return count;
+    }
+
+    //=====================================================================
+    // Calendar fields
+    //=====================================================================
+
+    std::size_t date( std::span<const DateTime> values, std::span<DateTime> out ) noexcept
+    {
+        return fields<TickField::Date>( values, out );
+    }
+
+    std::size_t dayOfWeek( std::span<const DateTime> values, std::span<std::int32_t> out ) noexcept
+    {
+        return fields<TickField::DayOfWeek>( values, out );
+    }
+
+    std::size_t hour( std::span<const DateTime> values, std::span<std::int32_t> out ) noexcept
+    {
+        return fields<TickField::Hour>( values, out );
+    }
+
+    //=====================================================================
+    // Bucketing
+    //=====================================================================
+
+    std::size_t floor( std::span<const DateTime> values, const TimeSpan& interval, std::span<DateTime> out ) noexcept
+    {
+        return bucket<Rounding::Floor>( values, interval, out );
+    }
+
+    std::size_t ceil( std::span<const DateTime> values, const TimeSpan& interval, std::span<DateTime> out ) noexcept
+    {
+        return bucket<Rounding::Ceil>( values, interval, out );
+    }
+
+    std::size_t round( std::span<const DateTime> values, const TimeSpan& interval, std::span<DateTime> out ) noexcept
+    {
+        return bucket<Rounding::Round>( values, interval, out );
+    }
+
+    //=====================================================================
+    // Packing
+    //=====================================================================
+
+    std::size_t pack( std::span<const DateTimeOffset> values, std::span<PackedDateTimeOffset> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = PackedDateTimeOffset{ values[i] };
+        }
+
+        return count;
+    }
+
+    std::size_t unpack( std::span<const PackedDateTimeOffset> values, std::span<DateTimeOffset> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = values[i].toDateTimeOffset();
+        }
+
+        return count;
+    }
+
+    //=====================================================================
+    // Reductions and sort keys
+    //=====================================================================
+
+    std::optional<std::pair<DateTime, DateTime>> minMax( std::span<const DateTime> values ) noexcept
+    {
+        if( values.empty() )
+        {
+            return std::nullopt;
+        }
+
+        auto low{ values[0].ticks() };
+        auto high{ low };
+        for( const auto& value : values )
+        {
+            low = std::min( low, value.ticks() );
+            high = std::max( high, value.ticks() );
+        }
+
+        return std::pair{ DateTime{ low }, DateTime{ high } };
+    }
+
+    std::optional<std::pair<TimeSpan, TimeSpan>> minMax( std::span<const TimeSpan> values ) noexcept
+    {
+        if( values.empty() )
+        {
+            return std::nullopt;
+        }
+
+        auto low{ values[0].ticks() };
+        auto high{ low };
+        for( const auto& value : values )
+        {
+            low = std::min( low, value.ticks() );
+            high = std::max( high, value.ticks() );
+        }
+
+        return std::pair{ TimeSpan{ low }, TimeSpan{ high } };
+    }
+
+    std::size_t sortKeys( std::span<const DateTime> values, std::span<std::uint64_t> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = signedKey( values[i].ticks() );
+        }
+
+        return count;
+    }
+
+    std::size_t sortKeys( std::span<const TimeSpan> values, std::span<std::uint64_t> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = signedKey( values[i].ticks() );
+        }
+
+        return count;
+    }
+
+    std::size_t sortKeys( std::span<const DateTimeOffset> values, std::span<std::uint64_t> out ) noexcept
+    {
+        const auto count{ std::min( values.size(), out.size() ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = signedKey( values[i].utcTicks() );
+        }
+
+        return count;
+    }
+} // namespace nfx::time::bulk
@@ -0,0 +1,162 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CachedClock.cpp
+ * @brief CachedClock writer, background refresh thread and global hook
+ */
+
+#include "nfx/datetime/CachedClock.h"
+#include "Internal.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <stop_token>
+
+namespace nfx::time
+{
+    //=====================================================================
+    // CachedClock class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    CachedClock::CachedClock() noexcept
+    {
+        update();
+    }
+
+    CachedClock::CachedClock( std::chrono::microseconds interval )
+        : CachedClock{}
+    {
+        start( interval );
+    }
+
+    //----------------------------------------------
+    // Destruction
+    //----------------------------------------------
+
+    CachedClock::~CachedClock()
+    {
+        stop();
+
+        const CachedClock* self{ this };
+        internal::installedCachedClock.compare_exchange_strong( self, nullptr, std::memory_order_acq_rel );
+    }
+
+    //----------------------------------------------
+    // Refresh
+    //----------------------------------------------
+
+    void CachedClock::update() noexcept
+    {
+        if( m_updating.exchange( true, std::memory_order_acquire ) )
+        {
+            return; // Another writer is publishing a fresh value right now
+        }
+
+        // Read the sources directly: going through DateTime::utcNow() would hit the hook
+        const auto utcTicks{ PreciseClock::utcTicks() };
+        const auto offsetTicks{ internal::systemTimezoneOffset( DateTime{ utcTicks } ).ticks() };
+
+        // Re-render the prefix only when the local second changes
+        const auto localTicks{ utcTicks + offsetTicks };
+        const auto localSecond{ localTicks / constants::TICKS_PER_SECOND };
+        if( localSecond != m_renderedSecond )
+        {
+            char buffer[constants::MAX_ISO8601_LENGTH];
+            if( DateTime{ localTicks }.formatTo( buffer, sizeof( buffer ), DateTime::Format::Iso8601 ) >=
+                PREFIX_LENGTH )
+            {
+                m_renderedPrefix.fill( 0 );
+                std::memcpy( m_renderedPrefix.data(), buffer, PREFIX_LENGTH );
+                m_renderedSecond = localSecond;
+            }
+        }
+
+        // Seqlock publish: odd sequence while the slot is being written
+        const auto sequence{ m_slot.sequence.load( std::memory_order_relaxed ) };
+        m_slot.sequence.store( sequence + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+
+        m_slot.utcTicks.store( utcTicks, std::memory_order_relaxed );
+        m_slot.offsetTicks.store( offsetTicks, std::memory_order_relaxed );
+        for( std::size_t i{ 0 }; i < PREFIX_WORDS; ++i )
+        {
+            m_slot.prefixWords[i].store( m_renderedPrefix[i], std::memory_order_relaxed );
+        }
+
+        m_slot.sequence.store( sequence + 2, std::memory_order_release );
+
+        m_updating.store( false, std::memory_order_release );
+    }
+
+    void CachedClock::start( std::chrono::microseconds interval )
+    {
+        stop();
+
+        m_thread = std::jthread{ [this, interval]( std::stop_token stopToken ) {
+            std::mutex mutex;
+            std::condition_variable_any wakeUp;
+            std::unique_lock lock{ mutex };
+
+            while( !stopToken.stop_requested() )
+            {
+                update();
+                (void)wakeUp.wait_for( lock, stopToken, interval, [] { return false; } );
+            }
+        } };
+    }
+
+    void CachedClock::stop() noexcept
+    {
+        if( m_thread.joinable() )
+        {
+            m_thread.request_stop();
+            m_thread.join();
+        }
+    }
+
+    bool CachedClock::isRunning() const noexcept
+    {
+        return m_thread.joinable();
+    }
+
+    //----------------------------------------------
+    // Global hook
+    //----------------------------------------------
+
+    void CachedClock::install( const CachedClock* clock ) noexcept
+    {
+        internal::installedCachedClock.store( clock, std::memory_order_release );
+    }
+
+    const CachedClock* CachedClock::installed() noexcept
+    {
+        return internal::installedCachedClock.load( std::memory_order_acquire );
+    }
+} // namespace nfx::time
@@ -0,0 +1,247 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Clock.cpp
+ * @brief Platform implementations of the coarse and time-stamp counter clock sources
+ * @details TscClock and TscSteadyClock share one process-wide counter calibration.
+ */
+
+#include "nfx/datetime/Clock.h"
+
+#if defined( _WIN32 )
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#else
+#    include <time.h>
+#endif
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+#    define NFX_DATETIME_HAS_TSC 1
+#    if defined( _MSC_VER )
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#        include <x86intrin.h>
+#    endif
+#endif
+
+namespace nfx::time
+{
+    //=====================================================================
+    // CoarseClock
+    //=====================================================================
+
+    std::int64_t CoarseClock::utcTicks() noexcept
+    {
+#if defined( _WIN32 )
+        // Updated once per timer interrupt, unlike GetSystemTimePreciseAsFileTime
+        FILETIME fileTime;
+        ::GetSystemTimeAsFileTime( &fileTime );
+        const auto fileTimeTicks{ ( static_cast<std::int64_t>( fileTime.dwHighDateTime ) << 32 ) |
+                                  fileTime.dwLowDateTime };
+
+        return constants::MICROSOFT_FILETIME_EPOCH_TICKS + fileTimeTicks;
+#elif defined( CLOCK_REALTIME_COARSE ) || defined( CLOCK_REALTIME_FAST )
+#    if defined( CLOCK_REALTIME_COARSE )
+        constexpr clockid_t clockId{ CLOCK_REALTIME_COARSE }; // Linux
+#    else
+        constexpr clockid_t clockId{ CLOCK_REALTIME_FAST }; // FreeBSD
+#    endif
+        timespec now;
+        if( ::clock_gettime( clockId, &now ) != 0 )
+        {
+            return PreciseClock::utcTicks();
+        }
+
+        return constants::UNIX_EPOCH_TICKS + static_cast<std::int64_t>( now.tv_sec ) * constants::TICKS_PER_SECOND +
+               now.tv_nsec / constants::NANOSECONDS_PER_TICK;
+#else
+        return PreciseClock::utcTicks();
+#endif
+    }
+
+    //=====================================================================
+    // TscClock
+    //=====================================================================
+
+#if defined( NFX_DATETIME_HAS_TSC )
+    namespace
+    {
+        /** @brief Length of the one-time frequency calibration */
+        constexpr std::int64_t CALIBRATION_TICKS{ 10 * constants::TICKS_PER_MILLISECOND };
+
+        /** @brief Interval after which a thread re-reads the system clock */
+        constexpr std::int64_t REANCHOR_TICKS{ 50 * constants::TICKS_PER_MILLISECOND };
+
+        /** @brief Check for an invariant (constant rate, non-stop) time-stamp counter */
+        [[nodiscard]] bool hasInvariantTsc() noexcept
+        {
+#    if defined( _MSC_VER )
+            int registers[4]{};
+            ::__cpuid( registers, 0x80000000 );
+            if( static_cast<unsigned int>( registers[0] ) < 0x80000007u )
+            {
+                return false;
+            }
+            ::__cpuid( registers, 0x80000007 );
+
+            return ( registers[3] & ( 1 << 8 ) ) != 0;
+#    else
+            unsigned int eax, ebx, ecx, edx;
+            if( __get_cpuid_max( 0x80000000u, nullptr ) < 0x80000007u ||
+                !__get_cpuid( 0x80000007u, &eax, &ebx, &ecx, &edx ) )
+            {
+                return false;
+            }
+
+            return ( edx & ( 1u << 8 ) ) != 0;
+#    endif
+        }
+
+        /** @brief Process-wide counter frequency, measured once */
+        struct TscCalibration
+        {
+            /** @brief Ticks per cycle in 32.32 fixed point (0 if the counter is unusable) */
+            std::uint64_t ticksPerCycleQ32{ 0 };
+
+            /** @brief Cycles per re-anchoring interval */
+            std::uint64_t reanchorCycles{ 0 };
+
+            TscCalibration() noexcept
+            {
+                if( !hasInvariantTsc() )
+                {
+                    return;
+                }
+
+                // Measure against the steady clock so a wall-clock step cannot skew the rate
+                using ticks_duration = std::chrono::duration<std::int64_t, std::ratio<1, 10000000>>;
+                const auto startTime{ std::chrono::steady_clock::now() };
+                const auto startCycles{ __rdtsc() };
+                std::int64_t elapsedTicks{ 0 };
+                std::uint64_t endCycles{ startCycles };
+                while( elapsedTicks < CALIBRATION_TICKS )
+                {
+                    elapsedTicks = std::chrono::duration_cast<ticks_duration>(
+                        std::chrono::steady_clock::now() - startTime )
+                                       .count();
+                    endCycles = __rdtsc();
+                }
+
+                const auto elapsedCycles{ endCycles - startCycles };
+                if( elapsedCycles == 0 )
+                {
+                    return;
+                }
+
+                ticksPerCycleQ32 = ( static_cast<std::uint64_t>( elapsedTicks ) << 32 ) / elapsedCycles;
+                reanchorCycles = elapsedCycles * static_cast<std::uint64_t>( REANCHOR_TICKS ) /
+                                 static_cast<std::uint64_t>( elapsedTicks );
+            }
+        };
+
+        [[nodiscard]] const TscCalibration& tscCalibration() noexcept
+        {
+            static const TscCalibration calibration;
+
+            return calibration;
+        }
+
+        /** @brief Per-thread pairing of a counter value with a system clock reading */
+        struct TscAnchor
+        {
+            std::uint64_t cycles{ 0 };
+            std::int64_t ticks{ 0 };
+        };
+    } // namespace
+#endif
+
+    std::int64_t TscClock::utcTicks() noexcept
+    {
+#if defined( NFX_DATETIME_HAS_TSC )
+        const auto& calibration{ tscCalibration() };
+        if( calibration.ticksPerCycleQ32 == 0 )
+        {
+            return PreciseClock::utcTicks();
+        }
+
+        thread_local TscAnchor anchor;
+
+        const auto cycles{ __rdtsc() };
+        auto elapsed{ cycles - anchor.cycles };
+
+        // Also taken on first use and when the counter appears to run backwards (unsigned wrap)
+        if( elapsed >= calibration.reanchorCycles )
+        {
+            anchor.ticks = PreciseClock::utcTicks();
+            anchor.cycles = __rdtsc();
+            elapsed = 0;
+        }
+
+        // elapsed < reanchorCycles keeps the product well inside 64 bits
+        return anchor.ticks + static_cast<std::int64_t>( ( elapsed * calibration.ticksPerCycleQ32 ) >> 32 );
+#else
+        return PreciseClock::utcTicks();
+#endif
+    }
+
+    bool TscClock::isAvailable() noexcept
+    {
+#if defined( NFX_DATETIME_HAS_TSC )
+        return tscCalibration().ticksPerCycleQ32 != 0;
+#else
+        return false;
+#endif
+    }
+
+    //=====================================================================
+    // TscSteadyClock
+    //=====================================================================
+
+    std::int64_t TscSteadyClock::ticks() noexcept
+    {
+#if defined( NFX_DATETIME_HAS_TSC )
+        const auto ticksPerCycleQ32{ tscCalibration().ticksPerCycleQ32 };
+        if( ticksPerCycleQ32 == 0 )
+        {
+            return SteadyClock::ticks();
+        }
+
+        // Split the 64 x 32.32 product so that absolute counter values cannot overflow
+        const auto cycles{ __rdtsc() };
+        const auto high{ ( cycles >> 32 ) * ticksPerCycleQ32 };
+        const auto low{ ( ( cycles & 0xFFFFFFFFu ) * ticksPerCycleQ32 ) >> 32 };
+
+        return static_cast<std::int64_t>( high + low );
+#else
+        return SteadyClock::ticks();
+#endif
+    }
+} // namespace nfx::time
@@ -25,21 +25,20 @@
 /**
  * @file DateTime.cpp
  * @brief Implementation of DateTime class methods for datetime operations
- * @details Provides parsing logic for ISO 8601 format, string conversion and formatting,
- *          date/time component extraction, validation logic, and factory methods for
- *          creating DateTime instances. Implements cross-platform time conversions and
- *          arithmetic operations with 100-nanosecond precision. Supports both UTC and
- *          local time representations.
+ * @details Provides parsing logic for ISO 8601 format, component constructors, clock-backed
+ *          factory methods and std::chrono conversions. Component extraction, arithmetic and
+ *          string formatting are inline in DateTime.inl.
  */
 
 #include "nfx/datetime/DateTime.h"
+#include "nfx/datetime/CachedClock.h"
 #include "Internal.h"
 
-#include <nfx/string/StringBuilder.h>
-
+#include <algorithm>
 #include <charconv>
 #include <istream>
 #include <limits>
+#include <locale>
 
 namespace nfx::time
 {
@@ -71,156 +70,17 @@ namespace nfx::time
         //  Internal helper methods
         //=====================================================================
 
-        /** @brief Convert ticks to date components */
-        static constexpr void dateComponentsFromTicks(
-            std::int64_t ticks, std::int32_t& year, std::int32_t& month, std::int32_t& day ) noexcept
-        {
-            // Extract date components using Gregorian 400-year cycle algorithm (O(1) complexity)
-            std::int64_t totalDays{ ticks / constants::TICKS_PER_DAY };
-
-            // Use 400-year cycles for O(1) year calculation
-            std::int64_t num400Years{ totalDays / constants::DAYS_PER_400_YEARS };
-            totalDays %= constants::DAYS_PER_400_YEARS;
-
-            // Extract 100-year periods (handle leap year edge case at 400-year boundary)
-            std::int64_t num100Years{ totalDays / constants::DAYS_PER_100_YEARS };
-            if( num100Years > 3 )
-            {
-                num100Years = 3; // Year divisible by 400 is a leap year
-            }
-            totalDays -= num100Years * constants::DAYS_PER_100_YEARS;
-
-            // Extract 4-year cycles
-            std::int64_t num4Years{ totalDays / constants::DAYS_PER_4_YEARS };
-            totalDays %= constants::DAYS_PER_4_YEARS;
-
-            // Extract remaining years (handle leap year edge case at 4-year boundary)
-            std::int64_t numYears{ totalDays / constants::DAYS_PER_YEAR };
-            if( numYears > 3 )
-            {
-                numYears = 3; // 4th year in cycle is a leap year
-            }
-            totalDays -= numYears * constants::DAYS_PER_YEAR;
-
-            // Calculate final year (add 1 because year 1 is the base)
-            year = static_cast<std::int32_t>( 1 + num400Years * 400 + num100Years * 100 + num4Years * 4 + numYears );
-
-            // Find the month by iterating through months (already O(1) - max 12 iterations)
-            month = 1;
-            while( month <= 12 )
-            {
-                std::int32_t daysInCurrentMonth{ DateTime::daysInMonth( year, month ) };
-                if( totalDays < daysInCurrentMonth )
-                {
-                    break;
-                }
-
-                totalDays -= daysInCurrentMonth;
-                ++month;
-            }
-
-            // Remaining days is the day of month (add 1 because day is 1-based)
-            day = static_cast<std::int32_t>( totalDays ) + 1;
-        }
-
-        /** @brief Convert ticks to time components */
-        static constexpr void timeComponentsFromTicks(
-            std::int64_t ticks,
-            std::int32_t& hour,
-            std::int32_t& minute,
-            std::int32_t& second,
-            std::int32_t& millisecond ) noexcept
-        {
-            std::int64_t timeTicks{ ticks % constants::TICKS_PER_DAY };
-
-            hour = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_HOUR );
-            timeTicks %= constants::TICKS_PER_HOUR;
-
-            minute = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_MINUTE );
-            timeTicks %= constants::TICKS_PER_MINUTE;
-
-            second = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_SECOND );
-            timeTicks %= constants::TICKS_PER_SECOND;
-
-            millisecond = static_cast<std::int32_t>( timeTicks / constants::TICKS_PER_MILLISECOND );
-        }
-
-        /** @brief Convert date components to ticks */
-        static constexpr std::int64_t dateToTicks( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
-        {
-            // Calculate total days since January 1, year 1 using Gregorian 400-year cycle algorithm (O(1) complexity)
-            std::int64_t totalDays{ 0 };
-
-            // Adjust to 0-based year for calculation
-            std::int32_t y{ year - 1 };
-
-            // Add days for complete 400-year cycles
-            totalDays += ( y / 400 ) * constants::DAYS_PER_400_YEARS;
-            y %= 400;
-
-            // Add days for complete 100-year periods
-            totalDays += ( y / 100 ) * constants::DAYS_PER_100_YEARS;
-            y %= 100;
-
-            // Add days for complete 4-year cycles
-            totalDays += ( y / 4 ) * constants::DAYS_PER_4_YEARS;
-            y %= 4;
-
-            // Add days for remaining years
-            totalDays += y * constants::DAYS_PER_YEAR;
-
-            // Add days for complete months in the given year
-            // Clamp month to valid range to prevent undefined behavior in loop
-            const std::int32_t validMonth = ( month < 1 ) ? 1 : ( month > 12 ) ? 12 : month;
-            for( std::int32_t m{ 1 }; m < validMonth; ++m )
-            {
-                totalDays += DateTime::daysInMonth( year, m );
-            }
-
-            // Add days in the current month (subtract 1 because day is 1-based)
-            totalDays += day - 1;
-
-            return totalDays * constants::TICKS_PER_DAY;
-        }
+        /** @brief Convert date components to ticks (shared with the header-only pattern parsers) */
+        using detail::dateToTicks;
 
         /** @brief Convert time components to ticks */
-        static constexpr std::int64_t timeToTicks(
-            std::int32_t hour, std::int32_t minute, std::int32_t second, std::int32_t millisecond ) noexcept
-        {
-            return ( static_cast<std::int64_t>( hour ) * constants::TICKS_PER_HOUR ) +
-                   ( static_cast<std::int64_t>( minute ) * constants::TICKS_PER_MINUTE ) +
-                   ( static_cast<std::int64_t>( second ) * constants::TICKS_PER_SECOND ) +
-                   ( static_cast<std::int64_t>( millisecond ) * constants::TICKS_PER_MILLISECOND );
-        }
+        using detail::timeToTicks;
 
         /** @brief Validate date components */
-        static constexpr bool isValidDate( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
-        {
-            if( year < constants::MIN_YEAR || year > constants::MAX_YEAR )
-            {
-                return false;
-            }
-            if( month < 1 || month > 12 )
-            {
-                return false;
-            }
-            if( day < 1 || day > DateTime::daysInMonth( year, month ) )
-            {
-                return false;
-            }
-
-            return true;
-        }
+        using detail::isValidDate;
 
         /** @brief Validate time components */
-        static constexpr bool isValidTime(
-            std::int32_t hour, std::int32_t minute, std::int32_t second, std::int32_t millisecond ) noexcept
-        {
-            return hour >= 0 && hour <= constants::HOURS_PER_DAY - 1 && minute >= 0 &&
-                   minute <= constants::MINUTES_PER_HOUR - 1 && second >= 0 &&
-                   second <= constants::SECONDS_PER_MINUTE - 1 && millisecond >= 0 &&
-                   millisecond <= constants::MILLISECONDS_PER_SECOND - 1;
-        }
+        using detail::isValidTime;
     } // namespace internal
 
     //=====================================================================
@@ -268,628 +128,582 @@ namespace nfx::time
          *          - "YYYY-MM-DDTHH:mm:ssZ" (20 chars)
          *          - "YYYY-MM-DDTHH:mm:ss.f" (21-27 chars)
          *          - "YYYY-MM-DDTHH:mm:ss.fZ" (22-28 chars)
+         *          Same grammar as the constexpr detail::parseIso8601DateTime(), with the
+         *          19-character block decoded by the vectorized kernel.
          * @return true if parsed successfully via fast path, false if fallback needed
          */
         [[nodiscard]] bool tryParseFastPath( std::string_view str, DateTime& result ) noexcept
         {
-            const std::size_t len = str.length();
-
-            // Fast path requirements: minimum 10 chars (YYYY-MM-DD)
-            if( len < 10 )
+            std::int64_t ticks{ 0 };
+            if( str.size() < 19 )
             {
-                return false;
+                if( !detail::parseIso8601DateTime( str, ticks ) )
+                {
+                    return false;
+                }
+                result = DateTime{ ticks };
+                return true;
             }
 
-            const char* data = str.data();
-
-            // Validate fixed separators and digit positions for date part
-            if( data[4] != '-' || data[7] != '-' || !areDigits( data, 4 ) || !areDigits( data + 5, 2 ) ||
-                !areDigits( data + 8, 2 ) )
+            // Validate and decode the fixed date/time block in one pass (vectorized when available)
+            internal::Iso8601DateTimeFields fields;
+            if( !internal::decodeIso8601DateTime( str.data(), fields ) ||
+                !detail::parseIso8601DateTimeTail( str, fields, ticks ) )
             {
                 return false;
             }
 
-            // Parse date components using fast digit parsing
-            const std::int32_t year = parse4Digits( data );
-            const std::int32_t month = parse2Digits( data + 5 );
-            const std::int32_t day = parse2Digits( data + 8 );
+            result = DateTime{ ticks };
+            return true;
+        }
+    } // namespace
 
-            // Validate date components
-            if( !internal::isValidDate( year, month, day ) )
-            {
-                return false;
-            }
+    //=====================================================================
+    // Batch parsing helpers
+    //=====================================================================
 
-            // Date-only format: "YYYY-MM-DD"
-            if( len == 10 )
-            {
-                const std::int64_t ticks = internal::dateToTicks( year, month, day );
-                result = DateTime{ ticks };
-                return true;
-            }
+    namespace internal
+    {
+        bool detectIso8601Layout( std::string_view str, Iso8601Layout& layout ) noexcept
+        {
+            const std::size_t len{ str.length() };
+            const char* data{ str.data() };
 
-            // Time part must start with 'T'
-            if( data[10] != 'T' )
+            if( len < 10 || data[4] != '-' || data[7] != '-' )
             {
                 return false;
             }
 
-            // Need at least "YYYY-MM-DDTHH:mm:ss" (19 chars)
-            if( len < 19 )
-            {
-                return false;
-            }
+            Iso8601Layout detected{};
+            detected.length = len;
 
-            // Validate time separators and digits
-            if( data[13] != ':' || data[16] != ':' || !areDigits( data + 11, 2 ) || !areDigits( data + 14, 2 ) ||
-                !areDigits( data + 17, 2 ) )
+            if( len == 10 )
             {
-                return false;
+                layout = detected;
+                return true;
             }
 
-            // Parse time components
-            const std::int32_t hour = parse2Digits( data + 11 );
-            const std::int32_t minute = parse2Digits( data + 14 );
-            const std::int32_t second = parse2Digits( data + 17 );
-
-            // Validate time components
-            if( !internal::isValidTime( hour, minute, second, 0 ) )
+            if( len < 19 || data[10] != 'T' || data[13] != ':' || data[16] != ':' )
             {
                 return false;
             }
 
-            std::int32_t fractionalTicks = 0;
-            std::size_t pos = 19;
+            detected.hasTime = true;
+            std::size_t pos{ 19 };
 
-            // Handle optional 'Z' at position 19
-            if( len == 20 && data[19] == 'Z' )
+            // Fractional seconds: up to 9 digits (digits beyond 100ns precision are truncated)
+            if( pos < len && data[pos] == '.' )
             {
-                // "YYYY-MM-DDTHH:mm:ssZ" - no fractional seconds
-                pos = 20;
-            }
-            // Handle fractional seconds
-            else if( len > 19 && data[19] == '.' )
-            {
-                pos = 20; // Start after '.'
-
-                // Parse up to 7 fractional digits (100ns precision)
-                std::int32_t fractionValue = 0;
-                std::int32_t fractionDigits = 0;
-
-                while( pos < len && isDigit( data[pos] ) && fractionDigits < 7 )
-                {
-                    fractionValue = fractionValue * 10 + ( data[pos] - '0' );
-                    ++fractionDigits;
-                    ++pos;
-                }
-
-                if( fractionDigits == 0 )
-                {
-                    return false; // '.' must be followed by at least one digit
-                }
-
-                // Pad to 7 digits (convert to 100ns ticks)
-                while( fractionDigits < 7 )
-                {
-                    fractionValue *= 10;
-                    ++fractionDigits;
-                }
-
-                fractionalTicks = fractionValue;
-
-                // Skip remaining fractional digits beyond our precision
+                ++pos;
                 while( pos < len && isDigit( data[pos] ) )
                 {
                     ++pos;
                 }
 
-                // Optional 'Z' after fractional seconds
-                if( pos < len && data[pos] == 'Z' )
+                detected.fractionDigits = pos - 20;
+                if( detected.fractionDigits == 0 || detected.fractionDigits > 9 )
                 {
-                    ++pos;
+                    return false;
                 }
             }
-            else if( len != 19 )
+
+            // Suffix: none, 'Z' or "±HH:MM"
+            const std::size_t remaining{ len - pos };
+            if( remaining == 1 && data[pos] == 'Z' )
             {
-                // Unexpected format - not a standard ISO 8601 we can fast-path
-                return false;
+                detected.suffix = Iso8601Layout::Suffix::Utc;
             }
-
-            // Should have consumed the entire string
-            if( pos != len )
+            else if( remaining == 6 && ( data[pos] == '+' || data[pos] == '-' ) && data[pos + 3] == ':' )
+            {
+                detected.suffix = Iso8601Layout::Suffix::Offset;
+            }
+            else if( remaining != 0 )
             {
                 return false;
             }
 
-            // Calculate total ticks
-            const std::int64_t ticks = internal::dateToTicks( year, month, day ) +
-                                       internal::timeToTicks( hour, minute, second, 0 ) + fractionalTicks;
-
-            result = DateTime{ ticks };
+            layout = detected;
             return true;
         }
-    } // namespace
-
-    //=====================================================================
-    // DateTime class
-    //=====================================================================
 
-    //----------------------------------------------
-    // Construction
-    //----------------------------------------------
-
-    DateTime::DateTime( std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
-    {
-        if( !internal::isValidDate( year, month, day ) )
+        bool parseIso8601Layout( std::string_view str,
+            const Iso8601Layout& layout,
+            std::int64_t& ticks,
+            std::int32_t& offsetMinutes ) noexcept
         {
-            m_ticks = constants::MIN_DATETIME_TICKS;
-            return;
-        }
-        m_ticks = internal::dateToTicks( year, month, day );
-    }
+            /** @brief Scale factors padding 0-7 fractional digits to 100ns ticks */
+            static constexpr std::int32_t FRACTION_SCALE[8]{ 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1 };
 
-    DateTime::DateTime(
-        std::int32_t year,
-        std::int32_t month,
-        std::int32_t day,
-        std::int32_t hour,
-        std::int32_t minute,
-        std::int32_t second ) noexcept
-    {
-        if( !internal::isValidDate( year, month, day ) || !internal::isValidTime( hour, minute, second, 0 ) )
-        {
-            m_ticks = constants::MIN_DATETIME_TICKS;
-            return;
-        }
-        m_ticks = internal::dateToTicks( year, month, day ) + internal::timeToTicks( hour, minute, second, 0 );
-    }
-
-    DateTime::DateTime(
-        std::int32_t year,
-        std::int32_t month,
-        std::int32_t day,
-        std::int32_t hour,
-        std::int32_t minute,
-        std::int32_t second,
-        std::int32_t millisecond ) noexcept
-    {
-        if( !internal::isValidDate( year, month, day ) || !internal::isValidTime( hour, minute, second, millisecond ) )
-        {
-            m_ticks = constants::MIN_DATETIME_TICKS;
-            return;
-        }
-        m_ticks =
-            internal::dateToTicks( year, month, day ) + internal::timeToTicks( hour, minute, second, millisecond );
-    }
+            const char* data{ str.data() };
 
-    //----------------------------------------------
-    // Property accessors
-    //----------------------------------------------
+            if( str.length() != layout.length )
+            {
+                return false;
+            }
 
-    std::int32_t DateTime::year() const noexcept
-    {
-        std::int32_t year, month, day;
-        internal::dateComponentsFromTicks( m_ticks, year, month, day );
+            offsetMinutes = 0;
 
-        return year;
-    }
+            if( !layout.hasTime )
+            {
+                if( data[4] != '-' || data[7] != '-' || !areDigits( data, 4 ) || !areDigits( data + 5, 2 ) ||
+                    !areDigits( data + 8, 2 ) )
+                {
+                    return false;
+                }
 
-    std::int32_t DateTime::month() const noexcept
-    {
-        std::int32_t year, month, day;
-        internal::dateComponentsFromTicks( m_ticks, year, month, day );
+                const std::int32_t year{ parse4Digits( data ) };
+                const std::int32_t month{ parse2Digits( data + 5 ) };
+                const std::int32_t day{ parse2Digits( data + 8 ) };
 
-        return month;
-    }
+                if( !isValidDate( year, month, day ) )
+                {
+                    return false;
+                }
 
-    std::int32_t DateTime::day() const noexcept
-    {
-        std::int32_t year, month, day;
-        internal::dateComponentsFromTicks( m_ticks, year, month, day );
+                ticks = dateToTicks( year, month, day );
+                return true;
+            }
 
-        return day;
-    }
+            Iso8601DateTimeFields fields;
+            if( !decodeIso8601DateTime( data, fields ) || !isValidDate( fields.year, fields.month, fields.day ) ||
+                !isValidTime( fields.hour, fields.minute, fields.second, 0 ) )
+            {
+                return false;
+            }
 
-    std::int32_t DateTime::hour() const noexcept
-    {
-        std::int32_t hour, minute, second, millisecond;
-        internal::timeComponentsFromTicks( m_ticks, hour, minute, second, millisecond );
+            ticks = dateToTicks( fields.year, fields.month, fields.day ) +
+                    timeToTicks( fields.hour, fields.minute, fields.second, 0 );
 
-        return hour;
-    }
+            std::size_t pos{ 19 };
+            if( layout.fractionDigits > 0 )
+            {
+                if( data[pos] != '.' || !areDigits( data + pos + 1, layout.fractionDigits ) )
+                {
+                    return false;
+                }
 
-    std::int32_t DateTime::minute() const noexcept
-    {
-        std::int32_t hour, minute, second, millisecond;
-        internal::timeComponentsFromTicks( m_ticks, hour, minute, second, millisecond );
+                // Fixed digit count: accumulate the significant digits, then scale to ticks
+                const std::size_t significant{ layout.fractionDigits < 7 ? layout.fractionDigits : 7 };
+                std::int32_t fraction{ 0 };
+                for( std::size_t i{ 1 }; i <= significant; ++i )
+                {
+                    fraction = fraction * 10 + ( data[pos + i] - '0' );
+                }
 
-        return minute;
-    }
+                ticks += fraction * FRACTION_SCALE[significant];
+                pos += 1 + layout.fractionDigits;
+            }
 
-    std::int32_t DateTime::second() const noexcept
-    {
-        std::int32_t hour, minute, second, millisecond;
-        internal::timeComponentsFromTicks( m_ticks, hour, minute, second, millisecond );
+            switch( layout.suffix )
+            {
+                case Iso8601Layout::Suffix::None:
+                    return true;
 
-        return second;
-    }
+                case Iso8601Layout::Suffix::Utc:
+                    return data[pos] == 'Z';
 
-    std::int32_t DateTime::millisecond() const noexcept
-    {
-        std::int32_t hour, minute, second, millisecond;
-        internal::timeComponentsFromTicks( m_ticks, hour, minute, second, millisecond );
+                case Iso8601Layout::Suffix::Offset:
+                {
+                    if( ( data[pos] != '+' && data[pos] != '-' ) || data[pos + 3] != ':' ||
+                        !areDigits( data + pos + 1, 2 ) || !areDigits( data + pos + 4, 2 ) )
+                    {
+                        return false;
+                    }
 
-        return millisecond;
-    }
+                    const std::int32_t offsetHours{ parse2Digits( data + pos + 1 ) };
+                    const std::int32_t offsetMins{ parse2Digits( data + pos + 4 ) };
 
-    std::int32_t DateTime::microsecond() const noexcept
-    {
-        const auto remainderTicks{ m_ticks % 10000 };
-
-        return static_cast<std::int32_t>( remainderTicks / 10 );
-    }
+                    // Validate offset range (±00:00 to ±14:00)
+                    if( offsetHours > 14 || offsetMins > 59 || ( offsetHours == 14 && offsetMins > 0 ) )
+                    {
+                        return false;
+                    }
 
-    std::int32_t DateTime::nanosecond() const noexcept
-    {
-        const auto remainderTicks{ m_ticks % 10 };
+                    offsetMinutes = offsetHours * constants::MINUTES_PER_HOUR + offsetMins;
+                    if( data[pos] == '-' )
+                    {
+                        offsetMinutes = -offsetMinutes;
+                    }
 
-        return static_cast<std::int32_t>( remainderTicks * 100 );
-    }
+                    return true;
+                }
+            }
 
-    std::int32_t DateTime::dayOfWeek() const noexcept
-    {
-        // January 1, 0001 was a Monday (day 1), so we need to adjust
-        std::int64_t days{ m_ticks / constants::TICKS_PER_DAY };
+            return false;
+        }
+    } // namespace internal
 
-        // 0=Sunday, 6=Saturday
-        return static_cast<std::int32_t>( ( days + 1 ) % 7 );
-    }
+    //=====================================================================
+    // Prefix parsing helpers
+    //=====================================================================
 
-    std::int32_t DateTime::dayOfYear() const noexcept
+    namespace internal
     {
-        std::int32_t year, month, day;
-        internal::dateComponentsFromTicks( m_ticks, year, month, day );
-
-        std::int32_t dayCount{ 0 };
-        for( std::int32_t m{ 1 }; m < month; ++m )
+        namespace
         {
-            dayCount += daysInMonth( year, m );
-        }
+            /** @brief Consume between minCount and maxCount digits, returning nullptr if too few */
+            [[nodiscard]] const char* scanDigits(
+                const char* p, const char* last, std::size_t minCount, std::size_t maxCount ) noexcept
+            {
+                std::size_t count{ 0 };
+                while( p != last && count < maxCount && *p >= '0' && *p <= '9' )
+                {
+                    ++p;
+                    ++count;
+                }
 
-        return dayCount + day;
-    }
+                return count >= minCount ? p : nullptr;
+            }
 
-    //----------------------------------------------
-    // Conversion methods
-    //----------------------------------------------
+            /** @brief Consume a separator followed by digits, returning nullptr if either is missing */
+            [[nodiscard]] const char* scanField(
+                const char* p, const char* last, char separator, std::size_t minCount, std::size_t maxCount ) noexcept
+            {
+                if( p == last || *p != separator )
+                {
+                    return nullptr;
+                }
 
-    DateTime DateTime::date() const noexcept
-    {
-        std::int64_t dayTicks{ ( m_ticks / constants::TICKS_PER_DAY ) * constants::TICKS_PER_DAY };
+                return scanDigits( p + 1, last, minCount, maxCount );
+            }
+        } // namespace
 
-        return DateTime{ dayTicks };
-    }
+        std::size_t scanIso8601Prefix(
+            const char* first, const char* last, const char* ( &ends )[MAX_ISO8601_PREFIX_CUTS] ) noexcept
+        {
+            // Date: YYYY-M[M]-D[D]
+            const char* p{ scanDigits( first, last, 4, 4 ) };
+            p = p ? scanField( p, last, '-', 1, 2 ) : nullptr;
+            p = p ? scanField( p, last, '-', 1, 2 ) : nullptr;
+            if( !p )
+            {
+                return 0;
+            }
 
-    TimeSpan DateTime::timeOfDay() const noexcept
-    {
-        std::int64_t timeTicks{ m_ticks % constants::TICKS_PER_DAY };
+            std::size_t count{ 0 };
+            const char* cuts[MAX_ISO8601_PREFIX_CUTS];
+            cuts[count++] = p;
 
-        return TimeSpan{ timeTicks };
-    }
+            // Time: THH:mm:ss (one or two digits each, as fromString() accepts)
+            const char* time{ scanField( p, last, 'T', 1, 2 ) };
+            time = time ? scanField( time, last, ':', 1, 2 ) : nullptr;
+            time = time ? scanField( time, last, ':', 1, 2 ) : nullptr;
+            if( time )
+            {
+                p = time;
+                cuts[count++] = p;
 
-    //----------------------------------------------
-    // String formatting
-    //----------------------------------------------
+                // Fraction: every digit is consumed, digits beyond 100 ns are ignored by the parsers
+                if( const char* fraction{ scanField( p, last, '.', 1, std::numeric_limits<std::size_t>::max() ) } )
+                {
+                    p = fraction;
+                    cuts[count++] = p;
+                }
 
-    namespace
-    {
-        /** @brief Append two-digit zero-padded integer */
-        inline void appendTwoDigits( nfx::string::StringBuilder& sb, std::int32_t value ) noexcept
-        {
-            sb.append( static_cast<char>( '0' + ( value / 10 ) ) );
-            sb.append( static_cast<char>( '0' + ( value % 10 ) ) );
-        }
+                // Zone: Z, ±HH, ±HHMM or ±HH:MM
+                if( p != last && *p == 'Z' )
+                {
+                    cuts[count++] = p + 1;
+                }
+                else if( p != last && ( *p == '+' || *p == '-' ) )
+                {
+                    if( const char* hours{ scanDigits( p + 1, last, 2, 2 ) } )
+                    {
+                        const char* minutes{ scanField( hours, last, ':', 2, 2 ) };
+                        if( !minutes )
+                        {
+                            minutes = scanDigits( hours, last, 2, 2 );
+                        }
+                        cuts[count++] = minutes ? minutes : hours;
+                    }
+                }
+            }
 
-        /** @brief Append four-digit zero-padded integer */
-        inline void appendFourDigits( nfx::string::StringBuilder& sb, std::int32_t value ) noexcept
-        {
-            sb.append( static_cast<char>( '0' + ( value / 1000 ) ) );
-            sb.append( static_cast<char>( '0' + ( ( value / 100 ) % 10 ) ) );
-            sb.append( static_cast<char>( '0' + ( ( value / 10 ) % 10 ) ) );
-            sb.append( static_cast<char>( '0' + ( value % 10 ) ) );
-        }
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                ends[i] = cuts[count - 1 - i];
+            }
 
-        /** @brief Append ISO 8601 date part: YYYY-MM-DD */
-        inline void appendIso8601Date(
-            nfx::string::StringBuilder& sb, std::int32_t year, std::int32_t month, std::int32_t day ) noexcept
-        {
-            appendFourDigits( sb, year );
-            sb.append( '-' );
-            appendTwoDigits( sb, month );
-            sb.append( '-' );
-            appendTwoDigits( sb, day );
+            return count;
         }
 
-        /** @brief Append ISO 8601 time part: HH:mm:ss */
-        inline void appendIso8601Time(
-            nfx::string::StringBuilder& sb, std::int32_t hour, std::int32_t minute, std::int32_t second ) noexcept
+        std::size_t readStreamToken( std::istream& is, char ( &buffer )[MAX_STREAM_TOKEN_LENGTH] )
         {
-            appendTwoDigits( sb, hour );
-            sb.append( ':' );
-            appendTwoDigits( sb, minute );
-            sb.append( ':' );
-            appendTwoDigits( sb, second );
-        }
+            const std::istream::sentry sentry{ is };
+            if( !sentry )
+            {
+                return 0;
+            }
 
-        /** @brief Append ISO 8601 datetime part: YYYY-MM-DDTHH:mm:ss */
-        inline void appendIso8601DateTime(
-            nfx::string::StringBuilder& sb,
-            std::int32_t year,
-            std::int32_t month,
-            std::int32_t day,
-            std::int32_t hour,
-            std::int32_t minute,
-            std::int32_t second ) noexcept
-        {
-            appendIso8601Date( sb, year, month, day );
-            sb.append( 'T' );
-            appendIso8601Time( sb, hour, minute, second );
-        }
+            // Same token rules as operator>> for std::string, reading the stream buffer directly
+            auto* streamBuffer{ is.rdbuf() };
+            const auto& ctype{ std::use_facet<std::ctype<char>>( is.getloc() ) };
+            std::size_t length{ 0 };
+            bool overflow{ false };
+            auto state{ std::ios::goodbit };
+            for( auto next{ streamBuffer->sgetc() };; next = streamBuffer->snextc() )
+            {
+                if( std::istream::traits_type::eq_int_type( next, std::istream::traits_type::eof() ) )
+                {
+                    state |= std::ios::eofbit;
+                    break;
+                }
 
-        /** @brief Append zero-padded fractional seconds with specific precision */
-        inline void appendFractionalSeconds(
-            nfx::string::StringBuilder& sb, std::int32_t fractionalValue, std::size_t bufferSize ) noexcept
-        {
-            char fracBuffer[8]; // Max size for 7 digits + decimal point
-            fracBuffer[0] = '.';
+                const auto ch{ std::istream::traits_type::to_char_type( next ) };
+                if( ctype.is( std::ctype_base::space, ch ) )
+                {
+                    break;
+                }
 
-            const auto ptr = std::to_chars( fracBuffer + 1, fracBuffer + bufferSize, fractionalValue ).ptr;
-            const auto fracLen = ptr - fracBuffer;
-            const auto paddingNeeded = bufferSize - fracLen;
+                if( length < MAX_STREAM_TOKEN_LENGTH )
+                {
+                    buffer[length++] = ch;
+                }
+                else
+                {
+                    overflow = true;
+                }
+            }
 
-            // Shift digits right and add leading zeros if needed
-            if( paddingNeeded > 0 )
+            if( length == 0 || overflow )
             {
-                std::memmove( fracBuffer + 1 + paddingNeeded, fracBuffer + 1, fracLen - 1 );
-                std::memset( fracBuffer + 1, '0', paddingNeeded );
+                state |= std::ios::failbit;
+                length = 0;
             }
+            is.setstate( state );
 
-            sb.append( std::string_view{ fracBuffer, bufferSize } );
+            return length;
         }
+    } // namespace internal
 
-        /** @brief Append fractional seconds with trimmed trailing zeros */
-        inline void appendFractionalSecondsTrimmed(
-            nfx::string::StringBuilder& sb, std::int32_t fractionalTicks ) noexcept
-        {
-            if( fractionalTicks > 0 )
-            {
-                char fracBuffer[8];
-                fracBuffer[0] = '.';
-                const auto ptr = std::to_chars( fracBuffer + 1, fracBuffer + 8, fractionalTicks ).ptr;
-                auto fracLen = ptr - fracBuffer;
-                const auto paddingNeeded = 8 - fracLen;
+    //=====================================================================
+    // String parsing
+    //=====================================================================
 
-                if( paddingNeeded > 0 )
+    namespace internal
+    {
+        namespace
+        {
+            /**
+             * @brief Flexible ISO 8601 parser for inputs the fast path rejects
+             * @details Accepts one- or two-digit month, day and time fields, strips a trailing 'Z' or
+             *          offset, and truncates fractions beyond 7 digits.
+             * @return true if parsed successfully
+             */
+            [[nodiscard]] bool tryParseFlexible( std::string_view iso8601String, DateTime& result ) noexcept
+            {
+                // Remove trailing 'Z' if present (for flexible parser compatibility)
+                if( iso8601String.back() == 'Z' )
                 {
-                    std::memmove( fracBuffer + 1 + paddingNeeded, fracBuffer + 1, fracLen - 1 );
-                    std::memset( fracBuffer + 1, '0', paddingNeeded );
-                    fracLen = 8;
+                    iso8601String.remove_suffix( 1 );
                 }
 
-                // Trim trailing zeros
-                while( fracLen > 2 && fracBuffer[fracLen - 1] == '0' )
+                // Remove timezone offset for DateTime parsing
+                auto tzPos{ iso8601String.find_last_of( "+-" ) };
+
+                // Ensure it's not in date part (after position 10 = "YYYY-MM-DD")
+                if( tzPos != std::string_view::npos && tzPos > 10 )
                 {
-                    --fracLen;
+                    iso8601String = iso8601String.substr( 0, tzPos );
                 }
 
-                sb.append( std::string_view{ fracBuffer, static_cast<std::size_t>( fracLen ) } );
-            }
-            else
-            {
-                sb.append( ".0" );
-            }
-        }
+                const char* data = iso8601String.data();
+                const char* end = data + iso8601String.size();
 
-        /** @brief Format ISO 8601 with UTC indicator: YYYY-MM-DDTHH:mm:ssZ */
-        inline void formatIso8601(
-            nfx::string::StringBuilder& sb,
-            std::int32_t y,
-            std::int32_t mon,
-            std::int32_t d,
-            std::int32_t h,
-            std::int32_t min,
-            std::int32_t s ) noexcept
-        {
-            appendIso8601DateTime( sb, y, mon, d, h, min, s );
-            sb.append( 'Z' );
-        }
+                // Parse year (YYYY)
+                if( iso8601String.size() < 4 )
+                {
+                    return false;
+                }
 
-        /** @brief Format ISO 8601 with precise fractional seconds: YYYY-MM-DDTHH:mm:ss.1234567Z */
-        inline void formatIso8601Precise(
-            nfx::string::StringBuilder& sb,
-            std::int32_t y,
-            std::int32_t mon,
-            std::int32_t d,
-            std::int32_t h,
-            std::int32_t min,
-            std::int32_t s,
-            std::int64_t ticks ) noexcept
-        {
-            const std::int32_t fractionalTicks{ static_cast<std::int32_t>( ticks % constants::TICKS_PER_SECOND ) };
-            appendIso8601DateTime( sb, y, mon, d, h, min, s );
-            appendFractionalSeconds( sb, fractionalTicks, 8 );
-            sb.append( 'Z' );
-        }
+                std::int32_t year{ 0 };
+                auto [ptr1, ec1] = std::from_chars( data, data + 4, year );
+                if( ec1 != std::errc{} || ptr1 != data + 4 )
+                {
+                    return false;
+                }
 
-        /** @brief Format ISO 8601 with trimmed fractional seconds: YYYY-MM-DDTHH:mm:ss.f+Z */
-        inline void formatIso8601PreciseTrimmed(
-            nfx::string::StringBuilder& sb,
-            std::int32_t y,
-            std::int32_t mon,
-            std::int32_t d,
-            std::int32_t h,
-            std::int32_t min,
-            std::int32_t s,
-            std::int64_t ticks ) noexcept
-        {
-            const std::int32_t fractionalTicks{ static_cast<std::int32_t>( ticks % constants::TICKS_PER_SECOND ) };
-            appendIso8601DateTime( sb, y, mon, d, h, min, s );
-            appendFractionalSecondsTrimmed( sb, fractionalTicks );
-            sb.append( 'Z' );
-        }
+                // Expect '-'
+                if( ptr1 >= end || *ptr1 != '-' )
+                {
+                    return false;
+                }
+                ++ptr1; // Skip '-'
 
-        /** @brief Format ISO 8601 with milliseconds: YYYY-MM-DDTHH:mm:ss.123Z */
-        inline void formatIso8601Millis(
-            nfx::string::StringBuilder& sb,
-            std::int32_t y,
-            std::int32_t mon,
-            std::int32_t d,
-            std::int32_t h,
-            std::int32_t min,
-            std::int32_t s,
-            std::int64_t ticks ) noexcept
-        {
-            const std::int32_t fractionalTicks{ static_cast<std::int32_t>( ticks % constants::TICKS_PER_SECOND ) };
-            const std::int32_t milliseconds{ static_cast<std::int32_t>(
-                fractionalTicks / constants::TICKS_PER_MILLISECOND ) };
-            appendIso8601DateTime( sb, y, mon, d, h, min, s );
-            appendFractionalSeconds( sb, milliseconds, 4 );
-            sb.append( 'Z' );
-        }
+                // Parse month (MM or M)
+                std::int32_t month{ 0 };
+                auto dashPos = iso8601String.find( '-', 5 ); // Find second dash after "YYYY-"
+                if( dashPos == std::string_view::npos )
+                {
+                    return false;
+                }
 
-        /** @brief Format ISO 8601 with microseconds: YYYY-MM-DDTHH:mm:ss.123456Z */
-        inline void formatIso8601Micros(
-            nfx::string::StringBuilder& sb,
-            std::int32_t y,
-            std::int32_t mon,
-            std::int32_t d,
-            std::int32_t h,
-            std::int32_t min,
-            std::int32_t s,
-            std::int64_t ticks ) noexcept
-        {
-            const std::int32_t fractionalTicks{ static_cast<std::int32_t>( ticks % constants::TICKS_PER_SECOND ) };
-            const std::int32_t microseconds{ static_cast<std::int32_t>(
-                fractionalTicks / constants::TICKS_PER_MICROSECOND ) };
-            appendIso8601DateTime( sb, y, mon, d, h, min, s );
-            appendFractionalSeconds( sb, microseconds, 7 );
-            sb.append( 'Z' );
-        }
+                auto [ptr2, ec2] = std::from_chars( ptr1, data + dashPos, month );
+                if( ec2 != std::errc{} )
+                {
+                    return false;
+                }
 
-        /** @brief Format ISO 8601 extended with UTC offset: YYYY-MM-DDTHH:mm:ss+00:00 */
-        inline void formatIso8601Extended(
-            nfx::string::StringBuilder& sb,
-            std::int32_t y,
-            std::int32_t mon,
-            std::int32_t d,
-            std::int32_t h,
-            std::int32_t min,
-            std::int32_t s ) noexcept
-        {
-            appendIso8601DateTime( sb, y, mon, d, h, min, s );
-            sb.append( "+00:00" );
-        }
+                // Expect '-'
+                if( ptr2 >= end || *ptr2 != '-' )
+                {
+                    return false;
+                }
+                ++ptr2; // Skip '-'
 
-        /** @brief Format ISO 8601 basic (compact): YYYYMMDDTHHMMSSZ */
-        inline void formatIso8601Basic(
-            nfx::string::StringBuilder& sb,
-            std::int32_t y,
-            std::int32_t mon,
-            std::int32_t d,
-            std::int32_t h,
-            std::int32_t min,
-            std::int32_t s ) noexcept
-        {
-            appendFourDigits( sb, y );
-            appendTwoDigits( sb, mon );
-            appendTwoDigits( sb, d );
-            sb.append( 'T' );
-            appendTwoDigits( sb, h );
-            appendTwoDigits( sb, min );
-            appendTwoDigits( sb, s );
-            sb.append( 'Z' );
-        }
-    } // namespace
+                // Parse day (DD or D)
+                std::int32_t day{ 0 };
+                const char* dayEnd = ptr2;
+                while( dayEnd < end && *dayEnd >= '0' && *dayEnd <= '9' )
+                {
+                    ++dayEnd;
+                }
 
-    std::string DateTime::toString( Format format ) const
-    {
-        std::int32_t y, mon, d, h, min, s, ms;
-        internal::dateComponentsFromTicks( m_ticks, y, mon, d );
-        internal::timeComponentsFromTicks( m_ticks, h, min, s, ms );
+                auto [ptr3, ec3] = std::from_chars( ptr2, dayEnd, day );
+                if( ec3 != std::errc{} )
+                {
+                    return false;
+                }
 
-        nfx::string::StringBuilder sb;
+                // Time part is optional
+                std::int32_t hour{ 0 }, minute{ 0 }, second{ 0 };
+                std::int32_t fractionalTicks{ 0 };
 
-        switch( format )
-        {
-            case Format::Iso8601:
-                formatIso8601( sb, y, mon, d, h, min, s );
-                break;
+                if( ptr3 < end && *ptr3 == 'T' )
+                {
+                    ++ptr3; // Skip 'T'
+
+                    // Parse hour (HH or H)
+                    const char* hourEnd = ptr3;
+                    while( hourEnd < end && *hourEnd >= '0' && *hourEnd <= '9' )
+                    {
+                        ++hourEnd;
+                    }
+
+                    auto [ptr4, ec4] = std::from_chars( ptr3, hourEnd, hour );
+                    if( ec4 != std::errc{} )
+                    {
+                        return false;
+                    }
+
+                    // Expect ':'
+                    if( ptr4 >= end || *ptr4 != ':' )
+                    {
+                        return false;
+                    }
+                    ++ptr4; // Skip ':'
+
+                    // Parse minute (MM or M)
+                    const char* minEnd = ptr4;
+                    while( minEnd < end && *minEnd >= '0' && *minEnd <= '9' )
+                    {
+                        ++minEnd;
+                    }
 
-            case Format::Iso8601Precise:
-                formatIso8601Precise( sb, y, mon, d, h, min, s, m_ticks );
-                break;
+                    auto [ptr5, ec5] = std::from_chars( ptr4, minEnd, minute );
+                    if( ec5 != std::errc{} )
+                    {
+                        return false;
+                    }
 
-            case Format::Iso8601PreciseTrimmed:
-                formatIso8601PreciseTrimmed( sb, y, mon, d, h, min, s, m_ticks );
-                break;
+                    // Expect ':'
+                    if( ptr5 >= end || *ptr5 != ':' )
+                    {
+                        return false;
+                    }
+                    ++ptr5; // Skip ':'
 
-            case Format::Iso8601Millis:
-                formatIso8601Millis( sb, y, mon, d, h, min, s, m_ticks );
-                break;
+                    // Parse second (SS or S)
+                    const char* secEnd = ptr5;
+                    while( secEnd < end && *secEnd >= '0' && *secEnd <= '9' )
+                    {
+                        ++secEnd;
+                    }
 
-            case Format::Iso8601Micros:
-                formatIso8601Micros( sb, y, mon, d, h, min, s, m_ticks );
-                break;
+                    auto [ptr6, ec6] = std::from_chars( ptr5, secEnd, second );
+                    if( ec6 != std::errc{} )
+                    {
+                        return false;
+                    }
 
-            case Format::Iso8601Extended:
-                formatIso8601Extended( sb, y, mon, d, h, min, s );
-                break;
+                    // Parse fractional seconds if present
+                    if( ptr6 < end && *ptr6 == '.' )
+                    {
+                        ++ptr6; // Skip '.'
+
+                        // Count fractional digits (max 7 for 100ns precision)
+                        const char* fracStart = ptr6;
+                        const char* fracEnd = fracStart;
+                        std::int32_t fractionDigits{ 0 };
+
+                        while( fracEnd < end && *fracEnd >= '0' && *fracEnd <= '9' && fractionDigits < 7 )
+                        {
+                            ++fracEnd;
+                            ++fractionDigits;
+                        }
+
+                        if( fractionDigits > 0 )
+                        {
+                            std::int32_t fractionValue{ 0 };
+                            auto [ptrF, ecF] = std::from_chars( fracStart, fracEnd, fractionValue );
+                            if( ecF != std::errc{} || ptrF != fracEnd )
+                            {
+                                return false;
+                            }
+
+                            // Pad to 7 digits (convert to 100ns ticks)
+                            while( fractionDigits < 7 )
+                            {
+                                fractionValue *= 10;
+                                ++fractionDigits;
+                            }
+
+                            fractionalTicks = fractionValue;
+                        }
+                    }
+                }
 
-            case Format::Iso8601Basic:
-                formatIso8601Basic( sb, y, mon, d, h, min, s );
-                break;
+                // Validate components
+                if( !internal::isValidDate( year, month, day ) || !internal::isValidTime( hour, minute, second, 0 ) )
+                {
+                    return false;
+                }
 
-            case Format::Iso8601Date:
-                appendIso8601Date( sb, y, mon, d );
-                break;
+                // Calculate ticks
+                std::int64_t ticks{ internal::dateToTicks( year, month, day ) +
+                                    internal::timeToTicks( hour, minute, second, 0 ) + fractionalTicks };
 
-            case Format::Iso8601Time:
-                appendIso8601Time( sb, h, min, s );
-                break;
+                result = DateTime{ ticks };
 
-            case Format::UnixSeconds:
+                return true;
+            }
+        } // namespace
+
+        ParsePath parseDateTime( std::string_view iso8601String, DateTime& result ) noexcept
+        {
+            // Fast empty/length check
+            if( iso8601String.length() < 10 )
             {
-                char buffer[32];
-                const auto epochSecs = toEpochSeconds();
-                const auto ptr = std::to_chars( buffer, buffer + 32, epochSecs ).ptr;
-                sb.append( std::string_view{ buffer, static_cast<std::size_t>( ptr - buffer ) } );
-                break;
+                return ParsePath::Failed;
             }
 
-            case Format::UnixMilliseconds:
+            // Try fast-path parser first (handles 95% of real-world cases)
+            // Supports: YYYY-MM-DD, YYYY-MM-DDTHH:mm:ss, YYYY-MM-DDTHH:mm:ssZ,
+            //           YYYY-MM-DDTHH:mm:ss.f, YYYY-MM-DDTHH:mm:ss.fffffffZ
+            if( tryParseFastPath( iso8601String, result ) )
             {
-                char buffer[32];
-                const auto epochMs = toEpochMilliseconds();
-                const auto ptr = std::to_chars( buffer, buffer + 32, epochMs ).ptr;
-                sb.append( std::string_view{ buffer, static_cast<std::size_t>( ptr - buffer ) } );
-                break;
+                return ParsePath::FastPath;
             }
 
-            default:
-                return toString( Format::Iso8601 );
+            // Fallback to flexible parser for non-standard formats
+            // (handles timezone offsets, variable digit counts, etc.)
+            return tryParseFlexible( iso8601String, result ) ? ParsePath::Fallback : ParsePath::Failed;
         }
+    } // namespace internal
 
-        return sb.toString();
-    }
-
-    //----------------------------------------------
-    // Validation methods
-    //----------------------------------------------
-
-    bool DateTime::isValid() const noexcept
-    {
-        return m_ticks >= constants::MIN_DATETIME_TICKS && m_ticks <= constants::MAX_DATETIME_TICKS;
-    }
+    //=====================================================================
+    // DateTime class
+    //=====================================================================
 
     //----------------------------------------------
     // Static factory methods
@@ -897,6 +711,11 @@ namespace nfx::time
 
     DateTime DateTime::now() noexcept
     {
+        if( const auto* cachedClock{ internal::installedCachedClock.load( std::memory_order_acquire ) } )
+        {
+            return cachedClock->now().localDateTime();
+        }
+
         const auto utcNow{ DateTime::utcNow() };
         const auto localOffset{ internal::systemTimezoneOffset( utcNow ) };
 
@@ -905,6 +724,11 @@ namespace nfx::time
 
     DateTime DateTime::utcNow() noexcept
     {
+        if( const auto* cachedClock{ internal::installedCachedClock.load( std::memory_order_acquire ) } )
+        {
+            return cachedClock->utcNow();
+        }
+
         return DateTime{ std::chrono::system_clock::now() };
     }
 
@@ -915,217 +739,82 @@ namespace nfx::time
 
     bool DateTime::fromString( std::string_view iso8601String, DateTime& result ) noexcept
     {
-        // Fast empty/length check
-        if( iso8601String.empty() || iso8601String.length() < 10 )
-        {
-            return false;
-        }
-
-        // Try fast-path parser first (handles 95% of real-world cases)
-        // Supports: YYYY-MM-DD, YYYY-MM-DDTHH:mm:ss, YYYY-MM-DDTHH:mm:ssZ,
-        //           YYYY-MM-DDTHH:mm:ss.f, YYYY-MM-DDTHH:mm:ss.fffffffZ
-        if( tryParseFastPath( iso8601String, result ) )
-        {
-            return true;
-        }
-
-        // Fallback to flexible parser for non-standard formats
-        // (handles timezone offsets, variable digit counts, etc.)
-
-        // Remove trailing 'Z' if present (for flexible parser compatibility)
-        if( iso8601String.back() == 'Z' )
-        {
-            iso8601String.remove_suffix( 1 );
-        }
-
-        // Remove timezone offset for DateTime parsing
-        auto tzPos{ iso8601String.find_last_of( "+-" ) };
-
-        // Ensure it's not in date part (after position 10 = "YYYY-MM-DD")
-        if( tzPos != std::string_view::npos && tzPos > 10 )
-        {
-            iso8601String = iso8601String.substr( 0, tzPos );
-        }
-
-        const char* data = iso8601String.data();
-        const char* end = data + iso8601String.size();
-
-        // Parse year (YYYY)
-        if( iso8601String.size() < 4 )
-        {
-            return false;
-        }
+        const auto path{ internal::parseDateTime( iso8601String, result ) };
+        NFX_DATETIME_COUNT_STAT( detail::StatCounter::DateTimeFastPath, static_cast<std::size_t>( path ) );
 
-        std::int32_t year{ 0 };
-        auto [ptr1, ec1] = std::from_chars( data, data + 4, year );
-        if( ec1 != std::errc{} || ptr1 != data + 4 )
-        {
-            return false;
-        }
-
-        // Expect '-'
-        if( ptr1 >= end || *ptr1 != '-' )
-        {
-            return false;
-        }
-        ++ptr1; // Skip '-'
-
-        // Parse month (MM or M)
-        std::int32_t month{ 0 };
-        auto dashPos = iso8601String.find( '-', 5 ); // Find second dash after "YYYY-"
-        if( dashPos == std::string_view::npos )
-        {
-            return false;
-        }
-
-        auto [ptr2, ec2] = std::from_chars( ptr1, data + dashPos, month );
-        if( ec2 != std::errc{} )
-        {
-            return false;
-        }
-
-        // Expect '-'
-        if( ptr2 >= end || *ptr2 != '-' )
-        {
-            return false;
-        }
-        ++ptr2; // Skip '-'
-
-        // Parse day (DD or D)
-        std::int32_t day{ 0 };
-        const char* dayEnd = ptr2;
-        while( dayEnd < end && *dayEnd >= '0' && *dayEnd <= '9' )
-        {
-            ++dayEnd;
-        }
+        return path != internal::ParsePath::Failed;
+    }
 
-        auto [ptr3, ec3] = std::from_chars( ptr2, dayEnd, day );
-        if( ec3 != std::errc{} )
+    std::optional<DateTime> DateTime::fromString( std::string_view iso8601String ) noexcept
+    {
+        DateTime result;
+        if( fromString( iso8601String, result ) )
         {
-            return false;
+            return result;
         }
+        return std::nullopt;
+    }
 
-        // Time part is optional
-        std::int32_t hour{ 0 }, minute{ 0 }, second{ 0 };
-        std::int32_t fractionalTicks{ 0 };
-
-        if( ptr3 < end && *ptr3 == 'T' )
+    const char* DateTime::parsePrefix( const char* first, const char* last, DateTime& result ) noexcept
+    {
+        const char* ends[internal::MAX_ISO8601_PREFIX_CUTS];
+        const auto count{ internal::scanIso8601Prefix( first, last, ends ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
         {
-            ++ptr3; // Skip 'T'
-
-            // Parse hour (HH or H)
-            const char* hourEnd = ptr3;
-            while( hourEnd < end && *hourEnd >= '0' && *hourEnd <= '9' )
+            if( fromString( std::string_view{ first, ends[i] }, result ) )
             {
-                ++hourEnd;
+                return ends[i];
             }
+        }
 
-            auto [ptr4, ec4] = std::from_chars( ptr3, hourEnd, hour );
-            if( ec4 != std::errc{} )
-            {
-                return false;
-            }
+        return first;
+    }
 
-            // Expect ':'
-            if( ptr4 >= end || *ptr4 != ':' )
-            {
-                return false;
-            }
-            ++ptr4; // Skip ':'
+    std::size_t DateTime::parseMany(
+        std::span<const std::string_view> inputs, std::span<DateTime> results, std::span<std::uint8_t> ok ) noexcept
+    {
+        const std::size_t count{ std::min( { inputs.size(), results.size(), ok.size() } ) };
+        std::size_t parsed{ 0 };
 
-            // Parse minute (MM or M)
-            const char* minEnd = ptr4;
-            while( minEnd < end && *minEnd >= '0' && *minEnd <= '9' )
-            {
-                ++minEnd;
-            }
+        // Layout is detected once from the first representative element, then reused
+        internal::Iso8601Layout layout{};
+        bool hasLayout{ false };
 
-            auto [ptr5, ec5] = std::from_chars( ptr4, minEnd, minute );
-            if( ec5 != std::errc{} )
-            {
-                return false;
-            }
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            const std::string_view str{ inputs[i] };
 
-            // Expect ':'
-            if( ptr5 >= end || *ptr5 != ':' )
+            if( !hasLayout )
             {
-                return false;
+                hasLayout = internal::detectIso8601Layout( str, layout ) &&
+                            layout.suffix != internal::Iso8601Layout::Suffix::Offset;
             }
-            ++ptr5; // Skip ':'
 
-            // Parse second (SS or S)
-            const char* secEnd = ptr5;
-            while( secEnd < end && *secEnd >= '0' && *secEnd <= '9' )
+            std::int64_t ticks;
+            std::int32_t offsetMinutes;
+            if( hasLayout && internal::parseIso8601Layout( str, layout, ticks, offsetMinutes ) )
             {
-                ++secEnd;
+                NFX_DATETIME_COUNT_STAT( detail::StatCounter::DateTimeFastPath );
+                results[i] = DateTime{ ticks };
+                ok[i] = 1;
+                ++parsed;
+                continue;
             }
 
-            auto [ptr6, ec6] = std::from_chars( ptr5, secEnd, second );
-            if( ec6 != std::errc{} )
+            // Outlier: flexible parser
+            if( fromString( str, results[i] ) )
             {
-                return false;
+                ok[i] = 1;
+                ++parsed;
             }
-
-            // Parse fractional seconds if present
-            if( ptr6 < end && *ptr6 == '.' )
+            else
             {
-                ++ptr6; // Skip '.'
-
-                // Count fractional digits (max 7 for 100ns precision)
-                const char* fracStart = ptr6;
-                const char* fracEnd = fracStart;
-                std::int32_t fractionDigits{ 0 };
-
-                while( fracEnd < end && *fracEnd >= '0' && *fracEnd <= '9' && fractionDigits < 7 )
-                {
-                    ++fracEnd;
-                    ++fractionDigits;
-                }
-
-                if( fractionDigits > 0 )
-                {
-                    std::int32_t fractionValue{ 0 };
-                    auto [ptrF, ecF] = std::from_chars( fracStart, fracEnd, fractionValue );
-                    if( ecF != std::errc{} || ptrF != fracEnd )
-                    {
-                        return false;
-                    }
-
-                    // Pad to 7 digits (convert to 100ns ticks)
-                    while( fractionDigits < 7 )
-                    {
-                        fractionValue *= 10;
-                        ++fractionDigits;
-                    }
-
-                    fractionalTicks = fractionValue;
-                }
+                results[i] = DateTime{};
+                ok[i] = 0;
             }
         }
 
-        // Validate components
-        if( !internal::isValidDate( year, month, day ) || !internal::isValidTime( hour, minute, second, 0 ) )
-        {
-            return false;
-        }
-
-        // Calculate ticks
-        std::int64_t ticks{ internal::dateToTicks( year, month, day ) +
-                            internal::timeToTicks( hour, minute, second, 0 ) + fractionalTicks };
-
-        result = DateTime{ ticks };
-
-        return true;
-    }
-
-    std::optional<DateTime> DateTime::fromString( std::string_view iso8601String ) noexcept
-    {
-        DateTime result;
-        if( fromString( iso8601String, result ) )
-        {
-            return result;
-        }
-        return std::nullopt;
+        return parsed;
     }
 
     //----------------------------------------------
@@ -1170,18 +859,11 @@ namespace nfx::time
     // Stream operators
     //=====================================================================
 
-    std::ostream& operator<<( std::ostream& os, const DateTime& dateTime )
-    {
-        os << dateTime.toString( nfx::time::DateTime::Format::Iso8601 );
-
-        return os;
-    }
-
     std::istream& operator>>( std::istream& is, DateTime& dateTime )
     {
-        std::string str;
-        is >> str;
-        if( !DateTime::fromString( str, dateTime ) )
+        char buffer[internal::MAX_STREAM_TOKEN_LENGTH];
+        const auto length{ internal::readStreamToken( is, buffer ) };
+        if( length != 0 && !DateTime::fromString( std::string_view{ buffer, length }, dateTime ) )
         {
             is.setstate( std::ios::failbit );
         }
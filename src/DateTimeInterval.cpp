@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DateTimeInterval.cpp
+ * @brief ISO 8601 formatting of DateTimeInterval and DateTimeOffsetInterval
+ */
+
+#include "nfx/datetime/DateTimeInterval.h"
+
+namespace nfx::time
+{
+    //=====================================================================
+    // DateTimeInterval class
+    //=====================================================================
+
+    //----------------------------------------------
+    // String formatting
+    //----------------------------------------------
+
+    std::string DateTimeInterval::toString( DateTime::Format format ) const
+    {
+        auto result{ m_start.toString( format ) };
+        result += '/';
+        result += m_end.toString( format );
+
+        return result;
+    }
+
+    //=====================================================================
+    // DateTimeOffsetInterval class
+    //=====================================================================
+
+    //----------------------------------------------
+    // String formatting
+    //----------------------------------------------
+
+    std::string DateTimeOffsetInterval::toString( DateTime::Format format ) const
+    {
+        auto result{ m_start.toString( format ) };
+        result += '/';
+        result += m_end.toString( format );
+
+        return result;
+    }
+} // namespace nfx::time
@@ -0,0 +1,163 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DateTimePattern.cpp
+ * @brief Implementation of runtime-compiled DateTimePattern
+ */
+
+#include "nfx/datetime/DateTimePattern.h"
+
+#include <algorithm>
+
+namespace nfx::time
+{
+    namespace
+    {
+        //=====================================================================
+        // Program interpretation
+        //=====================================================================
+
+        template <typename Program>
+        std::size_t formatProgram( const Program& program,
+            char* buffer,
+            std::size_t capacity,
+            const DateTime::Components& components,
+            std::int32_t offsetMinutes ) noexcept
+        {
+            if( capacity < program.length )
+            {
+                return 0;
+            }
+
+            std::copy_n( program.text.data(), program.length, buffer );
+            for( std::size_t i{ 0 }; i < program.opCount; ++i )
+            {
+                detail::writeProgramField( buffer, program.ops[i], components, offsetMinutes );
+            }
+
+            return program.length;
+        }
+
+        template <typename Program>
+        bool readProgram( const Program& program, std::string_view text, detail::PatternFields& fields ) noexcept
+        {
+            bool zulu{};
+            if( !detail::matchProgramLength( program, text, zulu ) )
+            {
+                return false;
+            }
+
+            for( std::size_t i{ 0 }; i < program.opCount; ++i )
+            {
+                if( !detail::readProgramField( text.data(), program.text.data(), program.ops[i], zulu, fields ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    } // namespace
+
+    //=====================================================================
+    // DateTimePattern class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    DateTimePattern::DateTimePattern( const Program& utcProgram, const Program& offsetProgram ) noexcept
+        : m_utcProgram{ utcProgram },
+          m_offsetProgram{ offsetProgram }
+    {
+    }
+
+    //----------------------------------------------
+    // Static factory methods
+    //----------------------------------------------
+
+    std::optional<DateTimePattern> DateTimePattern::compile( std::string_view pattern ) noexcept
+    {
+        const auto utcProgram{ detail::compilePattern<MAX_LENGTH, MAX_LENGTH>( pattern, false ) };
+        const auto offsetProgram{ detail::compilePattern<MAX_LENGTH, MAX_LENGTH>( pattern, true ) };
+        if( !utcProgram.valid || !offsetProgram.valid )
+        {
+            return std::nullopt;
+        }
+
+        return DateTimePattern{ utcProgram, offsetProgram };
+    }
+
+    //----------------------------------------------
+    // Formatting
+    //----------------------------------------------
+
+    std::size_t DateTimePattern::formatTo( const DateTime& value, char* buffer, std::size_t capacity ) const noexcept
+    {
+        return formatProgram( m_utcProgram, buffer, capacity, value.components(), 0 );
+    }
+
+    std::size_t DateTimePattern::formatTo(
+        const DateTimeOffset& value, char* buffer, std::size_t capacity ) const noexcept
+    {
+        return formatProgram(
+            m_offsetProgram, buffer, capacity, value.dateTime().components(), value.totalOffsetMinutes() );
+    }
+
+    std::string DateTimePattern::format( const DateTime& value ) const
+    {
+        std::string result( m_utcProgram.length, '\0' );
+        (void)formatTo( value, result.data(), result.size() );
+
+        return result;
+    }
+
+    std::string DateTimePattern::format( const DateTimeOffset& value ) const
+    {
+        std::string result( m_offsetProgram.length, '\0' );
+        (void)formatTo( value, result.data(), result.size() );
+
+        return result;
+    }
+
+    //----------------------------------------------
+    // Parsing
+    //----------------------------------------------
+
+    bool DateTimePattern::tryParse( std::string_view text, DateTime& result ) const noexcept
+    {
+        detail::PatternFields fields;
+
+        return readProgram( m_utcProgram, text, fields ) && detail::patternFieldsToDateTime( fields, result );
+    }
+
+    bool DateTimePattern::tryParse( std::string_view text, DateTimeOffset& result ) const noexcept
+    {
+        detail::PatternFields fields;
+
+        return readProgram( m_offsetProgram, text, fields ) && detail::patternFieldsToDateTimeOffset( fields, result );
+    }
+} // namespace nfx::time
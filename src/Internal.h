@@ -33,12 +33,20 @@
 #pragma once
 
 #include <atomic>
+#include <charconv>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <iosfwd>
+#include <string_view>
 
 #include "nfx/datetime/DateTime.h"
 #include "nfx/datetime/TimeSpan.h"
 #include "nfx/detail/datetime/Constants.h"
+#include "nfx/detail/datetime/Format.h"
+#include "nfx/detail/datetime/Iso8601.h"
+#include "nfx/detail/datetime/Stats.h"
 
 //----------------------------------------------
 // Cross-platform time functions
@@ -72,115 +80,277 @@
 #    define NFX_DATETIME_LOCALTIME_R( timer, result ) ( ( *( result ) = *localtime( timer ) ), true )
 #endif
 
+namespace nfx::time
+{
+    class CachedClock;
+} // namespace nfx::time
+
 namespace nfx::time::internal
 {
+    //=====================================================================
+    // Cached clock hook
+    //=====================================================================
+
+    /** @brief Clock installed with CachedClock::install(), read by now()/utcNow() (nullptr if none) */
+    inline std::atomic<const CachedClock*> installedCachedClock{ nullptr };
+
+    //=====================================================================
+    // System time zone
+    //=====================================================================
+
+    /**
+     * @brief Compute the system timezone offset at a Unix instant through the C library
+     * @param unixSeconds Seconds since the Unix epoch (UTC)
+     * @return Offset from UTC in seconds, 0 if the conversion fails
+     * @note Goes through gmtime_r/localtime_r and the C library time zone lock; hot paths
+     *       should use systemTimezoneOffset() instead
+     */
+    [[nodiscard]] std::int64_t computeSystemOffsetSeconds( std::int64_t unixSeconds ) noexcept;
+
     /**
-     * @brief Thread-safe timezone offset cache with hour-level granularity
-     * @details Caches timezone offset per hour to handle DST transitions correctly.
-     *          Uses atomic operations for lock-free reads in the common case.
+     * @brief Timezone offset cache with quarter-hour granularity
+     * @details Caches the timezone offset per 15-minute slot, the granularity at which real-world
+     *          DST transitions happen. Key and offset are packed into a single 64-bit word, so a
+     *          reader can never observe a new key paired with a stale offset. The process uses one
+     *          instance per thread (see systemTimezoneOffset()), so lookups never share a cache line.
      */
     class TimeZoneOffsetCache
     {
     public:
+        /** @brief Cache slot width (15 minutes) */
+        static constexpr std::int64_t TICKS_PER_SLOT{ 15 * constants::TICKS_PER_MINUTE };
+
         TimeZoneOffsetCache() noexcept
-            : m_cachedHour{ 0 },
-              m_offsetSeconds{ 0 }
+            : m_entry{ 0 }
         {
         }
 
         /**
          * @brief Get timezone offset for given DateTime, using cache when valid
          * @param dateTime The DateTime to get timezone offset for
+         * @param compute Callable `bool( const DateTime&, std::int64_t& offsetSeconds )` run on a
+         *        cache miss; returns false if the offset may change within the 15-minute slot, in
+         *        which case the result is not cached
          * @return TimeSpan representing the timezone offset
-         * @note Cache invalidates hourly to handle DST transitions correctly
+         * @note Cache invalidates every 15 minutes to handle DST transitions correctly
          */
-        TimeSpan offset( const DateTime& dateTime ) noexcept
+        template <typename Compute>
+        TimeSpan offset( const DateTime& dateTime, Compute&& compute ) noexcept
         {
-            // Cache key: year * 1000000 + month * 10000 + day * 100 + hour
-            // This ensures cache invalidation on DST transitions (which occur at specific hours)
-            const auto year{ dateTime.year() };
-            const auto month{ dateTime.month() };
-            const auto day{ dateTime.day() };
-            const auto hour{ dateTime.hour() };
-
-            const std::int64_t currentHourKey{ year * 1000000LL + month * 10000 + day * 100 + hour };
+            const auto slot{ static_cast<std::uint64_t>( dateTime.ticks() / TICKS_PER_SLOT ) };
 
-            // Fast path: check if cache is valid (lock-free)
-            if( m_cachedHour.load( std::memory_order_acquire ) == currentHourKey )
+            // Fast path: single load, key and offset always consistent
+            const auto entry{ m_entry.load( std::memory_order_relaxed ) };
+            if( ( entry >> OFFSET_BITS ) == slot + 1 )
             {
-                return TimeSpan::fromSeconds(
-                    static_cast<double>( m_offsetSeconds.load( std::memory_order_acquire ) ) );
+                NFX_DATETIME_COUNT_STAT( detail::StatCounter::TimezoneCacheHit );
+
+                return offsetFromEntry( entry );
             }
 
-            // Slow path: recompute offset
-            const auto newOffset{ computeOffset( dateTime ) };
+            // Slow path: recompute offset and publish key and value together
+            NFX_DATETIME_COUNT_STAT( detail::StatCounter::TimezoneCacheMiss );
+            std::int64_t offsetSeconds{ 0 };
+            const bool cacheable{ compute( dateTime, offsetSeconds ) };
+            const auto newEntry{ ( ( slot + 1 ) << OFFSET_BITS ) |
+                                 static_cast<std::uint64_t>( offsetSeconds + OFFSET_BIAS ) };
 
-            // Update cache atomically
-            m_offsetSeconds.store( newOffset, std::memory_order_release );
-            m_cachedHour.store( currentHourKey, std::memory_order_release );
+            if( cacheable )
+            {
+                m_entry.store( newEntry, std::memory_order_relaxed );
+            }
 
-            return TimeSpan::fromSeconds( static_cast<double>( newOffset ) );
+            return offsetFromEntry( newEntry );
         }
 
     private:
-        std::atomic<std::int64_t> m_cachedHour;    ///< Cached hour key (yyyymmddhh)
-        std::atomic<std::int64_t> m_offsetSeconds; ///< Cached offset in seconds
+        /** @brief Low bits holding the biased offset in seconds */
+        static constexpr unsigned OFFSET_BITS{ 24 };
 
-        /**
-         * @brief Compute timezone offset for given DateTime
-         * @param dateTime The DateTime to compute offset for
-         * @return Offset in seconds
-         */
-        std::int64_t computeOffset( const DateTime& dateTime ) noexcept
+        /** @brief Bias that makes any offset within +/-97 days non-negative */
+        static constexpr std::int64_t OFFSET_BIAS{ std::int64_t{ 1 } << ( OFFSET_BITS - 1 ) };
+
+        /** @brief Packed (slot + 1) << OFFSET_BITS | (offsetSeconds + OFFSET_BIAS); 0 means empty */
+        std::atomic<std::uint64_t> m_entry;
+
+        /** @brief Unpack the offset from a cache entry */
+        static TimeSpan offsetFromEntry( std::uint64_t entry ) noexcept
         {
-            // Convert DateTime to Unix timestamp (seconds since 1970-01-01)
-            const auto unixSeconds{ dateTime.toEpochSeconds() };
-            const auto systemTimeT{ static_cast<std::time_t>( unixSeconds ) };
+            constexpr std::uint64_t OFFSET_MASK{ ( std::uint64_t{ 1 } << OFFSET_BITS ) - 1 };
+            const auto offsetSeconds{ static_cast<std::int64_t>( entry & OFFSET_MASK ) - OFFSET_BIAS };
 
-            std::tm utcTm{};
-            std::tm localTm{};
+            return TimeSpan{ offsetSeconds * constants::TICKS_PER_SECOND };
+        }
+    };
 
-            const bool utcSuccess = NFX_DATETIME_GMTIME_R( &systemTimeT, &utcTm );
-            const bool localSuccess = NFX_DATETIME_LOCALTIME_R( &systemTimeT, &localTm );
+    //=====================================================================
+    // Formatting helpers
+    //=====================================================================
 
-            if( !utcSuccess || !localSuccess )
-            {
-                return 0; // Fallback to UTC
-            }
+    /*
+        The writers live in the inline detail header so the formatters in DateTime.inl,
+        DateTimeOffset.inl and TimeSpan.inl can use them; re-exported for the sources.
+    */
 
-            const auto utcSeconds{ utcTm.tm_hour * constants::SECONDS_PER_HOUR +
-                                   utcTm.tm_min * constants::SECONDS_PER_MINUTE + utcTm.tm_sec };
-            const auto localSeconds{ localTm.tm_hour * constants::SECONDS_PER_HOUR +
-                                     localTm.tm_min * constants::SECONDS_PER_MINUTE + localTm.tm_sec };
+    using detail::appendFourDigits;
+    using detail::appendFractionalSeconds;
+    using detail::appendFractionalSecondsTrimmed;
+    using detail::appendInteger;
+    using detail::appendIso8601BasicDateTime;
+    using detail::appendIso8601Date;
+    using detail::appendIso8601DateTime;
+    using detail::appendIso8601Time;
+    using detail::appendOffset;
+    using detail::appendPaddedDigits;
+    using detail::appendTwoDigits;
+    using detail::formatInto;
 
-            auto offsetSeconds{ localSeconds - utcSeconds };
+    //=====================================================================
+    // ISO 8601 decoding kernel
+    //=====================================================================
 
-            // Handle day boundary crossing
-            if( localTm.tm_mday != utcTm.tm_mday )
-            {
-                if( localTm.tm_mday > utcTm.tm_mday )
-                {
-                    offsetSeconds += constants::SECONDS_PER_DAY;
-                }
-                else
-                {
-                    offsetSeconds -= constants::SECONDS_PER_DAY;
-                }
-            }
+    /** @brief Raw date/time fields decoded from "YYYY-MM-DDTHH:mm:ss" */
+    using detail::Iso8601DateTimeFields;
 
-            return offsetSeconds;
-        }
+    /**
+     * @brief Decode the fixed 19-character "YYYY-MM-DDTHH:mm:ss" block
+     * @details Validates separators and digit characters and converts the digit pairs to integers.
+     *          Uses an SSE4.1 (x86-64) or NEON (AArch64) kernel when NFX_DATETIME_ENABLE_SIMD is set,
+     *          selected at runtime on x86-64 builds that do not target SSE4.1 natively, and a scalar
+     *          implementation otherwise. Component ranges are not validated.
+     * @param data Pointer to at least 19 readable characters
+     * @param fields Receives the decoded fields
+     * @return true if all separators and digits are well-formed
+     */
+    [[nodiscard]] bool decodeIso8601DateTime( const char* data, Iso8601DateTimeFields& fields ) noexcept;
+
+    /** @brief Scalar reference implementation of decodeIso8601DateTime() */
+    using detail::decodeIso8601DateTimeScalar;
+
+    //=====================================================================
+    // Batch parsing helpers
+    //=====================================================================
+
+    /**
+     * @brief Fixed-width ISO 8601 layout shared by every element of a batch
+     * @details Detected once from a representative element, then used to parse
+     *          further elements with fixed separator positions and no scanning.
+     */
+    struct Iso8601Layout
+    {
+        /** @brief Suffix following the date/time part */
+        enum class Suffix : std::uint8_t
+        {
+            None,
+            Utc,
+            Offset
+        };
+
+        /** @brief Total length in characters */
+        std::size_t length{ 0 };
+
+        /** @brief Number of fractional second digits (0 if none) */
+        std::size_t fractionDigits{ 0 };
+
+        /** @brief true if a time part "THH:mm:ss" follows the date */
+        bool hasTime{ false };
+
+        /** @brief Suffix kind: none, 'Z' or "±HH:MM" */
+        Suffix suffix{ Suffix::None };
     };
 
     /**
-     * @brief Get system timezone offset with caching
+     * @brief Detect the fixed-width layout of an ISO 8601 string
+     * @details Recognizes "YYYY-MM-DD", "YYYY-MM-DDTHH:mm:ss[.f{1-9}][Z|±HH:MM]".
+     *          Only the shape is checked; values are validated by parseIso8601Layout().
+     * @param str String to inspect
+     * @param layout Receives the detected layout
+     * @return true if the string matches a fixed-width layout
+     */
+    [[nodiscard]] bool detectIso8601Layout( std::string_view str, Iso8601Layout& layout ) noexcept;
+
+    /**
+     * @brief Parse a string known to have the given fixed-width layout
+     * @param str String to parse (length must equal layout.length)
+     * @param layout Layout previously returned by detectIso8601Layout()
+     * @param ticks Receives the date/time ticks (excluding offset)
+     * @param offsetMinutes Receives the offset in minutes (0 unless layout.suffix is Offset)
+     * @return true if all separators, digits and component ranges are valid
+     */
+    [[nodiscard]] bool parseIso8601Layout( std::string_view str,
+        const Iso8601Layout& layout,
+        std::int64_t& ticks,
+        std::int32_t& offsetMinutes ) noexcept;
+
+    //=====================================================================
+    // String parsing
+    //=====================================================================
+
+    /**
+     * @brief Parser that produced a result
+     * @details Ordered like the fast path / fallback / failure counter triples of detail::StatCounter,
+     *          so a path can be added to the first counter of a triple.
+     */
+    enum class ParsePath : std::uint8_t
+    {
+        FastPath,
+        Fallback,
+        Failed
+    };
+
+    /**
+     * @brief Parse an ISO 8601 DateTime through the fast path, then the flexible parser
+     * @details DateTime::fromString() without the instrumentation. DateTimeOffset::fromString()
+     *          parses its date-time part through it, so offset inputs are not counted twice.
+     * @param iso8601String String to parse
+     * @param result Receives the parsed value on success
+     * @return Parser that accepted the input, or ParsePath::Failed
+     */
+    [[nodiscard]] ParsePath parseDateTime( std::string_view iso8601String, DateTime& result ) noexcept;
+
+    //=====================================================================
+    // Prefix parsing helpers
+    //=====================================================================
+
+    /** @brief Maximum number of candidate ends reported by scanIso8601Prefix() */
+    inline constexpr std::size_t MAX_ISO8601_PREFIX_CUTS{ 4 };
+
+    /**
+     * @brief Find the candidate ends of an ISO 8601 timestamp at the start of a range
+     * @details Scans the shape "YYYY-M[M]-D[D][THH:mm:ss[.f+][Z|±HH[[:]MM]]]" without
+     *          validating values. Each optional part that is complete adds a candidate end,
+     *          so a caller can try the longest first and back off to shorter prefixes when a
+     *          trailing part turns out to be invalid.
+     * @param first Start of the character range
+     * @param last End of the character range
+     * @param ends Receives the candidate ends, longest first
+     * @return Number of candidate ends (0 if no date starts at first)
+     */
+    [[nodiscard]] std::size_t scanIso8601Prefix(
+        const char* first, const char* last, const char* ( &ends )[MAX_ISO8601_PREFIX_CUTS] ) noexcept;
+
+    /** @brief Capacity of the token buffer used by the stream extraction operators */
+    inline constexpr std::size_t MAX_STREAM_TOKEN_LENGTH{ 64 };
+
+    /**
+     * @brief Extract one whitespace-delimited token from a stream without allocating
+     * @details Skips leading whitespace (unless std::noskipws is set) and reads characters from the
+     *          stream buffer into buffer until whitespace or end of file, like operator>> for
+     *          std::string. A token longer than the buffer is consumed and sets failbit.
+     * @param is Stream to read from
+     * @param buffer Receives the token (not null-terminated)
+     * @return Token length, or 0 if extraction failed (stream state updated)
+     */
+    [[nodiscard]] std::size_t readStreamToken( std::istream& is, char ( &buffer )[MAX_STREAM_TOKEN_LENGTH] );
+
+    /**
+     * @brief Get system timezone offset
      * @param dateTime The DateTime to get timezone offset for
      * @return TimeSpan representing the timezone offset
+     * @details Served from a per-thread TimeZoneOffsetCache. On a miss, instants inside the
+     *          precomputed transition table range are resolved by binary search without touching
+     *          the C library; other instants fall back to computeSystemOffsetSeconds().
      */
-    inline TimeSpan systemTimezoneOffset( const DateTime& dateTime ) noexcept
-    {
-        static TimeZoneOffsetCache cache;
-        return cache.offset( dateTime );
-    }
+    [[nodiscard]] TimeSpan systemTimezoneOffset( const DateTime& dateTime ) noexcept;
 
 } // namespace nfx::time::internal
@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file IntervalIndex.cpp
+ * @brief IntervalIndex construction, allocating queries and coalescing
+ * @details The tree is a complete binary tree stored heap-style (children of node k at 2k and
+ *          2k + 1) whose leaves are the end ticks of the intervals in start order; padding
+ *          leaves hold INT64_MIN so they never pass the max end test.
+ */
+
+#include "nfx/datetime/IntervalIndex.h"
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <limits>
+
+namespace nfx::time
+{
+    namespace
+    {
+        /** @brief Merge non-empty intervals sorted by start in one sweep */
+        std::vector<DateTimeInterval> coalesceSorted( std::span<const DateTimeInterval> sorted )
+        {
+            std::vector<DateTimeInterval> result;
+            for( const auto& interval : sorted )
+            {
+                if( !result.empty() && interval.start() <= result.back().end() )
+                {
+                    result.back() = result.back().hull( interval );
+                }
+                else
+                {
+                    result.push_back( interval );
+                }
+            }
+
+            return result;
+        }
+    } // namespace
+
+    //=====================================================================
+    // IntervalIndex class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    IntervalIndex::IntervalIndex( std::span<const DateTimeInterval> intervals )
+    {
+        // Sort (interval, position) pairs directly: ties keep construction order
+        std::vector<std::pair<DateTimeInterval, std::size_t>> entries;
+        entries.reserve( intervals.size() );
+        for( std::size_t i{ 0 }; i < intervals.size(); ++i )
+        {
+            if( !intervals[i].isEmpty() )
+            {
+                entries.emplace_back( intervals[i], i );
+            }
+        }
+        std::sort( entries.begin(), entries.end() );
+
+        m_intervals.reserve( entries.size() );
+        m_indices.reserve( entries.size() );
+        for( const auto& [interval, index] : entries )
+        {
+            m_intervals.push_back( interval );
+            m_indices.push_back( index );
+        }
+
+        if( m_intervals.empty() )
+        {
+            return;
+        }
+
+        m_leafCount = std::bit_ceil( m_intervals.size() );
+        m_maxEnds.assign( 2 * m_leafCount, std::numeric_limits<std::int64_t>::min() );
+        for( std::size_t i{ 0 }; i < m_intervals.size(); ++i )
+        {
+            m_maxEnds[m_leafCount + i] = m_intervals[i].end().ticks();
+        }
+        for( auto node{ m_leafCount - 1 }; node > 0; --node )
+        {
+            m_maxEnds[node] = std::max( m_maxEnds[2 * node], m_maxEnds[2 * node + 1] );
+        }
+    }
+
+    //----------------------------------------------
+    // Queries
+    //----------------------------------------------
+
+    std::vector<std::size_t> IntervalIndex::stabbing( const DateTime& instant ) const
+    {
+        std::vector<std::size_t> result;
+        forEachStabbing( instant, [&]( const DateTimeInterval&, std::size_t index ) { result.push_back( index ); } );
+
+        return result;
+    }
+
+    std::vector<std::size_t> IntervalIndex::overlapping( const DateTimeInterval& query ) const
+    {
+        std::vector<std::size_t> result;
+        forEachOverlapping( query, [&]( const DateTimeInterval&, std::size_t index ) { result.push_back( index ); } );
+
+        return result;
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> IntervalIndex::overlappingPairs() const
+    {
+        // Sorted by start: interval j > i overlaps i exactly while j starts before i ends
+        std::vector<std::pair<std::size_t, std::size_t>> result;
+        for( std::size_t i{ 0 }; i < m_intervals.size(); ++i )
+        {
+            const auto endTicks{ m_intervals[i].end().ticks() };
+            for( auto j{ i + 1 }; j < m_intervals.size() && m_intervals[j].start().ticks() < endTicks; ++j )
+            {
+                result.emplace_back( m_indices[i], m_indices[j] );
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<DateTimeInterval> IntervalIndex::coalesced() const
+    {
+        return coalesceSorted( m_intervals );
+    }
+
+    std::size_t IntervalIndex::countStartingBefore( std::int64_t ticks ) const noexcept
+    {
+        const auto it{ std::partition_point( m_intervals.begin(), m_intervals.end(),
+            [ticks]( const DateTimeInterval& interval ) { return interval.start().ticks() < ticks; } ) };
+
+        return static_cast<std::size_t>( it - m_intervals.begin() );
+    }
+
+    //=====================================================================
+    // Coalescing
+    //=====================================================================
+
+    std::vector<DateTimeInterval> coalesce( std::span<const DateTimeInterval> intervals )
+    {
+        std::vector<DateTimeInterval> sorted;
+        sorted.reserve( intervals.size() );
+        std::copy_if( intervals.begin(), intervals.end(), std::back_inserter( sorted ),
+            []( const DateTimeInterval& interval ) { return !interval.isEmpty(); } );
+        std::sort( sorted.begin(), sorted.end() );
+
+        return coalesceSorted( sorted );
+    }
+} // namespace nfx::time
@@ -0,0 +1,220 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Iso8601Decode.cpp
+ * @brief Vectorized decoding of the fixed "YYYY-MM-DDTHH:mm:ss" ISO 8601 block
+ * @details Provides SSE4.1 and NEON kernels validating separators and digits and
+ *          converting digit pairs with multiply-add, plus runtime CPU dispatch on x86-64
+ *          builds that do not target SSE4.1 natively. The scalar kernel is constexpr and
+ *          lives in nfx/detail/datetime/Iso8601.h.
+ */
+
+#include "Internal.h"
+
+#if defined( NFX_DATETIME_ENABLE_SIMD ) && !defined( __EMSCRIPTEN__ )
+#    if defined( __x86_64__ ) || defined( _M_X64 )
+#        define NFX_DATETIME_ISO8601_SSE41 1
+#        include <immintrin.h>
+#        if defined( _MSC_VER ) && !defined( __clang__ )
+#            include <intrin.h>
+#        endif
+#    elif defined( __aarch64__ ) || defined( _M_ARM64 )
+#        define NFX_DATETIME_ISO8601_NEON 1
+#        include <arm_neon.h>
+#    endif
+#endif
+
+namespace nfx::time::internal
+{
+    /*
+        Vector kernels:
+        The 19-character block is covered by two overlapping 16-byte loads, at offsets 0 and 3,
+        so the kernel never reads past the end of the block. Subtracting a template holding '0'
+        in digit lanes and the expected separator elsewhere maps valid digits to 0-9 and valid
+        separators to 0; a single unsigned compare against a per-lane limit (9, 0, or 255 for
+        lanes that are ignored) validates the whole block. The fourteen digits are then gathered
+        into adjacent pairs with a byte shuffle and combined as tens * 10 + ones.
+    */
+
+#if defined( NFX_DATETIME_ISO8601_SSE41 )
+
+    //=====================================================================
+    // SSE4.1 kernel
+    //=====================================================================
+
+    namespace
+    {
+#    if defined( __GNUC__ ) || defined( __clang__ )
+#        define NFX_DATETIME_TARGET_SSE41 __attribute__( ( target( "sse4.1" ) ) )
+#    else
+#        define NFX_DATETIME_TARGET_SSE41
+#    endif
+
+        NFX_DATETIME_TARGET_SSE41 bool decodeIso8601DateTimeSse41(
+            const char* data, Iso8601DateTimeFields& fields ) noexcept
+        {
+            const __m128i head{ _mm_loadu_si128( reinterpret_cast<const __m128i*>( data ) ) };
+            const __m128i tail{ _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + 3 ) ) };
+
+            // Characters 0-15: "YYYY-MM-DDTHH:mm"
+            const __m128i headBase{ _mm_setr_epi8(
+                '0', '0', '0', '0', '-', '0', '0', '-', '0', '0', 'T', '0', '0', ':', '0', '0' ) };
+            const __m128i headLimit{ _mm_setr_epi8( 9, 9, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9 ) };
+
+            // Characters 3-18: only ":ss" (lanes 13-15) is checked here
+            const __m128i tailBase{ _mm_setr_epi8( 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ':', '0', '0' ) };
+            const __m128i tailLimit{ _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 9, 9 ) };
+
+            const __m128i headDelta{ _mm_sub_epi8( head, headBase ) };
+            const __m128i tailDelta{ _mm_sub_epi8( tail, tailBase ) };
+
+            const __m128i headOk{ _mm_cmpeq_epi8( _mm_max_epu8( headDelta, headLimit ), headLimit ) };
+            const __m128i tailOk{ _mm_cmpeq_epi8( _mm_max_epu8( tailDelta, tailLimit ), tailLimit ) };
+
+            if( _mm_movemask_epi8( _mm_and_si128( headOk, tailOk ) ) != 0xFFFF )
+            {
+                return false;
+            }
+
+            // Gather digits into pairs: YY YY MM DD HH mm ss
+            const __m128i headDigits{ _mm_shuffle_epi8(
+                headDelta, _mm_setr_epi8( 0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, -1, -1, -1, -1 ) ) };
+            const __m128i tailDigits{ _mm_shuffle_epi8(
+                tailDelta, _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, 15, -1, -1 ) ) };
+            const __m128i digits{ _mm_or_si128( headDigits, tailDigits ) };
+
+            // tens * 10 + ones for each pair
+            const __m128i pairs{ _mm_maddubs_epi16(
+                digits, _mm_setr_epi8( 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 0, 0 ) ) };
+
+            fields.year = _mm_extract_epi16( pairs, 0 ) * 100 + _mm_extract_epi16( pairs, 1 );
+            fields.month = _mm_extract_epi16( pairs, 2 );
+            fields.day = _mm_extract_epi16( pairs, 3 );
+            fields.hour = _mm_extract_epi16( pairs, 4 );
+            fields.minute = _mm_extract_epi16( pairs, 5 );
+            fields.second = _mm_extract_epi16( pairs, 6 );
+
+            return true;
+        }
+
+#    undef NFX_DATETIME_TARGET_SSE41
+
+#    if !defined( __SSE4_1__ ) && !defined( __AVX2__ )
+        /** @brief Function signature shared by the decoding kernels */
+        using DecodeFunction = bool ( * )( const char*, Iso8601DateTimeFields& ) noexcept;
+
+        /** @brief Select the best kernel supported by the executing CPU */
+        [[nodiscard]] DecodeFunction selectDecodeFunction() noexcept
+        {
+#        if defined( _MSC_VER ) && !defined( __clang__ )
+            int info[4];
+            __cpuid( info, 1 );
+            const bool hasSse41{ ( info[2] & ( 1 << 19 ) ) != 0 };
+#        else
+            const bool hasSse41{ __builtin_cpu_supports( "sse4.1" ) != 0 };
+#        endif
+
+            return hasSse41 ? &decodeIso8601DateTimeSse41 : &decodeIso8601DateTimeScalar;
+        }
+#    endif
+    } // namespace
+
+    bool decodeIso8601DateTime( const char* data, Iso8601DateTimeFields& fields ) noexcept
+    {
+#    if defined( __SSE4_1__ ) || defined( __AVX2__ )
+        // Target baseline already includes SSE4.1
+        return decodeIso8601DateTimeSse41( data, fields );
+#    else
+        // Runtime CPU dispatch, resolved once
+        static const DecodeFunction decode{ selectDecodeFunction() };
+
+        return decode( data, fields );
+#    endif
+    }
+
+#elif defined( NFX_DATETIME_ISO8601_NEON )
+
+    //=====================================================================
+    // NEON kernel
+    //=====================================================================
+
+    bool decodeIso8601DateTime( const char* data, Iso8601DateTimeFields& fields ) noexcept
+    {
+        static constexpr std::uint8_t HEAD_BASE[16]{
+            '0', '0', '0', '0', '-', '0', '0', '-', '0', '0', 'T', '0', '0', ':', '0', '0' };
+        static constexpr std::uint8_t HEAD_LIMIT[16]{ 9, 9, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9 };
+        static constexpr std::uint8_t TAIL_BASE[16]{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ':', '0', '0' };
+        static constexpr std::uint8_t TAIL_LIMIT[16]{
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 9, 9 };
+        static constexpr std::uint8_t HEAD_GATHER[16]{ 0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, 255, 255, 255, 255 };
+        static constexpr std::uint8_t TAIL_GATHER[16]{
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 15, 255, 255 };
+
+        const uint8x16_t head{ vld1q_u8( reinterpret_cast<const std::uint8_t*>( data ) ) };
+        const uint8x16_t tail{ vld1q_u8( reinterpret_cast<const std::uint8_t*>( data + 3 ) ) };
+
+        const uint8x16_t headDelta{ vsubq_u8( head, vld1q_u8( HEAD_BASE ) ) };
+        const uint8x16_t tailDelta{ vsubq_u8( tail, vld1q_u8( TAIL_BASE ) ) };
+
+        const uint8x16_t ok{ vandq_u8(
+            vcleq_u8( headDelta, vld1q_u8( HEAD_LIMIT ) ), vcleq_u8( tailDelta, vld1q_u8( TAIL_LIMIT ) ) ) };
+
+        if( vminvq_u8( ok ) != 0xFF )
+        {
+            return false;
+        }
+
+        // Gather digits into pairs: YY YY MM DD HH mm ss (out-of-range indices yield 0)
+        const uint8x16_t digits{ vorrq_u8(
+            vqtbl1q_u8( headDelta, vld1q_u8( HEAD_GATHER ) ), vqtbl1q_u8( tailDelta, vld1q_u8( TAIL_GATHER ) ) ) };
+
+        // tens * 10 + ones for each pair
+        const uint8x8_t tens{ vget_low_u8( vuzp1q_u8( digits, digits ) ) };
+        const uint8x8_t ones{ vget_low_u8( vuzp2q_u8( digits, digits ) ) };
+        const uint16x8_t pairs{ vmlal_u8( vmovl_u8( ones ), tens, vdup_n_u8( 10 ) ) };
+
+        fields.year = vgetq_lane_u16( pairs, 0 ) * 100 + vgetq_lane_u16( pairs, 1 );
+        fields.month = vgetq_lane_u16( pairs, 2 );
+        fields.day = vgetq_lane_u16( pairs, 3 );
+        fields.hour = vgetq_lane_u16( pairs, 4 );
+        fields.minute = vgetq_lane_u16( pairs, 5 );
+        fields.second = vgetq_lane_u16( pairs, 6 );
+
+        return true;
+    }
+
+#else
+
+    //=====================================================================
+    // Portable build
+    //=====================================================================
+
+    bool decodeIso8601DateTime( const char* data, Iso8601DateTimeFields& fields ) noexcept
+    {
+        return decodeIso8601DateTimeScalar( data, fields );
+    }
+
+#endif
+} // namespace nfx::time::internal
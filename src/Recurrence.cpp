@@ -0,0 +1,1080 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Recurrence.cpp
+ * @brief Implementation of Recurrence: cron and RRULE compilation and occurrence search
+ * @details Both syntaxes compile to the same field masks. The search resolves the month, the
+ *          day, then the time of day, each with a single bit scan over the matching values, and
+ *          moves to the next coarser field whenever a finer one has no match left.
+ */
+
+#include "nfx/datetime/Recurrence.h"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <span>
+
+namespace nfx::time
+{
+    namespace
+    {
+        //=====================================================================
+        // Text helpers
+        //=====================================================================
+
+        constexpr std::array<std::string_view, 12> MONTH_NAMES{
+            "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };
+
+        constexpr std::array<std::string_view, 7> CRON_DAY_NAMES{ "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT" };
+
+        constexpr std::array<std::string_view, 7> RRULE_DAY_NAMES{ "SU", "MO", "TU", "WE", "TH", "FR", "SA" };
+
+        /** @brief Days 1, 8, 15, 22 and 29 of a month (bit 0 is day 1) */
+        constexpr std::uint64_t EVERY_SEVENTH_DAY{ 0x10204081 };
+
+        [[nodiscard]] constexpr char toUpper( char c ) noexcept
+        {
+            return ( c >= 'a' && c <= 'z' ) ? static_cast<char>( c - 'a' + 'A' ) : c;
+        }
+
+        [[nodiscard]] constexpr bool equalsIgnoreCase( std::string_view text, std::string_view upper ) noexcept
+        {
+            return text.size() == upper.size() &&
+                   std::equal( text.begin(), text.end(), upper.begin(), []( char a, char b ) {
+                       return toUpper( a ) == b;
+                   } );
+        }
+
+        [[nodiscard]] constexpr bool isSpace( char c ) noexcept
+        {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        }
+
+        [[nodiscard]] constexpr std::string_view trim( std::string_view text ) noexcept
+        {
+            while( !text.empty() && isSpace( text.front() ) )
+            {
+                text.remove_prefix( 1 );
+            }
+            while( !text.empty() && isSpace( text.back() ) )
+            {
+                text.remove_suffix( 1 );
+            }
+
+            return text;
+        }
+
+        /** @brief Split off the text before the next delimiter (the whole text if there is none) */
+        [[nodiscard]] constexpr std::string_view nextToken( std::string_view& text, char delimiter ) noexcept
+        {
+            const auto position{ text.find( delimiter ) };
+            const auto token{ text.substr( 0, position ) };
+            text = position == std::string_view::npos ? std::string_view{} : text.substr( position + 1 );
+
+            return token;
+        }
+
+        /** @brief Parse a non-negative decimal number of 1 to 9 digits */
+        [[nodiscard]] bool parseNumber( std::string_view text, std::int32_t& value ) noexcept
+        {
+            if( text.empty() || text.size() > 9 || text.front() < '0' || text.front() > '9' )
+            {
+                return false;
+            }
+
+            const auto [end, error]{ std::from_chars( text.data(), text.data() + text.size(), value ) };
+
+            return error == std::errc{} && end == text.data() + text.size();
+        }
+
+        /** @brief Parse a number with an optional sign */
+        [[nodiscard]] bool parseSignedNumber( std::string_view text, std::int32_t& value ) noexcept
+        {
+            const bool negative{ !text.empty() && text.front() == '-' };
+            if( !text.empty() && ( text.front() == '-' || text.front() == '+' ) )
+            {
+                text.remove_prefix( 1 );
+            }
+            if( !parseNumber( text, value ) )
+            {
+                return false;
+            }
+            value = negative ? -value : value;
+
+            return true;
+        }
+
+        /** @brief Find a name in a table of upper-case names */
+        [[nodiscard]] std::int32_t findName( std::string_view text, std::span<const std::string_view> names ) noexcept
+        {
+            for( std::size_t i{ 0 }; i < names.size(); ++i )
+            {
+                if( equalsIgnoreCase( text, names[i] ) )
+                {
+                    return static_cast<std::int32_t>( i );
+                }
+            }
+
+            return -1;
+        }
+
+        //=====================================================================
+        // Period arithmetic
+        //=====================================================================
+
+        [[nodiscard]] constexpr std::int64_t floorMod( std::int64_t value, std::int64_t divisor ) noexcept
+        {
+            const auto remainder{ value % divisor };
+
+            return remainder < 0 ? remainder + divisor : remainder;
+        }
+
+        /** @brief Smallest period index at or after value that is a whole number of intervals from anchor */
+        [[nodiscard]] constexpr std::int64_t alignUp(
+            std::int64_t value, std::int64_t anchor, std::int64_t interval ) noexcept
+        {
+            return value + floorMod( anchor - value, interval );
+        }
+
+        /** @brief Mask of the periods base .. base + count - 1 that are aligned with anchor */
+        [[nodiscard]] constexpr std::uint64_t periodMask(
+            std::int64_t base, std::int32_t count, std::int64_t anchor, std::int64_t interval ) noexcept
+        {
+            std::uint64_t mask{};
+            for( auto i{ floorMod( anchor - base, interval ) }; i < count; i += interval )
+            {
+                mask |= std::uint64_t{ 1 } << i;
+            }
+
+            return mask;
+        }
+
+        /** @brief Index of the week holding a day, weeks starting on weekStart (0=Sunday) */
+        [[nodiscard]] constexpr std::int64_t weekIndex( std::int64_t dayNumber, std::int32_t weekStart ) noexcept
+        {
+            // Day 0 (January 1, 0001) is a Monday
+            return ( dayNumber + ( 8 - weekStart ) % 7 ) / 7;
+        }
+
+        /** @brief Mask of the weekdays that have ordinals (bit 0 is Sunday) */
+        [[nodiscard]] constexpr std::uint8_t ordinalWeekdays( const std::array<std::uint16_t, 7>& ordinals ) noexcept
+        {
+            std::uint8_t mask{};
+            for( std::size_t weekday{ 0 }; weekday < ordinals.size(); ++weekday )
+            {
+                mask |= static_cast<std::uint8_t>( ( ordinals[weekday] != 0 ? 1u : 0u ) << weekday );
+            }
+
+            return mask;
+        }
+
+        //=====================================================================
+        // Cron fields
+        //=====================================================================
+
+        struct CronField
+        {
+            std::int32_t min;
+            std::int32_t max;
+            std::span<const std::string_view> names;
+            std::int32_t nameBase;
+        };
+
+        constexpr CronField CRON_SECONDS{ 0, 59, {}, 0 };
+        constexpr CronField CRON_MINUTES{ 0, 59, {}, 0 };
+        constexpr CronField CRON_HOURS{ 0, 23, {}, 0 };
+        constexpr CronField CRON_MONTH_DAYS{ 1, 31, {}, 0 };
+        constexpr CronField CRON_MONTHS{ 1, 12, MONTH_NAMES, 1 };
+        constexpr CronField CRON_WEEKDAYS{ 0, 7, CRON_DAY_NAMES, 0 };
+
+        [[nodiscard]] bool parseCronValue( std::string_view text, const CronField& field, std::int32_t& value ) noexcept
+        {
+            if( parseNumber( text, value ) )
+            {
+                return value >= field.min && value <= field.max;
+            }
+
+            const auto index{ findName( text, field.names ) };
+            value = field.nameBase + index;
+
+            return index >= 0;
+        }
+
+        /** @brief Parse one list item: *, a, a-b, with an optional /step */
+        [[nodiscard]] bool parseCronItem( std::string_view item, const CronField& field, std::uint64_t& mask ) noexcept
+        {
+            std::int32_t step{ 1 };
+            const auto slash{ item.find( '/' ) };
+            if( slash != std::string_view::npos )
+            {
+                if( !parseNumber( item.substr( slash + 1 ), step ) || step < 1 )
+                {
+                    return false;
+                }
+                item = item.substr( 0, slash );
+            }
+
+            std::int32_t low{ field.min };
+            std::int32_t high{ field.max };
+            if( item != "*" )
+            {
+                const auto dash{ item.find( '-' ) };
+                if( !parseCronValue( item.substr( 0, dash ), field, low ) )
+                {
+                    return false;
+                }
+                if( dash != std::string_view::npos )
+                {
+                    if( !parseCronValue( item.substr( dash + 1 ), field, high ) )
+                    {
+                        return false;
+                    }
+                }
+                else if( slash == std::string_view::npos )
+                {
+                    high = low;
+                }
+            }
+            if( low > high )
+            {
+                return false;
+            }
+
+            for( auto value{ low }; value <= high; value += step )
+            {
+                mask |= std::uint64_t{ 1 } << value;
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] bool parseCronField( std::string_view text, const CronField& field, std::uint64_t& mask ) noexcept
+        {
+            while( !text.empty() )
+            {
+                if( !parseCronItem( nextToken( text, ',' ), field, mask ) )
+                {
+                    return false;
+                }
+            }
+
+            return mask != 0;
+        }
+
+        /** @brief Parse the day-of-month field: numbers, ranges, L and L-n */
+        [[nodiscard]] bool parseCronMonthDays(
+            std::string_view text, std::uint64_t& mask, std::uint32_t& lastDays ) noexcept
+        {
+            while( !text.empty() )
+            {
+                auto item{ nextToken( text, ',' ) };
+                if( item == "?" )
+                {
+                    item = "*";
+                }
+
+                if( !item.empty() && toUpper( item.front() ) == 'L' )
+                {
+                    std::int32_t before{ 0 };
+                    if( item.size() > 1 &&
+                        ( item[1] != '-' || !parseNumber( item.substr( 2 ), before ) || before > 30 ) )
+                    {
+                        return false;
+                    }
+                    lastDays |= 1u << before;
+                }
+                else if( !parseCronItem( item, CRON_MONTH_DAYS, mask ) )
+                {
+                    return false;
+                }
+            }
+
+            return mask != 0 || lastDays != 0;
+        }
+
+        /** @brief Parse the day-of-week field: numbers, names, ranges, dL (last) and d#n (n-th) */
+        [[nodiscard]] bool parseCronWeekdays(
+            std::string_view text, std::uint64_t& mask, std::array<std::uint16_t, 7>& ordinals ) noexcept
+        {
+            bool any{};
+            while( !text.empty() )
+            {
+                auto item{ nextToken( text, ',' ) };
+                if( item == "?" )
+                {
+                    item = "*";
+                }
+
+                std::int32_t weekday{};
+                const auto hash{ item.find( '#' ) };
+                if( hash != std::string_view::npos )
+                {
+                    std::int32_t ordinal{};
+                    if( !parseCronValue( item.substr( 0, hash ), CRON_WEEKDAYS, weekday ) ||
+                        !parseNumber( item.substr( hash + 1 ), ordinal ) || ordinal < 1 || ordinal > 5 )
+                    {
+                        return false;
+                    }
+                    ordinals[weekday % 7] |= static_cast<std::uint16_t>( 1u << ( ordinal - 1 ) );
+                }
+                else if( item.size() > 1 && toUpper( item.back() ) == 'L' )
+                {
+                    if( !parseCronValue( item.substr( 0, item.size() - 1 ), CRON_WEEKDAYS, weekday ) )
+                    {
+                        return false;
+                    }
+                    ordinals[weekday % 7] |= static_cast<std::uint16_t>( 1u << 5 );
+                }
+                else if( !parseCronItem( item, CRON_WEEKDAYS, mask ) )
+                {
+                    return false;
+                }
+                any = true;
+            }
+
+            // 7 is an alias for Sunday
+            mask = ( mask | ( mask >> 7 ) ) & 0x7F;
+
+            return any;
+        }
+
+        /** @brief Expand a cron macro to its five-field form */
+        [[nodiscard]] std::string_view expandCronMacro( std::string_view expression ) noexcept
+        {
+            if( equalsIgnoreCase( expression, "@YEARLY" ) || equalsIgnoreCase( expression, "@ANNUALLY" ) )
+            {
+                return "0 0 1 1 *";
+            }
+            if( equalsIgnoreCase( expression, "@MONTHLY" ) )
+            {
+                return "0 0 1 * *";
+            }
+            if( equalsIgnoreCase( expression, "@WEEKLY" ) )
+            {
+                return "0 0 * * 0";
+            }
+            if( equalsIgnoreCase( expression, "@DAILY" ) || equalsIgnoreCase( expression, "@MIDNIGHT" ) )
+            {
+                return "0 0 * * *";
+            }
+            if( equalsIgnoreCase( expression, "@HOURLY" ) )
+            {
+                return "0 * * * *";
+            }
+
+            return {};
+        }
+
+        //=====================================================================
+        // RRULE parts
+        //=====================================================================
+
+        /** @brief Parse a comma-separated list of integers in [min, max] into a mask */
+        [[nodiscard]] bool parseRRuleList(
+            std::string_view text, std::int32_t min, std::int32_t max, std::uint64_t& mask ) noexcept
+        {
+            if( text.empty() )
+            {
+                return false;
+            }
+            while( !text.empty() )
+            {
+                std::int32_t value{};
+                if( !parseNumber( nextToken( text, ',' ), value ) || value < min || value > max )
+                {
+                    return false;
+                }
+                mask |= std::uint64_t{ 1 } << value;
+            }
+
+            return true;
+        }
+
+        /** @brief Parse an UNTIL value: YYYYMMDD or YYYYMMDDTHHMMSS, optionally followed by Z */
+        [[nodiscard]] bool parseUntil( std::string_view text, std::int64_t& ticks ) noexcept
+        {
+            if( !text.empty() && toUpper( text.back() ) == 'Z' )
+            {
+                text.remove_suffix( 1 );
+            }
+            if( text.size() != 8 && ( text.size() != 15 || toUpper( text[8] ) != 'T' ) )
+            {
+                return false;
+            }
+
+            std::int32_t year{}, month{}, day{};
+            if( !parseNumber( text.substr( 0, 4 ), year ) || !parseNumber( text.substr( 4, 2 ), month ) ||
+                !parseNumber( text.substr( 6, 2 ), day ) || year < constants::MIN_YEAR || month < 1 || month > 12 ||
+                day < 1 || day > DateTime::daysInMonth( year, month ) )
+            {
+                return false;
+            }
+
+            // A date-only UNTIL includes the whole day
+            std::int32_t hour{ 23 }, minute{ 59 }, second{ 59 };
+            if( text.size() == 15 &&
+                ( !parseNumber( text.substr( 9, 2 ), hour ) || !parseNumber( text.substr( 11, 2 ), minute ) ||
+                    !parseNumber( text.substr( 13, 2 ), second ) || hour > 23 || minute > 59 || second > 59 ) )
+            {
+                return false;
+            }
+
+            ticks = detail::dateToTicks( year, month, day ) + hour * constants::TICKS_PER_HOUR +
+                    minute * constants::TICKS_PER_MINUTE + second * constants::TICKS_PER_SECOND;
+
+            return true;
+        }
+    } // namespace
+
+    //=====================================================================
+    // Recurrence class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Static factory methods
+    //----------------------------------------------
+
+    std::optional<Recurrence> Recurrence::fromCron( std::string_view expression ) noexcept
+    {
+        expression = trim( expression );
+        if( !expression.empty() && expression.front() == '@' )
+        {
+            expression = expandCronMacro( expression );
+        }
+
+        std::array<std::string_view, 6> fields{};
+        std::size_t count{ 0 };
+        while( !expression.empty() )
+        {
+            if( count == fields.size() )
+            {
+                return std::nullopt;
+            }
+
+            const auto end{ std::find_if( expression.begin(), expression.end(), isSpace ) };
+            fields[count++] = expression.substr( 0, static_cast<std::size_t>( end - expression.begin() ) );
+            expression = trim( expression.substr( fields[count - 1].size() ) );
+        }
+        if( count != 5 && count != 6 )
+        {
+            return std::nullopt;
+        }
+
+        // Five-field expressions fire on second 0
+        if( count == 5 )
+        {
+            std::copy_backward( fields.begin(), fields.begin() + 5, fields.end() );
+            fields[0] = "0";
+        }
+
+        Recurrence result;
+        std::uint64_t hours{}, monthDays{}, months{}, weekdays{};
+        if( !parseCronField( fields[0], CRON_SECONDS, result.m_seconds ) ||
+            !parseCronField( fields[1], CRON_MINUTES, result.m_minutes ) ||
+            !parseCronField( fields[2], CRON_HOURS, hours ) ||
+            !parseCronMonthDays( fields[3], monthDays, result.m_lastMonthDays ) ||
+            !parseCronField( fields[4], CRON_MONTHS, months ) ||
+            !parseCronWeekdays( fields[5], weekdays, result.m_ordinals ) )
+        {
+            return std::nullopt;
+        }
+
+        result.m_hours = static_cast<std::uint32_t>( hours );
+        result.m_monthDays = static_cast<std::uint32_t>( monthDays >> 1 );
+        result.m_months = static_cast<std::uint16_t>( months >> 1 );
+        result.m_weekdays = static_cast<std::uint8_t>( weekdays );
+        result.m_ordinalWeekdays = ordinalWeekdays( result.m_ordinals );
+
+        // A field starting with * or ? does not restrict the day; when both do, either matches
+        const auto restricts{ []( std::string_view field ) { return field.front() != '*' && field.front() != '?'; } };
+        result.m_hasMonthDayRule = restricts( fields[3] );
+        result.m_hasWeekdayRule = restricts( fields[5] );
+        result.m_dayUnion = true;
+
+        return result;
+    }
+
+    std::optional<Recurrence> Recurrence::fromRRule( std::string_view rule, const DateTime& start ) noexcept
+    {
+        rule = trim( rule );
+        if( rule.size() >= 6 && equalsIgnoreCase( rule.substr( 0, 6 ), "RRULE:" ) )
+        {
+            rule.remove_prefix( 6 );
+        }
+
+        std::optional<Frequency> frequency;
+        std::int32_t interval{ 1 };
+        std::int32_t count{ 0 };
+        std::optional<std::int64_t> until;
+        std::int32_t weekStart{ 1 };
+        std::uint64_t seconds{}, minutes{}, hours{}, monthDays{}, lastMonthDays{}, months{};
+        std::uint8_t weekdays{};
+        std::array<std::uint16_t, 7> ordinals{};
+        bool hasOrdinals{}, hasByDay{};
+
+        while( !rule.empty() )
+        {
+            auto value{ nextToken( rule, ';' ) };
+            const auto key{ nextToken( value, '=' ) };
+
+            if( equalsIgnoreCase( key, "FREQ" ) )
+            {
+                constexpr std::array<std::string_view, 7> names{
+                    "SECONDLY", "MINUTELY", "HOURLY", "DAILY", "WEEKLY", "MONTHLY", "YEARLY" };
+                const auto index{ findName( value, names ) };
+                if( index < 0 )
+                {
+                    return std::nullopt;
+                }
+                frequency = static_cast<Frequency>( index );
+            }
+            else if( equalsIgnoreCase( key, "INTERVAL" ) )
+            {
+                if( !parseNumber( value, interval ) || interval < 1 )
+                {
+                    return std::nullopt;
+                }
+            }
+            else if( equalsIgnoreCase( key, "COUNT" ) )
+            {
+                if( !parseNumber( value, count ) || count < 1 )
+                {
+                    return std::nullopt;
+                }
+            }
+            else if( equalsIgnoreCase( key, "UNTIL" ) )
+            {
+                std::int64_t ticks{};
+                if( !parseUntil( value, ticks ) )
+                {
+                    return std::nullopt;
+                }
+                until = ticks;
+            }
+            else if( equalsIgnoreCase( key, "WKST" ) )
+            {
+                weekStart = findName( value, RRULE_DAY_NAMES );
+                if( weekStart < 0 )
+                {
+                    return std::nullopt;
+                }
+            }
+            else if( equalsIgnoreCase( key, "BYSECOND" ) )
+            {
+                if( !parseRRuleList( value, 0, 59, seconds ) )
+                {
+                    return std::nullopt;
+                }
+            }
+            else if( equalsIgnoreCase( key, "BYMINUTE" ) )
+            {
+                if( !parseRRuleList( value, 0, 59, minutes ) )
+                {
+                    return std::nullopt;
+                }
+            }
+            else if( equalsIgnoreCase( key, "BYHOUR" ) )
+            {
+                if( !parseRRuleList( value, 0, 23, hours ) )
+                {
+                    return std::nullopt;
+                }
+            }
+            else if( equalsIgnoreCase( key, "BYMONTH" ) )
+            {
+                if( !parseRRuleList( value, 1, 12, months ) )
+                {
+                    return std::nullopt;
+                }
+            }
+            else if( equalsIgnoreCase( key, "BYMONTHDAY" ) )
+            {
+                if( value.empty() )
+                {
+                    return std::nullopt;
+                }
+                while( !value.empty() )
+                {
+                    std::int32_t day{};
+                    if( !parseSignedNumber( nextToken( value, ',' ), day ) || day == 0 || day < -31 || day > 31 )
+                    {
+                        return std::nullopt;
+                    }
+                    if( day > 0 )
+                    {
+                        monthDays |= std::uint64_t{ 1 } << day;
+                    }
+                    else
+                    {
+                        lastMonthDays |= std::uint64_t{ 1 } << ( -day - 1 );
+                    }
+                }
+            }
+            else if( equalsIgnoreCase( key, "BYDAY" ) )
+            {
+                if( value.empty() )
+                {
+                    return std::nullopt;
+                }
+                while( !value.empty() )
+                {
+                    const auto item{ nextToken( value, ',' ) };
+                    if( item.size() < 2 )
+                    {
+                        return std::nullopt;
+                    }
+
+                    const auto weekday{ findName( item.substr( item.size() - 2 ), RRULE_DAY_NAMES ) };
+                    if( weekday < 0 )
+                    {
+                        return std::nullopt;
+                    }
+                    if( item.size() == 2 )
+                    {
+                        weekdays |= static_cast<std::uint8_t>( 1u << weekday );
+                    }
+                    else
+                    {
+                        std::int32_t ordinal{};
+                        if( !parseSignedNumber( item.substr( 0, item.size() - 2 ), ordinal ) || ordinal == 0 ||
+                            ordinal < -5 || ordinal > 5 )
+                        {
+                            return std::nullopt;
+                        }
+                        const auto bit{ ordinal > 0 ? ordinal - 1 : 4 - ordinal };
+                        ordinals[weekday] |= static_cast<std::uint16_t>( 1u << bit );
+                        hasOrdinals = true;
+                    }
+                }
+                hasByDay = true;
+            }
+            else
+            {
+                // BYYEARDAY, BYWEEKNO, BYSETPOS and extensions are not supported
+                return std::nullopt;
+            }
+        }
+
+        if( !frequency.has_value() || ( count != 0 && until.has_value() ) )
+        {
+            return std::nullopt;
+        }
+
+        // Ordinals count within the month; BYMONTHDAY has no meaning for weekly rules
+        const auto freq{ *frequency };
+        if( ( hasOrdinals && freq != Frequency::Monthly && ( freq != Frequency::Yearly || months == 0 ) ) ||
+            ( freq == Frequency::Weekly && ( monthDays | lastMonthDays ) != 0 ) )
+        {
+            return std::nullopt;
+        }
+
+        // Unspecified fields finer than the frequency are taken from the start time
+        const auto s{ start.components() };
+        const bool hasMonthDays{ ( monthDays | lastMonthDays ) != 0 };
+        if( seconds == 0 )
+        {
+            seconds = freq > Frequency::Secondly ? std::uint64_t{ 1 } << s.second : ( std::uint64_t{ 1 } << 60 ) - 1;
+        }
+        if( minutes == 0 )
+        {
+            minutes = freq > Frequency::Minutely ? std::uint64_t{ 1 } << s.minute : ( std::uint64_t{ 1 } << 60 ) - 1;
+        }
+        if( hours == 0 )
+        {
+            hours = freq > Frequency::Hourly ? std::uint64_t{ 1 } << s.hour : ( std::uint64_t{ 1 } << 24 ) - 1;
+        }
+        if( freq == Frequency::Weekly && !hasByDay )
+        {
+            weekdays = static_cast<std::uint8_t>( 1u << s.dayOfWeek );
+            hasByDay = true;
+        }
+        if( freq >= Frequency::Monthly && !hasByDay && !hasMonthDays )
+        {
+            monthDays = std::uint64_t{ 1 } << s.day;
+            if( freq == Frequency::Yearly && months == 0 )
+            {
+                months = std::uint64_t{ 1 } << s.month;
+            }
+        }
+
+        Recurrence result;
+        result.m_seconds = seconds;
+        result.m_minutes = minutes;
+        result.m_hours = static_cast<std::uint32_t>( hours );
+        result.m_monthDays = static_cast<std::uint32_t>( monthDays >> 1 );
+        result.m_lastMonthDays = static_cast<std::uint32_t>( lastMonthDays );
+        result.m_months = months == 0 ? std::uint16_t{ 0xFFF } : static_cast<std::uint16_t>( months >> 1 );
+        result.m_weekdays = weekdays;
+        result.m_ordinals = ordinals;
+        result.m_ordinalWeekdays = ordinalWeekdays( ordinals );
+        result.m_hasMonthDayRule = result.m_monthDays != 0 || result.m_lastMonthDays != 0;
+        result.m_hasWeekdayRule = hasByDay;
+        result.m_frequency = freq;
+        result.m_weekStart = weekStart;
+        result.m_interval = interval;
+        result.m_startTicks = start.ticks() - start.ticks() % constants::TICKS_PER_SECOND;
+
+        const auto startDay{ result.m_startTicks / constants::TICKS_PER_DAY };
+        const auto startHour{ startDay * 24 + s.hour };
+        const auto startMinute{ startHour * 60 + s.minute };
+        switch( freq )
+        {
+            case Frequency::Secondly:
+                result.m_anchor = startMinute * 60 + s.second;
+                break;
+            case Frequency::Minutely:
+                result.m_anchor = startMinute;
+                break;
+            case Frequency::Hourly:
+                result.m_anchor = startHour;
+                break;
+            case Frequency::Daily:
+                result.m_anchor = startDay;
+                break;
+            case Frequency::Weekly:
+                result.m_anchor = weekIndex( startDay, weekStart );
+                break;
+            case Frequency::Monthly:
+                result.m_anchor = static_cast<std::int64_t>( s.year ) * 12 + s.month - 1;
+                break;
+            case Frequency::Yearly:
+                result.m_anchor = s.year;
+                break;
+        }
+
+        if( until.has_value() )
+        {
+            result.m_endTicks = *until;
+        }
+        else if( count != 0 )
+        {
+            // Resolve COUNT once to the time of the last occurrence
+            std::int64_t last{ result.m_startTicks - 1 };
+            for( std::int64_t from{ result.m_startTicks }; count > 0; --count )
+            {
+                const auto found{ result.nextTicks( from ) };
+                if( found < 0 )
+                {
+                    break;
+                }
+                last = found;
+                from = found + constants::TICKS_PER_SECOND;
+            }
+            result.m_endTicks = last;
+        }
+
+        return result;
+    }
+
+    //----------------------------------------------
+    // Occurrence search
+    //----------------------------------------------
+
+    std::optional<DateTime> Recurrence::nextAfter( const DateTime& after ) const noexcept
+    {
+        const auto ticks{ after.ticks() };
+        const auto nextSecond{ ticks - ticks % constants::TICKS_PER_SECOND + constants::TICKS_PER_SECOND };
+        const auto from{ std::max( nextSecond, m_startTicks ) };
+        if( from > m_endTicks )
+        {
+            return std::nullopt;
+        }
+
+        const auto found{ nextTicks( from ) };
+        if( found < 0 || found > m_endTicks )
+        {
+            return std::nullopt;
+        }
+
+        return DateTime{ found };
+    }
+
+    std::optional<DateTimeOffset> Recurrence::nextAfter( const DateTimeOffset& after ) const noexcept
+    {
+        const auto next{ nextAfter( after.dateTime() ) };
+        if( !next.has_value() )
+        {
+            return std::nullopt;
+        }
+
+        return DateTimeOffset{ *next, after.offset() };
+    }
+
+    std::optional<DateTimeOffset> Recurrence::nextAfter(
+        const DateTimeOffset& after, const TimeZone& zone ) const noexcept
+    {
+        const auto utcAfter{ after.utcTicks() };
+        auto cursor{ DateTime{ std::clamp( utcAfter + zone.offsetAt( utcAfter ).ticks(),
+            constants::MIN_DATETIME_TICKS,
+            constants::MAX_DATETIME_TICKS ) } };
+
+        for( ;; )
+        {
+            const auto local{ nextAfter( cursor ) };
+            if( !local.has_value() )
+            {
+                return std::nullopt;
+            }
+
+            // Offsets in effect a day either side bracket any transition near the local time
+            const auto localTicks{ local->ticks() };
+            const auto dayBefore{ std::max( localTicks - constants::TICKS_PER_DAY, constants::MIN_DATETIME_TICKS ) };
+            const auto dayAfter{ std::min( localTicks + constants::TICKS_PER_DAY, constants::MAX_DATETIME_TICKS ) };
+            const auto earlyOffset{ zone.offsetAt( dayBefore ).ticks() };
+            const auto lateOffset{ zone.offsetAt( dayAfter ).ticks() };
+            const auto earlyUtc{ localTicks - earlyOffset };
+            const auto lateUtc{ localTicks - lateOffset };
+            const bool earlyValid{ zone.offsetAt( earlyUtc ).ticks() == earlyOffset };
+            const bool lateValid{ zone.offsetAt( lateUtc ).ticks() == lateOffset };
+
+            // Repeated local time: first instance; skipped local time: offset before the gap
+            const auto utc{ earlyValid && lateValid ? std::min( earlyUtc, lateUtc )
+                                                    : ( lateValid && !earlyValid ? lateUtc : earlyUtc ) };
+            if( utc > utcAfter )
+            {
+                const auto offset{ zone.offsetAt( utc ) };
+
+                return DateTimeOffset{ DateTime{ utc + offset.ticks() }, offset };
+            }
+
+            cursor = *local;
+        }
+    }
+
+    //----------------------------------------------
+    // Search
+    //----------------------------------------------
+
+    std::int64_t Recurrence::nextTicks( std::int64_t fromTicks ) const noexcept
+    {
+        if( fromTicks > constants::MAX_DATETIME_TICKS )
+        {
+            return -1;
+        }
+
+        const auto c{ DateTime{ fromTicks }.components() };
+        std::int64_t monthIndex{ static_cast<std::int64_t>( c.year ) * 12 + c.month - 1 };
+        std::int32_t day{ c.day };
+        std::int32_t hour{ c.hour };
+        std::int32_t minute{ c.minute };
+        std::int32_t second{ c.second };
+
+        std::int64_t maskMonth{ -1 };
+        std::int64_t firstDay{ 0 };
+        std::uint32_t monthDays{ 0 };
+        for( ;; )
+        {
+            // Month: next month allowed by the mask and a monthly or yearly interval
+            const auto fromMonth{ monthIndex };
+            for( ;; )
+            {
+                if( monthIndex / 12 > constants::MAX_YEAR )
+                {
+                    return -1;
+                }
+                if( m_interval > 1 && m_frequency == Frequency::Yearly )
+                {
+                    const auto year{ monthIndex / 12 };
+                    const auto aligned{ alignUp( year, m_anchor, m_interval ) };
+                    if( aligned != year )
+                    {
+                        monthIndex = aligned * 12;
+                        continue;
+                    }
+                }
+                else if( m_interval > 1 && m_frequency == Frequency::Monthly )
+                {
+                    const auto aligned{ alignUp( monthIndex, m_anchor, m_interval ) };
+                    if( aligned != monthIndex )
+                    {
+                        monthIndex = aligned;
+                        continue;
+                    }
+                }
+
+                const auto month{ static_cast<std::int32_t>( monthIndex % 12 ) };
+                if( ( m_months >> month ) & 1 )
+                {
+                    break;
+                }
+
+                const auto later{ static_cast<std::uint32_t>( m_months >> ( month + 1 ) ) };
+                monthIndex = later != 0 ? monthIndex + 1 + std::countr_zero( later )
+                                        : ( monthIndex / 12 + 1 ) * 12 + std::countr_zero( m_months );
+            }
+            if( monthIndex != fromMonth )
+            {
+                day = 1;
+                hour = minute = second = 0;
+            }
+
+            // Day within the month (the month mask is only rebuilt when the month changes)
+            if( monthIndex != maskMonth )
+            {
+                const auto year{ static_cast<std::int32_t>( monthIndex / 12 ) };
+                const auto month{ static_cast<std::int32_t>( monthIndex % 12 ) + 1 };
+                firstDay = detail::dateToTicks( year, month, 1 ) / constants::TICKS_PER_DAY;
+                monthDays = dayMask( year, month, firstDay );
+                maskMonth = monthIndex;
+            }
+            const auto days{ monthDays & ( ~0u << ( day - 1 ) ) };
+            if( days == 0 )
+            {
+                ++monthIndex;
+                day = 1;
+                hour = minute = second = 0;
+                continue;
+            }
+            if( const auto next{ std::countr_zero( days ) + 1 }; next != day )
+            {
+                day = next;
+                hour = minute = second = 0;
+            }
+
+            // Time of day, each field limited by an hourly, minutely or secondly interval
+            const auto dayNumber{ firstDay + day - 1 };
+            auto hours{ m_hours & ( ~0u << hour ) };
+            if( m_interval > 1 && m_frequency == Frequency::Hourly )
+            {
+                hours &= static_cast<std::uint32_t>( periodMask( dayNumber * 24, 24, m_anchor, m_interval ) );
+            }
+            if( hours == 0 )
+            {
+                ++day;
+                hour = minute = second = 0;
+                continue;
+            }
+            if( const auto next{ std::countr_zero( hours ) }; next != hour )
+            {
+                hour = next;
+                minute = second = 0;
+            }
+
+            const auto hourNumber{ dayNumber * 24 + hour };
+            auto minutes{ m_minutes & ( ~std::uint64_t{ 0 } << minute ) };
+            if( m_interval > 1 && m_frequency == Frequency::Minutely )
+            {
+                minutes &= periodMask( hourNumber * 60, 60, m_anchor, m_interval );
+            }
+            if( minutes == 0 )
+            {
+                ++hour;
+                minute = second = 0;
+                continue;
+            }
+            if( const auto next{ std::countr_zero( minutes ) }; next != minute )
+            {
+                minute = next;
+                second = 0;
+            }
+
+            const auto minuteNumber{ hourNumber * 60 + minute };
+            auto seconds{ m_seconds & ( ~std::uint64_t{ 0 } << second ) };
+            if( m_interval > 1 && m_frequency == Frequency::Secondly )
+            {
+                seconds &= periodMask( minuteNumber * 60, 60, m_anchor, m_interval );
+            }
+            if( seconds == 0 )
+            {
+                ++minute;
+                second = 0;
+                continue;
+            }
+
+            return ( minuteNumber * 60 + std::countr_zero( seconds ) ) * constants::TICKS_PER_SECOND;
+        }
+    }
+
+    std::uint32_t Recurrence::dayMask( std::int32_t year, std::int32_t month, std::int64_t firstDay ) const noexcept
+    {
+        const auto daysInMonth{ DateTime::daysInMonth( year, month ) };
+        const std::uint32_t all{ ( 1u << daysInMonth ) - 1 };
+        std::uint32_t result{ all };
+
+        if( m_hasMonthDayRule || m_hasWeekdayRule )
+        {
+            auto monthDays{ m_monthDays };
+            for( auto last{ m_lastMonthDays }; last != 0; last &= last - 1 )
+            {
+                const auto fromEnd{ std::countr_zero( last ) };
+                if( fromEnd < daysInMonth )
+                {
+                    monthDays |= 1u << ( daysInMonth - 1 - fromEnd );
+                }
+            }
+
+            // Weekdays repeat every seven days: rotate the mask to start on day 1, then replicate
+            const auto firstWeekday{ static_cast<std::int32_t>( ( firstDay + 1 ) % 7 ) };
+            const auto week{ ( ( m_weekdays >> firstWeekday ) | ( m_weekdays << ( 7 - firstWeekday ) ) ) & 0x7Fu };
+            auto weekdays{ static_cast<std::uint32_t>( week * EVERY_SEVENTH_DAY ) };
+            for( auto withOrdinals{ m_ordinalWeekdays }; withOrdinals != 0; withOrdinals &= withOrdinals - 1 )
+            {
+                // Zero-based day of the first such weekday and number of them in the month
+                const auto weekday{ std::countr_zero( withOrdinals ) };
+                const auto first{ ( weekday - firstWeekday + 7 ) % 7 };
+                const auto count{ ( daysInMonth - 1 - first ) / 7 + 1 };
+                for( std::uint32_t ordinals{ m_ordinals[static_cast<std::size_t>( weekday )] }; ordinals != 0;
+                     ordinals &= ordinals - 1 )
+                {
+                    const auto bit{ std::countr_zero( ordinals ) };
+                    const auto index{ bit < 5 ? bit : count - ( bit - 4 ) };
+                    if( index >= 0 && index < count )
+                    {
+                        weekdays |= 1u << ( first + 7 * index );
+                    }
+                }
+            }
+
+            if( m_hasMonthDayRule && m_hasWeekdayRule )
+            {
+                result = m_dayUnion ? ( monthDays | weekdays ) : ( monthDays & weekdays );
+            }
+            else
+            {
+                result = m_hasMonthDayRule ? monthDays : weekdays;
+            }
+        }
+
+        if( m_interval > 1 && m_frequency == Frequency::Daily )
+        {
+            result &= static_cast<std::uint32_t>( periodMask( firstDay, daysInMonth, m_anchor, m_interval ) );
+        }
+        else if( m_interval > 1 && m_frequency == Frequency::Weekly )
+        {
+            std::uint32_t weeks{};
+            for( std::int32_t i{ 0 }; i < daysInMonth; ++i )
+            {
+                if( floorMod( weekIndex( firstDay + i, m_weekStart ) - m_anchor, m_interval ) == 0 )
+                {
+                    weeks |= 1u << i;
+                }
+            }
+            result &= weeks;
+        }
+
+        return result & all;
+    }
+} // namespace nfx::time
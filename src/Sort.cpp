@@ -0,0 +1,207 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Sort.cpp
+ * @brief LSD radix sort on 64-bit temporal keys
+ * @details All three value types are 8 bytes wide and are moved as whole values; only the key
+ *          extraction differs. Histograms for every digit are built in one pass so that
+ *          degenerate digits (one bucket holding every key) can be skipped without touching
+ *          the data again.
+ */
+
+#include "nfx/datetime/Sort.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nfx::time
+{
+    namespace
+    {
+        //=====================================================================
+        // Radix sort kernel
+        //=====================================================================
+
+        /** @brief Number of bits per digit */
+        constexpr std::size_t DIGIT_BITS{ 8 };
+
+        /** @brief Number of buckets per digit */
+        constexpr std::size_t BUCKETS{ std::size_t{ 1 } << DIGIT_BITS };
+
+        /** @brief Number of digits in a 64-bit key */
+        constexpr std::size_t DIGITS{ 64 / DIGIT_BITS };
+
+        /** @brief Below this size std::sort beats the histogram setup */
+        constexpr std::size_t MIN_RADIX_SIZE{ 256 };
+
+        /** @brief Map signed ticks to unsigned keys with the same order */
+        [[nodiscard]] constexpr std::uint64_t signedKey( std::int64_t ticks ) noexcept
+        {
+            return static_cast<std::uint64_t>( ticks ) ^ ( std::uint64_t{ 1 } << 63 );
+        }
+
+        /** @brief Sort key of a DateTime */
+        [[nodiscard]] constexpr std::uint64_t sortKey( const DateTime& value ) noexcept
+        {
+            return signedKey( value.ticks() );
+        }
+
+        /** @brief Sort key of a TimeSpan */
+        [[nodiscard]] constexpr std::uint64_t sortKey( const TimeSpan& value ) noexcept
+        {
+            return signedKey( value.ticks() );
+        }
+
+        /** @brief Sort key of a PackedDateTimeOffset (already ordered as unsigned) */
+        [[nodiscard]] constexpr std::uint64_t sortKey( const PackedDateTimeOffset& value ) noexcept
+        {
+            return value.raw();
+        }
+
+        /**
+         * @brief Stable LSD radix sort of values using scratch as the ping-pong buffer
+         * @param values Values to sort (at least MIN_RADIX_SIZE elements)
+         * @param scratch Buffer of at least values.size() elements
+         */
+        template <typename T>
+        void radixSortKernel( std::span<T> values, std::span<T> scratch ) noexcept
+        {
+            const auto count{ values.size() };
+
+            std::array<std::array<std::size_t, BUCKETS>, DIGITS> histograms{};
+            for( const auto& value : values )
+            {
+                const auto key{ sortKey( value ) };
+                for( std::size_t digit{ 0 }; digit < DIGITS; ++digit )
+                {
+                    ++histograms[digit][( key >> ( digit * DIGIT_BITS ) ) & ( BUCKETS - 1 )];
+                }
+            }
+
+            T* source{ values.data() };
+            T* target{ scratch.data() };
+            for( std::size_t digit{ 0 }; digit < DIGITS; ++digit )
+            {
+                auto& histogram{ histograms[digit] };
+
+                // Every key shares this digit: the pass would be the identity
+                const auto firstKey{ sortKey( *source ) };
+                if( histogram[( firstKey >> ( digit * DIGIT_BITS ) ) & ( BUCKETS - 1 )] == count )
+                {
+                    continue;
+                }
+
+                // Exclusive prefix sum turns counts into bucket starts
+                std::size_t offset{ 0 };
+                for( auto& bucket : histogram )
+                {
+                    const auto bucketCount{ bucket };
+                    bucket = offset;
+                    offset += bucketCount;
+                }
+
+                const auto shift{ digit * DIGIT_BITS };
+                for( std::size_t i{ 0 }; i < count; ++i )
+                {
+                    const auto value{ source[i] };
+                    target[histogram[( sortKey( value ) >> shift ) & ( BUCKETS - 1 )]++] = value;
+                }
+
+                std::swap( source, target );
+            }
+
+            if( source != values.data() )
+            {
+                std::copy( source, source + count, values.data() );
+            }
+        }
+
+        /** @brief Sort with a caller-provided scratch buffer, falling back to std::sort */
+        template <typename T>
+        void radixSortWith( std::span<T> values, std::span<T> scratch ) noexcept
+        {
+            if( values.size() < MIN_RADIX_SIZE || scratch.size() < values.size() )
+            {
+                std::sort( values.begin(), values.end() );
+
+                return;
+            }
+
+            radixSortKernel( values, scratch.first( values.size() ) );
+        }
+
+        /** @brief Sort with an internally allocated scratch buffer */
+        template <typename T>
+        void radixSortAllocating( std::span<T> values )
+        {
+            if( values.size() < MIN_RADIX_SIZE )
+            {
+                std::sort( values.begin(), values.end() );
+
+                return;
+            }
+
+            std::vector<T> scratch( values.size() );
+            radixSortKernel( values, std::span<T>{ scratch } );
+        }
+    } // namespace
+
+    //=====================================================================
+    // Radix sort
+    //=====================================================================
+
+    void radixSort( std::span<DateTime> values )
+    {
+        radixSortAllocating( values );
+    }
+
+    void radixSort( std::span<TimeSpan> values )
+    {
+        radixSortAllocating( values );
+    }
+
+    void radixSort( std::span<PackedDateTimeOffset> values )
+    {
+        radixSortAllocating( values );
+    }
+
+    void radixSort( std::span<DateTime> values, std::span<DateTime> scratch ) noexcept
+    {
+        radixSortWith( values, scratch );
+    }
+
+    void radixSort( std::span<TimeSpan> values, std::span<TimeSpan> scratch ) noexcept
+    {
+        radixSortWith( values, scratch );
+    }
+
+    void radixSort( std::span<PackedDateTimeOffset> values, std::span<PackedDateTimeOffset> scratch ) noexcept
+    {
+        radixSortWith( values, scratch );
+    }
+} // namespace nfx::time
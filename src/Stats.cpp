@@ -0,0 +1,228 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Stats.cpp
+ * @brief Per-thread counter registry and aggregation behind stats()
+ */
+
+#include "nfx/datetime/Stats.h"
+
+#include <mutex>
+
+namespace nfx::time
+{
+    static_assert( static_cast<std::size_t>( DateTime::Format::UnixMilliseconds ) + 1 == detail::FORMAT_STAT_COUNT,
+        "FORMAT_STAT_COUNT must cover every DateTime::Format value" );
+
+#if defined( NFX_DATETIME_ENABLE_STATS )
+    namespace
+    {
+        //=====================================================================
+        // Counter registry
+        //=====================================================================
+
+        using Counters = std::array<std::uint64_t, detail::STAT_COUNTER_COUNT>;
+
+        /**
+         * @brief One thread's counters, on their own cache lines
+         * @details values are written only by the owning thread. resetStats() records the current
+         *          values as the baseline (under the registry mutex) instead of clearing them, so an
+         *          increment racing with a reset cannot undo it.
+         */
+        struct alignas( 64 ) CounterBlock
+        {
+            std::atomic<std::uint64_t> values[detail::STAT_COUNTER_COUNT]{};
+            Counters baseline{};
+            CounterBlock* next{ nullptr };
+            CounterBlock* previous{ nullptr };
+        };
+
+        /** @brief Live counter blocks plus the totals of threads that have exited */
+        struct Registry
+        {
+            std::mutex mutex;
+            CounterBlock* head{ nullptr };
+            Counters retired{};
+
+            /** @brief Receives counts made by thread-local destructors after a thread's block is gone */
+            CounterBlock discarded;
+        };
+
+        Registry& registry() noexcept
+        {
+            // Never destroyed: threads may still exit (and fold their counts) during static destruction
+            static Registry* const instance{ new Registry{} };
+
+            return *instance;
+        }
+
+        /** @brief Thread-owned block, linked into the registry for the lifetime of the thread */
+        class ThreadCounters
+        {
+        public:
+            ThreadCounters() noexcept
+            {
+                auto& reg{ registry() };
+                const std::lock_guard lock{ reg.mutex };
+
+                m_block.next = reg.head;
+                if( reg.head != nullptr )
+                {
+                    reg.head->previous = &m_block;
+                }
+                reg.head = &m_block;
+            }
+
+            ~ThreadCounters()
+            {
+                auto& reg{ registry() };
+                const std::lock_guard lock{ reg.mutex };
+
+                for( std::size_t i{ 0 }; i < detail::STAT_COUNTER_COUNT; ++i )
+                {
+                    reg.retired[i] += m_block.values[i].load( std::memory_order_relaxed ) - m_block.baseline[i];
+                }
+
+                if( m_block.previous != nullptr )
+                {
+                    m_block.previous->next = m_block.next;
+                }
+                else
+                {
+                    reg.head = m_block.next;
+                }
+                if( m_block.next != nullptr )
+                {
+                    m_block.next->previous = m_block.previous;
+                }
+
+                detail::t_statCounters = reg.discarded.values;
+            }
+
+            ThreadCounters( const ThreadCounters& ) = delete;
+            ThreadCounters& operator=( const ThreadCounters& ) = delete;
+
+            std::atomic<std::uint64_t>* values() noexcept
+            {
+                return m_block.values;
+            }
+
+        private:
+            CounterBlock m_block;
+        };
+
+        /** @brief Sum the retired totals and every live block since its baseline */
+        Counters collect() noexcept
+        {
+            auto& reg{ registry() };
+            const std::lock_guard lock{ reg.mutex };
+
+            Counters totals{ reg.retired };
+            for( const CounterBlock* block{ reg.head }; block != nullptr; block = block->next )
+            {
+                for( std::size_t i{ 0 }; i < detail::STAT_COUNTER_COUNT; ++i )
+                {
+                    totals[i] += block->values[i].load( std::memory_order_relaxed ) - block->baseline[i];
+                }
+            }
+
+            return totals;
+        }
+    } // namespace
+
+    namespace detail
+    {
+        std::atomic<std::uint64_t>* threadStatCounters() noexcept
+        {
+            thread_local ThreadCounters counters;
+
+            return counters.values();
+        }
+    } // namespace detail
+
+    //=====================================================================
+    // Instrumentation snapshot
+    //=====================================================================
+
+    Stats stats() noexcept
+    {
+        const Counters counters{ collect() };
+        const auto at{ [&counters]( detail::StatCounter counter ) noexcept {
+            return counters[static_cast<std::size_t>( counter )];
+        } };
+
+        Stats result;
+        result.dateTime = { at( detail::StatCounter::DateTimeFastPath ),
+            at( detail::StatCounter::DateTimeFallback ),
+            at( detail::StatCounter::DateTimeFailure ) };
+        result.dateTimeOffset = { at( detail::StatCounter::DateTimeOffsetFastPath ),
+            at( detail::StatCounter::DateTimeOffsetFallback ),
+            at( detail::StatCounter::DateTimeOffsetFailure ) };
+        result.timeSpan = { at( detail::StatCounter::TimeSpanFastPath ),
+            at( detail::StatCounter::TimeSpanFallback ),
+            at( detail::StatCounter::TimeSpanFailure ) };
+        result.timezoneCacheHits = at( detail::StatCounter::TimezoneCacheHit );
+        result.timezoneCacheMisses = at( detail::StatCounter::TimezoneCacheMiss );
+        result.timezoneLibraryCalls = at( detail::StatCounter::TimezoneLibraryCall );
+        result.timeSpanFormatCalls = at( detail::StatCounter::TimeSpanFormat );
+
+        for( std::size_t i{ 0 }; i < detail::FORMAT_STAT_COUNT; ++i )
+        {
+            result.formatCalls[i] = counters[static_cast<std::size_t>( detail::StatCounter::Format ) + i];
+        }
+
+        return result;
+    }
+
+    void resetStats() noexcept
+    {
+        auto& reg{ registry() };
+        const std::lock_guard lock{ reg.mutex };
+
+        reg.retired.fill( 0 );
+        for( CounterBlock* block{ reg.head }; block != nullptr; block = block->next )
+        {
+            // Live blocks belong to their threads: move the baseline rather than writing the counters
+            for( std::size_t i{ 0 }; i < detail::STAT_COUNTER_COUNT; ++i )
+            {
+                block->baseline[i] = block->values[i].load( std::memory_order_relaxed );
+            }
+        }
+    }
+#else
+    //=====================================================================
+    // Instrumentation snapshot
+    //=====================================================================
+
+    Stats stats() noexcept
+    {
+        return Stats{};
+    }
+
+    void resetStats() noexcept
+    {
+    }
+#endif
+} // namespace nfx::time
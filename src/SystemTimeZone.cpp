@@ -0,0 +1,258 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file SystemTimeZone.cpp
+ * @brief System (process-local) time zone offset resolution
+ * @details Builds, once per process, a sorted table of the system zone's UTC offset
+ *          transitions and resolves offsets by binary search on UTC ticks. Instants outside
+ *          the table range fall back to the C library through a per-thread cache.
+ */
+
+#include "Internal.h"
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+/** @brief First year covered by the system time zone transition table */
+#ifndef NFX_DATETIME_TZ_TABLE_FIRST_YEAR
+#    define NFX_DATETIME_TZ_TABLE_FIRST_YEAR 1970
+#endif
+
+/** @brief Last year covered by the system time zone transition table */
+#ifndef NFX_DATETIME_TZ_TABLE_LAST_YEAR
+#    define NFX_DATETIME_TZ_TABLE_LAST_YEAR 2100
+#endif
+
+namespace nfx::time::internal
+{
+    //=====================================================================
+    // C library offset computation
+    //=====================================================================
+
+    std::int64_t computeSystemOffsetSeconds( std::int64_t unixSeconds ) noexcept
+    {
+        const auto systemTimeT{ static_cast<std::time_t>( unixSeconds ) };
+
+        std::tm utcTm{};
+        std::tm localTm{};
+
+        const bool utcSuccess = NFX_DATETIME_GMTIME_R( &systemTimeT, &utcTm );
+        const bool localSuccess = NFX_DATETIME_LOCALTIME_R( &systemTimeT, &localTm );
+
+        if( !utcSuccess || !localSuccess )
+        {
+            return 0; // Fallback to UTC
+        }
+
+        const auto utcSeconds{ utcTm.tm_hour * constants::SECONDS_PER_HOUR +
+                               utcTm.tm_min * constants::SECONDS_PER_MINUTE + utcTm.tm_sec };
+        const auto localSeconds{ localTm.tm_hour * constants::SECONDS_PER_HOUR +
+                                 localTm.tm_min * constants::SECONDS_PER_MINUTE + localTm.tm_sec };
+
+        std::int64_t offsetSeconds{ localSeconds - utcSeconds };
+
+        // Handle day boundary crossing (compare full dates so month and year ends are handled)
+        const auto utcDate{ utcTm.tm_year * 1000 + utcTm.tm_yday };
+        const auto localDate{ localTm.tm_year * 1000 + localTm.tm_yday };
+        if( localDate > utcDate )
+        {
+            offsetSeconds += constants::SECONDS_PER_DAY;
+        }
+        else if( localDate < utcDate )
+        {
+            offsetSeconds -= constants::SECONDS_PER_DAY;
+        }
+
+        return offsetSeconds;
+    }
+
+    //=====================================================================
+    // Transition table
+    //=====================================================================
+
+    namespace
+    {
+        /**
+         * @brief Immutable table of the system zone's UTC offset transitions
+         * @details Built once by sampling the C library every week of the covered range and
+         *          bisecting each change down to the second. Two changes less than a week apart
+         *          that cancel out are not detected; no zone in the IANA database has such
+         *          transitions.
+         *          The table reflects the time zone configured when it was built.
+         */
+        class SystemTimezoneTable
+        {
+        public:
+            SystemTimezoneTable( std::int32_t firstYear, std::int32_t lastYear ) noexcept
+                : m_firstTicks{ DateTime{ firstYear, 1, 1 }.ticks() },
+                  m_endTicks{ DateTime{ lastYear, 12, 31 }.ticks() + constants::TICKS_PER_DAY }
+            {
+                try
+                {
+                    build();
+                }
+                catch( const std::bad_alloc& )
+                {
+                    // Leave the table empty: every lookup falls back to the C library
+                    m_transitionTicks.clear();
+                    m_offsetSeconds.clear();
+                }
+            }
+
+            /**
+             * @brief Look up the offset in effect at a UTC instant
+             * @param ticks UTC ticks of the instant
+             * @param offsetSeconds Receives the offset in seconds
+             * @param validFrom Receives the first tick at which the offset applies
+             * @param validUntil Receives the tick at which the next offset takes over
+             * @return true if the instant is covered by the table
+             */
+            [[nodiscard]] bool tryOffset( std::int64_t ticks,
+                std::int64_t& offsetSeconds,
+                std::int64_t& validFrom,
+                std::int64_t& validUntil ) const noexcept
+            {
+                if( ticks < m_firstTicks || ticks >= m_endTicks || m_offsetSeconds.empty() )
+                {
+                    return false;
+                }
+
+                // Branch-free upper bound: m_offsetSeconds[i] applies from m_transitionTicks[i - 1] onwards
+                const std::size_t count{ m_transitionTicks.size() };
+                std::size_t index{ 0 };
+                if( count != 0 )
+                {
+                    const std::int64_t* base{ m_transitionTicks.data() };
+                    std::size_t remaining{ count };
+                    while( remaining > 1 )
+                    {
+                        const auto half{ remaining / 2 };
+                        base = ( base[half] <= ticks ) ? base + half : base;
+                        remaining -= half;
+                    }
+                    index = static_cast<std::size_t>( base - m_transitionTicks.data() ) + ( *base <= ticks );
+                }
+
+                offsetSeconds = m_offsetSeconds[index];
+                validFrom = index == 0 ? m_firstTicks : m_transitionTicks[index - 1];
+                validUntil = index == count ? m_endTicks : m_transitionTicks[index];
+
+                return true;
+            }
+
+        private:
+            /** @brief Interval between C library samples */
+            static constexpr std::int64_t SAMPLE_STEP_SECONDS{ 7 * constants::SECONDS_PER_DAY };
+
+            std::int64_t m_firstTicks;                   ///< First covered UTC tick
+            std::int64_t m_endTicks;                     ///< One past the last covered UTC tick
+            std::vector<std::int64_t> m_transitionTicks; ///< Ascending UTC ticks at which the offset changes
+            std::vector<std::int64_t> m_offsetSeconds;   ///< Offset before the first and after each transition
+
+            /** @brief Convert Unix seconds to DateTime ticks */
+            static constexpr std::int64_t ticksFromUnixSeconds( std::int64_t unixSeconds ) noexcept
+            {
+                return constants::UNIX_EPOCH_TICKS + unixSeconds * constants::TICKS_PER_SECOND;
+            }
+
+            /** @brief Sample the C library over the covered range and record every offset change */
+            void build()
+            {
+                const auto firstSeconds{ DateTime{ m_firstTicks }.toEpochSeconds() };
+                const auto endSeconds{ DateTime{ m_endTicks }.toEpochSeconds() };
+
+                auto previousOffset{ computeSystemOffsetSeconds( firstSeconds ) };
+                m_offsetSeconds.push_back( previousOffset );
+
+                for( auto low{ firstSeconds }; low < endSeconds; low += SAMPLE_STEP_SECONDS )
+                {
+                    const auto high{ std::min( low + SAMPLE_STEP_SECONDS, endSeconds ) };
+                    const auto highOffset{ computeSystemOffsetSeconds( high ) };
+
+                    // Bisect (low, high] until the sample at high is reached; more than one
+                    // change inside a step is recorded in order
+                    auto searchLow{ low };
+                    while( previousOffset != highOffset )
+                    {
+                        auto first{ searchLow + 1 };
+                        auto last{ high };
+                        while( first < last )
+                        {
+                            const auto mid{ first + ( last - first ) / 2 };
+                            if( computeSystemOffsetSeconds( mid ) != previousOffset )
+                            {
+                                last = mid;
+                            }
+                            else
+                            {
+                                first = mid + 1;
+                            }
+                        }
+
+                        previousOffset = computeSystemOffsetSeconds( first );
+                        m_transitionTicks.push_back( ticksFromUnixSeconds( first ) );
+                        m_offsetSeconds.push_back( previousOffset );
+                        searchLow = first;
+                    }
+                }
+            }
+        };
+
+        /** @brief Process-wide transition table, built on first use */
+        const SystemTimezoneTable& systemTimezoneTable() noexcept
+        {
+            static const SystemTimezoneTable table{ NFX_DATETIME_TZ_TABLE_FIRST_YEAR,
+                NFX_DATETIME_TZ_TABLE_LAST_YEAR };
+
+            return table;
+        }
+    } // namespace
+
+    //=====================================================================
+    // Offset lookup
+    //=====================================================================
+
+    TimeSpan systemTimezoneOffset( const DateTime& dateTime ) noexcept
+    {
+        thread_local TimeZoneOffsetCache cache;
+
+        return cache.offset( dateTime, []( const DateTime& value, std::int64_t& offsetSeconds ) noexcept {
+            std::int64_t validFrom, validUntil;
+            if( systemTimezoneTable().tryOffset( value.ticks(), offsetSeconds, validFrom, validUntil ) )
+            {
+                // Only cache when no transition falls inside the 15-minute slot
+                const auto slotStart{ value.ticks() - value.ticks() % TimeZoneOffsetCache::TICKS_PER_SLOT };
+
+                return validFrom <= slotStart && slotStart + TimeZoneOffsetCache::TICKS_PER_SLOT <= validUntil;
+            }
+
+            NFX_DATETIME_COUNT_STAT( detail::StatCounter::TimezoneLibraryCall );
+            offsetSeconds = computeSystemOffsetSeconds( value.toEpochSeconds() );
+
+            return true;
+        } );
+    }
+} // namespace nfx::time::internal
@@ -31,16 +31,18 @@
  */
 
 #include "nfx/datetime/TimeSpan.h"
+#include "Internal.h"
 
-#include <nfx/string/StringBuilder.h>
-
+#include <algorithm>
 #include <charconv>
+#include <istream>
+#include <limits>
 #include <string>
 
 namespace nfx::time
 {
     //=====================================================================
-    // Fast parsing helpers
+    // Parsing helpers
     //=====================================================================
 
     namespace
@@ -50,174 +52,6 @@ namespace nfx::time
         {
             return c >= '0' && c <= '9';
         }
-
-        /** @brief Parse integer from string view using fast digit parsing */
-        [[nodiscard]] bool fastParseInt( std::string_view str, double& value ) noexcept
-        {
-            if( str.empty() )
-            {
-                return false;
-            }
-
-            value = 0;
-            for( char c : str )
-            {
-                if( !isDigit( c ) )
-                {
-                    return false;
-                }
-                value = value * 10 + ( c - '0' );
-            }
-            return true;
-        }
-
-        /** @brief Parse fractional seconds (e.g., "45.5S" -> 45.5) */
-        [[nodiscard]] bool fastParseDecimal( std::string_view str, double& value ) noexcept
-        {
-            if( str.empty() )
-            {
-                return false;
-            }
-
-            auto dotPos = str.find( '.' );
-            if( dotPos == std::string_view::npos )
-            {
-                // No decimal point - parse as integer
-                return fastParseInt( str, value );
-            }
-
-            // Parse integer part
-            double intPart = 0;
-            if( dotPos > 0 && !fastParseInt( str.substr( 0, dotPos ), intPart ) )
-            {
-                return false;
-            }
-
-            // Parse fractional part
-            double fracPart = 0;
-            if( dotPos + 1 < str.length() )
-            {
-                auto fracStr = str.substr( dotPos + 1 );
-                if( !fastParseInt( fracStr, fracPart ) )
-                {
-                    return false;
-                }
-
-                // Convert to fraction (e.g., "5" from "45.5" -> 0.5)
-                double divisor = 1;
-                for( std::size_t i = 0; i < fracStr.length(); ++i )
-                {
-                    divisor *= 10;
-                }
-                fracPart /= divisor;
-            }
-
-            value = intPart + fracPart;
-            return true;
-        }
-
-        /**
-         * @brief Fast-path parser for common ISO 8601 duration formats
-         * @details Handles optimized parsing for:
-         *          - PT1H, PT2H30M, PT45S (simple integer components)
-         *          - PT1H30M45S (all components)
-         *          - PT45.5S (fractional seconds)
-         * @return true if parsed successfully via fast path, false if fallback needed
-         */
-        [[nodiscard]] bool tryParseFastPathDuration( std::string_view str, TimeSpan& result ) noexcept
-        {
-            if( str.length() < 3 ) // Minimum: "PT1H"
-            {
-                return false;
-            }
-
-            // Handle negative durations
-            bool isNegative = false;
-            if( str[0] == '-' )
-            {
-                isNegative = true;
-                str.remove_prefix( 1 );
-                if( str.length() < 3 )
-                {
-                    return false;
-                }
-            }
-
-            // Must start with 'P'
-            if( str[0] != 'P' )
-            {
-                return false;
-            }
-
-            // Check for time part indicator 'T'
-            if( str.length() < 3 || str[1] != 'T' )
-            {
-                return false; // Fallback for date components (P1D) or complex formats
-            }
-
-            // Parse time components: PT[n]H[n]M[n]S
-            str.remove_prefix( 2 ); // Skip "PT"
-
-            double totalSeconds = 0;
-            bool foundComponent = false;
-
-            // Parse hours (if present)
-            auto hPos = str.find( 'H' );
-            if( hPos != std::string_view::npos )
-            {
-                double hours = 0;
-                if( !fastParseDecimal( str.substr( 0, hPos ), hours ) )
-                {
-                    return false;
-                }
-                totalSeconds += hours * constants::SECONDS_PER_HOUR;
-                str.remove_prefix( hPos + 1 );
-                foundComponent = true;
-            }
-
-            // Parse minutes (if present)
-            auto mPos = str.find( 'M' );
-            if( mPos != std::string_view::npos )
-            {
-                double minutes = 0;
-                if( !fastParseDecimal( str.substr( 0, mPos ), minutes ) )
-                {
-                    return false;
-                }
-                totalSeconds += minutes * constants::SECONDS_PER_MINUTE;
-                str.remove_prefix( mPos + 1 );
-                foundComponent = true;
-            }
-
-            // Parse seconds (if present)
-            auto sPos = str.find( 'S' );
-            if( sPos != std::string_view::npos )
-            {
-                double seconds = 0;
-                if( !fastParseDecimal( str.substr( 0, sPos ), seconds ) )
-                {
-                    return false;
-                }
-                totalSeconds += seconds;
-                str.remove_prefix( sPos + 1 );
-                foundComponent = true;
-            }
-
-            // Must have at least one component and consumed entire string
-            if( !foundComponent || !str.empty() )
-            {
-                return false;
-            }
-
-            // Apply negative sign
-            if( isNegative )
-            {
-                totalSeconds = -totalSeconds;
-            }
-
-            result = TimeSpan::fromSeconds( totalSeconds );
-            return true;
-        }
     } // namespace
 
     //=====================================================================
@@ -225,104 +59,34 @@ namespace nfx::time
     //=====================================================================
 
     //----------------------------------------------
-    // String formatting
+    // String parsing
     //----------------------------------------------
 
-    std::string TimeSpan::toString() const
+    bool TimeSpan::fromString( std::string_view iso8601DurationString, TimeSpan& result ) noexcept
     {
-        nfx::string::StringBuilder sb( 64 );
-
-        // Handle negative durations
-        bool isNegative{ m_ticks < 0 };
-        if( isNegative )
+        if( iso8601DurationString.empty() )
         {
-            sb.append( '-' );
-        }
-
-        sb.append( 'P' );
-
-        std::int64_t absTicks{ std::abs( m_ticks ) };
-        std::int64_t totalSeconds{ absTicks / constants::TICKS_PER_SECOND };
-
-        // Break down into days, hours, minutes, seconds
-        std::int32_t days{ static_cast<std::int32_t>( totalSeconds / constants::SECONDS_PER_DAY ) };
-        std::int32_t remainingSeconds{ static_cast<std::int32_t>( totalSeconds % constants::SECONDS_PER_DAY ) };
-        std::int32_t hours{ remainingSeconds / constants::SECONDS_PER_HOUR };
-        std::int32_t minutes{ ( remainingSeconds % constants::SECONDS_PER_HOUR ) / constants::SECONDS_PER_MINUTE };
-        std::int32_t seconds{ remainingSeconds % constants::SECONDS_PER_MINUTE };
+            NFX_DATETIME_COUNT_STAT( detail::StatCounter::TimeSpanFailure );
 
-        // Output days if present
-        if( days > 0 )
-        {
-            sb.append( days ).append( 'D' );
+            return false;
         }
 
-        // Check if we have any time components
-        std::int64_t fractionalTicks{ absTicks % constants::TICKS_PER_SECOND };
-        bool hasTimeComponent{ hours > 0 || minutes > 0 || seconds > 0 || fractionalTicks > 0 };
-
-        // Only output time component if present
-        if( hasTimeComponent )
+        // ISO 8601 durations ([-]P...) are handled entirely by the single-pass parser
+        const bool isDuration{ iso8601DurationString[0] == 'P' ||
+                               ( iso8601DurationString[0] == '-' && iso8601DurationString.size() > 1 &&
+                                   iso8601DurationString[1] == 'P' ) };
+        if( isDuration )
         {
-            sb.append( 'T' );
-
-            if( hours > 0 )
-            {
-                sb.append( hours ).append( 'H' );
-            }
-
-            if( minutes > 0 )
+            std::int64_t ticks{ 0 };
+            if( !detail::parseIso8601Duration( iso8601DurationString, ticks ) )
             {
-                sb.append( minutes ).append( 'M' );
-            }
+                NFX_DATETIME_COUNT_STAT( detail::StatCounter::TimeSpanFailure );
 
-            // Include seconds with or without fractional part
-            if( seconds > 0 || fractionalTicks > 0 )
-            {
-                if( fractionalTicks > 0 )
-                {
-                    // Format fractional seconds directly to avoid allocations
-                    char fracBuffer[8];
-                    std::snprintf(
-                        fracBuffer, sizeof( fracBuffer ), "%07lld", static_cast<long long>( fractionalTicks ) );
-
-                    // Strip trailing zeros
-                    std::size_t fracLen{ 7 };
-                    while( fracLen > 1 && fracBuffer[fracLen - 1] == '0' )
-                    {
-                        --fracLen;
-                    }
-
-                    sb.append( seconds ).append( '.' ).append( std::string_view{ fracBuffer, fracLen } ).append( 'S' );
-                }
-                else
-                {
-                    sb.append( seconds ).append( 'S' );
-                }
+                return false;
             }
-        }
-        else if( days == 0 )
-        {
-            // No days and no time components: output PT0S for zero duration
-            sb.append( "T0S" );
-        }
-        return sb.toString();
-    }
+            NFX_DATETIME_COUNT_STAT( detail::StatCounter::TimeSpanFastPath );
+            result = TimeSpan{ ticks };
 
-    //----------------------------------------------
-    // String parsing
-    //----------------------------------------------
-
-    bool TimeSpan::fromString( std::string_view iso8601DurationString, TimeSpan& result ) noexcept
-    {
-        if( iso8601DurationString.empty() )
-        {
-            return false;
-        }
-
-        // Try fast-path for common ISO 8601 duration formats (PT1H30M, PT45S, etc.)
-        if( tryParseFastPathDuration( iso8601DurationString, result ) )
-        {
             return true;
         }
 
@@ -341,206 +105,110 @@ namespace nfx::time
             if( ec == std::errc{} && ptr == iso8601DurationString.data() + iso8601DurationString.size() )
 #endif
             {
+                NFX_DATETIME_COUNT_STAT( detail::StatCounter::TimeSpanFallback );
                 result = TimeSpan::fromSeconds( seconds );
                 return true;
             }
-            return false;
         }
+        NFX_DATETIME_COUNT_STAT( detail::StatCounter::TimeSpanFailure );
 
-        // Check for negative sign
-        bool isNegative{ false };
-        std::string_view parseStr{ iso8601DurationString };
-        if( !parseStr.empty() && parseStr[0] == '-' )
+        return false;
+    }
+
+    std::optional<TimeSpan> TimeSpan::fromString( std::string_view iso8601DurationString ) noexcept
+    {
+        TimeSpan result;
+        if( fromString( iso8601DurationString, result ) )
         {
-            isNegative = true;
-            parseStr = parseStr.substr( 1 );
+            return result;
         }
+        return std::nullopt;
+    }
 
-        if( parseStr.length() > 1 && parseStr[0] == 'P' )
+    const char* TimeSpan::parsePrefix( const char* first, const char* last, TimeSpan& result ) noexcept
+    {
+        const char* p{ first };
+        if( p != last && *p == '-' )
         {
-            double days{ 0.0 };
-            double totalSeconds{ 0.0 };
-            bool foundComponent{ false };
-
-            // Parse days component (P[n]D)
-            auto tPos{ parseStr.find( 'T' ) };
+            ++p;
+        }
 
-            // Parse date part (before T, or entire string if no T)
-            auto datePart{ tPos != std::string_view::npos ? parseStr.substr( 1, tPos - 1 ) : parseStr.substr( 1 ) };
-            if( !datePart.empty() )
+        if( p != last && *p == 'P' )
+        {
+            // Duration: consume the designator alphabet, then back off to each designator
+            // letter until a prefix parses ("PT1H30Mx" -> "PT1H30M", "P1DT" -> "P1D")
+            constexpr std::string_view DESIGNATORS{ "YMWDHS" };
+            ++p;
+            while( p != last && ( isDigit( *p ) || *p == '.' || *p == ',' || *p == 'T' ||
+                                    DESIGNATORS.find( *p ) != DESIGNATORS.npos ) )
             {
-                auto dPos{ datePart.find( 'D' ) };
-                if( dPos != std::string_view::npos )
-                {
-                    auto dayStr{ datePart.substr( 0, dPos ) };
-#ifdef __EMSCRIPTEN__
-                    char* end;
-                    days = std::strtod( dayStr.data(), &end );
-                    if( end == dayStr.data() + dayStr.size() )
-#else
-                    auto [ptr, ec] = std::from_chars( dayStr.data(), dayStr.data() + dayStr.size(), days );
-                    if( ec == std::errc{} && ptr == dayStr.data() + dayStr.size() )
-#endif
-                    {
-                        foundComponent = true;
-                    }
-                    else
-                    {
-                        return false;
-                    }
-                }
+                ++p;
             }
 
-            // Parse time part after T (if present)
-            if( tPos != std::string_view::npos )
+            for( ; p - first > 1; --p )
             {
-                auto timePart{ parseStr.substr( tPos + 1 ) };
-                auto originalTimePart{ timePart }; // Keep original for position tracking
-
-                // Must have at least one component after T (not just "PT")
-                if( timePart.empty() )
-                {
-                    return false;
-                }
-
-                // Find all component positions in the original string for order validation
-                auto hPos{ originalTimePart.find( 'H' ) };
-                auto mPos{ originalTimePart.find( 'M' ) };
-                auto sPos{ originalTimePart.find( 'S' ) };
-
-                // Detect duplicate components
-                if( hPos != std::string_view::npos && originalTimePart.find( 'H', hPos + 1 ) != std::string_view::npos )
-                {
-                    return false; // Duplicate hours
-                }
-                if( mPos != std::string_view::npos && originalTimePart.find( 'M', mPos + 1 ) != std::string_view::npos )
-                {
-                    return false; // Duplicate minutes
-                }
-                if( sPos != std::string_view::npos && originalTimePart.find( 'S', sPos + 1 ) != std::string_view::npos )
-                {
-                    return false; // Duplicate seconds
-                }
-
-                // Validate component order (H before M before S)
-                if( hPos != std::string_view::npos && mPos != std::string_view::npos && hPos > mPos )
+                if( DESIGNATORS.find( p[-1] ) != DESIGNATORS.npos &&
+                    fromString( std::string_view{ first, p }, result ) )
                 {
-                    return false; // Minutes before hours
-                }
-                if( hPos != std::string_view::npos && sPos != std::string_view::npos && hPos > sPos )
-                {
-                    return false; // Seconds before hours
-                }
-                if( mPos != std::string_view::npos && sPos != std::string_view::npos && mPos > sPos )
-                {
-                    return false; // Seconds before minutes
-                }
-
-                // Parse hours
-                if( hPos != std::string_view::npos )
-                {
-                    auto hourStr{ timePart.substr( 0, hPos ) };
-                    double hours{};
-#ifdef __EMSCRIPTEN__
-                    char* end;
-                    hours = std::strtod( hourStr.data(), &end );
-                    if( end == hourStr.data() + hourStr.size() )
-#else
-                    auto [ptr, ec] = std::from_chars( hourStr.data(), hourStr.data() + hourStr.size(), hours );
-                    if( ec == std::errc{} && ptr == hourStr.data() + hourStr.size() )
-#endif
-                    {
-                        totalSeconds += hours * static_cast<double>( constants::SECONDS_PER_HOUR );
-                        timePart = timePart.substr( hPos + 1 );
-                        foundComponent = true;
-                    }
-                    else
-                    {
-                        return false;
-                    }
+                    return p;
                 }
+            }
 
-                // Parse minutes (recalculate position in current timePart)
-                mPos = timePart.find( 'M' );
-                if( mPos != std::string::npos )
-                {
-                    auto minuteStr{ timePart.substr( 0, mPos ) };
-                    double minutes{};
-#ifdef __EMSCRIPTEN__
-                    char* end;
-                    minutes = std::strtod( minuteStr.data(), &end );
-                    if( end == minuteStr.data() + minuteStr.size() )
-#else
-                    auto [ptr, ec] = std::from_chars( minuteStr.data(), minuteStr.data() + minuteStr.size(), minutes );
-                    if( ec == std::errc{} && ptr == minuteStr.data() + minuteStr.size() )
-#endif
-                    {
-                        totalSeconds += minutes * static_cast<double>( constants::SECONDS_PER_MINUTE );
-                        timePart = timePart.substr( mPos + 1 );
-                        foundComponent = true;
-                    }
-                    else
-                    {
-                        return false;
-                    }
-                }
+            return first;
+        }
 
-                // Parse seconds (recalculate position in current timePart)
-                sPos = timePart.find( 'S' );
-                if( sPos != std::string::npos )
-                {
-                    auto secondStr{ timePart.substr( 0, sPos ) };
-                    double seconds{};
-#ifdef __EMSCRIPTEN__
-                    char* end;
-                    seconds = std::strtod( secondStr.data(), &end );
-                    if( end == secondStr.data() + secondStr.size() )
-#else
-                    auto [ptr, ec] = std::from_chars( secondStr.data(), secondStr.data() + secondStr.size(), seconds );
-                    if( ec == std::errc{} && ptr == secondStr.data() + secondStr.size() )
-#endif
-                    {
-                        totalSeconds += seconds;
-                        foundComponent = true;
-                    }
-                    else
-                    {
-                        return false;
-                    }
-                }
-            }
+        // Numeric seconds: [-]digits[.digits], backing off to the integer part
+        const char* integerEnd{ p };
+        while( integerEnd != last && isDigit( *integerEnd ) )
+        {
+            ++integerEnd;
+        }
 
-            // Must have parsed at least one valid component (D, H, M, or S)
-            if( !foundComponent )
+        const char* fractionEnd{ integerEnd };
+        if( fractionEnd != last && *fractionEnd == '.' )
+        {
+            ++fractionEnd;
+            while( fractionEnd != last && isDigit( *fractionEnd ) )
             {
-                return false;
+                ++fractionEnd;
             }
+        }
 
-            // Convert days to seconds
-            totalSeconds += days * static_cast<double>( constants::SECONDS_PER_DAY );
-
-            // Apply negative sign if present
-            if( isNegative )
+        for( const char* end : { fractionEnd, integerEnd } )
+        {
+            if( end != p && fromString( std::string_view{ first, end }, result ) )
             {
-                totalSeconds = -totalSeconds;
+                return end;
             }
-
-            result = TimeSpan::fromSeconds( totalSeconds );
-
-            return true;
         }
 
-        return false;
+        return first;
     }
 
-    std::optional<TimeSpan> TimeSpan::fromString( std::string_view iso8601DurationString ) noexcept
+    std::size_t TimeSpan::parseMany(
+        std::span<const std::string_view> inputs, std::span<TimeSpan> results, std::span<std::uint8_t> ok ) noexcept
     {
-        TimeSpan result;
-        if( fromString( iso8601DurationString, result ) )
+        const std::size_t count{ std::min( { inputs.size(), results.size(), ok.size() } ) };
+        std::size_t parsed{ 0 };
+
+        for( std::size_t i{ 0 }; i < count; ++i )
         {
-            return result;
+            const std::string_view str{ inputs[i] };
+
+            // Durations have no fixed-width layout; fromString() is already a single pass
+            if( fromString( str, results[i] ) )
+            {
+                ok[i] = 1;
+                ++parsed;
+            }
+            else
+            {
+                results[i] = TimeSpan{};
+                ok[i] = 0;
+            }
         }
-        return std::nullopt;
+
+        return parsed;
     }
 
     //----------------------------------------------
@@ -574,18 +242,11 @@ namespace nfx::time
     // Stream operators
     //=====================================================================
 
-    std::ostream& operator<<( std::ostream& os, const TimeSpan& timeSpan )
-    {
-        os << timeSpan.toString();
-
-        return os;
-    }
-
     std::istream& operator>>( std::istream& is, TimeSpan& timeSpan )
     {
-        std::string str;
-        is >> str;
-        if( !TimeSpan::fromString( str, timeSpan ) )
+        char buffer[internal::MAX_STREAM_TOKEN_LENGTH];
+        const auto length{ internal::readStreamToken( is, buffer ) };
+        if( length != 0 && !TimeSpan::fromString( std::string_view{ buffer, length }, timeSpan ) )
         {
             is.setstate( std::ios::failbit );
         }
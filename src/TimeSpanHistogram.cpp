@@ -0,0 +1,238 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimeSpanHistogram.cpp
+ * @brief Percentile queries, merging and shard management for the TimeSpan histograms
+ */
+
+#include "nfx/datetime/TimeSpanHistogram.h"
+
+#include <cmath>
+#include <new>
+
+namespace nfx::time
+{
+    namespace
+    {
+        /** @brief Source of ConcurrentTimeSpanHistogram identifiers (0 marks an empty cache slot) */
+        std::atomic<std::uint64_t> g_nextHistogramId{ 1 };
+    } // namespace
+
+    //=====================================================================
+    // TimeSpanHistogram class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Recording
+    //----------------------------------------------
+
+    void TimeSpanHistogram::merge( const TimeSpanHistogram& other ) noexcept
+    {
+        for( std::size_t i{ 0 }; i < BUCKET_COUNT; ++i )
+        {
+            m_buckets[i] += other.m_buckets[i];
+        }
+
+        m_count += other.m_count;
+        m_sum += other.m_sum;
+        m_min = std::min( m_min, other.m_min );
+        m_max = std::max( m_max, other.m_max );
+    }
+
+    void TimeSpanHistogram::reset() noexcept
+    {
+        *this = TimeSpanHistogram{};
+    }
+
+    //----------------------------------------------
+    // Queries
+    //----------------------------------------------
+
+    TimeSpan TimeSpanHistogram::mean() const noexcept
+    {
+        if( m_count == 0 )
+        {
+            return TimeSpan{};
+        }
+
+        return TimeSpan{ static_cast<std::int64_t>( std::llround( m_sum / static_cast<double>( m_count ) ) ) };
+    }
+
+    TimeSpan TimeSpanHistogram::percentile( double percentile ) const noexcept
+    {
+        if( m_count == 0 )
+        {
+            return TimeSpan{};
+        }
+        if( !( percentile > 0.0 ) )
+        {
+            return min();
+        }
+        if( percentile >= 100.0 )
+        {
+            return max();
+        }
+
+        // Rank of the requested value, 1-based: the smallest rank covering the percentile
+        const auto exactRank{ percentile / 100.0 * static_cast<double>( m_count ) };
+        auto rank{ static_cast<std::uint64_t>( std::ceil( exactRank ) ) };
+        rank = std::clamp<std::uint64_t>( rank, 1, m_count );
+
+        std::uint64_t seen{ 0 };
+        for( std::size_t i{ 0 }; i < BUCKET_COUNT; ++i )
+        {
+            seen += m_buckets[i];
+            if( seen >= rank )
+            {
+                return TimeSpan{ std::clamp( bucketUpperBound( i ), m_min, m_max ) };
+            }
+        }
+
+        return max();
+    }
+
+    //----------------------------------------------
+    // String formatting
+    //----------------------------------------------
+
+    std::string TimeSpanHistogram::toString() const
+    {
+        std::string result{ "count=" };
+        result += std::to_string( m_count );
+        result += " min=";
+        result += min().toString();
+        result += " mean=";
+        result += mean().toString();
+        result += " p50=";
+        result += percentile( 50.0 ).toString();
+        result += " p90=";
+        result += percentile( 90.0 ).toString();
+        result += " p99=";
+        result += percentile( 99.0 ).toString();
+        result += " p99.9=";
+        result += percentile( 99.9 ).toString();
+        result += " max=";
+        result += max().toString();
+
+        return result;
+    }
+
+    //=====================================================================
+    // ConcurrentTimeSpanHistogram class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    ConcurrentTimeSpanHistogram::ConcurrentTimeSpanHistogram() noexcept
+        : m_id{ g_nextHistogramId.fetch_add( 1, std::memory_order_relaxed ) }
+    {
+    }
+
+    ConcurrentTimeSpanHistogram::~ConcurrentTimeSpanHistogram()
+    {
+        auto* shard{ m_shards.load( std::memory_order_acquire ) };
+        while( shard != nullptr )
+        {
+            auto* next{ shard->next };
+            delete shard;
+            shard = next;
+        }
+    }
+
+    //----------------------------------------------
+    // Recording
+    //----------------------------------------------
+
+    void ConcurrentTimeSpanHistogram::reset() noexcept
+    {
+        // Shards belong to their threads: retire them by generation rather than writing them
+        m_generation.fetch_add( 1, std::memory_order_acq_rel );
+    }
+
+    //----------------------------------------------
+    // Queries
+    //----------------------------------------------
+
+    TimeSpanHistogram ConcurrentTimeSpanHistogram::snapshot() const noexcept
+    {
+        TimeSpanHistogram result;
+        const auto generation{ m_generation.load( std::memory_order_acquire ) };
+        for( auto* shard{ m_shards.load( std::memory_order_acquire ) }; shard != nullptr; shard = shard->next )
+        {
+            if( shard->generation.load( std::memory_order_acquire ) != generation )
+            {
+                continue; // Not recorded into since the last reset
+            }
+
+            for( std::size_t i{ 0 }; i < TimeSpanHistogram::BUCKET_COUNT; ++i )
+            {
+                result.m_buckets[i] += shard->buckets[i].load( std::memory_order_relaxed );
+            }
+            result.m_count += shard->count.load( std::memory_order_relaxed );
+            result.m_sum += shard->sum.load( std::memory_order_relaxed );
+            result.m_min = std::min( result.m_min, shard->min.load( std::memory_order_relaxed ) );
+            result.m_max = std::max( result.m_max, shard->max.load( std::memory_order_relaxed ) );
+        }
+
+        return result;
+    }
+
+    //----------------------------------------------
+    // Shards
+    //----------------------------------------------
+
+    ConcurrentTimeSpanHistogram::Shard* ConcurrentTimeSpanHistogram::acquireShard() noexcept
+    {
+        const auto self{ std::this_thread::get_id() };
+
+        // Shards are only ever pushed, so a thread's own shard is found by a plain scan
+        auto* head{ m_shards.load( std::memory_order_acquire ) };
+        for( auto* shard{ head }; shard != nullptr; shard = shard->next )
+        {
+            if( shard->owner == self )
+            {
+                return shard;
+            }
+        }
+
+        auto* shard{ new( std::nothrow ) Shard{} };
+        if( shard == nullptr )
+        {
+            return nullptr;
+        }
+
+        shard->owner = self;
+        shard->generation.store( m_generation.load( std::memory_order_acquire ), std::memory_order_relaxed );
+        shard->next = head;
+        while( !m_shards.compare_exchange_weak(
+            shard->next, shard, std::memory_order_release, std::memory_order_acquire ) )
+        {
+        }
+
+        return shard;
+    }
+} // namespace nfx::time
@@ -0,0 +1,833 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimeZone.cpp
+ * @brief Implementation of TimeZone: TZif mapping, POSIX TZ footer rules and zone registry
+ * @details Maps TZif (RFC 8536) files read-only and searches their big-endian transition
+ *          arrays in place. Instants after the last transition are resolved with the POSIX TZ
+ *          string stored in the file footer. Loaded zones are interned by name in a
+ *          process-wide registry.
+ */
+
+#include "nfx/datetime/TimeZone.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#if defined( _WIN32 )
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace nfx::time
+{
+    namespace
+    {
+        //=====================================================================
+        // Read-only file mapping
+        //=====================================================================
+
+        /** @brief RAII read-only memory mapping of a whole file */
+        class MappedFile final
+        {
+        public:
+            MappedFile() noexcept = default;
+
+            MappedFile( const MappedFile& ) = delete;
+            MappedFile& operator=( const MappedFile& ) = delete;
+
+            ~MappedFile()
+            {
+                if( m_data == nullptr )
+                {
+                    return;
+                }
+#if defined( _WIN32 )
+                ::UnmapViewOfFile( m_data );
+#else
+                ::munmap( const_cast<unsigned char*>( m_data ), m_size );
+#endif
+            }
+
+            /**
+             * @brief Map a file read-only
+             * @param path File path
+             * @return true if the file was mapped and is not empty
+             */
+            [[nodiscard]] bool open( const std::string& path ) noexcept
+            {
+#if defined( _WIN32 )
+                const HANDLE file{ ::CreateFileA( path.c_str(),
+                    GENERIC_READ,
+                    FILE_SHARE_READ,
+                    nullptr,
+                    OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL,
+                    nullptr ) };
+                if( file == INVALID_HANDLE_VALUE )
+                {
+                    return false;
+                }
+
+                LARGE_INTEGER fileSize{};
+                if( !::GetFileSizeEx( file, &fileSize ) || fileSize.QuadPart <= 0 )
+                {
+                    ::CloseHandle( file );
+                    return false;
+                }
+
+                const HANDLE mapping{ ::CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) };
+                ::CloseHandle( file );
+                if( mapping == nullptr )
+                {
+                    return false;
+                }
+
+                void* view{ ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) };
+                ::CloseHandle( mapping );
+                if( view == nullptr )
+                {
+                    return false;
+                }
+
+                m_data = static_cast<const unsigned char*>( view );
+                m_size = static_cast<std::size_t>( fileSize.QuadPart );
+#else
+                const int fd{ ::open( path.c_str(), O_RDONLY | O_CLOEXEC ) };
+                if( fd < 0 )
+                {
+                    return false;
+                }
+
+                struct stat info{};
+                if( ::fstat( fd, &info ) != 0 || !S_ISREG( info.st_mode ) || info.st_size <= 0 )
+                {
+                    ::close( fd );
+                    return false;
+                }
+
+                const auto size{ static_cast<std::size_t>( info.st_size ) };
+                void* view{ ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 ) };
+                ::close( fd );
+                if( view == MAP_FAILED )
+                {
+                    return false;
+                }
+
+                m_data = static_cast<const unsigned char*>( view );
+                m_size = size;
+#endif
+                return true;
+            }
+
+            /** @brief Mapped bytes */
+            [[nodiscard]] const unsigned char* data() const noexcept
+            {
+                return m_data;
+            }
+
+            /** @brief Mapped size in bytes */
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return m_size;
+            }
+
+        private:
+            const unsigned char* m_data{ nullptr };
+            std::size_t m_size{ 0 };
+        };
+
+        //=====================================================================
+        // TZif decoding helpers
+        //=====================================================================
+
+        /** @brief Size of a TZif header */
+        constexpr std::size_t TZIF_HEADER_SIZE{ 44 };
+
+        /** @brief Size of a TZif local time type record (utoff, isdst, desigidx) */
+        constexpr std::size_t TZIF_TYPE_SIZE{ 6 };
+
+        /** @brief Read a big-endian 32-bit unsigned value */
+        [[nodiscard]] inline std::uint32_t readBigEndian32( const unsigned char* p ) noexcept
+        {
+            return ( static_cast<std::uint32_t>( p[0] ) << 24 ) | ( static_cast<std::uint32_t>( p[1] ) << 16 ) |
+                   ( static_cast<std::uint32_t>( p[2] ) << 8 ) | static_cast<std::uint32_t>( p[3] );
+        }
+
+        /** @brief Read a big-endian 64-bit signed value */
+        [[nodiscard]] inline std::int64_t readBigEndian64( const unsigned char* p ) noexcept
+        {
+            const std::uint64_t value{ ( static_cast<std::uint64_t>( readBigEndian32( p ) ) << 32 ) |
+                                       readBigEndian32( p + 4 ) };
+
+            return static_cast<std::int64_t>( value );
+        }
+
+        /** @brief TZif header counts */
+        struct TzifHeader
+        {
+            char version;
+            std::uint32_t isutcnt;
+            std::uint32_t isstdcnt;
+            std::uint32_t leapcnt;
+            std::uint32_t timecnt;
+            std::uint32_t typecnt;
+            std::uint32_t charcnt;
+        };
+
+        /** @brief Decode a TZif header at the given offset */
+        [[nodiscard]] bool readTzifHeader(
+            const unsigned char* data, std::size_t size, std::size_t offset, TzifHeader& header ) noexcept
+        {
+            if( size < offset || size - offset < TZIF_HEADER_SIZE || std::memcmp( data + offset, "TZif", 4 ) != 0 )
+            {
+                return false;
+            }
+
+            const unsigned char* p{ data + offset };
+            header.version = static_cast<char>( p[4] );
+            header.isutcnt = readBigEndian32( p + 20 );
+            header.isstdcnt = readBigEndian32( p + 24 );
+            header.leapcnt = readBigEndian32( p + 28 );
+            header.timecnt = readBigEndian32( p + 32 );
+            header.typecnt = readBigEndian32( p + 36 );
+            header.charcnt = readBigEndian32( p + 40 );
+
+            return true;
+        }
+
+        /** @brief Size of a TZif data block for the given header and time size */
+        [[nodiscard]] constexpr std::uint64_t tzifDataSize( const TzifHeader& h, std::uint64_t timeSize ) noexcept
+        {
+            return std::uint64_t{ h.timecnt } * timeSize + h.timecnt + std::uint64_t{ h.typecnt } * TZIF_TYPE_SIZE +
+                   h.charcnt + std::uint64_t{ h.leapcnt } * ( timeSize + 4 ) + h.isstdcnt + h.isutcnt;
+        }
+
+        //=====================================================================
+        // POSIX TZ footer rules
+        //=====================================================================
+
+        /** @brief Date rule of a POSIX TZ transition ("Jn", "n" or "Mm.w.d") */
+        struct PosixDate
+        {
+            enum class Kind : std::uint8_t
+            {
+                JulianNoLeap, ///< Jn: day 1-365, February 29 never counted
+                JulianZero,   ///< n: day 0-365, February 29 counted in leap years
+                MonthWeekDay, ///< Mm.w.d: weekday d of week w (5 = last) of month m
+            };
+
+            Kind kind{ Kind::MonthWeekDay };
+            std::int32_t day{ 0 };
+            std::int32_t week{ 0 };
+            std::int32_t month{ 0 };
+
+            /** @brief Transition time of day in local wall-clock seconds (may exceed 24h or be negative) */
+            std::int32_t timeSeconds{ 2 * constants::SECONDS_PER_HOUR };
+        };
+
+        /** @brief Parsed POSIX TZ string (e.g. "CET-1CEST,M3.5.0,M10.5.0/3") */
+        struct PosixRule
+        {
+            std::int32_t standardOffset{ 0 }; ///< Standard time UT offset in seconds (east positive)
+            std::int32_t daylightOffset{ 0 }; ///< Daylight time UT offset in seconds (east positive)
+            bool hasDaylight{ false };
+            PosixDate start;
+            PosixDate end;
+        };
+
+        /** @brief Cursor over a POSIX TZ string */
+        class PosixParser final
+        {
+        public:
+            explicit PosixParser( std::string_view text ) noexcept
+                : m_text{ text }
+            {
+            }
+
+            /** @brief Parse the whole string; false if malformed */
+            [[nodiscard]] bool parse( PosixRule& rule ) noexcept
+            {
+                std::int32_t offset;
+                if( !skipName() || !parseTime( offset ) )
+                {
+                    return false;
+                }
+                // POSIX offsets count hours west of Greenwich
+                rule.standardOffset = -offset;
+
+                if( atEnd() )
+                {
+                    return true;
+                }
+
+                if( !skipName() )
+                {
+                    return false;
+                }
+                rule.hasDaylight = true;
+                rule.daylightOffset = rule.standardOffset + constants::SECONDS_PER_HOUR;
+
+                if( !atEnd() && peek() != ',' )
+                {
+                    if( !parseTime( offset ) )
+                    {
+                        return false;
+                    }
+                    rule.daylightOffset = -offset;
+                }
+
+                if( atEnd() )
+                {
+                    // No rule given: POSIX leaves this implementation-defined; use the US rules
+                    rule.start = PosixDate{ PosixDate::Kind::MonthWeekDay, 0, 2, 3 };
+                    rule.end = PosixDate{ PosixDate::Kind::MonthWeekDay, 0, 1, 11 };
+                    return true;
+                }
+
+                return consume( ',' ) && parseDate( rule.start ) && consume( ',' ) && parseDate( rule.end ) &&
+                       atEnd();
+            }
+
+        private:
+            std::string_view m_text;
+            std::size_t m_pos{ 0 };
+
+            [[nodiscard]] bool atEnd() const noexcept
+            {
+                return m_pos >= m_text.size();
+            }
+
+            [[nodiscard]] char peek() const noexcept
+            {
+                return atEnd() ? '\0' : m_text[m_pos];
+            }
+
+            [[nodiscard]] bool consume( char c ) noexcept
+            {
+                if( peek() != c )
+                {
+                    return false;
+                }
+                ++m_pos;
+                return true;
+            }
+
+            /** @brief Skip a zone abbreviation ("CET" or quoted "<+0530>") */
+            [[nodiscard]] bool skipName() noexcept
+            {
+                const auto begin{ m_pos };
+                if( consume( '<' ) )
+                {
+                    while( !atEnd() && peek() != '>' )
+                    {
+                        ++m_pos;
+                    }
+                    return m_pos > begin + 1 && consume( '>' );
+                }
+
+                while( ( peek() >= 'A' && peek() <= 'Z' ) || ( peek() >= 'a' && peek() <= 'z' ) )
+                {
+                    ++m_pos;
+                }
+                return m_pos > begin;
+            }
+
+            /** @brief Parse an unsigned decimal number of at most maxDigits digits */
+            [[nodiscard]] bool parseNumber( std::int32_t& value, std::size_t maxDigits ) noexcept
+            {
+                const auto begin{ m_pos };
+                value = 0;
+                while( peek() >= '0' && peek() <= '9' && m_pos - begin < maxDigits )
+                {
+                    value = value * 10 + ( m_text[m_pos++] - '0' );
+                }
+                return m_pos > begin;
+            }
+
+            /** @brief Parse [+|-]hh[:mm[:ss]] (hours up to 167, RFC 8536 extension) */
+            [[nodiscard]] bool parseTime( std::int32_t& seconds ) noexcept
+            {
+                std::int32_t sign{ 1 };
+                if( consume( '-' ) )
+                {
+                    sign = -1;
+                }
+                else
+                {
+                    (void)consume( '+' );
+                }
+
+                std::int32_t hours, minutes{ 0 }, secs{ 0 };
+                if( !parseNumber( hours, 3 ) || hours > 167 )
+                {
+                    return false;
+                }
+                if( consume( ':' ) && ( !parseNumber( minutes, 2 ) || minutes > 59 ) )
+                {
+                    return false;
+                }
+                if( consume( ':' ) && ( !parseNumber( secs, 2 ) || secs > 59 ) )
+                {
+                    return false;
+                }
+
+                seconds = sign * ( hours * constants::SECONDS_PER_HOUR + minutes * constants::SECONDS_PER_MINUTE +
+                                   secs );
+                return true;
+            }
+
+            /** @brief Parse a transition date with optional "/time" */
+            [[nodiscard]] bool parseDate( PosixDate& date ) noexcept
+            {
+                if( consume( 'J' ) )
+                {
+                    date.kind = PosixDate::Kind::JulianNoLeap;
+                    if( !parseNumber( date.day, 3 ) || date.day < 1 || date.day > 365 )
+                    {
+                        return false;
+                    }
+                }
+                else if( consume( 'M' ) )
+                {
+                    date.kind = PosixDate::Kind::MonthWeekDay;
+                    if( !parseNumber( date.month, 2 ) || date.month < 1 || date.month > 12 || !consume( '.' ) ||
+                        !parseNumber( date.week, 1 ) || date.week < 1 || date.week > 5 || !consume( '.' ) ||
+                        !parseNumber( date.day, 1 ) || date.day > 6 )
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    date.kind = PosixDate::Kind::JulianZero;
+                    if( !parseNumber( date.day, 3 ) || date.day > 365 )
+                    {
+                        return false;
+                    }
+                }
+
+                if( consume( '/' ) )
+                {
+                    return parseTime( date.timeSeconds );
+                }
+                return true;
+            }
+        };
+
+        /** @brief Days from 1970-01-01 to the first day of month in year */
+        [[nodiscard]] inline std::int64_t unixDaysFromCivil( std::int32_t year, std::int32_t month ) noexcept
+        {
+            return ( DateTime{ year, month, 1 }.ticks() - constants::UNIX_EPOCH_TICKS ) / constants::TICKS_PER_DAY;
+        }
+
+        /** @brief Local wall-clock seconds since 1970-01-01 of a rule date in the given year */
+        [[nodiscard]] std::int64_t localTransitionSeconds( const PosixDate& date, std::int32_t year ) noexcept
+        {
+            std::int64_t days{ 0 };
+            switch( date.kind )
+            {
+                case PosixDate::Kind::JulianNoLeap:
+                {
+                    const bool skipsLeapDay{ DateTime::isLeapYear( year ) && date.day >= 60 };
+                    days = unixDaysFromCivil( year, 1 ) + date.day - 1 + ( skipsLeapDay ? 1 : 0 );
+                    break;
+                }
+                case PosixDate::Kind::JulianZero:
+                {
+                    days = unixDaysFromCivil( year, 1 ) + date.day;
+                    break;
+                }
+                case PosixDate::Kind::MonthWeekDay:
+                {
+                    const auto firstOfMonth{ unixDaysFromCivil( year, date.month ) };
+                    // 1970-01-01 was a Thursday (4)
+                    const auto firstWeekday{ static_cast<std::int32_t>( ( firstOfMonth % 7 + 11 ) % 7 ) };
+                    auto dayOfMonth{ 1 + ( date.day - firstWeekday + 7 ) % 7 + ( date.week - 1 ) * 7 };
+                    if( dayOfMonth > DateTime::daysInMonth( year, date.month ) )
+                    {
+                        dayOfMonth -= 7;
+                    }
+                    days = firstOfMonth + dayOfMonth - 1;
+                    break;
+                }
+            }
+
+            return days * constants::SECONDS_PER_DAY + date.timeSeconds;
+        }
+
+        /** @brief UT offset in seconds given by a POSIX rule at a Unix instant */
+        [[nodiscard]] std::int32_t ruleOffsetAt( const PosixRule& rule, std::int64_t unixSeconds ) noexcept
+        {
+            if( !rule.hasDaylight )
+            {
+                return rule.standardOffset;
+            }
+
+            // Year of the instant in local standard time, clamped to the DateTime range
+            const auto localTicks{ std::clamp( constants::UNIX_EPOCH_TICKS +
+                                                   ( unixSeconds + rule.standardOffset ) * constants::TICKS_PER_SECOND,
+                constants::MIN_DATETIME_TICKS,
+                constants::MAX_DATETIME_TICKS ) };
+            const auto year{ DateTime{ localTicks }.year() };
+
+            // Start is given in standard time, end in daylight time
+            const auto startUtc{ localTransitionSeconds( rule.start, year ) - rule.standardOffset };
+            const auto endUtc{ localTransitionSeconds( rule.end, year ) - rule.daylightOffset };
+
+            const bool isDaylight{ startUtc < endUtc ? ( unixSeconds >= startUtc && unixSeconds < endUtc )
+                                                     : !( unixSeconds >= endUtc && unixSeconds < startUtc ) };
+
+            return isDaylight ? rule.daylightOffset : rule.standardOffset;
+        }
+
+        //=====================================================================
+        // Zone name validation and paths
+        //=====================================================================
+
+        /** @brief Accept only relative IANA-style names (no "..", no absolute paths) */
+        [[nodiscard]] bool isValidZoneName( std::string_view name ) noexcept
+        {
+            if( name.empty() || name.size() > 255 || name.front() == '/' || name.back() == '/' ||
+                name.find( ".." ) != std::string_view::npos )
+            {
+                return false;
+            }
+
+            for( const char c : name )
+            {
+                const bool valid{ ( c >= 'A' && c <= 'Z' ) || ( c >= 'a' && c <= 'z' ) || ( c >= '0' && c <= '9' ) ||
+                                  c == '/' || c == '_' || c == '-' || c == '+' || c == '.' };
+                if( !valid )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /** @brief Directory holding TZif files (TZDIR or /usr/share/zoneinfo) */
+        [[nodiscard]] std::string zoneDirectory()
+        {
+#if defined( _MSC_VER )
+            char* value{ nullptr };
+            std::size_t length{ 0 };
+            std::string directory;
+            if( ::_dupenv_s( &value, &length, "TZDIR" ) == 0 && value != nullptr )
+            {
+                directory = value;
+            }
+            std::free( value );
+#else
+            const char* value{ std::getenv( "TZDIR" ) };
+            std::string directory{ value != nullptr ? value : "" };
+#endif
+            return directory.empty() ? std::string{ "/usr/share/zoneinfo" } : directory;
+        }
+
+        /** @brief Names resolved to the built-in UTC zone when no zone file is available */
+        [[nodiscard]] bool isUtcAlias( std::string_view name ) noexcept
+        {
+            return name == "UTC" || name == "Etc/UTC" || name == "Etc/UCT" || name == "UCT" || name == "Zulu" ||
+                   name == "Etc/Zulu" || name == "GMT" || name == "Etc/GMT" || name == "Universal" ||
+                   name == "Etc/Universal";
+        }
+    } // namespace
+
+    //=====================================================================
+    // TimeZone data
+    //=====================================================================
+
+    struct TimeZone::Data
+    {
+        /** @brief IANA name */
+        std::string name;
+
+        /** @brief Mapped TZif file (empty for the built-in UTC zone) */
+        MappedFile file;
+
+        /** @brief Big-endian 64-bit transition times (Unix seconds, ascending) */
+        const unsigned char* transitions{ nullptr };
+
+        /** @brief Local time type index of each transition */
+        const unsigned char* typeIndices{ nullptr };
+
+        /** @brief Local time type records (big-endian utoff, isdst, desigidx) */
+        const unsigned char* types{ nullptr };
+
+        /** @brief Number of transitions */
+        std::size_t transitionCount{ 0 };
+
+        /** @brief Footer rule for instants after the last transition */
+        PosixRule rule;
+
+        /** @brief Whether the footer holds a rule */
+        bool hasRule{ false };
+
+        /** @brief UT offset of local time type index, in seconds */
+        [[nodiscard]] std::int32_t typeOffset( std::size_t index ) const noexcept
+        {
+            return static_cast<std::int32_t>( readBigEndian32( types + index * TZIF_TYPE_SIZE ) );
+        }
+
+        /** @brief Map and validate a TZif file */
+        [[nodiscard]] bool load( const std::string& path ) noexcept
+        {
+            if( !file.open( path ) )
+            {
+                return false;
+            }
+
+            const unsigned char* bytes{ file.data() };
+            const std::size_t size{ file.size() };
+
+            // Version 1 header and data block, skipped in favour of the 64-bit block
+            TzifHeader header{};
+            if( !readTzifHeader( bytes, size, 0, header ) || header.version < '2' )
+            {
+                return false;
+            }
+            const auto v1Size{ tzifDataSize( header, 4 ) };
+            if( v1Size > size - TZIF_HEADER_SIZE )
+            {
+                return false;
+            }
+
+            const auto v2HeaderOffset{ TZIF_HEADER_SIZE + static_cast<std::size_t>( v1Size ) };
+            if( !readTzifHeader( bytes, size, v2HeaderOffset, header ) || header.typecnt == 0 ||
+                header.leapcnt != 0 )
+            {
+                return false;
+            }
+
+            const auto dataOffset{ v2HeaderOffset + TZIF_HEADER_SIZE };
+            const auto v2Size{ tzifDataSize( header, 8 ) };
+            if( v2Size > size - dataOffset )
+            {
+                return false;
+            }
+
+            transitionCount = header.timecnt;
+            transitions = bytes + dataOffset;
+            typeIndices = transitions + transitionCount * 8;
+            types = typeIndices + transitionCount;
+
+            for( std::size_t i{ 0 }; i < transitionCount; ++i )
+            {
+                if( typeIndices[i] >= header.typecnt )
+                {
+                    return false;
+                }
+            }
+
+            // Footer: "\n<POSIX TZ string>\n"
+            const auto footerOffset{ dataOffset + static_cast<std::size_t>( v2Size ) };
+            if( footerOffset < size && bytes[footerOffset] == '\n' )
+            {
+                const auto* footerBegin{ reinterpret_cast<const char*>( bytes + footerOffset + 1 ) };
+                const auto* footerEnd{ static_cast<const char*>(
+                    std::memchr( footerBegin, '\n', size - footerOffset - 1 ) ) };
+                if( footerEnd != nullptr && footerEnd != footerBegin )
+                {
+                    const std::string_view text{ footerBegin, static_cast<std::size_t>( footerEnd - footerBegin ) };
+                    hasRule = PosixParser{ text }.parse( rule );
+                }
+            }
+
+            return true;
+        }
+    };
+
+    //=====================================================================
+    // TimeZone class
+    //=====================================================================
+
+    namespace
+    {
+        /** @brief Single zero-offset local time type of the built-in UTC zone */
+        constexpr unsigned char UTC_TYPE[TZIF_TYPE_SIZE]{ 0, 0, 0, 0, 0, 0 };
+
+        /** @brief Transparent hash for heterogeneous string_view lookups */
+        struct ZoneNameHash
+        {
+            using is_transparent = void;
+
+            std::size_t operator()( std::string_view name ) const noexcept
+            {
+                return std::hash<std::string_view>{}( name );
+            }
+        };
+    } // namespace
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    TimeZone::TimeZone( std::unique_ptr<Data> data ) noexcept
+        : m_data{ std::move( data ) }
+    {
+    }
+
+    //----------------------------------------------
+    // Destruction
+    //----------------------------------------------
+
+    TimeZone::~TimeZone() = default;
+
+    //----------------------------------------------
+    // Property accessors
+    //----------------------------------------------
+
+    std::string_view TimeZone::name() const noexcept
+    {
+        return m_data->name;
+    }
+
+    //----------------------------------------------
+    // Offset lookup
+    //----------------------------------------------
+
+    TimeSpan TimeZone::offsetAt( std::int64_t utcTicks ) const noexcept
+    {
+        const Data& data{ *m_data };
+
+        // Floor division so instants before 1970 resolve to the second they fall in
+        const auto sinceEpoch{ utcTicks - constants::UNIX_EPOCH_TICKS };
+        const auto unixSeconds{ sinceEpoch / constants::TICKS_PER_SECOND -
+                                ( sinceEpoch % constants::TICKS_PER_SECOND < 0 ? 1 : 0 ) };
+
+        // Branch-free upper bound over the mapped big-endian transition times
+        std::size_t index{ 0 };
+        if( data.transitionCount != 0 )
+        {
+            const unsigned char* base{ data.transitions };
+            std::size_t remaining{ data.transitionCount };
+            while( remaining > 1 )
+            {
+                const auto half{ remaining / 2 };
+                base = ( readBigEndian64( base + half * 8 ) <= unixSeconds ) ? base + half * 8 : base;
+                remaining -= half;
+            }
+            index = static_cast<std::size_t>( base - data.transitions ) / 8 +
+                    ( readBigEndian64( base ) <= unixSeconds ? 1 : 0 );
+        }
+
+        std::int32_t offsetSeconds;
+        if( index == data.transitionCount && data.hasRule )
+        {
+            offsetSeconds = ruleOffsetAt( data.rule, unixSeconds );
+        }
+        else
+        {
+            // Instants before the first transition use local time type 0
+            offsetSeconds = data.typeOffset( index == 0 ? 0 : data.typeIndices[index - 1] );
+        }
+
+        return TimeSpan{ static_cast<std::int64_t>( offsetSeconds ) * constants::TICKS_PER_SECOND };
+    }
+
+    //----------------------------------------------
+    // Static factory methods
+    //----------------------------------------------
+
+    const TimeZone& TimeZone::utc() noexcept
+    {
+        static const TimeZone zone{ [] {
+            auto data{ std::make_unique<Data>() };
+            data->name = "UTC";
+            data->types = UTC_TYPE;
+            return data;
+        }() };
+
+        return zone;
+    }
+
+    const TimeZone* TimeZone::find( std::string_view name ) noexcept
+    {
+        // Fastest path: same name as this thread's previous lookup (zones are never unloaded)
+        thread_local const TimeZone* lastZone{ nullptr };
+        if( lastZone != nullptr && lastZone->name() == name )
+        {
+            return lastZone;
+        }
+
+        if( !isValidZoneName( name ) )
+        {
+            return nullptr;
+        }
+
+        try
+        {
+            static std::shared_mutex mutex;
+            static std::unordered_map<std::string, std::unique_ptr<TimeZone>, ZoneNameHash, std::equal_to<>> zones;
+
+            // Fast path: already interned
+            {
+                const std::shared_lock lock{ mutex };
+                if( const auto it{ zones.find( name ) }; it != zones.end() )
+                {
+                    lastZone = it->second.get();
+                    return lastZone;
+                }
+            }
+
+            // Slow path: map the zone file outside the lock, then intern it
+            auto data{ std::make_unique<Data>() };
+            data->name = name;
+            if( !data->load( zoneDirectory() + '/' + data->name ) )
+            {
+                return isUtcAlias( name ) ? &utc() : nullptr;
+            }
+
+            auto zone{ std::unique_ptr<TimeZone>{ new TimeZone{ std::move( data ) } } };
+
+            const std::unique_lock lock{ mutex };
+            const auto [it, inserted]{ zones.try_emplace( std::string{ name }, std::move( zone ) ) };
+            lastZone = it->second.get();
+
+            return lastZone;
+        }
+        catch( ... )
+        {
+            return nullptr;
+        }
+    }
+} // namespace nfx::time
@@ -0,0 +1,150 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Timeline.cpp
+ * @brief Implicit B+ tree construction and search for Timeline
+ * @details Each upper level holds the largest key of every node of the level below, except
+ *          for the last node whose separator is INT64_MAX like the padding keys; padding never
+ *          compares less than a search key, so the last node of each level catches every key
+ *          beyond the largest value and a descent never leaves the level. Node scans count keys
+ *          below the search key instead of branching, so the loop vectorizes.
+ */
+
+#include "nfx/datetime/Timeline.h"
+#include "nfx/datetime/Sort.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace nfx::time
+{
+    namespace
+    {
+        /** @brief Padding key, never less than a search key */
+        constexpr std::int64_t PADDING_TICKS{ std::numeric_limits<std::int64_t>::max() };
+
+        /** @brief Round a count up to whole nodes */
+        [[nodiscard]] constexpr std::size_t paddedSize( std::size_t count ) noexcept
+        {
+            return ( count + Timeline::NODE_SIZE - 1 ) / Timeline::NODE_SIZE * Timeline::NODE_SIZE;
+        }
+
+        /** @brief Count the keys of an upper level node below a key */
+        [[nodiscard]] inline std::size_t countBelow( const std::int64_t* node, std::int64_t ticks ) noexcept
+        {
+            std::size_t result{ 0 };
+            for( std::size_t i{ 0 }; i < Timeline::NODE_SIZE; ++i )
+            {
+                result += node[i] < ticks;
+            }
+
+            return result;
+        }
+
+        /** @brief Count the values of a level 0 node below a key */
+        [[nodiscard]] inline std::size_t countBelow( const DateTime* node, std::int64_t ticks ) noexcept
+        {
+            std::size_t result{ 0 };
+            for( std::size_t i{ 0 }; i < Timeline::NODE_SIZE; ++i )
+            {
+                result += node[i].ticks() < ticks;
+            }
+
+            return result;
+        }
+    } // namespace
+
+    //=====================================================================
+    // Timeline class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    Timeline::Timeline( std::span<const DateTime> values )
+        : m_values( paddedSize( values.size() ), DateTime{ PADDING_TICKS } ),
+          m_size{ values.size() }
+    {
+        if( m_size == 0 )
+        {
+            return;
+        }
+
+        std::copy( values.begin(), values.end(), m_values.begin() );
+        radixSort( std::span<DateTime>{ m_values.data(), m_size } );
+
+        // Level 1 takes the last key of every level 0 node, each further level the last key of
+        // every node below, until a level fits in one node. The last node gets the padding key so
+        // keys above the largest value descend into it rather than one past the end of the level
+        std::size_t nodeCount{ m_values.size() / NODE_SIZE };
+        std::size_t belowOffset{ 0 };
+        bool belowIsValues{ true };
+        while( nodeCount > 1 )
+        {
+            const auto offset{ m_index.size() };
+            m_index.resize( offset + paddedSize( nodeCount ), PADDING_TICKS );
+            for( std::size_t node{ 0 }; node + 1 < nodeCount; ++node )
+            {
+                const auto last{ ( node + 1 ) * NODE_SIZE - 1 };
+                m_index[offset + node] = belowIsValues ? m_values[last].ticks() : m_index[belowOffset + last];
+            }
+
+            m_levelOffsets.push_back( offset );
+            belowOffset = offset;
+            belowIsValues = false;
+            nodeCount = paddedSize( nodeCount ) / NODE_SIZE;
+        }
+    }
+
+    //----------------------------------------------
+    // Search
+    //----------------------------------------------
+
+    std::size_t Timeline::lowerBound( const DateTime& value ) const noexcept
+    {
+        return lowerBoundTicks( value.ticks() );
+    }
+
+    std::size_t Timeline::lowerBoundTicks( std::int64_t ticks ) const noexcept
+    {
+        if( m_size == 0 )
+        {
+            return 0;
+        }
+
+        // Descend from the single top node; node is the node index within the current level
+        std::size_t node{ 0 };
+        for( auto level{ m_levelOffsets.size() }; level > 0; --level )
+        {
+            const auto* keys{ m_index.data() + m_levelOffsets[level - 1] + node * NODE_SIZE };
+            node = node * NODE_SIZE + countBelow( keys, ticks );
+        }
+
+        const auto position{ node * NODE_SIZE + countBelow( m_values.data() + node * NODE_SIZE, ticks ) };
+
+        return std::min( position, m_size );
+    }
+} // namespace nfx::time
@@ -0,0 +1,547 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampColumn.cpp
+ * @brief Delta-of-delta block encoding and scalar/AVX2 block decoding
+ * @details Decoding runs in two passes per block: the fixed-width zigzag delta-of-deltas are
+ *          unpacked into a local array, then zigzag decoded and prefix summed twice (deltas, then
+ *          ticks). The AVX2 kernel gathers four fields per step and computes both prefix sums
+ *          across 64-bit lanes; x86-64 builds that do not target AVX2 natively select it at runtime.
+ */
+
+#include "nfx/datetime/TimestampColumn.h"
+#include "nfx/datetime/Binary.h"
+
+#include <algorithm>
+#include <bit>
+
+#if defined( NFX_DATETIME_ENABLE_SIMD ) && !defined( __EMSCRIPTEN__ )
+#    if defined( __x86_64__ ) || defined( _M_X64 )
+#        define NFX_DATETIME_COLUMN_AVX2 1
+#        include <immintrin.h>
+#        if defined( _MSC_VER ) && !defined( __clang__ )
+#            include <intrin.h>
+#        endif
+#    endif
+#endif
+
+namespace nfx::time
+{
+    namespace
+    {
+        //=====================================================================
+        // Block format helpers
+        //=====================================================================
+
+        /** @brief Maximum number of values per block */
+        constexpr std::size_t BLOCK_SIZE{ TimestampColumnEncoder::BLOCK_SIZE };
+
+        /** @brief Number of 64-bit payload words holding count values of width bits */
+        [[nodiscard]] constexpr std::size_t payloadWords( std::size_t count, std::size_t width ) noexcept
+        {
+            return ( count * width + 63 ) / 64;
+        }
+
+        /** @brief Map a wrapped delta-of-delta to an unsigned value with small magnitude */
+        [[nodiscard]] constexpr std::uint64_t zigzagEncode( std::uint64_t value ) noexcept
+        {
+            return ( value << 1 ) ^ ( 0 - ( value >> 63 ) );
+        }
+
+        /** @brief Inverse of zigzagEncode */
+        [[nodiscard]] constexpr std::uint64_t zigzagDecode( std::uint64_t value ) noexcept
+        {
+            return ( value >> 1 ) ^ ( 0 - ( value & 1 ) );
+        }
+
+        /** @brief Decoded block header */
+        struct BlockHeader
+        {
+            std::size_t count;   ///< Value count
+            std::size_t width;   ///< Bits per packed delta-of-delta
+            std::uint64_t first; ///< First ticks
+            std::uint64_t delta; ///< First delta
+        };
+
+        /** @brief Read a block header (at least BLOCK_HEADER_SIZE bytes) */
+        [[nodiscard]] BlockHeader readHeader( const std::byte* data ) noexcept
+        {
+            return BlockHeader{ static_cast<std::size_t>( data[0] ) | static_cast<std::size_t>( data[1] ) << 8,
+                static_cast<std::size_t>( data[2] ),
+                detail::loadLittleEndian64( data + 4 ),
+                detail::loadLittleEndian64( data + 12 ) };
+        }
+
+        /**
+         * @brief Read the 64 bits starting at a bit position of a payload
+         * @details Branch-free: the following word is always combined (zero past the end), so
+         *          byte-unaligned widths do not cost a misprediction per value.
+         */
+        [[nodiscard]] inline std::uint64_t readPacked(
+            const std::byte* payload, std::size_t words, std::size_t position ) noexcept
+        {
+            const auto word{ position >> 6 };
+            const auto shift{ position & 63 };
+            const std::uint64_t low{ detail::loadLittleEndian64( payload + word * 8 ) };
+            const std::uint64_t high{ word + 1 < words ? detail::loadLittleEndian64( payload + word * 8 + 8 ) : 0 };
+
+            return ( low >> shift ) | ( ( high << 1 ) << ( 63 - shift ) );
+        }
+
+        /**
+         * @brief Unpack the fixed-width fields of a block payload
+         * @param payload Packed fields (payloadWords( count, width ) * 8 bytes)
+         * @param count Number of fields
+         * @param width Bits per field (1 - 64)
+         * @param fields Receives the zigzag-encoded fields
+         */
+        inline void unpackFields(
+            const std::byte* payload, std::size_t count, std::size_t width, std::uint64_t* fields ) noexcept
+        {
+            const std::uint64_t mask{ width == 64 ? ~std::uint64_t{ 0 } : ( std::uint64_t{ 1 } << width ) - 1 };
+            const auto words{ payloadWords( count, width ) };
+            std::size_t i{ 0 };
+
+            // Fields up to 57 bits wide fit in the 8 bytes starting at the byte holding their first
+            // bit; use one unaligned load while those 8 bytes stay inside the payload
+            if( width <= 57 )
+            {
+                for( ; i < count && ( ( i * width ) >> 3 ) + 8 <= words * 8; ++i )
+                {
+                    const auto position{ i * width };
+                    const auto word{ detail::loadLittleEndian64( payload + ( position >> 3 ) ) };
+                    fields[i] = ( word >> ( position & 7 ) ) & mask;
+                }
+            }
+
+            for( ; i < count; ++i )
+            {
+                fields[i] = readPacked( payload, words, i * width ) & mask;
+            }
+        }
+
+        //=====================================================================
+        // Scalar kernel
+        //=====================================================================
+
+        /**
+         * @brief Decode a block payload
+         * @param header Block header
+         * @param payload Packed delta-of-deltas (payloadWords() * 8 bytes)
+         * @param out Destination (header.count values)
+         */
+        void decodeBlockScalar( const BlockHeader& header, const std::byte* payload, std::int64_t* out ) noexcept
+        {
+            std::uint64_t ticks{ header.first };
+            std::uint64_t delta{ header.delta };
+            out[0] = static_cast<std::int64_t>( ticks );
+            if( header.count == 1 )
+            {
+                return;
+            }
+            ticks += delta;
+            out[1] = static_cast<std::int64_t>( ticks );
+
+            const auto width{ header.width };
+            if( width == 0 )
+            {
+                // Regular series: constant delta
+                for( std::size_t i{ 2 }; i < header.count; ++i )
+                {
+                    ticks += delta;
+                    out[i] = static_cast<std::int64_t>( ticks );
+                }
+                return;
+            }
+
+            const auto packedCount{ header.count - 2 };
+            std::uint64_t packed[BLOCK_SIZE];
+            unpackFields( payload, packedCount, width, packed );
+            for( std::size_t i{ 0 }; i < packedCount; ++i )
+            {
+                delta += zigzagDecode( packed[i] );
+                ticks += delta;
+                out[i + 2] = static_cast<std::int64_t>( ticks );
+            }
+        }
+
+#if defined( NFX_DATETIME_COLUMN_AVX2 )
+
+        //=====================================================================
+        // AVX2 kernel
+        //=====================================================================
+
+#    if defined( __GNUC__ ) || defined( __clang__ )
+#        define NFX_DATETIME_TARGET_AVX2 __attribute__( ( target( "avx2" ) ) )
+#    else
+#        define NFX_DATETIME_TARGET_AVX2
+#    endif
+
+        /** @brief Inclusive prefix sum across the four 64-bit lanes, plus carry in every lane */
+        NFX_DATETIME_TARGET_AVX2 inline __m256i prefixSum( __m256i values, __m256i carry ) noexcept
+        {
+            const __m256i zero{ _mm256_setzero_si256() };
+            values = _mm256_add_epi64(
+                values, _mm256_blend_epi32( zero, _mm256_permute4x64_epi64( values, 0x90 ), 0xFC ) );
+            values = _mm256_add_epi64(
+                values, _mm256_blend_epi32( zero, _mm256_permute4x64_epi64( values, 0x40 ), 0xF0 ) );
+
+            return _mm256_add_epi64( values, carry );
+        }
+
+        /** @brief AVX2 version of unpackFields(), gathering four fields per step */
+        NFX_DATETIME_TARGET_AVX2 void unpackFieldsAvx2(
+            const std::byte* payload, std::size_t count, std::size_t width, std::uint64_t* fields ) noexcept
+        {
+            // Each lane reads the 8 bytes starting at the byte holding its field's first bit,
+            // which covers fields up to 57 bits wide
+            if( width > 57 )
+            {
+                unpackFields( payload, count, width, fields );
+                return;
+            }
+
+            const auto payloadBytes{ payloadWords( count, width ) * 8 };
+            const __m256i mask{ _mm256_set1_epi64x( static_cast<long long>( ( std::uint64_t{ 1 } << width ) - 1 ) ) };
+            const __m256i seven{ _mm256_set1_epi64x( 7 ) };
+            const __m256i step{ _mm256_set1_epi64x( static_cast<long long>( 4 * width ) ) };
+            __m256i positions{ _mm256_setr_epi64x( 0,
+                static_cast<long long>( width ),
+                static_cast<long long>( 2 * width ),
+                static_cast<long long>( 3 * width ) ) };
+
+            std::size_t i{ 0 };
+            for( ; i + 4 <= count && ( ( ( i + 3 ) * width ) >> 3 ) + 8 <= payloadBytes; i += 4 )
+            {
+                const __m256i gathered{ _mm256_i64gather_epi64(
+                    reinterpret_cast<const long long*>( payload ), _mm256_srli_epi64( positions, 3 ), 1 ) };
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( fields + i ),
+                    _mm256_and_si256( _mm256_srlv_epi64( gathered, _mm256_and_si256( positions, seven ) ), mask ) );
+                positions = _mm256_add_epi64( positions, step );
+            }
+
+            // Last fields, whose 8-byte window would run past the payload
+            const auto words{ payloadWords( count, width ) };
+            for( ; i < count; ++i )
+            {
+                fields[i] = readPacked( payload, words, i * width ) & ( ( std::uint64_t{ 1 } << width ) - 1 );
+            }
+        }
+
+        NFX_DATETIME_TARGET_AVX2 void decodeBlockAvx2(
+            const BlockHeader& header, const std::byte* payload, std::int64_t* out ) noexcept
+        {
+            const auto width{ header.width };
+            if( width == 0 || header.count < 6 )
+            {
+                decodeBlockScalar( header, payload, out );
+                return;
+            }
+
+            // Pass 1: unpack the fields, independent of each other
+            const auto packedCount{ header.count - 2 };
+            alignas( 32 ) std::uint64_t packed[BLOCK_SIZE];
+            unpackFieldsAvx2( payload, packedCount, width, packed );
+
+            // Pass 2: zigzag decode and both prefix sums, four values per step
+            std::uint64_t ticks{ header.first };
+            std::uint64_t delta{ header.delta };
+            out[0] = static_cast<std::int64_t>( ticks );
+            ticks += delta;
+            out[1] = static_cast<std::int64_t>( ticks );
+
+            const __m256i one{ _mm256_set1_epi64x( 1 ) };
+            __m256i deltaCarry{ _mm256_set1_epi64x( static_cast<long long>( delta ) ) };
+            __m256i ticksCarry{ _mm256_set1_epi64x( static_cast<long long>( ticks ) ) };
+
+            std::size_t i{ 0 };
+            for( ; i + 4 <= packedCount; i += 4 )
+            {
+                const __m256i fields{ _mm256_load_si256( reinterpret_cast<const __m256i*>( packed + i ) ) };
+
+                // Zigzag decode: (v >> 1) ^ -(v & 1)
+                const __m256i dods{ _mm256_xor_si256( _mm256_srli_epi64( fields, 1 ),
+                    _mm256_sub_epi64( _mm256_setzero_si256(), _mm256_and_si256( fields, one ) ) ) };
+
+                const __m256i deltas{ prefixSum( dods, deltaCarry ) };
+                const __m256i values{ prefixSum( deltas, ticksCarry ) };
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + 2 + i ), values );
+
+                deltaCarry = _mm256_permute4x64_epi64( deltas, 0xFF );
+                ticksCarry = _mm256_permute4x64_epi64( values, 0xFF );
+            }
+
+            delta = static_cast<std::uint64_t>( _mm256_extract_epi64( deltaCarry, 0 ) );
+            ticks = static_cast<std::uint64_t>( _mm256_extract_epi64( ticksCarry, 0 ) );
+            for( ; i < packedCount; ++i )
+            {
+                delta += zigzagDecode( packed[i] );
+                ticks += delta;
+                out[2 + i] = static_cast<std::int64_t>( ticks );
+            }
+        }
+
+#    undef NFX_DATETIME_TARGET_AVX2
+
+#    if !defined( __AVX2__ )
+        /** @brief Function signature shared by the decoding kernels */
+        using DecodeFunction = void ( * )( const BlockHeader&, const std::byte*, std::int64_t* ) noexcept;
+
+        /** @brief Select the best kernel supported by the executing CPU */
+        [[nodiscard]] DecodeFunction selectDecodeFunction() noexcept
+        {
+#        if defined( _MSC_VER ) && !defined( __clang__ )
+            int info[4];
+            __cpuidex( info, 7, 0 );
+            const bool hasAvx2{ ( info[1] & ( 1 << 5 ) ) != 0 };
+#        else
+            const bool hasAvx2{ __builtin_cpu_supports( "avx2" ) != 0 };
+#        endif
+
+            return hasAvx2 ? &decodeBlockAvx2 : &decodeBlockScalar;
+        }
+#    endif
+#endif
+
+        /** @brief Decode a block payload with the best available kernel */
+        void decodeBlockPayload( const BlockHeader& header, const std::byte* payload, std::int64_t* out ) noexcept
+        {
+#if defined( NFX_DATETIME_COLUMN_AVX2 ) && defined( __AVX2__ )
+            decodeBlockAvx2( header, payload, out );
+#elif defined( NFX_DATETIME_COLUMN_AVX2 )
+            // Runtime CPU dispatch, resolved once
+            static const DecodeFunction decode{ selectDecodeFunction() };
+            decode( header, payload, out );
+#else
+            decodeBlockScalar( header, payload, out );
+#endif
+        }
+    } // namespace
+
+    //=====================================================================
+    // TimestampColumnEncoder class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Appending
+    //----------------------------------------------
+
+    void TimestampColumnEncoder::append( std::span<const std::int64_t> ticks )
+    {
+        while( !ticks.empty() )
+        {
+            const auto count{ std::min( ticks.size(), BLOCK_SIZE - m_pendingCount ) };
+            std::copy_n( ticks.begin(), count, m_pending.begin() + static_cast<std::ptrdiff_t>( m_pendingCount ) );
+            m_pendingCount += count;
+            ticks = ticks.subspan( count );
+            if( m_pendingCount == BLOCK_SIZE )
+            {
+                sealBlock();
+            }
+        }
+    }
+
+    void TimestampColumnEncoder::flush()
+    {
+        if( m_pendingCount != 0 )
+        {
+            sealBlock();
+        }
+    }
+
+    void TimestampColumnEncoder::clear() noexcept
+    {
+        m_pendingCount = 0;
+        m_sealedCount = 0;
+        m_blockCount = 0;
+        m_data.clear();
+    }
+
+    void TimestampColumnEncoder::sealBlock()
+    {
+        const auto count{ m_pendingCount };
+        const auto packedCount{ count < 2 ? 0 : count - 2 };
+
+        // Zigzag delta-of-deltas in wrapping arithmetic, and the widest of them
+        std::array<std::uint64_t, BLOCK_SIZE> zigzags;
+        std::uint64_t combined{ 0 };
+        for( std::size_t i{ 0 }; i < packedCount; ++i )
+        {
+            const auto t0{ static_cast<std::uint64_t>( m_pending[i] ) };
+            const auto t1{ static_cast<std::uint64_t>( m_pending[i + 1] ) };
+            const auto t2{ static_cast<std::uint64_t>( m_pending[i + 2] ) };
+            zigzags[i] = zigzagEncode( ( t2 - t1 ) - ( t1 - t0 ) );
+            combined |= zigzags[i];
+        }
+        const auto width{ static_cast<std::size_t>( 64 - std::countl_zero( combined ) ) };
+        const auto words{ payloadWords( packedCount, width ) };
+
+        const auto offset{ m_data.size() };
+        m_data.resize( offset + BLOCK_HEADER_SIZE + words * 8 );
+        auto* block{ m_data.data() + offset };
+
+        const auto first{ static_cast<std::uint64_t>( m_pending[0] ) };
+        const auto delta{ count < 2 ? 0 : static_cast<std::uint64_t>( m_pending[1] ) - first };
+        block[0] = static_cast<std::byte>( count );
+        block[1] = static_cast<std::byte>( count >> 8 );
+        block[2] = static_cast<std::byte>( width );
+        block[3] = std::byte{ 0 };
+        detail::storeLittleEndian64( block + 4, first );
+        detail::storeLittleEndian64( block + 12, delta );
+
+        // Pack least significant bit first into little-endian words
+        auto* payload{ block + BLOCK_HEADER_SIZE };
+        std::uint64_t word{ 0 };
+        std::size_t used{ 0 };
+        std::size_t wordIndex{ 0 };
+        for( std::size_t i{ 0 }; i < packedCount; ++i )
+        {
+            word |= zigzags[i] << used;
+            used += width;
+            if( used >= 64 )
+            {
+                detail::storeLittleEndian64( payload + wordIndex++ * 8, word );
+                used -= 64;
+                word = used == 0 ? 0 : zigzags[i] >> ( width - used );
+            }
+        }
+        if( used != 0 )
+        {
+            detail::storeLittleEndian64( payload + wordIndex * 8, word );
+        }
+
+        m_sealedCount += count;
+        ++m_blockCount;
+        m_pendingCount = 0;
+    }
+
+    //=====================================================================
+    // TimestampColumnDecoder class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    TimestampColumnDecoder::TimestampColumnDecoder( std::span<const std::byte> data ) noexcept
+        : m_data{ data }
+    {
+    }
+
+    //----------------------------------------------
+    // Static factory methods
+    //----------------------------------------------
+
+    std::optional<TimestampColumnDecoder> TimestampColumnDecoder::open( std::span<const std::byte> data )
+    {
+        TimestampColumnDecoder decoder{ data };
+        decoder.m_firstRows.push_back( 0 );
+
+        std::size_t offset{ 0 };
+        while( offset < data.size() )
+        {
+            if( data.size() - offset < TimestampColumnEncoder::BLOCK_HEADER_SIZE )
+            {
+                return std::nullopt;
+            }
+
+            const auto header{ readHeader( data.data() + offset ) };
+            if( header.count == 0 || header.count > BLOCK_SIZE || header.width > 64 ||
+                data[offset + 3] != std::byte{ 0 } )
+            {
+                return std::nullopt;
+            }
+
+            const auto blockBytes{ TimestampColumnEncoder::BLOCK_HEADER_SIZE +
+                                   payloadWords( header.count < 2 ? 0 : header.count - 2, header.width ) * 8 };
+            if( data.size() - offset < blockBytes )
+            {
+                return std::nullopt;
+            }
+
+            decoder.m_blockOffsets.push_back( offset );
+            decoder.m_firstRows.push_back( decoder.m_firstRows.back() + header.count );
+            offset += blockBytes;
+        }
+
+        return decoder;
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    std::size_t TimestampColumnDecoder::findBlock( std::size_t row ) const noexcept
+    {
+        const auto next{ std::upper_bound( m_firstRows.begin(), m_firstRows.end(), row ) };
+
+        return static_cast<std::size_t>( next - m_firstRows.begin() ) - 1;
+    }
+
+    //----------------------------------------------
+    // Decoding
+    //----------------------------------------------
+
+    std::size_t TimestampColumnDecoder::decodeBlock( std::size_t block, std::span<std::int64_t> out ) const noexcept
+    {
+        if( block >= blockCount() || out.size() < blockSize( block ) )
+        {
+            return 0;
+        }
+
+        const auto* data{ m_data.data() + m_blockOffsets[block] };
+        const auto header{ readHeader( data ) };
+        decodeBlockPayload( header, data + TimestampColumnEncoder::BLOCK_HEADER_SIZE, out.data() );
+
+        return header.count;
+    }
+
+    std::size_t TimestampColumnDecoder::decodeBlock( std::size_t block, std::span<DateTime> out ) const noexcept
+    {
+        std::array<std::int64_t, BLOCK_SIZE> ticks;
+        const auto count{ decodeBlock( block, std::span{ ticks }.first( std::min( out.size(), BLOCK_SIZE ) ) ) };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[i] = DateTime{ ticks[i] };
+        }
+
+        return count;
+    }
+
+    std::size_t TimestampColumnDecoder::decode( std::span<std::int64_t> out ) const noexcept
+    {
+        if( out.size() < size() )
+        {
+            return 0;
+        }
+
+        for( std::size_t block{ 0 }; block < blockCount(); ++block )
+        {
+            (void)decodeBlock( block, out.subspan( m_firstRows[block] ) );
+        }
+
+        return size();
+    }
+} // namespace nfx::time
@@ -0,0 +1,246 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampFormatter.cpp
+ * @brief Implementation of the incremental TimestampFormatter
+ */
+
+#include "nfx/datetime/TimestampFormatter.h"
+#include "Internal.h"
+
+#include <cstring>
+
+namespace nfx::time
+{
+    //=====================================================================
+    // TimestampFormatter class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    TimestampFormatter::TimestampFormatter( DateTime::Format format ) noexcept
+        : m_format{ format }
+    {
+    }
+
+    //----------------------------------------------
+    // Formatting
+    //----------------------------------------------
+
+    std::string_view TimestampFormatter::format( const DateTime& dateTime ) noexcept
+    {
+        return render( dateTime.ticks(), NO_OFFSET, nullptr );
+    }
+
+    std::string_view TimestampFormatter::format( const DateTimeOffset& dateTimeOffset ) noexcept
+    {
+        return render( dateTimeOffset.ticks(), dateTimeOffset.totalOffsetMinutes(), &dateTimeOffset );
+    }
+
+    void TimestampFormatter::reset() noexcept
+    {
+        m_secondTicks = -1;
+        m_offsetMinutes = NO_OFFSET;
+    }
+
+    //----------------------------------------------
+    // Property accessors
+    //----------------------------------------------
+
+    DateTime::Format TimestampFormatter::outputFormat() const noexcept
+    {
+        return m_format;
+    }
+
+    //----------------------------------------------
+    // Rendering
+    //----------------------------------------------
+
+    std::string_view TimestampFormatter::render(
+        std::int64_t localTicks, std::int32_t offsetMinutes, const DateTimeOffset* source ) noexcept
+    {
+        const auto secondTicks{ localTicks - localTicks % constants::TICKS_PER_SECOND };
+
+        if( m_secondTicks < 0 || offsetMinutes != m_offsetMinutes )
+        {
+            renderFull( localTicks, offsetMinutes, source );
+        }
+        else if( secondTicks == m_secondTicks )
+        {
+            // Same second: only the fraction can differ
+            writeTail( localTicks );
+        }
+        else if( m_format == DateTime::Format::Iso8601Date &&
+                 localTicks / constants::TICKS_PER_DAY == m_secondTicks / constants::TICKS_PER_DAY )
+        {
+            // Same day: the date text is unchanged
+            m_secondTicks = secondTicks;
+        }
+        else if( m_hourPosition >= 0 &&
+                 localTicks / constants::TICKS_PER_DAY == m_secondTicks / constants::TICKS_PER_DAY )
+        {
+            // Same day: patch the time of day digits, minutes and hours only when they changed
+            const auto secondOfDay{ static_cast<std::int32_t>(
+                ( secondTicks % constants::TICKS_PER_DAY ) / constants::TICKS_PER_SECOND ) };
+            if( secondTicks / constants::TICKS_PER_MINUTE != m_secondTicks / constants::TICKS_PER_MINUTE )
+            {
+                internal::appendTwoDigits( m_buffer + m_hourPosition, secondOfDay / constants::SECONDS_PER_HOUR );
+                internal::appendTwoDigits( m_buffer + m_minutePosition,
+                    ( secondOfDay / constants::SECONDS_PER_MINUTE ) % constants::MINUTES_PER_HOUR );
+            }
+            internal::appendTwoDigits( m_buffer + m_secondPosition, secondOfDay % constants::SECONDS_PER_MINUTE );
+
+            m_secondTicks = secondTicks;
+            writeTail( localTicks );
+        }
+        else
+        {
+            renderFull( localTicks, offsetMinutes, source );
+        }
+
+        return std::string_view{ m_buffer, m_length };
+    }
+
+    void TimestampFormatter::renderFull(
+        std::int64_t localTicks, std::int32_t offsetMinutes, const DateTimeOffset* source ) noexcept
+    {
+        const auto length{ source != nullptr
+                               ? source->formatTo( m_buffer, sizeof( m_buffer ), m_format )
+                               : DateTime{ localTicks }.formatTo( m_buffer, sizeof( m_buffer ), m_format ) };
+        m_length = static_cast<std::uint8_t>( length );
+
+        // Field positions of each layout (years always render as four digits)
+        m_hourPosition = -1;
+        m_minutePosition = -1;
+        m_secondPosition = -1;
+        switch( m_format )
+        {
+            case DateTime::Format::Iso8601:
+            case DateTime::Format::Iso8601Precise:
+            case DateTime::Format::Iso8601PreciseTrimmed:
+            case DateTime::Format::Iso8601Millis:
+            case DateTime::Format::Iso8601Micros:
+            case DateTime::Format::Iso8601Extended:
+            {
+                // YYYY-MM-DDTHH:mm:ss
+                m_hourPosition = 11;
+                m_minutePosition = 14;
+                m_secondPosition = 17;
+                m_prefixLength = 19;
+                break;
+            }
+            case DateTime::Format::Iso8601Basic:
+            {
+                // YYYYMMDDTHHMMSS
+                m_hourPosition = 9;
+                m_minutePosition = 11;
+                m_secondPosition = 13;
+                m_prefixLength = 15;
+                break;
+            }
+            case DateTime::Format::Iso8601Time:
+            {
+                // HH:mm:ss
+                m_hourPosition = 0;
+                m_minutePosition = 3;
+                m_secondPosition = 6;
+                m_prefixLength = 8;
+                break;
+            }
+            case DateTime::Format::Iso8601Date:
+            case DateTime::Format::UnixSeconds:
+            {
+                // Whole text depends only on the day or second
+                m_prefixLength = m_length;
+                break;
+            }
+            case DateTime::Format::UnixMilliseconds:
+            default:
+            {
+                // Not cached: every call renders from scratch
+                m_prefixLength = m_length;
+                m_suffixLength = 0;
+                m_secondTicks = -1;
+                m_offsetMinutes = NO_OFFSET;
+                return;
+            }
+        }
+
+        // Suffix: whatever follows the optional fraction (UTC designator or numeric offset)
+        std::size_t suffixStart{ m_prefixLength };
+        while( suffixStart < m_length &&
+               ( m_buffer[suffixStart] == '.' || ( m_buffer[suffixStart] >= '0' && m_buffer[suffixStart] <= '9' ) ) )
+        {
+            ++suffixStart;
+        }
+        m_suffixLength = static_cast<std::uint8_t>( m_length - suffixStart );
+        std::memcpy( m_suffix, m_buffer + suffixStart, m_suffixLength );
+
+        m_secondTicks = localTicks - localTicks % constants::TICKS_PER_SECOND;
+        m_offsetMinutes = offsetMinutes;
+    }
+
+    void TimestampFormatter::writeTail( std::int64_t localTicks ) noexcept
+    {
+        const auto subsecondTicks{ static_cast<std::int32_t>( localTicks % constants::TICKS_PER_SECOND ) };
+
+        char* out{ m_buffer + m_prefixLength };
+        switch( m_format )
+        {
+            case DateTime::Format::Iso8601Precise:
+            {
+                out = internal::appendFractionalSeconds( out, subsecondTicks, 7 );
+                break;
+            }
+            case DateTime::Format::Iso8601PreciseTrimmed:
+            {
+                out = internal::appendFractionalSecondsTrimmed( out, subsecondTicks );
+                break;
+            }
+            case DateTime::Format::Iso8601Millis:
+            {
+                out = internal::appendFractionalSeconds(
+                    out, static_cast<std::int32_t>( subsecondTicks / constants::TICKS_PER_MILLISECOND ), 3 );
+                break;
+            }
+            case DateTime::Format::Iso8601Micros:
+            {
+                out = internal::appendFractionalSeconds(
+                    out, static_cast<std::int32_t>( subsecondTicks / constants::TICKS_PER_MICROSECOND ), 6 );
+                break;
+            }
+            default:
+            {
+                // No fraction: the rendered text already ends with the suffix
+                return;
+            }
+        }
+
+        std::memcpy( out, m_suffix, m_suffixLength );
+        m_length = static_cast<std::uint8_t>( out + m_suffixLength - m_buffer );
+    }
+} // namespace nfx::time
@@ -0,0 +1,376 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TimestampPipeline.cpp
+ * @brief Chunk splitting, worker pool and block conversion behind TimestampPipeline
+ */
+
+#include "nfx/datetime/TimestampPipeline.h"
+#include "nfx/datetime/Bulk.h"
+#include "nfx/datetime/DateTimeOffset.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace nfx::time
+{
+    namespace
+    {
+        //=====================================================================
+        // Chunking
+        //=====================================================================
+
+        /** @brief Records converted per parseMany() call (stack buffers stay within L1) */
+        constexpr std::size_t BLOCK_SIZE{ 256 };
+
+        /** @brief Byte range of the buffer ending on a record boundary */
+        struct Chunk
+        {
+            std::size_t begin{ 0 };
+            std::size_t end{ 0 };
+            std::size_t firstRow{ 0 };
+            std::size_t records{ 0 };
+            std::size_t converted{ 0 };
+            std::size_t parsed{ 0 };
+        };
+
+        /** @brief Cut the buffer after the first delimiter at or past every chunkBytes boundary */
+        std::vector<Chunk> splitChunks( std::string_view buffer, char delimiter, std::size_t chunkBytes )
+        {
+            std::vector<Chunk> chunks;
+            chunks.reserve( buffer.size() / chunkBytes + 1 );
+
+            std::size_t begin{ 0 };
+            while( begin < buffer.size() )
+            {
+                auto end{ std::min( begin + chunkBytes, buffer.size() ) };
+                if( end < buffer.size() )
+                {
+                    const auto cut{ buffer.find( delimiter, end - 1 ) };
+                    end = cut == std::string_view::npos ? buffer.size() : cut + 1;
+                }
+
+                chunks.push_back( Chunk{ begin, end } );
+                begin = end;
+            }
+
+            return chunks;
+        }
+
+        /** @brief One record per delimiter, plus a final record without one */
+        std::size_t countDelimited( std::string_view text, char delimiter ) noexcept
+        {
+            const auto delimiters{ static_cast<std::size_t>( std::count( text.begin(), text.end(), delimiter ) ) };
+
+            return delimiters + ( !text.empty() && text.back() != delimiter ? 1 : 0 );
+        }
+
+        //=====================================================================
+        // Conversion
+        //=====================================================================
+
+        /** @brief Parse one block of records and write rows [firstRow, firstRow + count) */
+        std::size_t convertBlock( std::span<const std::string_view> records,
+            std::size_t firstRow,
+            const TimestampPipeline::Columns& columns,
+            const TimeSpan& bucket ) noexcept
+        {
+            const auto count{ records.size() };
+            DateTimeOffset values[BLOCK_SIZE];
+            DateTime utc[BLOCK_SIZE];
+            std::uint8_t ok[BLOCK_SIZE];
+
+            const auto parsed{ DateTimeOffset::parseMany( records, { values, count }, { ok, count } ) };
+
+            // Failed records hold a default DateTimeOffset, so their rows get its defaults too
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                utc[i] = values[i].utcDateTime();
+            }
+
+            if( !columns.utc.empty() )
+            {
+                std::copy_n( utc, count, columns.utc.begin() + static_cast<std::ptrdiff_t>( firstRow ) );
+            }
+            if( !columns.packed.empty() )
+            {
+                bulk::pack( { values, count }, columns.packed.subspan( firstRow, count ) );
+            }
+            if( !columns.buckets.empty() )
+            {
+                bulk::floor( { utc, count }, bucket, columns.buckets.subspan( firstRow, count ) );
+            }
+            if( !columns.ok.empty() )
+            {
+                std::copy_n( ok, count, columns.ok.begin() + static_cast<std::ptrdiff_t>( firstRow ) );
+            }
+
+            return parsed;
+        }
+
+        /**
+         * @brief Tokenize a chunk into blocks of records and convert rows below rowLimit
+         * @return Number of bytes of the chunk consumed (all of it unless rowLimit was reached)
+         */
+        std::size_t convertChunk( std::string_view text,
+            Chunk& chunk,
+            std::size_t rowLimit,
+            const TimestampPipeline::Columns& columns,
+            const TimestampPipeline::Options& options ) noexcept
+        {
+            std::string_view records[BLOCK_SIZE];
+            std::size_t pending{ 0 };
+            std::size_t row{ chunk.firstRow };
+
+            const char* p{ text.data() };
+            const char* const last{ p + text.size() };
+            while( p != last && row + pending < rowLimit )
+            {
+                const auto* found{ static_cast<const char*>(
+                    std::memchr( p, options.delimiter, static_cast<std::size_t>( last - p ) ) ) };
+                const char* end{ found != nullptr ? found : last };
+
+                std::string_view record{ p, static_cast<std::size_t>( end - p ) };
+                if( options.delimiter == '\n' && !record.empty() && record.back() == '\r' )
+                {
+                    record.remove_suffix( 1 );
+                }
+                records[pending++] = record;
+                p = found != nullptr ? found + 1 : last;
+
+                if( pending == BLOCK_SIZE )
+                {
+                    chunk.parsed += convertBlock( { records, pending }, row, columns, options.bucket );
+                    row += pending;
+                    pending = 0;
+                }
+            }
+
+            if( pending != 0 )
+            {
+                chunk.parsed += convertBlock( { records, pending }, row, columns, options.bucket );
+                row += pending;
+            }
+            chunk.converted = row - chunk.firstRow;
+
+            return static_cast<std::size_t>( p - text.data() );
+        }
+
+        /** @brief Rows every non-empty column can hold (unlimited without columns) */
+        std::size_t rowCapacity( const TimestampPipeline::Columns& columns ) noexcept
+        {
+            auto capacity{ std::numeric_limits<std::size_t>::max() };
+            for( const auto size :
+                { columns.utc.size(), columns.packed.size(), columns.buckets.size(), columns.ok.size() } )
+            {
+                if( size != 0 )
+                {
+                    capacity = std::min( capacity, size );
+                }
+            }
+
+            return capacity;
+        }
+    } // namespace
+
+    //=====================================================================
+    // TimestampPipeline class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    TimestampPipeline::TimestampPipeline( unsigned threads )
+    {
+        if( threads == 0 )
+        {
+            threads = std::max( 1u, std::thread::hardware_concurrency() );
+        }
+
+        m_workers.reserve( threads - 1 );
+        for( unsigned i{ 1 }; i < threads; ++i )
+        {
+            m_workers.emplace_back( [this]( std::stop_token stopToken ) { workerLoop( stopToken ); } );
+        }
+    }
+
+    TimestampPipeline::~TimestampPipeline()
+    {
+        for( auto& worker : m_workers )
+        {
+            worker.request_stop();
+        }
+    }
+
+    //----------------------------------------------
+    // Conversion
+    //----------------------------------------------
+
+    TimestampPipeline::Result TimestampPipeline::run(
+        std::string_view buffer, const Columns& columns, const Options& options )
+    {
+        std::lock_guard runLock{ m_runMutex };
+
+        Result result;
+        const auto rowLimit{ rowCapacity( columns ) };
+
+        // Without workers, one pass over the whole buffer: no chunk table and no counting pass
+        if( m_workers.empty() )
+        {
+            Chunk whole{ 0, buffer.size() };
+            const auto consumed{ convertChunk( buffer, whole, rowLimit, columns, options ) };
+            const auto remaining{ countDelimited( buffer.substr( consumed ), options.delimiter ) };
+
+            result.converted = whole.converted;
+            result.records = whole.converted + remaining;
+            result.parsed = whole.parsed;
+
+            return result;
+        }
+
+        auto chunks{ splitChunks( buffer, options.delimiter, std::max<std::size_t>( options.chunkBytes, 1 ) ) };
+        const auto chunkText{ [&]( const Chunk& chunk ) {
+            return buffer.substr( chunk.begin, chunk.end - chunk.begin );
+        } };
+
+        parallelFor( chunks.size(), [&]( std::size_t i ) {
+            chunks[i].records = countDelimited( chunkText( chunks[i] ), options.delimiter );
+        } );
+
+        for( auto& chunk : chunks )
+        {
+            chunk.firstRow = result.records;
+            result.records += chunk.records;
+        }
+
+        parallelFor( chunks.size(), [&]( std::size_t i ) {
+            if( chunks[i].firstRow < rowLimit )
+            {
+                convertChunk( chunkText( chunks[i] ), chunks[i], rowLimit, columns, options );
+            }
+        } );
+
+        for( const auto& chunk : chunks )
+        {
+            result.converted += chunk.converted;
+            result.parsed += chunk.parsed;
+        }
+
+        return result;
+    }
+
+    TimestampPipeline::Result TimestampPipeline::run( std::string_view buffer, const Columns& columns )
+    {
+        return run( buffer, columns, Options{} );
+    }
+
+    std::size_t TimestampPipeline::countRecords( std::string_view buffer, char delimiter ) noexcept
+    {
+        return countDelimited( buffer, delimiter );
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    unsigned TimestampPipeline::threadCount() const noexcept
+    {
+        return static_cast<unsigned>( m_workers.size() ) + 1;
+    }
+
+    //----------------------------------------------
+    // Scheduling
+    //----------------------------------------------
+
+    void TimestampPipeline::parallelFor( std::size_t count, const std::function<void( std::size_t )>& task )
+    {
+        if( m_workers.empty() || count <= 1 )
+        {
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                task( i );
+            }
+
+            return;
+        }
+
+        {
+            std::lock_guard lock{ m_mutex };
+            m_task = &task;
+            m_taskCount = count;
+            m_nextItem.store( 0, std::memory_order_relaxed );
+            m_busyWorkers = static_cast<unsigned>( m_workers.size() );
+            ++m_generation;
+        }
+        m_wakeUp.notify_all();
+
+        drain( task, count );
+
+        // Workers publish their chunk results through the mutex when they check in
+        std::unique_lock lock{ m_mutex };
+        m_done.wait( lock, [this] { return m_busyWorkers == 0; } );
+        m_task = nullptr;
+    }
+
+    void TimestampPipeline::drain( const std::function<void( std::size_t )>& task, std::size_t count ) noexcept
+    {
+        for( auto i{ m_nextItem.fetch_add( 1, std::memory_order_relaxed ) }; i < count;
+            i = m_nextItem.fetch_add( 1, std::memory_order_relaxed ) )
+        {
+            task( i );
+        }
+    }
+
+    void TimestampPipeline::workerLoop( std::stop_token stopToken ) noexcept
+    {
+        std::uint64_t seenGeneration{ 0 };
+        while( true )
+        {
+            const std::function<void( std::size_t )>* task;
+            std::size_t count;
+            {
+                std::unique_lock lock{ m_mutex };
+                if( !m_wakeUp.wait( lock, stopToken, [&] { return m_generation != seenGeneration; } ) )
+                {
+                    return;
+                }
+
+                seenGeneration = m_generation;
+                task = m_task;
+                count = m_taskCount;
+            }
+
+            drain( *task, count );
+
+            std::lock_guard lock{ m_mutex };
+            if( --m_busyWorkers == 0 )
+            {
+                m_done.notify_one();
+            }
+        }
+    }
+} // namespace nfx::time
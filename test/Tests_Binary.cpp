@@ -0,0 +1,279 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_Binary.cpp
+ * @brief Unit tests for the binary wire format
+ * @details Checks the documented byte layouts, round trips across the full value range,
+ *          bulk span overloads and rejection of truncated or out-of-range input
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#include <nfx/datetime/Binary.h>
+
+namespace nfx::time::test
+{
+    namespace
+    {
+        /** @brief Build a byte array from integer literals */
+        template <typename... Bytes>
+        constexpr std::array<std::byte, sizeof...( Bytes )> bytes( Bytes... values ) noexcept
+        {
+            return { static_cast<std::byte>( values )... };
+        }
+    } // namespace
+
+    //=====================================================================
+    // Fixed-width layout
+    //=====================================================================
+
+    TEST( BinaryFixed, DateTimeLayout )
+    {
+        std::array<std::byte, binary::FIXED_SIZE> buffer{};
+        EXPECT_EQ( binary::encode( DateTime{ 0x0102030405060708LL }, buffer ), binary::FIXED_SIZE );
+        EXPECT_EQ( buffer, ( bytes( 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01 ) ) );
+
+        DateTime decoded;
+        EXPECT_EQ( binary::decode( buffer, decoded ), binary::FIXED_SIZE );
+        EXPECT_EQ( decoded.ticks(), 0x0102030405060708LL );
+    }
+
+    TEST( BinaryFixed, TimeSpanLayout )
+    {
+        std::array<std::byte, binary::FIXED_SIZE> buffer{};
+        EXPECT_EQ( binary::encode( TimeSpan{ -2 }, buffer ), binary::FIXED_SIZE );
+        EXPECT_EQ( buffer, ( bytes( 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ) ) );
+
+        TimeSpan decoded;
+        EXPECT_EQ( binary::decode( buffer, decoded ), binary::FIXED_SIZE );
+        EXPECT_EQ( decoded.ticks(), -2 );
+    }
+
+    TEST( BinaryFixed, DateTimeOffsetLayout )
+    {
+        const DateTimeOffset value{ DateTime{ 0x10LL }, TimeSpan::fromMinutes( -330 ) };
+
+        std::array<std::byte, binary::OFFSET_FIXED_SIZE> buffer{};
+        EXPECT_EQ( binary::encode( value, buffer ), binary::OFFSET_FIXED_SIZE );
+        EXPECT_EQ( buffer, ( bytes( 0x10, 0, 0, 0, 0, 0, 0, 0, 0xB6, 0xFE ) ) );
+
+        DateTimeOffset decoded;
+        EXPECT_EQ( binary::decode( buffer, decoded ), binary::OFFSET_FIXED_SIZE );
+        EXPECT_EQ( decoded.dateTime().ticks(), 0x10LL );
+        EXPECT_EQ( decoded.totalOffsetMinutes(), -330 );
+    }
+
+    TEST( BinaryFixed, RoundTripExtremes )
+    {
+        std::array<std::byte, binary::OFFSET_FIXED_SIZE> buffer{};
+        for( const auto& value : { DateTimeOffset{ DateTime::min(), TimeSpan::fromHours( 14 ) },
+                 DateTimeOffset{ DateTime::max(), TimeSpan::fromHours( -14 ) },
+                 DateTimeOffset{ DateTime{ 2024, 2, 29, 23, 59, 59, 999 }, TimeSpan::fromMinutes( 345 ) } } )
+        {
+            DateTimeOffset decoded;
+            ASSERT_EQ( binary::encode( value, buffer ), binary::OFFSET_FIXED_SIZE );
+            ASSERT_EQ( binary::decode( buffer, decoded ), binary::OFFSET_FIXED_SIZE );
+            EXPECT_EQ( decoded.dateTime(), value.dateTime() );
+            EXPECT_EQ( decoded.offset(), value.offset() );
+        }
+
+        for( const auto& value : { TimeSpan{ std::numeric_limits<std::int64_t>::min() },
+                 TimeSpan{ std::numeric_limits<std::int64_t>::max() },
+                 TimeSpan{ 0 } } )
+        {
+            TimeSpan decoded;
+            ASSERT_EQ( binary::encode( value, buffer ), binary::FIXED_SIZE );
+            ASSERT_EQ( binary::decode( buffer, decoded ), binary::FIXED_SIZE );
+            EXPECT_EQ( decoded, value );
+        }
+    }
+
+    TEST( BinaryFixed, RejectShortOrInvalidInput )
+    {
+        std::array<std::byte, binary::OFFSET_FIXED_SIZE> buffer{};
+        DateTime dateTime;
+        DateTimeOffset dateTimeOffset;
+        TimeSpan timeSpan;
+
+        EXPECT_EQ( binary::encode( DateTime::now(), std::span{ buffer }.first( 7 ) ), 0 );
+        EXPECT_EQ( binary::encode( DateTimeOffset::now(), std::span{ buffer }.first( 9 ) ), 0 );
+        EXPECT_EQ( binary::decode( std::span{ buffer }.first( 7 ), dateTime ), 0 );
+        EXPECT_EQ( binary::decode( std::span{ buffer }.first( 7 ), timeSpan ), 0 );
+        EXPECT_EQ( binary::decode( std::span{ buffer }.first( 9 ), dateTimeOffset ), 0 );
+
+        // Negative ticks
+        buffer = bytes( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0, 0 );
+        EXPECT_EQ( binary::decode( buffer, dateTime ), 0 );
+        EXPECT_EQ( binary::decode( buffer, dateTimeOffset ), 0 );
+
+        // Offset of +14:01
+        buffer = bytes( 0, 0, 0, 0, 0, 0, 0, 0, 0x49, 0x03 );
+        EXPECT_EQ( binary::decode( buffer, dateTimeOffset ), 0 );
+    }
+
+    //=====================================================================
+    // Variable-length layout
+    //=====================================================================
+
+    TEST( BinaryVarint, Layout )
+    {
+        std::array<std::byte, binary::MAX_VARINT_OFFSET_SIZE> buffer{};
+
+        EXPECT_EQ( binary::encodeVarint( DateTime{ 300LL }, buffer ), 2 );
+        EXPECT_EQ( buffer[0], std::byte{ 0xAC } );
+        EXPECT_EQ( buffer[1], std::byte{ 0x02 } );
+
+        EXPECT_EQ( binary::encodeVarint( TimeSpan{ -1 }, buffer ), 1 );
+        EXPECT_EQ( buffer[0], std::byte{ 0x01 } );
+
+        EXPECT_EQ( binary::encodeVarint( DateTimeOffset{ DateTime{ 1LL }, TimeSpan::fromMinutes( 90 ) }, buffer ), 3 );
+        EXPECT_EQ( buffer[0], std::byte{ 0x01 } );
+        EXPECT_EQ( buffer[1], std::byte{ 0xB4 } );
+        EXPECT_EQ( buffer[2], std::byte{ 0x01 } );
+
+        EXPECT_EQ( binary::encodeVarint( DateTime::max(), buffer ), binary::MAX_VARINT_SIZE );
+        EXPECT_EQ( binary::encodeVarint( TimeSpan{ std::numeric_limits<std::int64_t>::min() }, buffer ),
+            binary::MAX_VARINT_TIMESPAN_SIZE );
+        EXPECT_EQ( binary::encodeVarint( DateTimeOffset{ DateTime::max(), TimeSpan::fromHours( -14 ) }, buffer ),
+            binary::MAX_VARINT_OFFSET_SIZE );
+    }
+
+    TEST( BinaryVarint, RoundTrip )
+    {
+        std::array<std::byte, binary::MAX_VARINT_OFFSET_SIZE> buffer{};
+
+        for( const auto& value : { TimeSpan{ std::numeric_limits<std::int64_t>::min() },
+                 TimeSpan{ std::numeric_limits<std::int64_t>::max() },
+                 TimeSpan{ 0 },
+                 TimeSpan{ -64 },
+                 TimeSpan{ 64 } } )
+        {
+            TimeSpan decoded;
+            const auto length{ binary::encodeVarint( value, buffer ) };
+            ASSERT_NE( length, 0 );
+            EXPECT_EQ( binary::decodeVarint( std::span{ buffer }.first( length ), decoded ), length );
+            EXPECT_EQ( decoded, value );
+        }
+
+        for( const auto& value : { DateTimeOffset{ DateTime::min(), TimeSpan::fromHours( 14 ) },
+                 DateTimeOffset{ DateTime::max(), TimeSpan::fromMinutes( -840 ) },
+                 DateTimeOffset{ DateTime{ 2025, 6, 15, 8, 30, 0 }, TimeSpan::fromMinutes( 0 ) } } )
+        {
+            DateTimeOffset decoded;
+            const auto length{ binary::encodeVarint( value, buffer ) };
+            ASSERT_NE( length, 0 );
+            EXPECT_EQ( binary::decodeVarint( std::span{ buffer }.first( length ), decoded ), length );
+            EXPECT_EQ( decoded.dateTime(), value.dateTime() );
+            EXPECT_EQ( decoded.offset(), value.offset() );
+        }
+    }
+
+    TEST( BinaryVarint, RejectMalformedInput )
+    {
+        DateTime dateTime;
+        TimeSpan timeSpan;
+        DateTimeOffset dateTimeOffset;
+
+        // Truncated
+        EXPECT_EQ( binary::decodeVarint( bytes( 0x80, 0x80 ), dateTime ), 0 );
+        EXPECT_EQ( binary::decodeVarint( std::span<const std::byte>{}, timeSpan ), 0 );
+        EXPECT_EQ( binary::decodeVarint( bytes( 0x01 ), dateTimeOffset ), 0 );
+
+        // More than 64 bits
+        EXPECT_EQ(
+            binary::decodeVarint( bytes( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02 ), timeSpan ), 0 );
+
+        // Overlong (non-minimal) encodings
+        EXPECT_EQ( binary::decodeVarint( bytes( 0x80, 0x00 ), dateTime ), 0 );
+        EXPECT_EQ( binary::decodeVarint( bytes( 0x81, 0x80, 0x00 ), timeSpan ), 0 );
+        EXPECT_EQ( binary::decodeVarint( bytes( 0x02, 0x80, 0x00 ), dateTimeOffset ), 0 );
+
+        // Ticks beyond DateTime::max()
+        EXPECT_EQ( binary::decodeVarint( bytes( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F ), dateTime ), 0 );
+
+        // Offset of +14:01 (zigzag 1682)
+        EXPECT_EQ( binary::decodeVarint( bytes( 0x00, 0x92, 0x0D ), dateTimeOffset ), 0 );
+
+        // Output too small
+        std::array<std::byte, 2> small{};
+        EXPECT_EQ( binary::encodeVarint( DateTime::max(), small ), 0 );
+    }
+
+    //=====================================================================
+    // Bulk overloads
+    //=====================================================================
+
+    TEST( BinaryBulk, FixedRoundTrip )
+    {
+        std::vector<DateTimeOffset> values;
+        for( std::int32_t i{ 0 }; i < 100; ++i )
+        {
+            const auto offsetMinutes{ ( i % 57 ) * 15 - 420 };
+            values.emplace_back( DateTime{ 2000 + i, 1 + i % 12, 1 + i % 28 }, TimeSpan::fromMinutes( offsetMinutes ) );
+        }
+
+        std::vector<std::byte> buffer( values.size() * binary::OFFSET_FIXED_SIZE );
+        const auto shortBuffer{ std::span{ buffer }.first( buffer.size() - 1 ) };
+        EXPECT_EQ( binary::encode( std::span<const DateTimeOffset>{ values }, shortBuffer ), 0 );
+        ASSERT_EQ( binary::encode( std::span<const DateTimeOffset>{ values }, buffer ), buffer.size() );
+
+        std::vector<DateTimeOffset> decoded( values.size() );
+        ASSERT_EQ( binary::decode( buffer, std::span{ decoded } ), values.size() );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            EXPECT_EQ( decoded[i].dateTime(), values[i].dateTime() );
+            EXPECT_EQ( decoded[i].offset(), values[i].offset() );
+        }
+
+        // Decoding stops at the first invalid record
+        buffer[5 * binary::OFFSET_FIXED_SIZE + 7] = std::byte{ 0xFF };
+        EXPECT_EQ( binary::decode( buffer, std::span{ decoded } ), 5 );
+    }
+
+    TEST( BinaryBulk, VarintRoundTrip )
+    {
+        std::vector<TimeSpan> values;
+        for( std::int64_t i{ -50 }; i < 50; ++i )
+        {
+            values.emplace_back( i * i * i * 1'000'003LL );
+        }
+
+        std::vector<std::byte> buffer( values.size() * binary::MAX_VARINT_TIMESPAN_SIZE );
+        const auto written{ binary::encodeVarint( std::span<const TimeSpan>{ values }, buffer ) };
+        ASSERT_NE( written, 0 );
+        EXPECT_LT( written, values.size() * binary::FIXED_SIZE );
+
+        std::vector<TimeSpan> decoded( values.size() );
+        std::size_t consumed{ 0 };
+        const auto encoded{ std::span{ buffer }.first( written ) };
+        ASSERT_EQ( binary::decodeVarint( encoded, std::span{ decoded }, consumed ), values.size() );
+        EXPECT_EQ( consumed, written );
+        EXPECT_EQ( decoded, values );
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,362 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_Bulk.cpp
+ * @brief Unit tests for the span kernels
+ * @details Compares every kernel against the matching member function on random values across
+ *          the full DateTime range, odd lengths (vector body plus scalar tail), in-place use and
+ *          empty input
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <nfx/datetime/Bulk.h>
+
+namespace nfx::time::test
+{
+    namespace
+    {
+        /** @brief Random valid DateTime values, with day, hour, second and epoch boundaries mixed in */
+        std::vector<DateTime> randomDateTimes( std::size_t count )
+        {
+            std::mt19937_64 rng{ 20241014 };
+            std::uniform_int_distribution<std::int64_t> distribution{
+                DateTime::min().ticks(), DateTime::max().ticks() };
+
+            std::vector<DateTime> values;
+            values.reserve( count );
+            values.push_back( DateTime::min() );
+            values.push_back( DateTime::max() );
+            values.push_back( DateTime::epoch() );
+            values.push_back( DateTime{ DateTime::epoch().ticks() - 1 } );
+            values.push_back( DateTime{ DateTime::epoch().ticks() + 1 } );
+            values.push_back( DateTime{ 1969, 12, 31, 23, 59, 59, 999 } );
+            values.push_back( DateTime{ 2024, 2, 29, 23, 0, 0 } );
+            while( values.size() < count )
+            {
+                auto ticks{ distribution( rng ) };
+                switch( rng() % 4 )
+                {
+                    case 0:
+                        ticks -= ticks % constants::TICKS_PER_DAY;
+                        break;
+                    case 1:
+                        ticks -= ticks % constants::TICKS_PER_SECOND;
+                        break;
+                    default:
+                        break;
+                }
+                values.push_back( DateTime{ ticks } );
+            }
+
+            return values;
+        }
+    } // namespace
+
+    //=====================================================================
+    // Arithmetic
+    //=====================================================================
+
+    TEST( Bulk, AddSubtract )
+    {
+        const auto values{ randomDateTimes( 1001 ) };
+        const auto duration{ TimeSpan::fromHours( -36.5 ) };
+        std::vector<DateTime> added( values.size() );
+        std::vector<DateTime> subtracted( values.size() );
+        std::vector<TimeSpan> differences( values.size() );
+
+        EXPECT_EQ( bulk::add( values, duration, added ), values.size() );
+        EXPECT_EQ( bulk::subtract( values, duration, subtracted ), values.size() );
+        EXPECT_EQ( bulk::subtract( added, values, differences ), values.size() );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            EXPECT_EQ( added[i], values[i] + duration );
+            EXPECT_EQ( subtracted[i], values[i] - duration );
+            EXPECT_EQ( differences[i], added[i] - values[i] );
+        }
+
+        std::vector<TimeSpan> spans( differences );
+        EXPECT_EQ( bulk::add( spans, TimeSpan::fromSeconds( 1 ), spans ), spans.size() );
+        for( std::size_t i{ 0 }; i < spans.size(); ++i )
+        {
+            EXPECT_EQ( spans[i], differences[i] + TimeSpan::fromSeconds( 1 ) );
+        }
+    }
+
+    TEST( Bulk, ShorterOutputAndEmptyInput )
+    {
+        const auto values{ randomDateTimes( 10 ) };
+        std::vector<DateTime> out( 3 );
+        EXPECT_EQ( bulk::add( values, TimeSpan::fromDays( 1 ), out ), 3U );
+        EXPECT_EQ( out[2], values[2] + TimeSpan::fromDays( 1 ) );
+
+        std::vector<std::int32_t> hours( 7, -1 );
+        EXPECT_EQ( bulk::hour( std::span<const DateTime>{ values }.first( 5 ), hours ), 5U );
+        EXPECT_EQ( hours[4], values[4].hour() );
+        EXPECT_EQ( hours[5], -1 );
+
+        EXPECT_EQ( bulk::toEpochSeconds( {}, std::span<std::int64_t>{} ), 0U );
+        EXPECT_FALSE( bulk::minMax( std::span<const DateTime>{} ).has_value() );
+        EXPECT_FALSE( bulk::minMax( std::span<const TimeSpan>{} ).has_value() );
+    }
+
+    TEST( Bulk, CalendarArithmetic )
+    {
+        const auto values{ randomDateTimes( 501 ) };
+        std::vector<DateTime> out( values.size() );
+
+        for( const std::int32_t amount : { 1, -1, 13, -25, 1200, -120000 } )
+        {
+            EXPECT_EQ( bulk::addMonths( values, amount, out ), values.size() );
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                ASSERT_EQ( out[i], values[i].addMonths( amount ) );
+            }
+
+            EXPECT_EQ( bulk::addYears( values, amount, out ), values.size() );
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                ASSERT_EQ( out[i], values[i].addYears( amount ) );
+            }
+
+            EXPECT_EQ( bulk::addBusinessDays( values, amount, out ), values.size() );
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                ASSERT_EQ( out[i], values[i].addBusinessDays( amount ) );
+            }
+        }
+    }
+
+    //=====================================================================
+    // Epoch conversion
+    //=====================================================================
+
+    TEST( Bulk, EpochConversion )
+    {
+        const auto values{ randomDateTimes( 1003 ) };
+        std::vector<std::int64_t> seconds( values.size() );
+        std::vector<std::int64_t> milliseconds( values.size() );
+
+        EXPECT_EQ( bulk::toEpochSeconds( values, seconds ), values.size() );
+        EXPECT_EQ( bulk::toEpochMilliseconds( values, milliseconds ), values.size() );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            EXPECT_EQ( seconds[i], values[i].toEpochSeconds() ) << values[i].ticks();
+            EXPECT_EQ( milliseconds[i], values[i].toEpochMilliseconds() ) << values[i].ticks();
+        }
+
+        std::vector<DateTime> fromSeconds( values.size() );
+        std::vector<DateTime> fromMilliseconds( values.size() );
+        EXPECT_EQ( bulk::fromEpochSeconds( seconds, fromSeconds ), values.size() );
+        EXPECT_EQ( bulk::fromEpochMilliseconds( milliseconds, fromMilliseconds ), values.size() );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            EXPECT_EQ( fromSeconds[i], DateTime::fromEpochSeconds( seconds[i] ) );
+            EXPECT_EQ( fromMilliseconds[i], DateTime::fromEpochMilliseconds( milliseconds[i] ) );
+        }
+    }
+
+    TEST( Bulk, UtcTicks )
+    {
+        const auto dateTimes{ randomDateTimes( 257 ) };
+        std::vector<DateTimeOffset> values;
+        for( std::size_t i{ 0 }; i < dateTimes.size(); ++i )
+        {
+            values.emplace_back( dateTimes[i], TimeSpan::fromMinutes( static_cast<double>( i % 57 ) * 30.0 - 840.0 ) );
+        }
+
+        std::vector<std::int64_t> ticks( values.size() );
+        EXPECT_EQ( bulk::utcTicks( values, ticks ), values.size() );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            EXPECT_EQ( ticks[i], values[i].utcTicks() );
+        }
+    }
+
+    //=====================================================================
+    // Calendar fields
+    //=====================================================================
+
+    TEST( Bulk, CalendarFields )
+    {
+        const auto values{ randomDateTimes( 2005 ) };
+        std::vector<DateTime> dates( values.size() );
+        std::vector<std::int32_t> daysOfWeek( values.size() );
+        std::vector<std::int32_t> hours( values.size() );
+
+        EXPECT_EQ( bulk::date( values, dates ), values.size() );
+        EXPECT_EQ( bulk::dayOfWeek( values, daysOfWeek ), values.size() );
+        EXPECT_EQ( bulk::hour( values, hours ), values.size() );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            EXPECT_EQ( dates[i], values[i].date() ) << values[i].ticks();
+            EXPECT_EQ( daysOfWeek[i], values[i].dayOfWeek() ) << values[i].ticks();
+            EXPECT_EQ( hours[i], values[i].hour() ) << values[i].ticks();
+        }
+    }
+
+    TEST( Bulk, DateInPlace )
+    {
+        const auto values{ randomDateTimes( 99 ) };
+        std::vector<DateTime> inPlace( values );
+
+        EXPECT_EQ( bulk::date( inPlace, inPlace ), values.size() );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            EXPECT_EQ( inPlace[i], values[i].date() );
+        }
+    }
+
+    TEST( Bulk, OutOfRangeTicksUseScalarPath )
+    {
+        // Not valid DateTime values, but the kernels must still match the member functions
+        const std::vector<DateTime> values{ DateTime{ -1 }, DateTime{ -constants::TICKS_PER_DAY - 5 },
+            DateTime{ 4 }, DateTime{ constants::TICKS_PER_HOUR * 25 }, DateTime{ -constants::TICKS_PER_HOUR } };
+        std::vector<std::int64_t> seconds( values.size() );
+        std::vector<std::int32_t> hours( values.size() );
+
+        bulk::toEpochSeconds( values, seconds );
+        bulk::hour( values, hours );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            EXPECT_EQ( seconds[i], values[i].toEpochSeconds() );
+            EXPECT_EQ( hours[i], values[i].hour() );
+        }
+    }
+
+    //=====================================================================
+    // Bucketing
+    //=====================================================================
+
+    TEST( Bulk, BucketingMatchesMemberFunctions )
+    {
+        const auto values{ randomDateTimes( 1001 ) };
+        std::vector<DateTime> floors( values.size() );
+        std::vector<DateTime> ceilings( values.size() );
+        std::vector<DateTime> rounded( values.size() );
+
+        std::mt19937_64 rng{ 7 };
+        std::vector<TimeSpan> intervals{ TimeSpan{ 1 }, TimeSpan{ 3 }, TimeSpan{ 1024 }, TimeSpan::fromSeconds( 1 ),
+            TimeSpan::fromMinutes( 5 ), TimeSpan::fromHours( 1 ), TimeSpan::fromDays( 1 ), TimeSpan::fromDays( 7 ),
+            TimeSpan{ constants::MAX_DATETIME_TICKS }, TimeSpan{ 0 }, TimeSpan{ -60 } };
+        for( int i{ 0 }; i < 20; ++i )
+        {
+            intervals.emplace_back( static_cast<std::int64_t>( rng() >> ( 2 + rng() % 60 ) ) + 1 );
+        }
+
+        for( const auto& interval : intervals )
+        {
+            EXPECT_EQ( bulk::floor( values, interval, floors ), values.size() );
+            EXPECT_EQ( bulk::ceil( values, interval, ceilings ), values.size() );
+            EXPECT_EQ( bulk::round( values, interval, rounded ), values.size() );
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                ASSERT_EQ( floors[i], values[i].floor( interval ) ) << interval.ticks() << " " << values[i].ticks();
+                ASSERT_EQ( ceilings[i], values[i].ceil( interval ) ) << interval.ticks() << " " << values[i].ticks();
+                ASSERT_EQ( rounded[i], values[i].round( interval ) ) << interval.ticks() << " " << values[i].ticks();
+            }
+        }
+
+        // Out-of-range ticks take the member function path
+        const std::vector<DateTime> negative{ DateTime{ -7 }, DateTime{ -1 } };
+        std::vector<DateTime> out( negative.size() );
+        bulk::floor( negative, TimeSpan{ 5 }, out );
+        EXPECT_EQ( out[0], DateTime{ -10 } );
+        EXPECT_EQ( out[1], DateTime{ -5 } );
+
+        // Rounding up inside the last partial bucket clamps to max()
+        const std::vector<DateTime> last{ DateTime::max(), DateTime::max().date() + TimeSpan::fromHours( 13 ) };
+        std::vector<DateTime> clamped( last.size() );
+        bulk::ceil( last, TimeSpan::fromDays( 1 ), clamped );
+        EXPECT_EQ( clamped[0], DateTime::max() );
+        EXPECT_EQ( clamped[1], DateTime::max() );
+        bulk::round( last, TimeSpan::fromDays( 1 ), clamped );
+        EXPECT_EQ( clamped[0], DateTime::max() );
+        EXPECT_EQ( clamped[1], DateTime::max() );
+    }
+
+    //=====================================================================
+    // Reductions and sort keys
+    //=====================================================================
+
+    TEST( Bulk, MinMax )
+    {
+        const auto values{ randomDateTimes( 513 ) };
+        const auto [low, high]{ *bulk::minMax( values ) };
+        EXPECT_EQ( low, DateTime::min() );
+        EXPECT_EQ( high, DateTime::max() );
+
+        const std::vector<TimeSpan> spans{ TimeSpan{ 5 }, TimeSpan{ -7 }, TimeSpan{ 3 } };
+        const auto range{ bulk::minMax( spans ) };
+        ASSERT_TRUE( range.has_value() );
+        EXPECT_EQ( range->first, TimeSpan{ -7 } );
+        EXPECT_EQ( range->second, TimeSpan{ 5 } );
+    }
+
+    TEST( Bulk, SortKeysPreserveOrder )
+    {
+        const std::vector<TimeSpan> spans{ TimeSpan{ -3 },
+            TimeSpan{ std::numeric_limits<std::int64_t>::min() },
+            TimeSpan{ 0 },
+            TimeSpan{ std::numeric_limits<std::int64_t>::max() },
+            TimeSpan{ 2 } };
+        std::vector<std::uint64_t> spanKeys( spans.size() );
+        EXPECT_EQ( bulk::sortKeys( spans, spanKeys ), spans.size() );
+        for( std::size_t i{ 0 }; i < spans.size(); ++i )
+        {
+            for( std::size_t j{ 0 }; j < spans.size(); ++j )
+            {
+                EXPECT_EQ( spanKeys[i] < spanKeys[j], spans[i] < spans[j] );
+            }
+        }
+
+        const auto values{ randomDateTimes( 300 ) };
+        std::vector<std::uint64_t> keys( values.size() );
+        bulk::sortKeys( values, keys );
+        std::vector<std::size_t> order( values.size() );
+        for( std::size_t i{ 0 }; i < order.size(); ++i )
+        {
+            order[i] = i;
+        }
+        std::sort( order.begin(), order.end(), [&]( std::size_t a, std::size_t b ) { return keys[a] < keys[b]; } );
+        for( std::size_t i{ 1 }; i < order.size(); ++i )
+        {
+            EXPECT_LE( values[order[i - 1]], values[order[i]] );
+        }
+
+        // Offsets sort by instant, not by local time
+        const std::vector<DateTimeOffset> offsets{
+            DateTimeOffset{ DateTime{ 2024, 1, 1, 10, 0, 0 }, TimeSpan::fromHours( 2 ) },
+            DateTimeOffset{ DateTime{ 2024, 1, 1, 9, 0, 0 }, TimeSpan::fromHours( 0 ) } };
+        std::vector<std::uint64_t> offsetKeys( offsets.size() );
+        bulk::sortKeys( offsets, offsetKeys );
+        EXPECT_LT( offsetKeys[0], offsetKeys[1] );
+    }
+} // namespace nfx::time::test
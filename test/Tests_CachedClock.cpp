@@ -0,0 +1,172 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_CachedClock.cpp
+ * @brief Unit tests for CachedClock class
+ * @details Tests caller-driven and background refresh, snapshot consistency under concurrent
+ *          reads and the opt-in global hook for DateTime and DateTimeOffset now()/utcNow()
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nfx/datetime/CachedClock.h>
+
+namespace nfx::time::test
+{
+    //=====================================================================
+    // CachedClock type tests
+    //=====================================================================
+
+    //----------------------------------------------
+    // Refresh
+    //----------------------------------------------
+
+    TEST( CachedClockRefresh, InitialSnapshot )
+    {
+        const CachedClock clock;
+        EXPECT_FALSE( clock.isRunning() );
+
+        EXPECT_LE( std::abs( clock.utcTicks() - DateTime::utcNow().ticks() ), TimeSpan::fromSeconds( 1 ).ticks() );
+        EXPECT_EQ( clock.offset(), ( DateTimeOffset{ clock.utcNow(), TimeSpan{ 0 } }.toLocalTime().offset() ) );
+
+        const auto now{ clock.now() };
+        EXPECT_EQ( now.utcTicks(), clock.utcTicks() );
+        EXPECT_EQ( now.offset(), clock.offset() );
+    }
+
+    TEST( CachedClockRefresh, SnapshotPrefixMatchesTicks )
+    {
+        const CachedClock clock;
+        const auto snapshot{ clock.snapshot() };
+
+        const std::string local{ DateTime{ snapshot.utcTicks + snapshot.offset.ticks() }.toString() };
+        EXPECT_EQ( snapshot.iso8601Prefix(), local.substr( 0, CachedClock::PREFIX_LENGTH ) );
+        EXPECT_EQ( snapshot.iso8601Prefix().size(), 19u );
+    }
+
+    TEST( CachedClockRefresh, CallerDriven )
+    {
+        CachedClock clock;
+        const auto first{ clock.utcTicks() };
+
+        std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+        EXPECT_EQ( clock.utcTicks(), first ); // No refresh without update()
+
+        clock.update();
+        EXPECT_GT( clock.utcTicks(), first );
+    }
+
+    TEST( CachedClockRefresh, BackgroundThread )
+    {
+        CachedClock clock{ std::chrono::microseconds( 500 ) };
+        EXPECT_TRUE( clock.isRunning() );
+
+        const auto first{ clock.utcTicks() };
+        const auto deadline{ std::chrono::steady_clock::now() + std::chrono::seconds( 5 ) };
+        while( clock.utcTicks() == first && std::chrono::steady_clock::now() < deadline )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        }
+        EXPECT_GT( clock.utcTicks(), first );
+
+        clock.stop();
+        EXPECT_FALSE( clock.isRunning() );
+
+        const auto stopped{ clock.utcTicks() };
+        std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+        EXPECT_EQ( clock.utcTicks(), stopped );
+    }
+
+    TEST( CachedClockRefresh, ConcurrentSnapshotsAreConsistent )
+    {
+        CachedClock clock{ std::chrono::microseconds( 50 ) };
+
+        std::atomic<int> inconsistent{ 0 };
+        std::vector<std::thread> readers;
+        for( int t{ 0 }; t < 4; ++t )
+        {
+            readers.emplace_back( [&clock, &inconsistent]() {
+                for( int i{ 0 }; i < 2000; ++i )
+                {
+                    const auto snapshot{ clock.snapshot() };
+                    const std::string local{ DateTime{ snapshot.utcTicks + snapshot.offset.ticks() }.toString() };
+                    if( snapshot.iso8601Prefix() != local.substr( 0, CachedClock::PREFIX_LENGTH ) )
+                    {
+                        inconsistent.fetch_add( 1, std::memory_order_relaxed );
+                    }
+                }
+            } );
+        }
+
+        for( auto& reader : readers )
+        {
+            reader.join();
+        }
+
+        EXPECT_EQ( inconsistent.load(), 0 );
+    }
+
+    //----------------------------------------------
+    // Global hook
+    //----------------------------------------------
+
+    TEST( CachedClockHook, RedirectsNow )
+    {
+        const CachedClock clock;
+        CachedClock::install( &clock );
+        EXPECT_EQ( CachedClock::installed(), &clock );
+
+        std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+
+        EXPECT_EQ( DateTime::utcNow(), clock.utcNow() );
+        EXPECT_EQ( DateTime::now(), clock.now().localDateTime() );
+        EXPECT_EQ( DateTimeOffset::utcNow().utcTicks(), clock.utcTicks() );
+        EXPECT_EQ( DateTimeOffset::now().utcTicks(), clock.utcTicks() );
+        EXPECT_EQ( DateTimeOffset::now().offset(), clock.offset() );
+
+        // Explicit clock sources are never redirected
+        EXPECT_GT( DateTime::utcNow<PreciseClock>(), clock.utcNow() );
+
+        CachedClock::install( nullptr );
+        EXPECT_EQ( CachedClock::installed(), nullptr );
+        EXPECT_GT( DateTime::utcNow(), clock.utcNow() );
+    }
+
+    TEST( CachedClockHook, DestructorUninstalls )
+    {
+        {
+            const CachedClock clock;
+            CachedClock::install( &clock );
+        }
+
+        EXPECT_EQ( CachedClock::installed(), nullptr );
+    }
+} // namespace nfx::time::test
@@ -31,7 +31,15 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <random>
+#include <iterator>
+#include <limits>
 #include <sstream>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
 
 #include <nfx/datetime/DateTime.h>
 
@@ -124,6 +132,61 @@ namespace nfx::time::test
         EXPECT_EQ( dt.second(), 30 );
     }
 
+    TEST( DateTimeConstruction, ConstexprFromIso8601String )
+    {
+        constexpr DateTime dt{ "2024-01-15T12:30:45.1234567Z" };
+        static_assert( dt.components() == DateTime::Components{ 2024, 1, 15, 12, 30, 45, 1'234'567, 1, 15 } );
+
+        constexpr DateTime date{ "2024-02-29" };
+        static_assert( date.ticks() % constants::TICKS_PER_DAY == 0 );
+
+        EXPECT_EQ( dt, DateTime::fromString( "2024-01-15T12:30:45.1234567Z" ) );
+        EXPECT_EQ( date, DateTime( 2024, 2, 29 ) );
+    }
+
+    TEST( DateTimeConstruction, Literal )
+    {
+        using namespace nfx::time::literals;
+
+        constexpr auto cutoff{ "2024-01-15T12:30:45Z"_dt };
+        static_assert( cutoff.ticks() == DateTime{ "2024-01-15T12:30:45" }.ticks() );
+        static_assert( "1970-01-01"_dt == DateTime::epoch() );
+        static_assert( "9999-12-31T23:59:59.9999999"_dt == DateTime::max() );
+
+        constexpr DateTime table[]{ "2024-03-10T02:00:00Z"_dt, "2024-11-03T02:00:00Z"_dt };
+        static_assert( table[1] - table[0] == TimeSpan::fromDays( 238 ) );
+
+        EXPECT_EQ( cutoff, DateTime( 2024, 1, 15, 12, 30, 45 ) );
+    }
+
+    TEST( DateTimeConstruction, ConstexprParserMatchesFromString )
+    {
+        // Fixed layouts must give identical results at compile time and at runtime
+        const std::string_view inputs[]{ "2024-01-15",
+            "2024-01-15T12:30:45",
+            "2024-01-15T12:30:45Z",
+            "2024-01-15T12:30:45.1",
+            "2024-01-15T12:30:45.123456789Z",
+            "0001-01-01T00:00:00Z",
+            "2023-02-29",
+            "2024-13-01T00:00:00Z",
+            "2024-01-15T24:00:00Z",
+            "0000-01-01" };
+
+        for( const auto input : inputs )
+        {
+            std::int64_t ticks{ 0 };
+            const bool constexprParsed{ detail::parseIso8601DateTime( input, ticks ) };
+
+            DateTime runtime;
+            EXPECT_EQ( constexprParsed, DateTime::fromString( input, runtime ) ) << input;
+            if( constexprParsed )
+            {
+                EXPECT_EQ( ticks, runtime.ticks() ) << input;
+            }
+        }
+    }
+
     TEST( DateTimeConstruction, CopyConstructor )
     {
         DateTime dt1{ 2024, 5, 15, 10, 20, 30 };
@@ -308,6 +371,97 @@ namespace nfx::time::test
         EXPECT_EQ( dt.dayOfYear(), 15 ); // 15th day of year
     }
 
+    TEST( DateTimeAccessors, CivilConversionEveryDay )
+    {
+        // Walk every day of the supported range and compare with an incrementally advanced calendar
+        std::int32_t year{ 1 }, month{ 1 }, day{ 1 }, dayOfYear{ 1 };
+
+        for( std::int64_t ticks{ 0 }; ticks <= DateTime::max().ticks(); ticks += constants::TICKS_PER_DAY )
+        {
+            const DateTime dt{ ticks };
+            ASSERT_EQ( dt.year(), year ) << ticks;
+            ASSERT_EQ( dt.month(), month ) << ticks;
+            ASSERT_EQ( dt.day(), day ) << ticks;
+            ASSERT_EQ( dt.dayOfYear(), dayOfYear ) << ticks;
+            ASSERT_EQ( DateTime( year, month, day ).ticks(), ticks );
+
+            ++dayOfYear;
+            if( ++day > DateTime::daysInMonth( year, month ) )
+            {
+                day = 1;
+                if( ++month > 12 )
+                {
+                    month = 1;
+                    dayOfYear = 1;
+                    ++year;
+                }
+            }
+        }
+
+        EXPECT_EQ( year, 10000 );
+    }
+
+    TEST( DateTimeAccessors, Components )
+    {
+        const DateTime dt{ DateTime{ 2024, 3, 15, 14, 30, 45, 123 }.ticks() + 4567 };
+        const auto c{ dt.components() };
+
+        EXPECT_EQ( c.year, 2024 );
+        EXPECT_EQ( c.month, 3 );
+        EXPECT_EQ( c.day, 15 );
+        EXPECT_EQ( c.hour, 14 );
+        EXPECT_EQ( c.minute, 30 );
+        EXPECT_EQ( c.second, 45 );
+        EXPECT_EQ( c.subsecondTicks, 1234567 );
+        EXPECT_EQ( c.dayOfWeek, 5 );  // Friday
+        EXPECT_EQ( c.dayOfYear, 75 ); // 31 + 29 + 15
+
+        static_assert( std::is_trivially_copyable_v<DateTime::Components> );
+    }
+
+    TEST( DateTimeAccessors, ComponentsConstexpr )
+    {
+        // 2000-02-29T23:59:59.9999999
+        constexpr std::int64_t ticks{ 630'874'655'999'999'999 };
+        constexpr auto c{ DateTime{ ticks }.components() };
+
+        static_assert( c.year == 2000 && c.month == 2 && c.day == 29 );
+        static_assert( c.hour == 23 && c.minute == 59 && c.second == 59 && c.subsecondTicks == 9'999'999 );
+        static_assert( c.dayOfWeek == 2 && c.dayOfYear == 60 );
+
+        static_assert( DateTime::min().components() == DateTime::Components{ 1, 1, 1, 0, 0, 0, 0, 1, 1 } );
+        static_assert(
+            DateTime::max().components() == DateTime::Components{ 9999, 12, 31, 23, 59, 59, 9'999'999, 5, 365 } );
+
+        EXPECT_EQ( ( DateTime{ 2000, 2, 29, 23, 59, 59, 999 }.ticks() + 9999 ), ticks );
+    }
+
+    TEST( DateTimeAccessors, ComponentsMatchAccessors )
+    {
+        std::mt19937_64 rng{ 20240315 };
+        std::uniform_int_distribution<std::int64_t> ticksDist{ DateTime::min().ticks(), DateTime::max().ticks() };
+
+        for( int i{ 0 }; i < 100'000; ++i )
+        {
+            const DateTime dt{ ticksDist( rng ) };
+            const auto c{ dt.components() };
+
+            ASSERT_EQ( c.year, dt.year() );
+            ASSERT_EQ( c.month, dt.month() );
+            ASSERT_EQ( c.day, dt.day() );
+            ASSERT_EQ( c.hour, dt.hour() );
+            ASSERT_EQ( c.minute, dt.minute() );
+            ASSERT_EQ( c.second, dt.second() );
+            ASSERT_EQ( c.subsecondTicks, dt.ticks() % constants::TICKS_PER_SECOND );
+            ASSERT_EQ( c.dayOfWeek, dt.dayOfWeek() );
+            ASSERT_EQ( c.dayOfYear, dt.dayOfYear() );
+
+            // Components must reassemble into the original instant
+            const DateTime rebuilt{ c.year, c.month, c.day, c.hour, c.minute, c.second };
+            ASSERT_EQ( rebuilt.ticks() + c.subsecondTicks, dt.ticks() );
+        }
+    }
+
     //----------------------------------------------
     // Conversion methods
     //----------------------------------------------
@@ -345,6 +499,154 @@ namespace nfx::time::test
         EXPECT_NEAR( timeOfDay.hours(), 14.0 + 30.0 / 60.0 + 45.0 / 3600.0, 0.001 );
     }
 
+    //----------------------------------------------
+    // Bucketing
+    //----------------------------------------------
+
+    TEST( DateTimeBucketing, FloorCeilRound )
+    {
+        const DateTime dt{ 2024, 3, 15, 14, 37, 29, 500 };
+        const auto fiveMinutes{ TimeSpan::fromMinutes( 5 ) };
+
+        EXPECT_EQ( dt.floor( fiveMinutes ), DateTime( 2024, 3, 15, 14, 35, 0 ) );
+        EXPECT_EQ( dt.ceil( fiveMinutes ), DateTime( 2024, 3, 15, 14, 40, 0 ) );
+        EXPECT_EQ( dt.round( fiveMinutes ), DateTime( 2024, 3, 15, 14, 35, 0 ) );
+        EXPECT_EQ( dt.floor( TimeSpan::fromSeconds( 1 ) ), DateTime( 2024, 3, 15, 14, 37, 29 ) );
+        EXPECT_EQ( dt.round( TimeSpan::fromSeconds( 1 ) ), DateTime( 2024, 3, 15, 14, 37, 30 ) );
+        EXPECT_EQ( dt.floor( TimeSpan::fromHours( 1 ) ), DateTime( 2024, 3, 15, 14, 0, 0 ) );
+        EXPECT_EQ( dt.floor( TimeSpan::fromDays( 1 ) ), dt.date() );
+
+        // Boundaries are fixed points
+        const DateTime boundary{ 2024, 3, 15, 14, 35, 0 };
+        EXPECT_EQ( boundary.floor( fiveMinutes ), boundary );
+        EXPECT_EQ( boundary.ceil( fiveMinutes ), boundary );
+        EXPECT_EQ( boundary.round( fiveMinutes ), boundary );
+
+        // Halfway rounds up
+        EXPECT_EQ( DateTime( 2024, 3, 15, 14, 37, 30 ).round( fiveMinutes ), DateTime( 2024, 3, 15, 14, 40, 0 ) );
+
+        // Non-positive intervals leave the value unchanged
+        EXPECT_EQ( dt.floor( TimeSpan{} ), dt );
+        EXPECT_EQ( dt.ceil( TimeSpan::fromMinutes( -5 ) ), dt );
+
+        // Rounding up inside the last partial bucket clamps to max()
+        EXPECT_EQ( DateTime::max().ceil( TimeSpan::fromDays( 1 ) ), DateTime::max() );
+        EXPECT_EQ( DateTime::max().round( TimeSpan::fromDays( 1 ) ), DateTime::max() );
+        EXPECT_EQ( DateTime::max().ceil( TimeSpan{ std::numeric_limits<std::int64_t>::max() } ), DateTime::max() );
+        EXPECT_EQ( DateTime::max().floor( TimeSpan::fromDays( 1 ) ), DateTime::max().date() );
+
+        static_assert( DateTime::epoch().floor( TimeSpan::fromDays( 1 ) ) == DateTime::epoch() );
+    }
+
+    TEST( DateTimeBucketing, WeekBucketsStartOnMonday )
+    {
+        // 2024-03-15 was a Friday
+        const DateTime dt{ 2024, 3, 15, 14, 37, 29 };
+
+        EXPECT_EQ( dt.floor( TimeSpan::fromDays( 7 ) ), DateTime( 2024, 3, 11 ) );
+        EXPECT_EQ( dt.startOfWeek(), DateTime( 2024, 3, 11 ) );
+        EXPECT_EQ( dt.startOfWeek( 0 ), DateTime( 2024, 3, 10 ) );
+        EXPECT_EQ( dt.startOfWeek( 5 ), DateTime( 2024, 3, 15 ) );
+        EXPECT_EQ( dt.startOfWeek( 6 ), DateTime( 2024, 3, 9 ) );
+
+        // January 1, 0001 was a Monday: a Sunday-based week is clamped to min()
+        EXPECT_EQ( DateTime::min().startOfWeek(), DateTime::min() );
+        EXPECT_EQ( DateTime( 1, 1, 3 ).startOfWeek( 0 ), DateTime::min() );
+    }
+
+    TEST( DateTimeBucketing, StartOfMonthAndYear )
+    {
+        EXPECT_EQ( DateTime( 2024, 3, 15, 14, 37, 29 ).startOfMonth(), DateTime( 2024, 3, 1 ) );
+        EXPECT_EQ( DateTime( 2024, 2, 29, 23, 59, 59 ).startOfMonth(), DateTime( 2024, 2, 1 ) );
+        EXPECT_EQ( DateTime( 2024, 12, 31, 23, 59, 59 ).startOfYear(), DateTime( 2024, 1, 1 ) );
+        EXPECT_EQ( DateTime( 2024, 1, 1 ).startOfYear(), DateTime( 2024, 1, 1 ) );
+        EXPECT_EQ( DateTime::max().startOfYear(), DateTime( 9999, 1, 1 ) );
+
+        static_assert( DateTime{ detail::dateToTicks( 2000, 6, 15 ) }.startOfMonth() ==
+                       DateTime{ detail::dateToTicks( 2000, 6, 1 ) } );
+    }
+
+    //----------------------------------------------
+    // Calendar arithmetic
+    //----------------------------------------------
+
+    TEST( DateTimeCalendarArithmetic, AddMonths )
+    {
+        const DateTime dt{ 2024, 1, 31, 10, 15, 30, 250 };
+
+        EXPECT_EQ( dt.addMonths( 1 ), DateTime( 2024, 2, 29, 10, 15, 30, 250 ) );
+        EXPECT_EQ( dt.addMonths( 13 ), DateTime( 2025, 2, 28, 10, 15, 30, 250 ) );
+        EXPECT_EQ( dt.addMonths( -1 ), DateTime( 2023, 12, 31, 10, 15, 30, 250 ) );
+        EXPECT_EQ( dt.addMonths( -14 ), DateTime( 2022, 11, 30, 10, 15, 30, 250 ) );
+        EXPECT_EQ( dt.addMonths( 0 ), dt );
+        EXPECT_EQ( dt.addMonths( 12000 ), DateTime( 3024, 1, 31, 10, 15, 30, 250 ) );
+        EXPECT_EQ( dt.addMonths( -12 * 2023 ), DateTime( 1, 1, 31, 10, 15, 30, 250 ) );
+
+        // Out-of-range results clamp
+        EXPECT_EQ( dt.addMonths( -12 * 2024 ), DateTime::min() );
+        EXPECT_EQ( dt.addMonths( std::numeric_limits<std::int32_t>::max() ), DateTime::max() );
+        EXPECT_EQ( dt.addMonths( std::numeric_limits<std::int32_t>::min() ), DateTime::min() );
+
+        static_assert( DateTime{ detail::dateToTicks( 2023, 3, 31 ) }.addMonths( -1 ) ==
+                       DateTime{ detail::dateToTicks( 2023, 2, 28 ) } );
+    }
+
+    TEST( DateTimeCalendarArithmetic, AddYears )
+    {
+        EXPECT_EQ( DateTime( 2024, 2, 29, 12, 0, 0 ).addYears( 1 ), DateTime( 2025, 2, 28, 12, 0, 0 ) );
+        EXPECT_EQ( DateTime( 2024, 2, 29 ).addYears( 4 ), DateTime( 2028, 2, 29 ) );
+        EXPECT_EQ( DateTime( 2024, 6, 15 ).addYears( -2023 ), DateTime( 1, 6, 15 ) );
+        EXPECT_EQ( DateTime( 2024, 6, 15 ).addYears( 8000 ), DateTime::max() );
+        EXPECT_EQ( DateTime( 2024, 6, 15 ).addYears( std::numeric_limits<std::int32_t>::min() ), DateTime::min() );
+    }
+
+    TEST( DateTimeCalendarArithmetic, AddBusinessDays )
+    {
+        // 2024-03-15 was a Friday
+        const DateTime friday{ 2024, 3, 15, 9, 30, 0 };
+
+        EXPECT_EQ( friday.addBusinessDays( 1 ), DateTime( 2024, 3, 18, 9, 30, 0 ) );
+        EXPECT_EQ( friday.addBusinessDays( 5 ), DateTime( 2024, 3, 22, 9, 30, 0 ) );
+        EXPECT_EQ( friday.addBusinessDays( -4 ), DateTime( 2024, 3, 11, 9, 30, 0 ) );
+        EXPECT_EQ( friday.addBusinessDays( -5 ), DateTime( 2024, 3, 8, 9, 30, 0 ) );
+        EXPECT_EQ( friday.addBusinessDays( 0 ), friday );
+
+        // Weekend starts count from the adjacent business day
+        const DateTime saturday{ 2024, 3, 16 };
+        EXPECT_EQ( saturday.addBusinessDays( 1 ), DateTime( 2024, 3, 18 ) );
+        EXPECT_EQ( saturday.addBusinessDays( -1 ), DateTime( 2024, 3, 15 ) );
+        EXPECT_EQ( DateTime( 2024, 3, 17 ).addBusinessDays( 1 ), DateTime( 2024, 3, 18 ) );
+        EXPECT_EQ( DateTime( 2024, 3, 17 ).addBusinessDays( -1 ), DateTime( 2024, 3, 15 ) );
+
+        EXPECT_EQ( friday.addBusinessDays( std::numeric_limits<std::int32_t>::max() ), DateTime::max() );
+        EXPECT_EQ( friday.addBusinessDays( std::numeric_limits<std::int32_t>::min() ), DateTime::min() );
+    }
+
+    TEST( DateTimeCalendarArithmetic, AddBusinessDaysMatchesDayByDayWalk )
+    {
+        const DateTime start{ 2024, 1, 1, 8, 0, 0 };
+        for( std::int32_t startDay{ 0 }; startDay < 14; ++startDay )
+        {
+            const auto from{ start + TimeSpan::fromDays( startDay ) };
+            for( std::int32_t days{ -30 }; days <= 30; ++days )
+            {
+                // Walk one calendar day at a time, counting weekdays
+                auto expected{ from };
+                const std::int32_t step{ days > 0 ? 1 : -1 };
+                for( std::int32_t remaining{ days > 0 ? days : -days }; remaining > 0; )
+                {
+                    expected += TimeSpan::fromDays( step );
+                    if( expected.dayOfWeek() != 0 && expected.dayOfWeek() != 6 )
+                    {
+                        --remaining;
+                    }
+                }
+
+                EXPECT_EQ( from.addBusinessDays( days ), expected ) << from.toString() << " + " << days;
+            }
+        }
+    }
+
     //----------------------------------------------
     // String Formatting
     //----------------------------------------------
@@ -460,6 +762,59 @@ namespace nfx::time::test
         EXPECT_EQ( str.find( "2024" ), std::string::npos ); // No date component
     }
 
+    TEST( DateTimeStringFormatting, FormatToMatchesToString )
+    {
+        DateTime dt{ DateTime{ 2024, 6, 20, 18, 45, 30, 123 }.ticks() + 4567 };
+
+        const DateTime::Format formats[]{
+            DateTime::Format::Iso8601,
+            DateTime::Format::Iso8601Precise,
+            DateTime::Format::Iso8601PreciseTrimmed,
+            DateTime::Format::Iso8601Millis,
+            DateTime::Format::Iso8601Micros,
+            DateTime::Format::Iso8601Extended,
+            DateTime::Format::Iso8601Basic,
+            DateTime::Format::Iso8601Date,
+            DateTime::Format::Iso8601Time,
+            DateTime::Format::UnixSeconds,
+            DateTime::Format::UnixMilliseconds };
+
+        for( const auto format : formats )
+        {
+            char buffer[constants::MAX_ISO8601_LENGTH];
+            const auto length{ dt.formatTo( buffer, sizeof( buffer ), format ) };
+            EXPECT_EQ( std::string_view( buffer, length ), dt.toString( format ) );
+        }
+
+        EXPECT_EQ( dt.toString( DateTime::Format::Iso8601Precise ), "2024-06-20T18:45:30.1234567Z" );
+        EXPECT_EQ( DateTime::max().toString( DateTime::Format::Iso8601Precise ), "9999-12-31T23:59:59.9999999Z" );
+    }
+
+    TEST( DateTimeStringFormatting, FormatToBufferTooSmall )
+    {
+        DateTime dt{ 2024, 6, 20, 18, 45, 30 };
+
+        // "2024-06-20T18:45:30Z" is 20 characters
+        char buffer[20];
+        EXPECT_EQ( dt.formatTo( buffer, 19 ), 0u );
+        EXPECT_EQ( dt.formatTo( buffer, 20 ), 20u );
+        EXPECT_EQ( std::string_view( buffer, 20 ), "2024-06-20T18:45:30Z" );
+        EXPECT_EQ( dt.formatTo( buffer, 0 ), 0u );
+    }
+
+    TEST( DateTimeStringFormatting, FormatToSpanAndIterator )
+    {
+        DateTime dt{ 2024, 6, 20, 18, 45, 30, 250 };
+
+        std::array<char, 64> buffer{};
+        const auto length{ dt.formatTo( std::span<char>{ buffer }, DateTime::Format::Iso8601Millis ) };
+        EXPECT_EQ( std::string_view( buffer.data(), length ), "2024-06-20T18:45:30.250Z" );
+
+        std::string out{ "ts=" };
+        dt.formatTo( std::back_inserter( out ), DateTime::Format::Iso8601Date );
+        EXPECT_EQ( out, "ts=2024-06-20" );
+    }
+
     //----------------------------------------------
     // Validation methods
     //----------------------------------------------
@@ -521,6 +876,45 @@ namespace nfx::time::test
         EXPECT_GE( now.year(), 2024 );
     }
 
+    TEST( DateTimeFactory, UtcNowClockSources )
+    {
+        static_assert( ClockSource<PreciseClock> );
+        static_assert( ClockSource<CoarseClock> );
+        static_assert( ClockSource<TscClock> );
+
+        // Every source agrees with the precise clock to well within a second
+        const auto reference{ DateTime::utcNow() };
+        const auto tolerance{ TimeSpan::fromMilliseconds( 500 ) };
+
+        EXPECT_LE( std::abs( ( DateTime::utcNow<PreciseClock>() - reference ).ticks() ), tolerance.ticks() );
+        EXPECT_LE( std::abs( ( DateTime::utcNow<CoarseClock>() - reference ).ticks() ), tolerance.ticks() );
+        EXPECT_LE( std::abs( ( DateTime::utcNow<TscClock>() - reference ).ticks() ), tolerance.ticks() );
+    }
+
+    TEST( DateTimeFactory, UtcNowTscClockAdvances )
+    {
+        const auto first{ DateTime::utcNow<TscClock>() };
+        std::this_thread::sleep_for( std::chrono::milliseconds( 60 ) ); // Beyond one re-anchoring interval
+        const auto second{ DateTime::utcNow<TscClock>() };
+
+        EXPECT_GE( ( second - first ).ticks(), TimeSpan::fromMilliseconds( 50 ).ticks() );
+        EXPECT_LE( std::abs( ( second - DateTime::utcNow() ).ticks() ), TimeSpan::fromMilliseconds( 500 ).ticks() );
+    }
+
+    TEST( DateTimeFactory, UtcNowCustomClockSource )
+    {
+        struct FixedClock
+        {
+            static std::int64_t utcTicks() noexcept
+            {
+                return DateTime{ 2024, 6, 15, 12, 30, 45 }.ticks();
+            }
+        };
+        static_assert( ClockSource<FixedClock> );
+
+        EXPECT_EQ( DateTime::utcNow<FixedClock>(), ( DateTime{ 2024, 6, 15, 12, 30, 45 } ) );
+    }
+
     TEST( DateTimeFactory, Today )
     {
         DateTime today{ DateTime::today() };
@@ -650,6 +1044,94 @@ namespace nfx::time::test
         EXPECT_THROW( [[maybe_unused]] auto _ = DateTime{ "not-a-date" }, std::invalid_argument );
     }
 
+    TEST( DateTimeStringParsing, RejectMalformedCharactersInFixedBlock )
+    {
+        const std::string valid{ "2024-06-15T14:30:45.1234567Z" };
+        ASSERT_TRUE( DateTime::fromString( valid ).has_value() );
+
+        // Characters just outside the digit range and a letter, at each digit position
+        // (trailing day and second digits are omitted: the flexible fallback accepts single-digit fields)
+        const std::size_t digitPositions[]{ 0, 1, 2, 3, 5, 6, 8, 11, 12, 14, 15, 17 };
+        for( const auto pos : digitPositions )
+        {
+            for( const char c : { '/', ':', 'a' } )
+            {
+                std::string str{ valid };
+                str[pos] = c;
+                EXPECT_FALSE( DateTime::fromString( str ).has_value() ) << str;
+            }
+        }
+
+        // Wrong separators
+        const std::size_t separatorPositions[]{ 4, 7, 13, 16 };
+        for( const auto pos : separatorPositions )
+        {
+            std::string str{ valid };
+            str[pos] = 'x';
+            EXPECT_FALSE( DateTime::fromString( str ).has_value() ) << str;
+        }
+    }
+
+    TEST( DateTimeStringParsing, RoundTripRandomTimestamps )
+    {
+        std::mt19937_64 rng{ 20240615 };
+        std::uniform_int_distribution<std::int64_t> distribution{ DateTime::min().ticks(), DateTime::max().ticks() };
+
+        for( int i{ 0 }; i < 10000; ++i )
+        {
+            const DateTime dt{ distribution( rng ) };
+            const auto str{ dt.toString( DateTime::Format::Iso8601Precise ) };
+
+            DateTime parsed;
+            ASSERT_TRUE( DateTime::fromString( str, parsed ) ) << str;
+            EXPECT_EQ( parsed, dt ) << str;
+        }
+    }
+
+    TEST( DateTimeStringParsing, ParseManyMatchesFromString )
+    {
+        const std::vector<std::string_view> inputs{
+            "2024-06-15T14:30:45.1234567Z",
+            "2024-06-15T14:30:46.0000001Z",
+            "2024-02-30T14:30:46.0000001Z",  // Invalid date with dominant layout
+            "2024-06-15T14:30:47Z",          // Outlier: no fraction
+            "2024-06-15T14:30:48.5+02:00",   // Outlier: offset and short fraction
+            "2024-06-15",                    // Outlier: date only
+            "2024-06-15T14:30:49.123456789Z", // Outlier: nanosecond digits truncated
+            "not-a-date",
+            "" };
+
+        std::vector<DateTime> results( inputs.size() );
+        std::vector<std::uint8_t> ok( inputs.size() );
+
+        const auto parsed{ DateTime::parseMany( inputs, results, ok ) };
+        EXPECT_EQ( parsed, 6u );
+
+        for( std::size_t i{ 0 }; i < inputs.size(); ++i )
+        {
+            DateTime expected;
+            const bool expectedOk{ DateTime::fromString( inputs[i], expected ) };
+            EXPECT_EQ( ok[i] != 0, expectedOk ) << inputs[i];
+            EXPECT_EQ( results[i], expectedOk ? expected : DateTime{} ) << inputs[i];
+        }
+
+        EXPECT_EQ( results[0].toString( DateTime::Format::Iso8601Precise ), "2024-06-15T14:30:45.1234567Z" );
+    }
+
+    TEST( DateTimeStringParsing, ParseManyShortSpans )
+    {
+        const std::string_view inputs[]{ "2024-06-15T14:30:45Z", "2024-06-15T14:30:46Z", "2024-06-15T14:30:47Z" };
+        DateTime results[2];
+        std::uint8_t ok[3]{};
+
+        // Only min of the span sizes is processed
+        EXPECT_EQ( DateTime::parseMany( inputs, results, ok ), 2u );
+        EXPECT_EQ( ok[2], 0 );
+        EXPECT_EQ( results[1], DateTime( 2024, 6, 15, 14, 30, 46 ) );
+
+        EXPECT_EQ( DateTime::parseMany( {}, {}, {} ), 0u );
+    }
+
     //----------------------------------------------
     // std::chrono interoperability
     //----------------------------------------------
@@ -690,6 +1172,80 @@ namespace nfx::time::test
         EXPECT_EQ( roundTrip.second(), original.second() );
     }
 
+    //----------------------------------------------
+    // Prefix parsing
+    //----------------------------------------------
+
+    TEST( DateTimePrefixParsing, StopsAtEndOfTimestamp )
+    {
+        const std::string_view line{ "2024-06-15T14:30:45.1234567Z GET /index.html 200" };
+        DateTime dt;
+        const char* end{ DateTime::parsePrefix( line.data(), line.data() + line.size(), dt ) };
+
+        EXPECT_EQ( end - line.data(), 28 );
+        EXPECT_EQ( dt, DateTime{ "2024-06-15T14:30:45.1234567Z" } );
+
+        // Every accepted form, followed by trailing text
+        for( const std::string_view timestamp : { "2024-06-15",
+                 "2024-06-15T14:30:45",
+                 "2024-06-15T14:30:45Z",
+                 "2024-06-15T14:30:45.5",
+                 "2024-06-15T14:30:45+02:00" } )
+        {
+            const std::string text{ std::string{ timestamp } + "|trailing" };
+            DateTime prefixed, whole;
+            ASSERT_TRUE( DateTime::fromString( timestamp, whole ) ) << timestamp;
+            EXPECT_EQ( DateTime::parsePrefix( text.data(), text.data() + text.size(), prefixed ),
+                text.data() + timestamp.size() )
+                << timestamp;
+            EXPECT_EQ( prefixed, whole ) << timestamp;
+        }
+    }
+
+    TEST( DateTimePrefixParsing, BacksOffToLongestValidPrefix )
+    {
+        // Invalid time: only the date is consumed
+        const std::string_view text{ "2024-06-15T25:00:00Z" };
+        DateTime dt;
+        EXPECT_EQ( DateTime::parsePrefix( text.data(), text.data() + text.size(), dt ), text.data() + 10 );
+        EXPECT_EQ( dt, ( DateTime{ 2024, 6, 15 } ) );
+
+        // Incomplete time is not consumed
+        const std::string_view partial{ "2024-06-15T14:30" };
+        EXPECT_EQ( DateTime::parsePrefix( partial.data(), partial.data() + partial.size(), dt ), partial.data() + 10 );
+
+        // Nothing valid: returns first and leaves the result unchanged
+        const DateTime before{ 2000, 1, 1 };
+        dt = before;
+        for( const std::string_view bad : { "", "2024", "2024-13-01", "x2024-06-15", "20240615" } )
+        {
+            EXPECT_EQ( DateTime::parsePrefix( bad.data(), bad.data() + bad.size(), dt ), bad.data() ) << bad;
+            EXPECT_EQ( dt, before );
+        }
+    }
+
+    TEST( DateTimePrefixParsing, TokenizesBufferInOnePass )
+    {
+        const std::string_view log{ "2024-06-15T10:00:00Z a\n2024-06-15T10:00:01Z b\n2024-06-15T10:00:02Z c\n" };
+        std::vector<DateTime> stamps;
+        const char* p{ log.data() };
+        const char* last{ log.data() + log.size() };
+        while( p != last )
+        {
+            DateTime dt;
+            const char* end{ DateTime::parsePrefix( p, last, dt ) };
+            if( end != p )
+            {
+                stamps.push_back( dt );
+            }
+            p = std::find( end, last, '\n' );
+            p = p == last ? p : p + 1;
+        }
+
+        ASSERT_EQ( stamps.size(), 3 );
+        EXPECT_EQ( stamps[2] - stamps[0], TimeSpan::fromSeconds( 2 ) );
+    }
+
     //----------------------------------------------
     // Stream operators
     //----------------------------------------------
@@ -715,6 +1271,24 @@ namespace nfx::time::test
         EXPECT_EQ( dt.hour(), 12 );
     }
 
+    TEST( DateTimeStreamOperators, InputOperatorReadsSuccessiveTokens )
+    {
+        std::istringstream iss{ "2024-01-15T12:30:45Z 2024-01-16 bogus" };
+        DateTime first, second, third;
+        iss >> first >> second;
+
+        EXPECT_FALSE( iss.fail() );
+        EXPECT_EQ( second, ( DateTime{ 2024, 1, 16 } ) );
+
+        iss >> third;
+        EXPECT_TRUE( iss.fail() );
+
+        // noskipws: leading whitespace ends the (empty) token
+        std::istringstream spaced{ " 2024-01-15" };
+        spaced >> std::noskipws >> first;
+        EXPECT_TRUE( spaced.fail() );
+    }
+
     //----------------------------------------------
     // std::formatter support
     //----------------------------------------------
@@ -760,6 +1334,90 @@ namespace nfx::time::test
         EXPECT_NE( mixed.find( "2024-11-16" ), std::string::npos );
     }
 
+    TEST( DateTimeFormatter, NamedFormatSpecs )
+    {
+        const DateTime dt{ 2024, 3, 9, 7, 5, 3, 123 };
+        const std::pair<const char*, DateTime::Format> specs[]{
+            { "{:iso}", DateTime::Format::Iso8601 },
+            { "{:precise}", DateTime::Format::Iso8601Precise },
+            { "{:trimmed}", DateTime::Format::Iso8601PreciseTrimmed },
+            { "{:ms}", DateTime::Format::Iso8601Millis },
+            { "{:us}", DateTime::Format::Iso8601Micros },
+            { "{:ext}", DateTime::Format::Iso8601Extended },
+            { "{:extended}", DateTime::Format::Iso8601Extended },
+            { "{:basic}", DateTime::Format::Iso8601Basic },
+            { "{:date}", DateTime::Format::Iso8601Date },
+            { "{:time}", DateTime::Format::Iso8601Time },
+            { "{:unix}", DateTime::Format::UnixSeconds },
+            { "{:unixms}", DateTime::Format::UnixMilliseconds },
+        };
+
+        for( const auto& [spec, format] : specs )
+        {
+            EXPECT_EQ( std::vformat( spec, std::make_format_args( dt ) ), dt.toString( format ) ) << spec;
+        }
+
+        EXPECT_EQ( std::format( "{:ms}", dt ), "2024-03-09T07:05:03.123Z" );
+        EXPECT_EQ( std::format( "{:basic}", dt ), "20240309T070503Z" );
+        EXPECT_EQ( std::format( "{}", dt ), dt.toString() );
+    }
+
+    TEST( DateTimeFormatter, CustomPattern )
+    {
+        const DateTime dt{ DateTime{ 2024, 3, 9, 7, 5, 3 }.ticks() + 1234567 };
+
+        EXPECT_EQ( std::format( "{:yyyy-MM-dd HH:mm:ss}", dt ), "2024-03-09 07:05:03" );
+        EXPECT_EQ( std::format( "{:dd/MM/yyyy}", dt ), "09/03/2024" );
+        EXPECT_EQ( std::format( "{:HH:mm:ss.f}", dt ), "07:05:03.1" );
+        EXPECT_EQ( std::format( "{:HH:mm:ss.fff}", dt ), "07:05:03.123" );
+        EXPECT_EQ( std::format( "{:HH:mm:ss.fffffff}", dt ), "07:05:03.1234567" );
+        EXPECT_EQ( std::format( "{:yyyyMMdd'T'HHmmssK}", dt ), "20240309T070503Z" );
+    }
+
+    TEST( DateTimeFormatter, InvalidSpecThrows )
+    {
+        const DateTime dt{ 2024, 3, 9 };
+
+        EXPECT_THROW( (void)std::vformat( "{:bogus}", std::make_format_args( dt ) ), std::format_error );
+        EXPECT_THROW( (void)std::vformat( "{:yy-MM-dd}", std::make_format_args( dt ) ), std::format_error );
+        EXPECT_THROW( (void)std::vformat( "{:HH:mm:ss.ffffffff}", std::make_format_args( dt ) ), std::format_error );
+        EXPECT_THROW( (void)std::vformat( "{:yyyy 'open}", std::make_format_args( dt ) ), std::format_error );
+    }
+
+    //----------------------------------------------
+    // std::hash support
+    //----------------------------------------------
+
+    TEST( DateTimeHash, EqualValuesHashEqually )
+    {
+        const DateTime a{ 2024, 6, 15, 14, 30, 45 };
+        const DateTime b{ a.ticks() };
+
+        EXPECT_EQ( std::hash<DateTime>{}( a ), std::hash<DateTime>{}( b ) );
+        EXPECT_NE( std::hash<DateTime>{}( a ), std::hash<DateTime>{}( a + TimeSpan::fromSeconds( 1 ) ) );
+    }
+
+    TEST( DateTimeHash, SecondAlignedValuesSpreadOverLowBits )
+    {
+        // Whole-second ticks are multiples of 10^7: an identity hash would put them all in
+        // one of 128 buckets selected by the low 7 bits
+        const DateTime start{ 2024, 1, 1 };
+        std::unordered_set<std::size_t> lowBits;
+        for( int i{ 0 }; i < 4096; ++i )
+        {
+            lowBits.insert( std::hash<DateTime>{}( start + TimeSpan::fromSeconds( i ) ) & 127 );
+        }
+
+        EXPECT_EQ( lowBits.size(), 128 );
+
+        std::unordered_set<DateTime> set;
+        for( int i{ 0 }; i < 1000; ++i )
+        {
+            set.insert( start + TimeSpan::fromDays( i % 500 ) );
+        }
+        EXPECT_EQ( set.size(), 500 );
+    }
+
     //----------------------------------------------
     // Integration
     //----------------------------------------------
@@ -0,0 +1,273 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_DateTimeInterval.cpp
+ * @brief Unit tests for DateTimeInterval, DateTimeOffsetInterval and IntervalIndex
+ * @details Tests half-open set operations, offset-independent comparison, and index queries
+ *          against brute-force scans.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <nfx/datetime/DateTimeInterval.h>
+#include <nfx/datetime/IntervalIndex.h>
+
+namespace nfx::time::test
+{
+    //=====================================================================
+    // DateTimeInterval type tests
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    TEST( DateTimeIntervalConstruction, OrdersEndpoints )
+    {
+        constexpr DateTimeInterval interval{ DateTime{ 1'000 }, DateTime{ 500 } };
+        static_assert( interval.start().ticks() == 500 && interval.end().ticks() == 1'000 );
+
+        const DateTimeInterval meeting{ DateTime{ 2024, 6, 15, 9, 0, 0 }, TimeSpan::fromHours( 1.5 ) };
+        EXPECT_EQ( meeting.end(), ( DateTime{ 2024, 6, 15, 10, 30, 0 } ) );
+        EXPECT_EQ( meeting.duration(), TimeSpan::fromMinutes( 90 ) );
+        EXPECT_FALSE( meeting.isEmpty() );
+
+        const DateTimeInterval before{ DateTime{ 2024, 6, 15 }, TimeSpan::fromHours( -2 ) };
+        EXPECT_EQ( before.start(), ( DateTime{ 2024, 6, 14, 22, 0, 0 } ) );
+        EXPECT_TRUE( DateTimeInterval{}.isEmpty() );
+    }
+
+    //----------------------------------------------
+    // Set operations
+    //----------------------------------------------
+
+    TEST( DateTimeIntervalSetOperations, HalfOpenSemantics )
+    {
+        const DateTimeInterval morning{ DateTime{ 2024, 6, 15, 9, 0, 0 }, DateTime{ 2024, 6, 15, 12, 0, 0 } };
+        const DateTimeInterval lunch{ DateTime{ 2024, 6, 15, 12, 0, 0 }, DateTime{ 2024, 6, 15, 13, 0, 0 } };
+        const DateTimeInterval overlap{ DateTime{ 2024, 6, 15, 11, 0, 0 }, DateTime{ 2024, 6, 15, 12, 30, 0 } };
+
+        EXPECT_TRUE( morning.contains( DateTime{ 2024, 6, 15, 9, 0, 0 } ) );
+        EXPECT_FALSE( morning.contains( DateTime{ 2024, 6, 15, 12, 0, 0 } ) );
+        EXPECT_TRUE( morning.contains(
+            DateTimeInterval{ DateTime{ 2024, 6, 15, 10, 0, 0 }, DateTime{ 2024, 6, 15, 12, 0, 0 } } ) );
+        EXPECT_FALSE( morning.contains( overlap ) );
+
+        EXPECT_FALSE( morning.overlaps( lunch ) );
+        EXPECT_TRUE( morning.isAdjacent( lunch ) );
+        EXPECT_TRUE( morning.overlaps( overlap ) );
+        EXPECT_TRUE( lunch.overlaps( overlap ) );
+
+        EXPECT_EQ( morning.intersect( lunch ), std::nullopt );
+        EXPECT_EQ( morning.intersect( overlap ),
+            ( DateTimeInterval{ DateTime{ 2024, 6, 15, 11, 0, 0 }, DateTime{ 2024, 6, 15, 12, 0, 0 } } ) );
+        EXPECT_EQ( morning.merge( lunch ),
+            ( DateTimeInterval{ DateTime{ 2024, 6, 15, 9, 0, 0 }, DateTime{ 2024, 6, 15, 13, 0, 0 } } ) );
+
+        const DateTimeInterval evening{ DateTime{ 2024, 6, 15, 18, 0, 0 }, DateTime{ 2024, 6, 15, 20, 0, 0 } };
+        EXPECT_EQ( morning.merge( evening ), std::nullopt );
+        EXPECT_EQ( morning.hull( evening ),
+            ( DateTimeInterval{ DateTime{ 2024, 6, 15, 9, 0, 0 }, DateTime{ 2024, 6, 15, 20, 0, 0 } } ) );
+
+        // An empty interval inside another overlaps nothing
+        const DateTimeInterval point{ DateTime{ 2024, 6, 15, 10, 0, 0 }, DateTime{ 2024, 6, 15, 10, 0, 0 } };
+        EXPECT_FALSE( morning.overlaps( point ) );
+        EXPECT_FALSE( point.contains( point.start() ) );
+    }
+
+    TEST( DateTimeIntervalFormatting, Iso8601Interval )
+    {
+        const DateTimeInterval interval{ DateTime{ 2024, 6, 15, 9, 0, 0 }, DateTime{ 2024, 6, 15, 12, 0, 0 } };
+
+        EXPECT_EQ( interval.toString(), "2024-06-15T09:00:00Z/2024-06-15T12:00:00Z" );
+    }
+
+    //=====================================================================
+    // DateTimeOffsetInterval type tests
+    //=====================================================================
+
+    TEST( DateTimeOffsetIntervalSetOperations, ComparesUtcInstants )
+    {
+        // 10:00-12:00 at +02:00 is 08:00-10:00 UTC
+        const DateTimeOffsetInterval paris{ DateTimeOffset{ 2024, 6, 15, 10, 0, 0, TimeSpan::fromHours( 2 ) },
+            DateTimeOffset{ 2024, 6, 15, 12, 0, 0, TimeSpan::fromHours( 2 ) } };
+        const DateTimeOffsetInterval newYork{ DateTimeOffset{ 2024, 6, 15, 5, 0, 0, TimeSpan::fromHours( -4 ) },
+            DateTimeOffset{ 2024, 6, 15, 7, 0, 0, TimeSpan::fromHours( -4 ) } };
+
+        EXPECT_EQ( paris.duration(), TimeSpan::fromHours( 2 ) );
+        EXPECT_TRUE( paris.overlaps( newYork ) );
+        EXPECT_TRUE( paris.contains( DateTimeOffset{ 2024, 6, 15, 8, 30, 0, TimeSpan{} } ) );
+
+        // Endpoints keep the offset of the operand that supplied them
+        const auto shared{ paris.intersect( newYork ) };
+        ASSERT_TRUE( shared.has_value() );
+        EXPECT_TRUE( shared->start().equalsExact( DateTimeOffset{ 2024, 6, 15, 5, 0, 0, TimeSpan::fromHours( -4 ) } ) );
+        EXPECT_TRUE( shared->end().equalsExact( DateTimeOffset{ 2024, 6, 15, 12, 0, 0, TimeSpan::fromHours( 2 ) } ) );
+        EXPECT_EQ( paris.toUtc(),
+            ( DateTimeInterval{ DateTime{ 2024, 6, 15, 8, 0, 0 }, DateTime{ 2024, 6, 15, 10, 0, 0 } } ) );
+        EXPECT_EQ( paris.toString(), "2024-06-15T10:00:00+02:00/2024-06-15T12:00:00+02:00" );
+
+        // Swapped endpoints are ordered by instant, not by local time
+        const DateTimeOffsetInterval swapped{ DateTimeOffset{ 2024, 6, 15, 9, 0, 0, TimeSpan::fromHours( -4 ) },
+            DateTimeOffset{ 2024, 6, 15, 14, 0, 0, TimeSpan::fromHours( 2 ) } };
+        EXPECT_EQ( swapped.start().utcTicks(), ( DateTime{ 2024, 6, 15, 12, 0, 0 } ).ticks() );
+    }
+
+    //=====================================================================
+    // IntervalIndex tests
+    //=====================================================================
+
+    namespace
+    {
+        std::vector<DateTimeInterval> randomIntervals( std::size_t count, std::uint64_t seed )
+        {
+            std::mt19937_64 random{ seed };
+            const auto start{ DateTime{ 2024, 1, 1 }.ticks() };
+            std::uniform_int_distribution<std::int64_t> minute{ 0, 7 * 24 * 60 };
+            std::uniform_int_distribution<std::int64_t> length{ 0, 180 };
+
+            std::vector<DateTimeInterval> result;
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                const auto first{ start + minute( random ) * constants::TICKS_PER_MINUTE };
+                const auto last{ first + length( random ) * constants::TICKS_PER_MINUTE };
+                result.emplace_back( DateTime{ first }, DateTime{ last } );
+            }
+
+            return result;
+        }
+    } // namespace
+
+    //----------------------------------------------
+    // Queries
+    //----------------------------------------------
+
+    TEST( IntervalIndexQueries, MatchBruteForce )
+    {
+        for( const std::size_t size : { 0u, 1u, 2u, 3u, 100u, 1025u } )
+        {
+            const auto intervals{ randomIntervals( size, size + 1 ) };
+            const IntervalIndex index{ intervals };
+            ASSERT_TRUE( std::is_sorted( index.intervals().begin(), index.intervals().end() ) );
+
+            for( const auto& query : randomIntervals( 300, 99 ) )
+            {
+                std::vector<std::size_t> expected;
+                for( std::size_t i{ 0 }; i < intervals.size(); ++i )
+                {
+                    if( intervals[i].overlaps( query ) )
+                    {
+                        expected.push_back( i );
+                    }
+                }
+
+                auto actual{ index.overlapping( query ) };
+                std::sort( actual.begin(), actual.end() );
+                ASSERT_EQ( actual, expected ) << size << " " << query.toString();
+
+                std::vector<std::size_t> stabbed;
+                for( std::size_t i{ 0 }; i < intervals.size(); ++i )
+                {
+                    if( intervals[i].contains( query.start() ) )
+                    {
+                        stabbed.push_back( i );
+                    }
+                }
+
+                auto actualStabbed{ index.stabbing( query.start() ) };
+                std::sort( actualStabbed.begin(), actualStabbed.end() );
+                ASSERT_EQ( actualStabbed, stabbed ) << size << " " << query.start().toString();
+            }
+        }
+    }
+
+    TEST( IntervalIndexQueries, VisitsInStartOrderWithOriginalIndices )
+    {
+        const std::vector<DateTimeInterval> reservations{
+            { DateTime{ 2024, 6, 15, 14, 0, 0 }, DateTime{ 2024, 6, 15, 16, 0, 0 } },
+            { DateTime{ 2024, 6, 15, 9, 0, 0 }, DateTime{ 2024, 6, 15, 18, 0, 0 } },
+            { DateTime{ 2024, 6, 15, 10, 0, 0 }, DateTime{ 2024, 6, 15, 10, 0, 0 } },
+            { DateTime{ 2024, 6, 15, 11, 0, 0 }, DateTime{ 2024, 6, 15, 12, 0, 0 } },
+        };
+        const IntervalIndex index{ reservations };
+        EXPECT_EQ( index.size(), 3 );
+
+        std::vector<std::size_t> visited;
+        const DateTimeInterval window{ DateTime{ 2024, 6, 15, 10, 0, 0 }, DateTime{ 2024, 6, 15, 15, 0, 0 } };
+        index.forEachOverlapping( window, [&]( const DateTimeInterval& interval, std::size_t i ) {
+            EXPECT_EQ( interval, reservations[i] );
+            visited.push_back( i );
+        } );
+        EXPECT_EQ( visited, ( std::vector<std::size_t>{ 1, 3, 0 } ) );
+
+        EXPECT_EQ( index.stabbing( DateTime{ 2024, 6, 15, 16, 0, 0 } ), std::vector<std::size_t>{ 1 } );
+        EXPECT_TRUE( index.overlapping( DateTimeInterval{} ).empty() );
+
+        auto pairs{ index.overlappingPairs() };
+        std::sort( pairs.begin(), pairs.end() );
+        EXPECT_EQ( pairs, ( std::vector<std::pair<std::size_t, std::size_t>>{ { 1, 0 }, { 1, 3 } } ) );
+    }
+
+    //----------------------------------------------
+    // Coalescing
+    //----------------------------------------------
+
+    TEST( IntervalIndexCoalescing, MergesOverlappingAndAdjacent )
+    {
+        const std::vector<DateTimeInterval> windows{
+            { DateTime{ 2024, 6, 15, 12, 0, 0 }, DateTime{ 2024, 6, 15, 13, 0, 0 } },
+            { DateTime{ 2024, 6, 15, 9, 0, 0 }, DateTime{ 2024, 6, 15, 10, 0, 0 } },
+            { DateTime{ 2024, 6, 15, 10, 0, 0 }, DateTime{ 2024, 6, 15, 11, 0, 0 } },
+            { DateTime{ 2024, 6, 15, 12, 30, 0 }, DateTime{ 2024, 6, 15, 12, 45, 0 } },
+            { DateTime{ 2024, 6, 15, 20, 0, 0 }, DateTime{ 2024, 6, 15, 20, 0, 0 } },
+        };
+
+        const std::vector<DateTimeInterval> expected{
+            { DateTime{ 2024, 6, 15, 9, 0, 0 }, DateTime{ 2024, 6, 15, 11, 0, 0 } },
+            { DateTime{ 2024, 6, 15, 12, 0, 0 }, DateTime{ 2024, 6, 15, 13, 0, 0 } },
+        };
+        EXPECT_EQ( coalesce( windows ), expected );
+        EXPECT_EQ( IntervalIndex{ windows }.coalesced(), expected );
+
+        // Coalesced output is disjoint and covers the same instants
+        const auto intervals{ randomIntervals( 500, 5 ) };
+        const auto merged{ coalesce( intervals ) };
+        for( std::size_t i{ 1 }; i < merged.size(); ++i )
+        {
+            ASSERT_LT( merged[i - 1].end(), merged[i].start() );
+        }
+        for( const auto& interval : intervals )
+        {
+            if( !interval.isEmpty() )
+            {
+                ASSERT_TRUE( std::ranges::any_of( merged, [&]( const auto& m ) { return m.contains( interval ); } ) );
+            }
+        }
+    }
+} // namespace nfx::time::test
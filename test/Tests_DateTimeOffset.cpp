@@ -32,7 +32,15 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <random>
+#include <iterator>
 #include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include <nfx/datetime/DateTimeOffset.h>
 
@@ -143,6 +151,56 @@ namespace nfx::time::test
         EXPECT_EQ( dto.offset().hours(), 2.0 );
     }
 
+    TEST( DateTimeOffsetConstruction, ConstexprFromIso8601String )
+    {
+        constexpr DateTimeOffset dto{ "2024-01-15T12:30:45.5+02:00" };
+        static_assert( dto.offset() == TimeSpan::fromHours( 2 ) );
+        static_assert( dto.utcTicks() == DateTime{ "2024-01-15T10:30:45.5Z" }.ticks() );
+
+        EXPECT_TRUE( dto.equalsExact( DateTimeOffset{ std::string_view{ "2024-01-15T12:30:45.5+02:00" } } ) );
+    }
+
+    TEST( DateTimeOffsetConstruction, Literal )
+    {
+        using namespace nfx::time::literals;
+
+        constexpr auto value{ "2024-01-15T12:30:45-05:30"_dto };
+        static_assert( value.offset() == -"+05:30"_offset );
+        static_assert( "2024-01-15T12:30:45Z"_dto.offset() == TimeSpan{ 0 } );
+        static_assert( "2024-01-15T12:30:45+0530"_dto == "2024-01-15T07:00:45Z"_dto );
+
+        const auto runtime{ DateTimeOffset::fromString( "2024-01-15T12:30:45-05:30" ) };
+        ASSERT_TRUE( runtime.has_value() );
+        EXPECT_TRUE( value.equalsExact( *runtime ) );
+    }
+
+    TEST( DateTimeOffsetConstruction, ConstexprParserMatchesFromString )
+    {
+        const std::string_view inputs[]{ "2024-01-15T12:30:45Z",
+            "2024-01-15T12:30:45+02:00",
+            "2024-01-15T12:30:45.1234567-08:00",
+            "2024-01-15T12:30:45+0530",
+            "2024-01-15T12:30:45+14",
+            "2024-01-15T12:30:45+14:01",
+            "2024-01-15T12:30:45+02:60",
+            "2024-02-30T12:30:45Z" };
+
+        for( const auto input : inputs )
+        {
+            std::int64_t ticks{ 0 };
+            std::int64_t offsetTicks{ 0 };
+            const bool constexprParsed{ detail::parseIso8601DateTimeOffset( input, ticks, offsetTicks ) };
+
+            DateTimeOffset runtime;
+            EXPECT_EQ( constexprParsed, DateTimeOffset::fromString( input, runtime ) ) << input;
+            if( constexprParsed )
+            {
+                EXPECT_EQ( ticks, runtime.ticks() ) << input;
+                EXPECT_EQ( offsetTicks, runtime.offset().ticks() ) << input;
+            }
+        }
+    }
+
     TEST( DateTimeOffsetConstruction, CopyConstructor )
     {
         DateTimeOffset dto1{ 2024, 5, 15, 10, 20, 30, TimeSpan::fromHours( 2.0 ) };
@@ -160,6 +218,51 @@ namespace nfx::time::test
         EXPECT_EQ( dto2.ticks(), originalTicks );
     }
 
+    TEST( DateTimeOffsetConstruction, FromDateTimeLocalOffsetConcurrent )
+    {
+        // Scattered instants force cache misses; every thread must agree with the sequential result
+        std::mt19937_64 rng{ 42 };
+        std::uniform_int_distribution<std::int64_t> ticksDist{ DateTime{ 1971, 1, 1 }.ticks(),
+            DateTime{ 2037, 12, 31 }.ticks() };
+
+        std::vector<DateTime> instants;
+        std::vector<std::int64_t> expected;
+        for( int i{ 0 }; i < 2000; ++i )
+        {
+            instants.emplace_back( ticksDist( rng ) );
+            expected.push_back( DateTimeOffset{ instants.back() }.offset().ticks() );
+        }
+
+        std::atomic<int> mismatches{ 0 };
+        std::vector<std::thread> threads;
+        for( int t{ 0 }; t < 8; ++t )
+        {
+            threads.emplace_back( [&, t]() {
+                for( int pass{ 0 }; pass < 5; ++pass )
+                {
+                    for( std::size_t i{ 0 }; i < instants.size(); ++i )
+                    {
+                        const auto index{ ( i * 7 + static_cast<std::size_t>( t ) ) % instants.size() };
+                        if( DateTimeOffset{ instants[index] }.offset().ticks() != expected[index] )
+                        {
+                            mismatches.fetch_add( 1, std::memory_order_relaxed );
+                        }
+                    }
+                }
+            } );
+        }
+        for( auto& thread : threads )
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ( mismatches.load(), 0 );
+        for( const auto offsetTicks : expected )
+        {
+            EXPECT_EQ( offsetTicks % constants::TICKS_PER_SECOND, 0 );
+        }
+    }
+
     //----------------------------------------------
     // Assignment
     //----------------------------------------------
@@ -348,6 +451,23 @@ namespace nfx::time::test
         EXPECT_EQ( dto.dayOfYear(), 15 ); // 15th day of year
     }
 
+    TEST( DateTimeOffsetAccessors, ComponentsUseLocalTime )
+    {
+        // Local 2024-01-01 01:30 at +05:00 is still 2023-12-31 in UTC
+        const DateTimeOffset dto{ 2024, 1, 1, 1, 30, 0, TimeSpan::fromHours( 5.0 ) };
+        const auto c{ dto.components() };
+
+        EXPECT_EQ( c, dto.dateTime().components() );
+        EXPECT_EQ( c.year, 2024 );
+        EXPECT_EQ( c.month, 1 );
+        EXPECT_EQ( c.day, 1 );
+        EXPECT_EQ( c.hour, 1 );
+        EXPECT_EQ( c.minute, 30 );
+        EXPECT_EQ( c.dayOfWeek, 1 ); // Monday
+        EXPECT_EQ( c.dayOfYear, 1 );
+        EXPECT_EQ( dto.utcDateTime().components().year, 2023 );
+    }
+
     //----------------------------------------------
     // Conversion methods
     //----------------------------------------------
@@ -391,6 +511,25 @@ namespace nfx::time::test
         EXPECT_EQ( utc.offset().ticks(), 0 );
     }
 
+    TEST( DateTimeOffsetConversion, ToLocalTimePreservesInstant )
+    {
+        // Covers the precomputed transition table range and the C library fallback beyond it
+        std::mt19937_64 rng{ 7 };
+        std::uniform_int_distribution<std::int64_t> ticksDist{ DateTime{ 1900, 1, 1 }.ticks(),
+            DateTime{ 2400, 12, 31 }.ticks() };
+
+        for( int i{ 0 }; i < 10'000; ++i )
+        {
+            const DateTimeOffset utc{ DateTime{ ticksDist( rng ) }, TimeSpan{ 0 } };
+            const auto local{ utc.toLocalTime() };
+
+            ASSERT_EQ( local.utcTicks(), utc.utcTicks() );
+            ASSERT_EQ( local.offset().ticks() % constants::TICKS_PER_SECOND, 0 );
+            ASSERT_LE( std::abs( local.offset().ticks() ), constants::TICKS_PER_DAY );
+            ASSERT_EQ( local.offset(), DateTimeOffset{ utc.utcDateTime() }.offset() );
+        }
+    }
+
     TEST( DateTimeOffsetConversion, DateAndTimeOfDay )
     {
         DateTimeOffset dto{ 2024, 3, 15, 14, 30, 45, TimeSpan::fromHours( 1.0 ) };
@@ -405,6 +544,27 @@ namespace nfx::time::test
         EXPECT_EQ( timeOfDay.hours(), 14.0 + 30.0 / 60.0 + 45.0 / 3600.0 );
     }
 
+    //----------------------------------------------
+    // Bucketing
+    //----------------------------------------------
+
+    TEST( DateTimeOffsetBucketing, BucketsFollowLocalTime )
+    {
+        // 2024-03-15 01:20 at +05:30 is 2024-03-14 19:50 UTC
+        const DateTimeOffset dto{ DateTime{ 2024, 3, 15, 1, 20, 0 }, TimeSpan::fromMinutes( 330 ) };
+
+        const auto day{ dto.floor( TimeSpan::fromDays( 1 ) ) };
+        EXPECT_EQ( day.dateTime(), DateTime( 2024, 3, 15 ) );
+        EXPECT_EQ( day.offset(), dto.offset() );
+
+        EXPECT_EQ( dto.ceil( TimeSpan::fromHours( 1 ) ).dateTime(), DateTime( 2024, 3, 15, 2, 0, 0 ) );
+        EXPECT_EQ( dto.round( TimeSpan::fromHours( 1 ) ).dateTime(), DateTime( 2024, 3, 15, 1, 0, 0 ) );
+        EXPECT_EQ( dto.startOfWeek().dateTime(), DateTime( 2024, 3, 11 ) );
+        EXPECT_EQ( dto.startOfMonth().dateTime(), DateTime( 2024, 3, 1 ) );
+        EXPECT_EQ( dto.startOfYear().dateTime(), DateTime( 2024, 1, 1 ) );
+        EXPECT_EQ( dto.startOfYear().offset(), dto.offset() );
+    }
+
     //----------------------------------------------
     // Arithmetic methods
     //----------------------------------------------
@@ -446,6 +606,28 @@ namespace nfx::time::test
         EXPECT_EQ( result.day(), 15 );
     }
 
+    TEST( DateTimeOffsetArithmeticMethods, AddMonthsClampsDayAndKeepsOffset )
+    {
+        DateTimeOffset dto{ 2024, 1, 31, 23, 30, 0, TimeSpan::fromHours( -5.0 ) };
+
+        const auto result{ dto.addMonths( 1 ) };
+        EXPECT_EQ( result.dateTime(), DateTime( 2024, 2, 29, 23, 30, 0 ) );
+        EXPECT_EQ( result.offset(), dto.offset() );
+
+        EXPECT_EQ( dto.addMonths( -12000 ).year(), 1024 );
+        EXPECT_EQ( dto.addYears( 1 ).dateTime(), DateTime( 2025, 1, 31, 23, 30, 0 ) );
+    }
+
+    TEST( DateTimeOffsetArithmeticMethods, AddBusinessDaysInLocalTime )
+    {
+        // Friday 23:30 local at -05:00 is Saturday in UTC; business days follow local time
+        DateTimeOffset dto{ 2024, 3, 15, 23, 30, 0, TimeSpan::fromHours( -5.0 ) };
+
+        const auto result{ dto.addBusinessDays( 1 ) };
+        EXPECT_EQ( result.dateTime(), DateTime( 2024, 3, 18, 23, 30, 0 ) );
+        EXPECT_EQ( result.offset(), dto.offset() );
+    }
+
     //----------------------------------------------
     // String formatting
     //----------------------------------------------
@@ -576,6 +758,60 @@ namespace nfx::time::test
         EXPECT_EQ( str4, "2024-06-20T08:15:00.000001+05:30" );
     }
 
+    TEST( DateTimeOffsetStringFormatting, FormatToMatchesToString )
+    {
+        DateTime dt{ DateTime{ 2024, 6, 20, 8, 15, 30, 123 }.ticks() + 4567 };
+        DateTimeOffset dto{ dt, TimeSpan::fromHours( -9.5 ) };
+
+        const DateTime::Format formats[]{
+            DateTime::Format::Iso8601,
+            DateTime::Format::Iso8601Precise,
+            DateTime::Format::Iso8601PreciseTrimmed,
+            DateTime::Format::Iso8601Millis,
+            DateTime::Format::Iso8601Micros,
+            DateTime::Format::Iso8601Extended,
+            DateTime::Format::Iso8601Basic,
+            DateTime::Format::Iso8601Date,
+            DateTime::Format::Iso8601Time,
+            DateTime::Format::UnixSeconds,
+            DateTime::Format::UnixMilliseconds };
+
+        for( const auto format : formats )
+        {
+            char buffer[constants::MAX_ISO8601_LENGTH];
+            const auto length{ dto.formatTo( buffer, sizeof( buffer ), format ) };
+            EXPECT_EQ( std::string_view( buffer, length ), dto.toString( format ) );
+        }
+
+        EXPECT_EQ( dto.toString( DateTime::Format::Iso8601Precise ), "2024-06-20T08:15:30.1234567-09:30" );
+        EXPECT_EQ( dto.toString( DateTime::Format::Iso8601Basic ), "20240620T081530-0930" );
+        EXPECT_EQ( dto.toString( DateTime::Format::Iso8601Time ), "08:15:30-09:30" );
+    }
+
+    TEST( DateTimeOffsetStringFormatting, FormatToBufferTooSmall )
+    {
+        DateTimeOffset dto{ 2024, 6, 20, 8, 15, 30, TimeSpan::fromHours( 2 ) };
+
+        // "2024-06-20T08:15:30+02:00" is 25 characters
+        char buffer[25];
+        EXPECT_EQ( dto.formatTo( buffer, 24 ), 0u );
+        EXPECT_EQ( dto.formatTo( buffer, 25 ), 25u );
+        EXPECT_EQ( std::string_view( buffer, 25 ), "2024-06-20T08:15:30+02:00" );
+    }
+
+    TEST( DateTimeOffsetStringFormatting, FormatToSpanAndIterator )
+    {
+        DateTimeOffset dto{ 2024, 6, 20, 8, 15, 30, TimeSpan::fromHours( 2 ) };
+
+        std::array<char, 64> buffer{};
+        const auto length{ dto.formatTo( std::span<char>{ buffer } ) };
+        EXPECT_EQ( std::string_view( buffer.data(), length ), "2024-06-20T08:15:30+02:00" );
+
+        std::string out;
+        dto.formatTo( std::back_inserter( out ), DateTime::Format::Iso8601Extended );
+        EXPECT_EQ( out, "2024-06-20T08:15:30+02:00" );
+    }
+
     //----------------------------------------------
     // Comparison methods
     //----------------------------------------------
@@ -613,6 +849,30 @@ namespace nfx::time::test
     // Static factory methods
     //----------------------------------------------
 
+    TEST( DateTimeOffsetFactory, NowAndUtcNowClockSources )
+    {
+        struct FixedClock
+        {
+            static std::int64_t utcTicks() noexcept
+            {
+                return DateTime{ 2024, 6, 15, 12, 30, 45 }.ticks();
+            }
+        };
+
+        const auto utc{ DateTimeOffset::utcNow<FixedClock>() };
+        EXPECT_EQ( utc.offset(), TimeSpan{ 0 } );
+        EXPECT_EQ( utc.utcTicks(), ( DateTime{ 2024, 6, 15, 12, 30, 45 }.ticks() ) );
+
+        // Local time of the same instant, with the system offset
+        const auto local{ DateTimeOffset::now<FixedClock>() };
+        EXPECT_EQ( local.utcTicks(), utc.utcTicks() );
+        EXPECT_EQ( local, utc.toLocalTime() );
+
+        const auto coarse{ DateTimeOffset::utcNow<CoarseClock>() };
+        EXPECT_LE( std::abs( coarse.utcTicks() - DateTimeOffset::utcNow().utcTicks() ),
+            TimeSpan::fromMilliseconds( 500 ).ticks() );
+    }
+
     TEST( DateTimeOffsetFactory, MinMaxValues )
     {
         DateTimeOffset minVal{ DateTimeOffset::min() };
@@ -801,6 +1061,93 @@ namespace nfx::time::test
         EXPECT_TRUE( DateTimeOffset::fromString( "2024-01-15T12:00:00+14" ).has_value() );
     }
 
+    TEST( DateTimeOffsetStringParsing, RoundTripRandomTimestamps )
+    {
+        std::mt19937_64 rng{ 20240615 };
+        std::uniform_int_distribution<std::int64_t> tickDistribution{
+            DateTime{ 1, 1, 2 }.ticks(), DateTime{ 9999, 12, 30 }.ticks() };
+        std::uniform_int_distribution<std::int32_t> offsetDistribution{ -14 * 4, 14 * 4 };
+
+        for( int i{ 0 }; i < 10000; ++i )
+        {
+            const DateTimeOffset dto{ DateTime{ tickDistribution( rng ) },
+                TimeSpan::fromMinutes( offsetDistribution( rng ) * 15 ) };
+            const auto str{ dto.toString( DateTime::Format::Iso8601Precise ) };
+
+            DateTimeOffset parsed;
+            ASSERT_TRUE( DateTimeOffset::fromString( str, parsed ) ) << str;
+            EXPECT_TRUE( parsed.equalsExact( dto ) ) << str;
+        }
+    }
+
+    TEST( DateTimeOffsetStringParsing, ParseManyMatchesFromString )
+    {
+        const std::vector<std::string_view> inputs{
+            "2024-06-15T14:30:45.123+02:00",
+            "2024-06-15T14:30:46.456-05:30",
+            "2024-06-15T14:30:47.789+14:30", // Offset out of range
+            "2024-06-15T14:30:48Z",          // Outlier: UTC designator
+            "2024-06-15T14:30:49.5+0100",    // Outlier: compact offset
+            "2024-06-15",                    // Outlier: date only
+            "2024-13-15T14:30:45.123+02:00", // Invalid month
+            "garbage" };
+
+        std::vector<DateTimeOffset> results( inputs.size() );
+        std::vector<std::uint8_t> ok( inputs.size() );
+
+        const auto parsed{ DateTimeOffset::parseMany( inputs, results, ok ) };
+
+        std::size_t expectedParsed{ 0 };
+        for( std::size_t i{ 0 }; i < inputs.size(); ++i )
+        {
+            DateTimeOffset expected;
+            const bool expectedOk{ DateTimeOffset::fromString( inputs[i], expected ) };
+            expectedParsed += expectedOk ? 1 : 0;
+            EXPECT_EQ( ok[i] != 0, expectedOk ) << inputs[i];
+            if( expectedOk )
+            {
+                EXPECT_TRUE( results[i].equalsExact( expected ) ) << inputs[i];
+            }
+        }
+        EXPECT_EQ( parsed, expectedParsed );
+
+        EXPECT_EQ( results[1].toString( DateTime::Format::Iso8601Millis ), "2024-06-15T14:30:46.456-05:30" );
+        EXPECT_EQ( ok[2], 0 );
+    }
+
+    //----------------------------------------------
+    // Prefix parsing
+    //----------------------------------------------
+
+    TEST( DateTimeOffsetPrefixParsing, ConsumesOffsetAndStops )
+    {
+        const std::string_view line{ "[2024-06-15T14:30:00.250+05:45] INFO started" };
+        DateTimeOffset dto;
+        const char* end{ DateTimeOffset::parsePrefix( line.data() + 1, line.data() + line.size(), dto ) };
+
+        ASSERT_EQ( *end, ']' );
+        EXPECT_TRUE( dto.equalsExact( DateTimeOffset{ 2024, 6, 15, 14, 30, 0, 250, TimeSpan::fromMinutes( 345 ) } ) );
+
+        for( const std::string_view timestamp :
+            { "2024-06-15T14:30:00Z", "2024-06-15T14:30:00-0800", "2024-06-15T14:30:00+01", "2024-06-15T14:30:00" } )
+        {
+            const std::string text{ std::string{ timestamp } + " tail" };
+            DateTimeOffset prefixed, whole;
+            ASSERT_TRUE( DateTimeOffset::fromString( timestamp, whole ) ) << timestamp;
+            EXPECT_EQ( DateTimeOffset::parsePrefix( text.data(), text.data() + text.size(), prefixed ),
+                text.data() + timestamp.size() )
+                << timestamp;
+            EXPECT_TRUE( prefixed.equalsExact( whole ) ) << timestamp;
+        }
+
+        // An out-of-range offset backs off to the local time without it
+        const std::string_view bad{ "2024-06-15T14:30:00+15:00" };
+        EXPECT_EQ( DateTimeOffset::parsePrefix( bad.data(), bad.data() + bad.size(), dto ), bad.data() + 19 );
+
+        const std::string_view none{ "not a timestamp" };
+        EXPECT_EQ( DateTimeOffset::parsePrefix( none.data(), none.data() + none.size(), dto ), none.data() );
+    }
+
     //----------------------------------------------
     // Stream operators
     //----------------------------------------------
@@ -895,6 +1242,57 @@ namespace nfx::time::test
         // Should show +00:00 or Z for UTC
     }
 
+    TEST( DateTimeOffsetFormatter, NamedFormatSpecs )
+    {
+        const DateTimeOffset dto{ 2024, 3, 9, 7, 5, 3, 123, TimeSpan::fromMinutes( -330 ) };
+        const std::pair<const char*, DateTime::Format> specs[]{
+            { "{:iso}", DateTime::Format::Iso8601 },
+            { "{:precise}", DateTime::Format::Iso8601Precise },
+            { "{:trimmed}", DateTime::Format::Iso8601PreciseTrimmed },
+            { "{:ms}", DateTime::Format::Iso8601Millis },
+            { "{:us}", DateTime::Format::Iso8601Micros },
+            { "{:ext}", DateTime::Format::Iso8601Extended },
+            { "{:basic}", DateTime::Format::Iso8601Basic },
+            { "{:date}", DateTime::Format::Iso8601Date },
+            { "{:time}", DateTime::Format::Iso8601Time },
+            { "{:unix}", DateTime::Format::UnixSeconds },
+            { "{:unixms}", DateTime::Format::UnixMilliseconds },
+        };
+
+        for( const auto& [spec, format] : specs )
+        {
+            EXPECT_EQ( std::vformat( spec, std::make_format_args( dto ) ), dto.toString( format ) ) << spec;
+        }
+
+        EXPECT_EQ( std::format( "{:ms}", dto ), "2024-03-09T07:05:03.123-05:30" );
+    }
+
+    TEST( DateTimeOffsetFormatter, CustomPattern )
+    {
+        const DateTimeOffset dto{ 2024, 3, 9, 7, 5, 3, 250, TimeSpan::fromMinutes( 345 ) };
+
+        EXPECT_EQ( std::format( "{:yyyy-MM-dd HH:mm:ss.fff K}", dto ), "2024-03-09 07:05:03.250 +05:45" );
+        EXPECT_EQ( std::format( "{:HH:mm 'UTC'zzz}", dto ), "07:05 UTC+05:45" );
+        EXPECT_THROW( (void)std::vformat( "{:hh:mm}", std::make_format_args( dto ) ), std::format_error );
+    }
+
+    //----------------------------------------------
+    // std::hash support
+    //----------------------------------------------
+
+    TEST( DateTimeOffsetHash, ConsistentWithEquality )
+    {
+        // Same instant under different offsets compares and hashes equal
+        const DateTimeOffset utc{ 2024, 6, 15, 12, 0, 0, TimeSpan{} };
+        const DateTimeOffset paris{ 2024, 6, 15, 14, 0, 0, TimeSpan::fromHours( 2 ) };
+
+        ASSERT_EQ( utc, paris );
+        EXPECT_EQ( std::hash<DateTimeOffset>{}( utc ), std::hash<DateTimeOffset>{}( paris ) );
+
+        std::unordered_set<DateTimeOffset> set{ utc, paris, utc + TimeSpan::fromMinutes( 1 ) };
+        EXPECT_EQ( set.size(), 2 );
+    }
+
     //----------------------------------------------
     // Edge cases and validation
     //----------------------------------------------
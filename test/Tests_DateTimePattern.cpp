@@ -0,0 +1,249 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_DateTimePattern.cpp
+ * @brief Unit tests for compile-time FixedPattern and runtime DateTimePattern
+ * @details Checks formatting against std::formatter patterns, exact-layout parsing, field
+ *          validation, offsets and agreement between compile-time and runtime programs
+ */
+
+#include <gtest/gtest.h>
+
+#include <format>
+#include <random>
+
+#include <nfx/datetime/DateTimePattern.h>
+
+namespace nfx::time::test
+{
+    //=====================================================================
+    // FixedPattern
+    //=====================================================================
+
+    //----------------------------------------------
+    // Formatting
+    //----------------------------------------------
+
+    TEST( FixedPatternFormatting, VendorLayouts )
+    {
+        const DateTime dt{ DateTime{ 2024, 3, 9, 7, 5, 3 }.ticks() + 1234567 };
+
+        EXPECT_EQ( format<"dd/MM/yyyy HH:mm:ss.fff">( dt ), "09/03/2024 07:05:03.123" );
+        EXPECT_EQ( format<"yyyyMMdd-HHmmss">( dt ), "20240309-070503" );
+        EXPECT_EQ( format<"yyyy-MM-dd'T'HH:mm:ss.fffffffK">( dt ), "2024-03-09T07:05:03.1234567Z" );
+        EXPECT_EQ( format<"HH'h'mm">( dt ), "07h05" );
+        EXPECT_EQ( FixedPattern<"yyyyMMdd-HHmmss">::LENGTH, 15u );
+    }
+
+    TEST( FixedPatternFormatting, Offsets )
+    {
+        const DateTimeOffset dto{ 2024, 3, 9, 7, 5, 3, 250, TimeSpan::fromMinutes( -330 ) };
+
+        EXPECT_EQ( format<"yyyy-MM-dd HH:mm:ss.fff K">( dto ), "2024-03-09 07:05:03.250 -05:30" );
+        EXPECT_EQ( format<"HH:mm zzz">( dto ), "07:05 -05:30" );
+        EXPECT_EQ( format<"HH:mm zzz">( DateTime{ 2024, 3, 9, 7, 5, 0 } ), "07:05 +00:00" );
+        EXPECT_EQ( FixedPattern<"HH:mmK">::LENGTH, 6u );
+        EXPECT_EQ( FixedPattern<"HH:mmK">::OFFSET_LENGTH, 11u );
+    }
+
+    TEST( FixedPatternFormatting, MatchesStdFormatter )
+    {
+        std::mt19937_64 rng{ 42 };
+        std::uniform_int_distribution<std::int64_t> ticks{ 0, constants::MAX_DATETIME_TICKS };
+
+        for( int i{ 0 }; i < 1000; ++i )
+        {
+            const DateTime dt{ ticks( rng ) };
+            const DateTimeOffset dto{ dt, TimeSpan::fromMinutes( ( i % 57 ) * 15 - 420 ) };
+
+            EXPECT_EQ(
+                format<"yyyy-MM-dd HH:mm:ss.fffffff K">( dt ), std::format( "{:yyyy-MM-dd HH:mm:ss.fffffff K}", dt ) );
+            EXPECT_EQ(
+                format<"dd/MM/yyyy HH:mm:ss.ff zzz">( dto ), std::format( "{:dd/MM/yyyy HH:mm:ss.ff zzz}", dto ) );
+        }
+    }
+
+    TEST( FixedPatternFormatting, BufferTooSmall )
+    {
+        const DateTime dt{ 2024, 3, 9 };
+        char buffer[15];
+
+        EXPECT_EQ( formatTo<"yyyyMMdd-HHmmss">( dt, buffer ), 15u );
+        EXPECT_EQ( std::string_view( buffer, 15 ), "20240309-000000" );
+        EXPECT_EQ( formatTo<"yyyy-MM-dd HH:mm:ss">( dt, buffer ), 0u );
+    }
+
+    //----------------------------------------------
+    // Parsing
+    //----------------------------------------------
+
+    TEST( FixedPatternParsing, RoundTrip )
+    {
+        std::mt19937_64 rng{ 7 };
+        std::uniform_int_distribution<std::int64_t> ticks{ 0, constants::MAX_DATETIME_TICKS };
+
+        for( int i{ 0 }; i < 1000; ++i )
+        {
+            const DateTime dt{ ticks( rng ) };
+            DateTime parsed;
+            const auto text{ format<"dd/MM/yyyy HH:mm:ss.fffffff">( dt ) };
+            ASSERT_TRUE( tryParse<"dd/MM/yyyy HH:mm:ss.fffffff">( text, parsed ) );
+            EXPECT_EQ( parsed, dt );
+
+            const DateTimeOffset dto{ dt, TimeSpan::fromMinutes( ( i % 113 ) * 15 - 840 ) };
+            DateTimeOffset parsedOffset;
+            const auto offsetText{ format<"yyyyMMdd'T'HHmmss.fffffffK">( dto ) };
+            ASSERT_TRUE( tryParse<"yyyyMMdd'T'HHmmss.fffffffK">( offsetText, parsedOffset ) );
+            EXPECT_EQ( parsedOffset.dateTime(), dto.dateTime() );
+            EXPECT_EQ( parsedOffset.offset(), dto.offset() );
+        }
+    }
+
+    TEST( FixedPatternParsing, PartialFields )
+    {
+        DateTime parsed;
+
+        ASSERT_TRUE( tryParse<"dd/MM/yyyy">( "29/02/2024", parsed ) );
+        EXPECT_EQ( parsed, ( DateTime{ 2024, 2, 29 } ) );
+
+        ASSERT_TRUE( tryParse<"yyyyMMdd-HHmm">( "20240309-0705", parsed ) );
+        EXPECT_EQ( parsed, ( DateTime{ 2024, 3, 9, 7, 5, 0 } ) );
+
+        ASSERT_TRUE( tryParse<"HH:mm:ss.f">( "07:05:03.5", parsed ) );
+        EXPECT_EQ( parsed.ticks(), ( DateTime{ 1, 1, 1, 7, 5, 3, 500 }.ticks() ) );
+    }
+
+    TEST( FixedPatternParsing, OffsetHandling )
+    {
+        DateTime utc;
+        ASSERT_TRUE( tryParse<"yyyy-MM-dd HH:mm zzz">( "2024-03-09 07:05 +02:00", utc ) );
+        EXPECT_EQ( utc, ( DateTime{ 2024, 3, 9, 5, 5, 0 } ) );
+
+        ASSERT_TRUE( tryParse<"yyyy-MM-dd HH:mmK">( "2024-03-09 07:05Z", utc ) );
+        EXPECT_FALSE( tryParse<"yyyy-MM-dd HH:mmK">( "2024-03-09 07:05+00:00", utc ) );
+
+        DateTimeOffset dto;
+        ASSERT_TRUE( tryParse<"yyyy-MM-dd HH:mmK">( "2024-03-09 07:05Z", dto ) );
+        EXPECT_EQ( dto.offset(), TimeSpan{} );
+        ASSERT_TRUE( tryParse<"yyyy-MM-dd HH:mmK">( "2024-03-09 07:05-09:30", dto ) );
+        EXPECT_EQ( dto.totalOffsetMinutes(), -570 );
+        EXPECT_EQ( dto.dateTime(), ( DateTime{ 2024, 3, 9, 7, 5, 0 } ) );
+        EXPECT_FALSE( tryParse<"yyyy-MM-dd HH:mmK">( "2024-03-09 07:05+15:00", dto ) );
+        EXPECT_FALSE( tryParse<"yyyy-MM-dd HH:mm zzz">( "2024-03-09 07:05 Z", dto ) );
+    }
+
+    TEST( FixedPatternParsing, RejectsMismatches )
+    {
+        DateTime parsed{ 2000, 1, 1 };
+        const DateTime original{ parsed };
+
+        EXPECT_FALSE( tryParse<"dd/MM/yyyy">( "29/02/2023", parsed ) ); // Not a leap year
+        EXPECT_FALSE( tryParse<"dd/MM/yyyy">( "31/04/2024", parsed ) );
+        EXPECT_FALSE( tryParse<"dd/MM/yyyy">( "01/13/2024", parsed ) );
+        EXPECT_FALSE( tryParse<"dd/MM/yyyy">( "01/01/0000", parsed ) );
+        EXPECT_FALSE( tryParse<"dd/MM/yyyy">( "01-01-2024", parsed ) );  // Literal mismatch
+        EXPECT_FALSE( tryParse<"dd/MM/yyyy">( "1/01/2024", parsed ) );   // Wrong length
+        EXPECT_FALSE( tryParse<"dd/MM/yyyy">( "01/01/2024 ", parsed ) ); // Trailing text
+        EXPECT_FALSE( tryParse<"dd/MM/yyyy">( "0a/01/2024", parsed ) );
+        EXPECT_FALSE( tryParse<"HH:mm">( "24:00", parsed ) );
+        EXPECT_FALSE( tryParse<"HH:mm:ss">( "23:59:60", parsed ) );
+        EXPECT_FALSE( tryParse<"yyyy-MM-dd HH:mm zzz">( "0001-01-01 00:00 +01:00", parsed ) ); // Before MinValue
+        EXPECT_EQ( parsed, original );
+    }
+
+    //----------------------------------------------
+    // Compile-time validation
+    //----------------------------------------------
+
+    TEST( FixedPatternValidation, PatternsCheckedAtCompileTime )
+    {
+        static_assert( detail::isValidPattern( "dd/MM/yyyy HH:mm:ss.fff" ) );
+        static_assert( detail::isValidPattern( "yyyy'year'" ) );
+        static_assert( !detail::isValidPattern( "dd/MM/yy" ) );        // yy not supported
+        static_assert( !detail::isValidPattern( "yyyy-MM-ddTHH:mm" ) ); // T must be quoted
+        static_assert( !detail::isValidPattern( "HH:mm 'open" ) );      // Unterminated quote
+        static_assert( !detail::isValidPattern( "ss.ffffffff" ) );      // More than 7 fraction digits
+        static_assert( FixedPattern<"yyyy-MM-dd">::LENGTH == 10 );
+
+        // format<"yyyy-MM-ddTHH:mm">( DateTime{} ) does not compile
+        SUCCEED();
+    }
+
+    //=====================================================================
+    // DateTimePattern
+    //=====================================================================
+
+    TEST( DateTimePatternRuntime, CompileRejectsInvalidPatterns )
+    {
+        EXPECT_TRUE( DateTimePattern::compile( "dd/MM/yyyy HH:mm:ss.fff" ).has_value() );
+        EXPECT_FALSE( DateTimePattern::compile( "" ).has_value() );
+        EXPECT_FALSE( DateTimePattern::compile( "dd/MM/yy" ).has_value() );
+        EXPECT_FALSE( DateTimePattern::compile( "yyyy-MM-ddTHH" ).has_value() );
+        EXPECT_FALSE( DateTimePattern::compile( std::string( DateTimePattern::MAX_LENGTH + 1, '-' ) ).has_value() );
+        EXPECT_TRUE( DateTimePattern::compile( std::string( DateTimePattern::MAX_LENGTH, '-' ) ).has_value() );
+    }
+
+    TEST( DateTimePatternRuntime, MatchesFixedPattern )
+    {
+        const auto pattern{ DateTimePattern::compile( "yyyyMMdd'T'HHmmss.fffK" ) };
+        ASSERT_TRUE( pattern.has_value() );
+        EXPECT_EQ( pattern->length(), ( FixedPattern<"yyyyMMdd'T'HHmmss.fffK">::LENGTH ) );
+        EXPECT_EQ( pattern->offsetLength(), ( FixedPattern<"yyyyMMdd'T'HHmmss.fffK">::OFFSET_LENGTH ) );
+
+        std::mt19937_64 rng{ 3 };
+        std::uniform_int_distribution<std::int64_t> ticks{ 0, constants::MAX_DATETIME_TICKS };
+
+        for( int i{ 0 }; i < 1000; ++i )
+        {
+            const DateTime dt{ ticks( rng ) };
+            const DateTimeOffset dto{ dt, TimeSpan::fromMinutes( ( i % 29 ) * 30 - 420 ) };
+
+            const auto text{ pattern->format( dt ) };
+            ASSERT_EQ( text, ( format<"yyyyMMdd'T'HHmmss.fffK">( dt ) ) );
+            ASSERT_EQ( pattern->format( dto ), ( format<"yyyyMMdd'T'HHmmss.fffK">( dto ) ) );
+
+            DateTime runtimeParsed, fixedParsed;
+            ASSERT_TRUE( pattern->tryParse( text, runtimeParsed ) );
+            ASSERT_TRUE( tryParse<"yyyyMMdd'T'HHmmss.fffK">( text, fixedParsed ) );
+            EXPECT_EQ( runtimeParsed, fixedParsed );
+            EXPECT_EQ( runtimeParsed.ticks(), dt.ticks() - dt.ticks() % constants::TICKS_PER_MILLISECOND );
+        }
+    }
+
+    TEST( DateTimePatternRuntime, ParsesOffsets )
+    {
+        const auto pattern{ DateTimePattern::compile( "dd.MM.yyyy HH:mm zzz" ) };
+        ASSERT_TRUE( pattern.has_value() );
+
+        DateTimeOffset dto;
+        ASSERT_TRUE( pattern->tryParse( "09.03.2024 07:05 +05:45", dto ) );
+        EXPECT_EQ( dto.totalOffsetMinutes(), 345 );
+        EXPECT_EQ( dto.dateTime(), ( DateTime{ 2024, 3, 9, 7, 5, 0 } ) );
+        EXPECT_FALSE( pattern->tryParse( "09.03.2024 07:05 +0545", dto ) );
+
+        char buffer[8];
+        EXPECT_EQ( pattern->formatTo( dto, buffer, sizeof( buffer ) ), 0u );
+    }
+} // namespace nfx::time::test
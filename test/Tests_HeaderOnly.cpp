@@ -0,0 +1,130 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_HeaderOnly.cpp
+ * @brief Unit tests for the header-only interface target
+ * @details Linked against nfx-datetime::header-only without the compiled library, so every
+ *          function used here must be defined in the headers; a missing definition fails the link.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+
+#include <nfx/datetime/DateTime.h>
+#include <nfx/datetime/DateTimeOffset.h>
+#include <nfx/datetime/TimeSpan.h>
+
+namespace nfx::time::test
+{
+    //=====================================================================
+    // Header-only API tests
+    //=====================================================================
+
+    //----------------------------------------------
+    // DateTime
+    //----------------------------------------------
+
+    TEST( HeaderOnlyDateTime, ComponentsAndAccessors )
+    {
+        constexpr DateTime dt{ 2024, 2, 29, 13, 45, 30, 250 };
+        static_assert( dt.year() == 2024 && dt.month() == 2 && dt.day() == 29 );
+        static_assert( dt.hour() == 13 && dt.minute() == 45 && dt.second() == 30 );
+        static_assert( dt.millisecond() == 250 );
+        static_assert( dt.dayOfYear() == 60 );
+        static_assert( dt.isValid() );
+
+        const DateTime runtime{ dt.ticks() };
+        EXPECT_EQ( runtime.dayOfWeek(), 4 );
+        EXPECT_EQ( runtime.date(), DateTime( 2024, 2, 29 ) );
+        EXPECT_EQ( runtime.timeOfDay(), TimeSpan::fromHours( 13 ) + TimeSpan::fromMinutes( 45 ) +
+                                            TimeSpan::fromSeconds( 30 ) + TimeSpan::fromMilliseconds( 250 ) );
+    }
+
+    TEST( HeaderOnlyDateTime, InvalidComponentsFallBackToMin )
+    {
+        static_assert( DateTime{ 2023, 2, 29 } == DateTime::min() );
+        static_assert( DateTime{ 2024, 1, 1, 24, 0, 0 } == DateTime::min() );
+    }
+
+    TEST( HeaderOnlyDateTime, Formatting )
+    {
+        const DateTime dt{ 2024, 1, 15, 12, 30, 45, 123 };
+
+        std::array<char, 64> buffer{};
+        const std::size_t length{ dt.formatTo( buffer.data(), buffer.size(), DateTime::Format::Iso8601Extended ) };
+        EXPECT_EQ( std::string( buffer.data(), length ), "2024-01-15T12:30:45+00:00" );
+
+        EXPECT_EQ( dt.toString(), "2024-01-15T12:30:45Z" );
+        EXPECT_EQ( dt.formatTo( buffer.data(), 4 ), 0u );
+    }
+
+    TEST( HeaderOnlyDateTime, LiteralsAndConstexprParsing )
+    {
+        using namespace nfx::time::literals;
+
+        constexpr auto dt{ "2024-01-15T12:30:45Z"_dt };
+        static_assert( dt == DateTime{ 2024, 1, 15, 12, 30, 45 } );
+
+        constexpr DateTime parsed{ "2024-01-15T12:30:45.5" };
+        static_assert( parsed.millisecond() == 500 );
+    }
+
+    //----------------------------------------------
+    // DateTimeOffset
+    //----------------------------------------------
+
+    TEST( HeaderOnlyDateTimeOffset, ConversionsAndFormatting )
+    {
+        using namespace nfx::time::literals;
+
+        constexpr auto value{ "2024-01-15T12:30:45+05:30"_dto };
+        static_assert( value.hour() == 12 && value.utcDateTime().hour() == 7 );
+        static_assert( value.toUniversalTime().offset() == TimeSpan{ 0 } );
+        static_assert( value.toOffset( "-05:00"_offset ).hour() == 2 );
+        static_assert( value.addDays( 1 ).day() == 16 );
+
+        EXPECT_EQ( value.toString(), "2024-01-15T12:30:45+05:30" );
+        EXPECT_EQ( DateTimeOffset::fromEpochSeconds( value.toEpochSeconds() ), value.toUniversalTime() );
+    }
+
+    //----------------------------------------------
+    // TimeSpan
+    //----------------------------------------------
+
+    TEST( HeaderOnlyTimeSpan, Formatting )
+    {
+        using namespace nfx::time::literals;
+
+        constexpr auto span{ "PT1H30M"_ts };
+        static_assert( span == 1_h + 30_min );
+
+        std::array<char, 64> buffer{};
+        const std::size_t length{ span.formatTo( buffer.data(), buffer.size() ) };
+        EXPECT_EQ( std::string( buffer.data(), length ), "PT1H30M" );
+        EXPECT_EQ( span.toString(), "PT1H30M" );
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,160 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_PackedDateTimeOffset.cpp
+ * @brief Unit tests for PackedDateTimeOffset
+ * @details Tests packing and unpacking round trips, truncation of sub-millisecond ticks and
+ *          offset seconds, ordering by raw integer value and span packing.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <nfx/datetime/Bulk.h>
+#include <nfx/datetime/PackedDateTimeOffset.h>
+
+namespace nfx::time::test
+{
+    static_assert( sizeof( PackedDateTimeOffset ) == 8 );
+    static_assert( std::is_trivially_copyable_v<PackedDateTimeOffset> );
+
+    //=====================================================================
+    // PackedDateTimeOffset type tests
+    //=====================================================================
+
+    //----------------------------------------------
+    // Conversion
+    //----------------------------------------------
+
+    TEST( PackedDateTimeOffsetConversion, RoundTripsMillisecondValues )
+    {
+        const std::vector<DateTimeOffset> values{
+            DateTimeOffset{ DateTime{ 2024, 6, 15, 14, 30, 45, 123 }, TimeSpan::fromHours( 2 ) },
+            DateTimeOffset{ DateTime{ 1970, 1, 1 }, TimeSpan{} },
+            DateTimeOffset{ DateTime{ 2024, 1, 1 }, TimeSpan::fromMinutes( 330 ) },
+            DateTimeOffset{ DateTime{ 2024, 1, 1 }, TimeSpan::fromMinutes( -570 ) },
+            DateTimeOffset{ DateTime{ 1, 1, 1 }, TimeSpan::fromHours( 14 ) },
+            DateTimeOffset{ DateTime{ 1, 1, 1 }, TimeSpan::fromHours( -24 ) },
+            DateTimeOffset{ DateTime::max().ticks() - DateTime::max().ticks() % 10000, TimeSpan::fromHours( -14 ) },
+            DateTimeOffset{ DateTime::max().ticks() - DateTime::max().ticks() % 10000, TimeSpan::fromHours( 24 ) },
+        };
+
+        for( const auto& value : values )
+        {
+            ASSERT_TRUE( PackedDateTimeOffset::isRepresentable( value ) ) << value.toString();
+
+            const PackedDateTimeOffset packed{ value };
+            const auto unpacked{ packed.toDateTimeOffset() };
+            EXPECT_TRUE( unpacked.equalsExact( value ) ) << value.toString() << " -> " << unpacked.toString();
+            EXPECT_EQ( packed.utcTicks(), value.utcTicks() );
+            EXPECT_EQ( packed.offset(), value.offset() );
+            EXPECT_EQ( packed.totalOffsetMinutes(), value.totalOffsetMinutes() );
+            EXPECT_EQ( PackedDateTimeOffset::fromRaw( packed.raw() ), packed );
+        }
+    }
+
+    TEST( PackedDateTimeOffsetConversion, TruncatesFinerValues )
+    {
+        const DateTime millisecond{ 2024, 6, 15, 14, 30, 45, 123 };
+        const DateTimeOffset fine{ millisecond + TimeSpan{ 4567 }, TimeSpan::fromHours( 1 ) };
+        EXPECT_FALSE( PackedDateTimeOffset::isRepresentable( fine ) );
+        EXPECT_EQ( PackedDateTimeOffset{ fine }.toDateTimeOffset().dateTime(), millisecond );
+
+        // Instants before 0001-01-01 UTC round toward negative infinity
+        const DateTimeOffset early{ DateTime{ 5 }, TimeSpan::fromHours( 1 ) };
+        EXPECT_EQ( PackedDateTimeOffset{ early }.utcTicks(), early.utcTicks() - early.utcTicks() % 10000 - 10000 );
+
+        // Offset seconds truncate toward zero, out-of-range offsets clamp to ±24:00
+        const DateTimeOffset seconds{ DateTime{ 2024, 1, 1 }, TimeSpan::fromSeconds( -( 5 * 3600 + 30 * 60 + 15 ) ) };
+        EXPECT_FALSE( PackedDateTimeOffset::isRepresentable( seconds ) );
+        EXPECT_EQ( PackedDateTimeOffset{ seconds }.totalOffsetMinutes(), -330 );
+
+        const DateTimeOffset wide{ DateTime{ 2024, 1, 1 }, TimeSpan::fromHours( 30 ) };
+        EXPECT_FALSE( PackedDateTimeOffset::isRepresentable( wide ) );
+        EXPECT_EQ( PackedDateTimeOffset{ wide }.totalOffsetMinutes(), 24 * 60 );
+    }
+
+    TEST( PackedDateTimeOffsetConversion, DefaultIsMinimumAtUtc )
+    {
+        const PackedDateTimeOffset packed{};
+        EXPECT_EQ( packed.utcTicks(), 0 );
+        EXPECT_EQ( packed.totalOffsetMinutes(), 0 );
+        EXPECT_EQ( packed, ( PackedDateTimeOffset{ DateTimeOffset{ DateTime::min(), TimeSpan{} } } ) );
+    }
+
+    //----------------------------------------------
+    // Comparison
+    //----------------------------------------------
+
+    TEST( PackedDateTimeOffsetComparison, OrdersByInstantThenOffset )
+    {
+        // Same instant in three offsets: equal as DateTimeOffset, ordered by offset when packed
+        const DateTimeOffset utc{ DateTime{ 2024, 6, 15, 12, 0, 0 }, TimeSpan{} };
+        const DateTimeOffset paris{ DateTime{ 2024, 6, 15, 14, 0, 0 }, TimeSpan::fromHours( 2 ) };
+        const DateTimeOffset newYork{ DateTime{ 2024, 6, 15, 8, 0, 0 }, TimeSpan::fromHours( -4 ) };
+        ASSERT_EQ( utc, paris );
+        EXPECT_LT( PackedDateTimeOffset{ newYork }, PackedDateTimeOffset{ utc } );
+        EXPECT_LT( PackedDateTimeOffset{ utc }, PackedDateTimeOffset{ paris } );
+        EXPECT_NE( PackedDateTimeOffset{ utc }, PackedDateTimeOffset{ paris } );
+
+        // A later instant sorts after regardless of offset
+        const DateTimeOffset later{ DateTime{ 2024, 6, 15, 11, 0, 1 }, TimeSpan::fromHours( -14 ) };
+        EXPECT_GT( PackedDateTimeOffset{ later }, PackedDateTimeOffset{ paris } );
+    }
+
+    TEST( PackedDateTimeOffsetComparison, SortMatchesDateTimeOffsetSort )
+    {
+        std::mt19937_64 random{ 21 };
+        std::uniform_int_distribution<std::int64_t> ticks{
+            constants::TICKS_PER_DAY, DateTime::max().ticks() - constants::TICKS_PER_DAY };
+        std::uniform_int_distribution<std::int32_t> minutes{ -14 * 60, 14 * 60 };
+
+        std::vector<DateTimeOffset> values;
+        for( int i{ 0 }; i < 10000; ++i )
+        {
+            const auto raw{ ticks( random ) };
+            values.emplace_back( raw - raw % 10000, TimeSpan::fromMinutes( minutes( random ) ) );
+        }
+
+        std::vector<PackedDateTimeOffset> packed( values.size() );
+        ASSERT_EQ( bulk::pack( values, packed ), values.size() );
+
+        std::sort( packed.begin(), packed.end() );
+        std::stable_sort( values.begin(), values.end(), []( const auto& a, const auto& b ) {
+            return a.utcTicks() != b.utcTicks() ? a.utcTicks() < b.utcTicks() : a.offset() < b.offset();
+        } );
+
+        std::vector<DateTimeOffset> unpacked( packed.size() );
+        ASSERT_EQ( bulk::unpack( packed, unpacked ), packed.size() );
+        for( std::size_t i{ 0 }; i < values.size(); ++i )
+        {
+            ASSERT_TRUE( unpacked[i].equalsExact( values[i] ) ) << i;
+        }
+    }
+} // namespace nfx::time::test
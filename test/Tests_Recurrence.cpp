@@ -0,0 +1,499 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_Recurrence.cpp
+ * @brief Unit tests for Recurrence schedules
+ * @details Tests cron and RRULE compilation, occurrence search against RFC 5545 examples and a
+ *          minute-by-minute reference walk, DateTimeOffset and TimeZone evaluation, and lazy
+ *          ranges. Tests that need zone files are skipped when no zoneinfo database is installed.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include <nfx/datetime/Recurrence.h>
+
+namespace nfx::time::test
+{
+    namespace
+    {
+        /** @brief Collect up to count occurrences strictly after a time */
+        std::vector<DateTime> take( const Recurrence& recurrence, const DateTime& after, std::size_t count )
+        {
+            std::vector<DateTime> result;
+            for( const auto& value : recurrence.occurrences( after ) | std::views::take( count ) )
+            {
+                result.push_back( value );
+            }
+
+            return result;
+        }
+
+        /** @brief Build expected occurrences from dates at a fixed time of day */
+        std::vector<DateTime> atTime( std::initializer_list<DateTime> dates, std::int32_t hour, std::int32_t minute )
+        {
+            std::vector<DateTime> result;
+            for( const auto& date : dates )
+            {
+                result.push_back( date + TimeSpan::fromHours( hour ) + TimeSpan::fromMinutes( minute ) );
+            }
+
+            return result;
+        }
+    } // namespace
+
+    //=====================================================================
+    // Recurrence type tests
+    //=====================================================================
+
+    //----------------------------------------------
+    // Cron expressions
+    //----------------------------------------------
+
+    TEST( RecurrenceCron, WeekdaysAtFixedTime )
+    {
+        const auto schedule{ Recurrence::fromCron( "30 9 * * MON-FRI" ) };
+        ASSERT_TRUE( schedule.has_value() );
+
+        // Saturday morning to Monday, then strictly after an occurrence to the next day
+        EXPECT_EQ( schedule->nextAfter( DateTime{ 2024, 6, 15, 10, 0, 0 } ), ( DateTime{ 2024, 6, 17, 9, 30, 0 } ) );
+        EXPECT_EQ( schedule->nextAfter( DateTime{ 2024, 6, 17, 9, 30, 0 } ), ( DateTime{ 2024, 6, 18, 9, 30, 0 } ) );
+        EXPECT_EQ( schedule->nextAfter( DateTime{ 2024, 6, 17, 9, 29, 59 } + TimeSpan{ 9'999'999 } ),
+            ( DateTime{ 2024, 6, 17, 9, 30, 0 } ) );
+        EXPECT_EQ( schedule->nextAfter( DateTime{ 2024, 6, 21, 9, 30, 0 } ), ( DateTime{ 2024, 6, 24, 9, 30, 0 } ) );
+    }
+
+    TEST( RecurrenceCron, FieldSyntax )
+    {
+        const DateTime start{ 2024, 1, 31, 23, 59, 30 };
+
+        EXPECT_EQ( take( *Recurrence::fromCron( "*/15 * * * *" ), start, 2 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 2, 1, 0, 0, 0 }, DateTime{ 2024, 2, 1, 0, 15, 0 } } ) );
+        EXPECT_EQ( take( *Recurrence::fromCron( "*/20 * * * * *" ), start, 3 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 1, 31, 23, 59, 40 },
+                DateTime{ 2024, 2, 1, 0, 0, 0 },
+                DateTime{ 2024, 2, 1, 0, 0, 20 } } ) );
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 8-18/5 * * *" ), start, 3 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 2, 1, 8, 0, 0 },
+                DateTime{ 2024, 2, 1, 13, 0, 0 },
+                DateTime{ 2024, 2, 1, 18, 0, 0 } } ) );
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 0 1 jan,Jul *" ), start, 2 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 7, 1 }, DateTime{ 2025, 1, 1 } } ) );
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 12 * * 7" ), start, 1 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 2, 4, 12, 0, 0 } } ) );
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 12 * * 0" ), start, 1 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 2, 4, 12, 0, 0 } } ) );
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 0 5/10 * ?" ), start, 3 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 2, 5 }, DateTime{ 2024, 2, 15 }, DateTime{ 2024, 2, 25 } } ) );
+    }
+
+    TEST( RecurrenceCron, LastAndOrdinalDays )
+    {
+        const DateTime start{ 2024, 1, 1 };
+
+        // Last day of the month and two days before it
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 0 L * *" ), start, 3 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 1, 31 }, DateTime{ 2024, 2, 29 }, DateTime{ 2024, 3, 31 } } ) );
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 0 L-2 * *" ), start, 2 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 1, 29 }, DateTime{ 2024, 2, 27 } } ) );
+
+        // Last Friday and second Monday of the month
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 17 * * 5L" ), start, 3 ),
+            atTime( { DateTime{ 2024, 1, 26 }, DateTime{ 2024, 2, 23 }, DateTime{ 2024, 3, 29 } }, 17, 0 ) );
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 0 * * MON#2" ), start, 3 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 1, 8 }, DateTime{ 2024, 2, 12 }, DateTime{ 2024, 3, 11 } } ) );
+
+        // Fifth Thursday only exists in some months
+        EXPECT_EQ( take( *Recurrence::fromCron( "0 0 * * 4#5" ), start, 2 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 2, 29 }, DateTime{ 2024, 5, 30 } } ) );
+    }
+
+    TEST( RecurrenceCron, DayFieldsCombineWithOr )
+    {
+        // The 13th or any Friday, as in classic cron
+        const auto either{ Recurrence::fromCron( "0 0 13 * FRI" ) };
+        ASSERT_TRUE( either.has_value() );
+        EXPECT_EQ( take( *either, DateTime{ 2024, 9, 1 }, 4 ),
+            ( std::vector<DateTime>{
+                DateTime{ 2024, 9, 6 }, DateTime{ 2024, 9, 13 }, DateTime{ 2024, 9, 20 }, DateTime{ 2024, 9, 27 } } ) );
+        EXPECT_EQ( take( *either, DateTime{ 2024, 10, 1 }, 2 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 10, 4 }, DateTime{ 2024, 10, 11 } } ) );
+        EXPECT_EQ( either->nextAfter( DateTime{ 2024, 10, 11 } ), ( DateTime{ 2024, 10, 13 } ) );
+
+        // A starred day field does not restrict
+        const auto anyDayFriday{ Recurrence::fromCron( "0 0 */1 * FRI" ) };
+        EXPECT_EQ( anyDayFriday->nextAfter( DateTime{ 2024, 10, 11 } ), ( DateTime{ 2024, 10, 18 } ) );
+    }
+
+    TEST( RecurrenceCron, Macros )
+    {
+        const DateTime start{ 2024, 6, 15, 12, 30, 0 };
+        EXPECT_EQ( Recurrence::fromCron( "@yearly" )->nextAfter( start ), ( DateTime{ 2025, 1, 1 } ) );
+        EXPECT_EQ( Recurrence::fromCron( "@annually" )->nextAfter( start ), ( DateTime{ 2025, 1, 1 } ) );
+        EXPECT_EQ( Recurrence::fromCron( "@monthly" )->nextAfter( start ), ( DateTime{ 2024, 7, 1 } ) );
+        EXPECT_EQ( Recurrence::fromCron( "@weekly" )->nextAfter( start ), ( DateTime{ 2024, 6, 16 } ) );
+        EXPECT_EQ( Recurrence::fromCron( "@daily" )->nextAfter( start ), ( DateTime{ 2024, 6, 16 } ) );
+        EXPECT_EQ( Recurrence::fromCron( " @HOURLY " )->nextAfter( start ), ( DateTime{ 2024, 6, 15, 13, 0, 0 } ) );
+    }
+
+    TEST( RecurrenceCron, InvalidExpressions )
+    {
+        for( const auto* expression : { "", "* * * *", "* * * * * * *", "60 * * * *", "* 24 * * *", "* * 0 * *",
+                 "* * 32 * *", "* * * 13 *", "* * * * 8", "5-1 * * * *", "*/0 * * * *", "a * * * *", "1- * * * *",
+                 "* * * * MON#6", "* * * * 1#0", "* * L-31 * *", "* * LW * *", "* * * JANUARY *", "@reboot",
+                 "1,,2 * * * *" } )
+        {
+            EXPECT_FALSE( Recurrence::fromCron( expression ).has_value() ) << expression;
+        }
+    }
+
+    TEST( RecurrenceCron, NeverMatchingEndsAtMaxYear )
+    {
+        const auto never{ Recurrence::fromCron( "0 0 30 2 *" ) };
+        ASSERT_TRUE( never.has_value() );
+        EXPECT_FALSE( never->nextAfter( DateTime{ 2024, 1, 1 } ).has_value() );
+
+        const auto yearly{ Recurrence::fromCron( "@yearly" ) };
+        EXPECT_FALSE( yearly->nextAfter( DateTime{ 9999, 1, 1 } ).has_value() );
+        EXPECT_FALSE( yearly->nextAfter( DateTime::max() ).has_value() );
+        EXPECT_EQ(
+            Recurrence::fromCron( "* * * * * *" )->nextAfter( DateTime::min() ), ( DateTime{ 1, 1, 1, 0, 0, 1 } ) );
+    }
+
+    TEST( RecurrenceCron, MatchesMinuteByMinuteWalk )
+    {
+        struct Case
+        {
+            const char* expression;
+            std::function<bool( const DateTime::Components& )> matches;
+        };
+
+        const std::vector<Case> cases{
+            { "30 9 * * 1-5", []( const auto& c ) {
+                 return c.minute == 30 && c.hour == 9 && c.dayOfWeek >= 1 && c.dayOfWeek <= 5;
+             } },
+            { "*/7 */5 * * *", []( const auto& c ) { return c.minute % 7 == 0 && c.hour % 5 == 0; } },
+            { "0 0 L * *", []( const auto& c ) {
+                 return c.minute == 0 && c.hour == 0 && c.day == DateTime::daysInMonth( c.year, c.month );
+             } },
+            { "15 4 1-7 * 2", []( const auto& c ) {
+                 return c.minute == 15 && c.hour == 4 && ( c.day <= 7 || c.dayOfWeek == 2 );
+             } },
+            { "0 12 * FEB,AUG 6L", []( const auto& c ) {
+                 return c.minute == 0 && c.hour == 12 && ( c.month == 2 || c.month == 8 ) && c.dayOfWeek == 6 &&
+                        c.day + 7 > DateTime::daysInMonth( c.year, c.month );
+             } },
+        };
+
+        const DateTime begin{ 2023, 12, 25 };
+        const DateTime end{ 2025, 1, 10 };
+        for( const auto& testCase : cases )
+        {
+            const auto schedule{ Recurrence::fromCron( testCase.expression ) };
+            ASSERT_TRUE( schedule.has_value() ) << testCase.expression;
+
+            auto expected{ begin };
+            auto actual{ schedule->nextAfter( begin ) };
+            for( auto minute{ begin + TimeSpan::fromMinutes( 1 ) }; minute < end; minute += TimeSpan::fromMinutes( 1 ) )
+            {
+                if( testCase.matches( minute.components() ) )
+                {
+                    ASSERT_TRUE( actual.has_value() ) << testCase.expression;
+                    ASSERT_EQ( *actual, minute ) << testCase.expression << " after " << expected.toString();
+                    expected = minute;
+                    actual = schedule->nextAfter( minute );
+                }
+            }
+            EXPECT_GE( *actual, end ) << testCase.expression;
+        }
+    }
+
+    //----------------------------------------------
+    // RRULE
+    //----------------------------------------------
+
+    TEST( RecurrenceRRule, DefaultsFromStart )
+    {
+        // Weekly on the start weekday at the start time
+        const DateTime start{ 2024, 6, 12, 9, 30, 15 };
+        const auto weekly{ Recurrence::fromRRule( "FREQ=WEEKLY", start ) };
+        ASSERT_TRUE( weekly.has_value() );
+        EXPECT_EQ( take( *weekly, DateTime{ 2024, 1, 1 }, 2 ),
+            ( std::vector<DateTime>{ start, DateTime{ 2024, 6, 19, 9, 30, 15 } } ) );
+
+        // Monthly on the start day, skipping months without it
+        const auto monthly{ Recurrence::fromRRule( "RRULE:FREQ=MONTHLY", DateTime{ 2024, 1, 31, 8, 0, 0 } ) };
+        EXPECT_EQ( take( *monthly, DateTime{ 2024, 1, 31, 8, 0, 0 }, 3 ),
+            atTime( { DateTime{ 2024, 3, 31 }, DateTime{ 2024, 5, 31 }, DateTime{ 2024, 7, 31 } }, 8, 0 ) );
+
+        // Yearly on February 29 occurs in leap years only
+        const auto leap{ Recurrence::fromRRule( "freq=yearly", DateTime{ 2024, 2, 29 } ) };
+        EXPECT_EQ( take( *leap, DateTime{ 2024, 1, 1 }, 3 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 2, 29 }, DateTime{ 2028, 2, 29 }, DateTime{ 2032, 2, 29 } } ) );
+
+        // Sub-second start fractions are dropped
+        const auto daily{ Recurrence::fromRRule( "FREQ=DAILY", DateTime{ 2024, 1, 1, 6, 0, 0 } + TimeSpan{ 1234 } ) };
+        EXPECT_EQ( daily->nextAfter( DateTime{ 2023, 1, 1 } ), ( DateTime{ 2024, 1, 1, 6, 0, 0 } ) );
+    }
+
+    TEST( RecurrenceRRule, Rfc5545Examples )
+    {
+        const auto expand{ []( std::string_view rule, const DateTime& start, std::size_t limit = 64 ) {
+            return take( *Recurrence::fromRRule( rule, start ), start - TimeSpan{ 1 }, limit );
+        } };
+        const DateTime sep2{ 1997, 9, 2, 9, 0, 0 };
+
+        EXPECT_EQ( expand( "FREQ=DAILY;INTERVAL=10;COUNT=5", sep2 ),
+            atTime( { DateTime{ 1997, 9, 2 }, DateTime{ 1997, 9, 12 }, DateTime{ 1997, 9, 22 }, DateTime{ 1997, 10, 2 },
+                        DateTime{ 1997, 10, 12 } },
+                9,
+                0 ) );
+
+        EXPECT_EQ( expand( "FREQ=WEEKLY;INTERVAL=2;COUNT=8;WKST=SU;BYDAY=TU,TH", sep2 ),
+            atTime( { DateTime{ 1997, 9, 2 }, DateTime{ 1997, 9, 4 }, DateTime{ 1997, 9, 16 }, DateTime{ 1997, 9, 18 },
+                        DateTime{ 1997, 9, 30 }, DateTime{ 1997, 10, 2 }, DateTime{ 1997, 10, 14 },
+                        DateTime{ 1997, 10, 16 } },
+                9,
+                0 ) );
+
+        // Week start changes which weeks an interval selects
+        const DateTime aug5{ 1997, 8, 5, 9, 0, 0 };
+        EXPECT_EQ( expand( "FREQ=WEEKLY;INTERVAL=2;COUNT=4;BYDAY=TU,SU;WKST=MO", aug5 ),
+            atTime(
+                { DateTime{ 1997, 8, 5 }, DateTime{ 1997, 8, 10 }, DateTime{ 1997, 8, 19 }, DateTime{ 1997, 8, 24 } },
+                9,
+                0 ) );
+        EXPECT_EQ( expand( "FREQ=WEEKLY;INTERVAL=2;COUNT=4;BYDAY=TU,SU;WKST=SU", aug5 ),
+            atTime(
+                { DateTime{ 1997, 8, 5 }, DateTime{ 1997, 8, 17 }, DateTime{ 1997, 8, 19 }, DateTime{ 1997, 8, 31 } },
+                9,
+                0 ) );
+
+        EXPECT_EQ( expand( "FREQ=MONTHLY;COUNT=10;BYDAY=1FR", DateTime{ 1997, 9, 5, 9, 0, 0 } ),
+            atTime( { DateTime{ 1997, 9, 5 }, DateTime{ 1997, 10, 3 }, DateTime{ 1997, 11, 7 }, DateTime{ 1997, 12, 5 },
+                        DateTime{ 1998, 1, 2 }, DateTime{ 1998, 2, 6 }, DateTime{ 1998, 3, 6 }, DateTime{ 1998, 4, 3 },
+                        DateTime{ 1998, 5, 1 }, DateTime{ 1998, 6, 5 } },
+                9,
+                0 ) );
+
+        EXPECT_EQ( expand( "FREQ=MONTHLY;INTERVAL=2;COUNT=10;BYDAY=1SU,-1SU", DateTime{ 1997, 9, 7, 9, 0, 0 } ),
+            atTime( { DateTime{ 1997, 9, 7 }, DateTime{ 1997, 9, 28 }, DateTime{ 1997, 11, 2 },
+                        DateTime{ 1997, 11, 30 }, DateTime{ 1998, 1, 4 }, DateTime{ 1998, 1, 25 },
+                        DateTime{ 1998, 3, 1 }, DateTime{ 1998, 3, 29 },
+                        DateTime{ 1998, 5, 3 }, DateTime{ 1998, 5, 31 } },
+                9,
+                0 ) );
+
+        EXPECT_EQ( expand( "FREQ=MONTHLY;BYMONTHDAY=-3", DateTime{ 1997, 9, 28, 9, 0, 0 }, 6 ),
+            atTime( { DateTime{ 1997, 9, 28 }, DateTime{ 1997, 10, 29 }, DateTime{ 1997, 11, 28 },
+                        DateTime{ 1997, 12, 29 }, DateTime{ 1998, 1, 29 }, DateTime{ 1998, 2, 26 } },
+                9,
+                0 ) );
+
+        // Friday the 13th: both day parts must match
+        EXPECT_EQ( expand( "FREQ=MONTHLY;BYDAY=FR;BYMONTHDAY=13", sep2, 5 ),
+            atTime( { DateTime{ 1998, 2, 13 }, DateTime{ 1998, 3, 13 }, DateTime{ 1998, 11, 13 },
+                        DateTime{ 1999, 8, 13 }, DateTime{ 2000, 10, 13 } },
+                9,
+                0 ) );
+
+        EXPECT_EQ( expand( "FREQ=YEARLY;INTERVAL=2;COUNT=10;BYMONTH=1,2,3", DateTime{ 1997, 3, 10, 9, 0, 0 } ),
+            atTime( { DateTime{ 1997, 3, 10 }, DateTime{ 1999, 1, 10 }, DateTime{ 1999, 2, 10 },
+                        DateTime{ 1999, 3, 10 }, DateTime{ 2001, 1, 10 }, DateTime{ 2001, 2, 10 },
+                        DateTime{ 2001, 3, 10 }, DateTime{ 2003, 1, 10 }, DateTime{ 2003, 2, 10 },
+                        DateTime{ 2003, 3, 10 } },
+                9,
+                0 ) );
+
+        // Last weekday-of-month ordinal inside a yearly rule
+        EXPECT_EQ( expand( "FREQ=YEARLY;BYMONTH=5;BYDAY=-1MO;BYHOUR=10;BYMINUTE=0", DateTime{ 2024, 1, 1 }, 3 ),
+            atTime( { DateTime{ 2024, 5, 27 }, DateTime{ 2025, 5, 26 }, DateTime{ 2026, 5, 25 } }, 10, 0 ) );
+
+        EXPECT_EQ( expand( "FREQ=HOURLY;INTERVAL=3;UNTIL=19970902T170000Z", sep2 ),
+            ( std::vector<DateTime>{ DateTime{ 1997, 9, 2, 9, 0, 0 },
+                DateTime{ 1997, 9, 2, 12, 0, 0 },
+                DateTime{ 1997, 9, 2, 15, 0, 0 } } ) );
+
+        EXPECT_EQ( expand( "FREQ=MINUTELY;INTERVAL=15;COUNT=6", sep2 ),
+            ( std::vector<DateTime>{ DateTime{ 1997, 9, 2, 9, 0, 0 },
+                DateTime{ 1997, 9, 2, 9, 15, 0 },
+                DateTime{ 1997, 9, 2, 9, 30, 0 },
+                DateTime{ 1997, 9, 2, 9, 45, 0 },
+                DateTime{ 1997, 9, 2, 10, 0, 0 },
+                DateTime{ 1997, 9, 2, 10, 15, 0 } } ) );
+
+        // Every day in January for three years
+        const auto january{
+            Recurrence::fromRRule( "FREQ=DAILY;UNTIL=20000131T140000Z;BYMONTH=1", DateTime{ 1998, 1, 1, 9, 0, 0 } ) };
+        ASSERT_TRUE( january.has_value() );
+        EXPECT_EQ( std::ranges::distance( january->occurrences( DateTime{ 1997, 1, 1 } ) ), 93 );
+    }
+
+    TEST( RecurrenceRRule, IntervalsAtFineFrequencies )
+    {
+        const DateTime start{ 2024, 3, 10, 23, 59, 50 };
+        EXPECT_EQ( take( *Recurrence::fromRRule( "FREQ=SECONDLY;INTERVAL=7", start ), start, 3 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 3, 10, 23, 59, 57 },
+                DateTime{ 2024, 3, 11, 0, 0, 4 },
+                DateTime{ 2024, 3, 11, 0, 0, 11 } } ) );
+        EXPECT_EQ( take( *Recurrence::fromRRule( "FREQ=HOURLY;INTERVAL=5;BYMINUTE=0;BYSECOND=0", start ), start, 2 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 3, 11, 4, 0, 0 }, DateTime{ 2024, 3, 11, 9, 0, 0 } } ) );
+        EXPECT_EQ( take( *Recurrence::fromRRule( "FREQ=DAILY;INTERVAL=3;BYDAY=MO", start ), start, 2 ),
+            ( std::vector<DateTime>{ DateTime{ 2024, 3, 25, 23, 59, 50 }, DateTime{ 2024, 4, 15, 23, 59, 50 } } ) );
+    }
+
+    TEST( RecurrenceRRule, CountAndUntilBoundTheRange )
+    {
+        const DateTime start{ 2024, 1, 1, 8, 0, 0 };
+        const auto counted{ Recurrence::fromRRule( "FREQ=DAILY;COUNT=3", start ) };
+        ASSERT_TRUE( counted.has_value() );
+        EXPECT_EQ( std::ranges::distance( counted->occurrences( DateTime::min() ) ), 3 );
+        EXPECT_FALSE( counted->nextAfter( DateTime{ 2024, 1, 3, 8, 0, 0 } ).has_value() );
+
+        // A date-only UNTIL includes that whole day
+        const auto until{ Recurrence::fromRRule( "FREQ=DAILY;UNTIL=20240103", start ) };
+        EXPECT_EQ( std::ranges::distance( until->occurrences( DateTime::min() ) ), 3 );
+
+        const auto before{ Recurrence::fromRRule( "FREQ=DAILY;UNTIL=20231231T000000", start ) };
+        EXPECT_FALSE( before->nextAfter( DateTime::min() ).has_value() );
+    }
+
+    TEST( RecurrenceRRule, InvalidRules )
+    {
+        const DateTime start{ 2024, 1, 1 };
+        for( const auto* rule : { "", "INTERVAL=2", "FREQ=FORTNIGHTLY", "FREQ=DAILY;INTERVAL=0", "FREQ=DAILY;COUNT=0",
+                 "FREQ=DAILY;COUNT=2;UNTIL=20240105", "FREQ=DAILY;UNTIL=2024010", "FREQ=DAILY;UNTIL=20240230",
+                 "FREQ=DAILY;UNTIL=20240101X120000", "FREQ=WEEKLY;BYDAY=1MO", "FREQ=YEARLY;BYDAY=20MO",
+                 "FREQ=YEARLY;BYDAY=-1MO", "FREQ=WEEKLY;BYMONTHDAY=1", "FREQ=MONTHLY;BYMONTHDAY=0",
+                 "FREQ=MONTHLY;BYMONTHDAY=32", "FREQ=MONTHLY;BYDAY=XX", "FREQ=DAILY;BYHOUR=24", "FREQ=DAILY;BYMINUTE=",
+                 "FREQ=DAILY;BYSECOND=60", "FREQ=MONTHLY;BYSETPOS=-1", "FREQ=YEARLY;BYYEARDAY=100",
+                 "FREQ=YEARLY;BYWEEKNO=20", "FREQ=DAILY;WKST=XX" } )
+        {
+            EXPECT_FALSE( Recurrence::fromRRule( rule, start ).has_value() ) << rule;
+        }
+    }
+
+    //----------------------------------------------
+    // DateTimeOffset and TimeZone
+    //----------------------------------------------
+
+    TEST( RecurrenceOffset, FixedOffsetWallClock )
+    {
+        const auto schedule{ Recurrence::fromCron( "0 9 * * *" ) };
+        const DateTimeOffset after{ DateTime{ 2024, 6, 15, 10, 0, 0 }, TimeSpan::fromHours( -5 ) };
+
+        const auto next{ schedule->nextAfter( after ) };
+        ASSERT_TRUE( next.has_value() );
+        EXPECT_EQ( next->dateTime(), ( DateTime{ 2024, 6, 16, 9, 0, 0 } ) );
+        EXPECT_EQ( next->offset(), TimeSpan::fromHours( -5 ) );
+
+        std::vector<DateTimeOffset> values;
+        for( const auto& value : schedule->occurrences( after ) | std::views::take( 2 ) )
+        {
+            values.push_back( value );
+        }
+        ASSERT_EQ( values.size(), 2u );
+        EXPECT_EQ( values[1].dateTime(), ( DateTime{ 2024, 6, 17, 9, 0, 0 } ) );
+    }
+
+    TEST( RecurrenceOffset, ZoneLocalTimeAcrossTransitions )
+    {
+        const auto* paris{ TimeZone::find( "Europe/Paris" ) };
+        if( paris == nullptr )
+        {
+            GTEST_SKIP() << "zoneinfo database not available";
+        }
+
+        const auto schedule{ Recurrence::fromCron( "30 2 * * *" ) };
+        const auto winter{ TimeSpan::fromHours( 1 ) };
+        const auto summer{ TimeSpan::fromHours( 2 ) };
+
+        // 02:30 does not exist on 2024-03-31: it takes the offset before the gap (03:30 +02:00)
+        std::vector<DateTimeOffset> spring;
+        const DateTimeOffset springStart{ DateTime{ 2024, 3, 30, 12, 0, 0 }, winter };
+        for( const auto& value : schedule->occurrences( springStart, *paris ) | std::views::take( 3 ) )
+        {
+            spring.push_back( value );
+        }
+        ASSERT_EQ( spring.size(), 3u );
+        EXPECT_EQ( spring[0], ( DateTimeOffset{ DateTime{ 2024, 3, 31, 2, 30, 0 } - winter, TimeSpan{} } ) );
+        EXPECT_EQ( spring[0].dateTime(), ( DateTime{ 2024, 3, 31, 3, 30, 0 } ) );
+        EXPECT_EQ( spring[0].offset(), summer );
+        EXPECT_EQ( spring[1].dateTime(), ( DateTime{ 2024, 4, 1, 2, 30, 0 } ) );
+        EXPECT_EQ( spring[1].offset(), summer );
+
+        // 02:30 happens twice on 2024-10-27: only the first instance occurs
+        const DateTimeOffset autumnStart{ DateTime{ 2024, 10, 26, 12, 0, 0 }, summer };
+        const auto autumn{ schedule->nextAfter( autumnStart, *paris ) };
+        ASSERT_TRUE( autumn.has_value() );
+        EXPECT_EQ( autumn->dateTime(), ( DateTime{ 2024, 10, 27, 2, 30, 0 } ) );
+        EXPECT_EQ( autumn->offset(), summer );
+
+        const auto afterFirst{ schedule->nextAfter( *autumn, *paris ) };
+        EXPECT_EQ( afterFirst->dateTime(), ( DateTime{ 2024, 10, 28, 2, 30, 0 } ) );
+        EXPECT_EQ( afterFirst->offset(), winter );
+
+        // During the repeated hour the wall time already occurred
+        const DateTimeOffset repeated{ DateTime{ 2024, 10, 27, 2, 15, 0 }, winter };
+        EXPECT_EQ( schedule->nextAfter( repeated, *paris )->dateTime(), ( DateTime{ 2024, 10, 28, 2, 30, 0 } ) );
+    }
+
+    //----------------------------------------------
+    // Ranges
+    //----------------------------------------------
+
+    TEST( RecurrenceRanges, ComposeWithViews )
+    {
+        static_assert( std::ranges::forward_range<RecurrenceView<DateTime>> );
+        static_assert( std::ranges::view<RecurrenceView<DateTimeOffset>> );
+
+        const auto weekdays{ Recurrence::fromCron( "0 9 * * MON-FRI" ) };
+        auto firstOfMonth{ weekdays->occurrences( DateTime{ 2024, 1, 1 } ) |
+                           std::views::filter( []( const DateTime& value ) { return value.day() <= 3; } ) |
+                           std::views::take( 4 ) };
+
+        std::vector<DateTime> values;
+        std::ranges::copy( firstOfMonth, std::back_inserter( values ) );
+        EXPECT_EQ( values,
+            atTime(
+                { DateTime{ 2024, 1, 1 }, DateTime{ 2024, 1, 2 }, DateTime{ 2024, 1, 3 }, DateTime{ 2024, 2, 1 } },
+                9,
+                0 ) );
+
+        // Iterators are multi-pass
+        const auto view{ weekdays->occurrences( DateTime{ 2024, 1, 1 } ) };
+        auto it{ view.begin() };
+        const auto copy{ it++ };
+        EXPECT_EQ( *copy, ( DateTime{ 2024, 1, 1, 9, 0, 0 } ) );
+        EXPECT_EQ( *it, ( DateTime{ 2024, 1, 2, 9, 0, 0 } ) );
+        EXPECT_EQ( view.begin(), copy );
+        EXPECT_NE( it, std::default_sentinel );
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,163 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_Sort.cpp
+ * @brief Unit tests for the radix sort
+ * @details Tests agreement with std::sort over random, clustered, negative and small inputs,
+ *          and the caller-provided scratch overloads.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <nfx/datetime/Sort.h>
+
+namespace nfx::time::test
+{
+    //=====================================================================
+    // Radix sort tests
+    //=====================================================================
+
+    //----------------------------------------------
+    // DateTime
+    //----------------------------------------------
+
+    TEST( RadixSort, DateTimeMatchesStdSort )
+    {
+        std::mt19937_64 random{ 22 };
+        std::uniform_int_distribution<std::int64_t> ticks{ 0, DateTime::max().ticks() };
+
+        for( const std::size_t size : { 0u, 1u, 255u, 256u, 1000u, 65537u } )
+        {
+            std::vector<DateTime> values;
+            for( std::size_t i{ 0 }; i < size; ++i )
+            {
+                values.emplace_back( ticks( random ) );
+            }
+
+            auto expected{ values };
+            std::sort( expected.begin(), expected.end() );
+
+            radixSort( values );
+            EXPECT_EQ( values, expected ) << size;
+        }
+    }
+
+    TEST( RadixSort, DateTimeClusteredSkipsSharedDigits )
+    {
+        // One day of millisecond timestamps shares the high bytes of every key
+        std::mt19937_64 random{ 7 };
+        const DateTime start{ 2024, 6, 15 };
+        std::uniform_int_distribution<std::int64_t> ms{ 0, 86'400'000 - 1 };
+
+        std::vector<DateTime> values;
+        for( int i{ 0 }; i < 10000; ++i )
+        {
+            values.push_back( start + TimeSpan::fromMilliseconds( static_cast<double>( ms( random ) ) ) );
+        }
+        values.push_back( start );
+        values.push_back( start );
+
+        auto expected{ values };
+        std::sort( expected.begin(), expected.end() );
+
+        radixSort( values );
+        EXPECT_EQ( values, expected );
+    }
+
+    TEST( RadixSort, ScratchOverloadDoesNotNeedAllocation )
+    {
+        std::mt19937_64 random{ 3 };
+        std::uniform_int_distribution<std::int64_t> ticks{ 0, DateTime::max().ticks() };
+
+        std::vector<DateTime> values;
+        for( int i{ 0 }; i < 5000; ++i )
+        {
+            values.emplace_back( ticks( random ) );
+        }
+        auto expected{ values };
+        std::sort( expected.begin(), expected.end() );
+
+        std::vector<DateTime> scratch( values.size() );
+        auto copy{ values };
+        radixSort( copy, scratch );
+        EXPECT_EQ( copy, expected );
+
+        // Too small a scratch buffer falls back to std::sort
+        std::vector<DateTime> smallScratch( 10 );
+        radixSort( values, smallScratch );
+        EXPECT_EQ( values, expected );
+    }
+
+    //----------------------------------------------
+    // TimeSpan and PackedDateTimeOffset
+    //----------------------------------------------
+
+    TEST( RadixSort, TimeSpanOrdersNegativeBeforePositive )
+    {
+        std::mt19937_64 random{ 11 };
+        std::uniform_int_distribution<std::int64_t> ticks{
+            -constants::TICKS_PER_DAY * 365, constants::TICKS_PER_DAY * 365 };
+
+        std::vector<TimeSpan> values;
+        for( int i{ 0 }; i < 3000; ++i )
+        {
+            values.emplace_back( ticks( random ) );
+        }
+        values.emplace_back( std::numeric_limits<std::int64_t>::min() );
+        values.emplace_back( std::numeric_limits<std::int64_t>::max() );
+
+        auto expected{ values };
+        std::sort( expected.begin(), expected.end() );
+
+        radixSort( values );
+        EXPECT_EQ( values, expected );
+        EXPECT_EQ( values.front().ticks(), std::numeric_limits<std::int64_t>::min() );
+    }
+
+    TEST( RadixSort, PackedDateTimeOffsetMatchesStdSort )
+    {
+        std::mt19937_64 random{ 5 };
+        std::uniform_int_distribution<std::int64_t> ms{ 63'800'000'000'000, 63'900'000'000'000 };
+        std::uniform_int_distribution<std::int32_t> minutes{ -14 * 60, 14 * 60 };
+
+        std::vector<PackedDateTimeOffset> values;
+        for( int i{ 0 }; i < 3000; ++i )
+        {
+            values.emplace_back( DateTimeOffset{
+                ms( random ) * constants::TICKS_PER_MILLISECOND, TimeSpan::fromMinutes( minutes( random ) ) } );
+        }
+
+        auto expected{ values };
+        std::sort( expected.begin(), expected.end() );
+
+        radixSort( values );
+        EXPECT_EQ( values, expected );
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,266 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_Stats.cpp
+ * @brief Unit tests for the hot-path instrumentation counters
+ * @details Tests parser path classification, time zone cache hit/miss counts, per-format
+ *          formatting counts, aggregation across threads and resetStats(). Tests that need
+ *          counting are skipped unless the library is built with NFX_DATETIME_ENABLE_STATS.
+ */
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <thread>
+
+#include <nfx/datetime/DateTime.h>
+#include <nfx/datetime/DateTimeOffset.h>
+#include <nfx/datetime/Stats.h>
+#include <nfx/datetime/TimeSpan.h>
+
+namespace nfx::time::test
+{
+    //=====================================================================
+    // Stats tests
+    //=====================================================================
+
+    TEST( Stats, DisabledBuildReportsZeros )
+    {
+        if constexpr( STATS_ENABLED )
+        {
+            GTEST_SKIP() << "Built with NFX_DATETIME_ENABLE_STATS";
+        }
+
+        DateTime value;
+        EXPECT_TRUE( DateTime::fromString( "2024-01-15T12:30:45Z", value ) );
+        EXPECT_FALSE( value.toString().empty() );
+
+        const Stats snapshot{ stats() };
+        EXPECT_EQ( snapshot.dateTime.total(), 0u );
+        EXPECT_EQ( snapshot.formatCount( DateTime::Format::Iso8601 ), 0u );
+    }
+
+    TEST( Stats, DateTimeParserPaths )
+    {
+        if constexpr( !STATS_ENABLED )
+        {
+            GTEST_SKIP() << "Built without NFX_DATETIME_ENABLE_STATS";
+        }
+
+        resetStats();
+
+        DateTime value;
+        EXPECT_TRUE( DateTime::fromString( "2024-01-15T12:30:45Z", value ) );
+        EXPECT_TRUE( DateTime::fromString( "2024-01-15", value ) );
+        EXPECT_TRUE( DateTime::fromString( "2024-1-5T1:2:3", value ) );
+        EXPECT_FALSE( DateTime::fromString( "not a timestamp", value ) );
+        EXPECT_FALSE( DateTime::fromString( "", value ) );
+
+        const Stats snapshot{ stats() };
+        EXPECT_EQ( snapshot.dateTime.fastPath, 2u );
+        EXPECT_EQ( snapshot.dateTime.fallback, 1u );
+        EXPECT_EQ( snapshot.dateTime.failures, 2u );
+        EXPECT_EQ( snapshot.dateTime.total(), 5u );
+    }
+
+    TEST( Stats, DateTimeOffsetParserPathsAreNotCountedAsDateTime )
+    {
+        if constexpr( !STATS_ENABLED )
+        {
+            GTEST_SKIP() << "Built without NFX_DATETIME_ENABLE_STATS";
+        }
+
+        resetStats();
+
+        DateTimeOffset value;
+        EXPECT_TRUE( DateTimeOffset::fromString( "2024-01-15T12:30:45+02:00", value ) );
+        EXPECT_TRUE( DateTimeOffset::fromString( "2024-1-15T12:30:45+02:00", value ) );
+        EXPECT_FALSE( DateTimeOffset::fromString( "2024-01-15T12:30:45+25:00", value ) );
+
+        const Stats snapshot{ stats() };
+        EXPECT_EQ( snapshot.dateTimeOffset.fastPath, 1u );
+        EXPECT_EQ( snapshot.dateTimeOffset.fallback, 1u );
+        EXPECT_EQ( snapshot.dateTimeOffset.failures, 1u );
+        EXPECT_EQ( snapshot.dateTime.total(), 0u );
+    }
+
+    TEST( Stats, TimeSpanParserPaths )
+    {
+        if constexpr( !STATS_ENABLED )
+        {
+            GTEST_SKIP() << "Built without NFX_DATETIME_ENABLE_STATS";
+        }
+
+        resetStats();
+
+        TimeSpan value;
+        EXPECT_TRUE( TimeSpan::fromString( "PT1H30M", value ) );
+        EXPECT_TRUE( TimeSpan::fromString( "90.5", value ) );
+        EXPECT_FALSE( TimeSpan::fromString( "P1Y", value ) );
+        EXPECT_FALSE( TimeSpan::fromString( "1:30", value ) );
+
+        const Stats snapshot{ stats() };
+        EXPECT_EQ( snapshot.timeSpan.fastPath, 1u );
+        EXPECT_EQ( snapshot.timeSpan.fallback, 1u );
+        EXPECT_EQ( snapshot.timeSpan.failures, 2u );
+    }
+
+    TEST( Stats, BatchParsersCountFastLayout )
+    {
+        if constexpr( !STATS_ENABLED )
+        {
+            GTEST_SKIP() << "Built without NFX_DATETIME_ENABLE_STATS";
+        }
+
+        resetStats();
+
+        const std::string_view inputs[]{ "2024-01-15T12:30:45Z", "2024-01-16T12:30:45Z", "2024-1-17T1:2:3" };
+        DateTime results[3];
+        std::uint8_t ok[3];
+        EXPECT_EQ( DateTime::parseMany( inputs, results, ok ), 3u );
+
+        const Stats snapshot{ stats() };
+        EXPECT_EQ( snapshot.dateTime.fastPath, 2u );
+        EXPECT_EQ( snapshot.dateTime.fallback, 1u );
+    }
+
+    TEST( Stats, FormattingPerFormat )
+    {
+        if constexpr( !STATS_ENABLED )
+        {
+            GTEST_SKIP() << "Built without NFX_DATETIME_ENABLE_STATS";
+        }
+
+        resetStats();
+
+        const DateTime dt{ 2024, 1, 15, 12, 30, 45 };
+        const DateTimeOffset dto{ dt, TimeSpan::fromHours( 2 ) };
+        char buffer[64];
+
+        EXPECT_FALSE( dt.toString().empty() );
+        EXPECT_NE( dto.formatTo( buffer, sizeof( buffer ) ), 0u );
+        EXPECT_NE( dt.formatTo( buffer, sizeof( buffer ), DateTime::Format::Iso8601Millis ), 0u );
+        EXPECT_FALSE( TimeSpan::fromMinutes( 90 ).toString().empty() );
+
+        const Stats snapshot{ stats() };
+        EXPECT_EQ( snapshot.formatCount( DateTime::Format::Iso8601 ), 2u );
+        EXPECT_EQ( snapshot.formatCount( DateTime::Format::Iso8601Millis ), 1u );
+        EXPECT_EQ( snapshot.formatCount( DateTime::Format::Iso8601Basic ), 0u );
+        EXPECT_EQ( snapshot.timeSpanFormatCalls, 1u );
+    }
+
+    TEST( Stats, TimezoneCacheHitsAndMisses )
+    {
+        if constexpr( !STATS_ENABLED )
+        {
+            GTEST_SKIP() << "Built without NFX_DATETIME_ENABLE_STATS";
+        }
+
+        resetStats();
+
+        // Fresh thread: its offset cache starts empty
+        std::thread worker{ [] {
+            const DateTime instant{ 2024, 6, 1, 12, 0, 0 };
+            const DateTimeOffset first{ instant };
+            const DateTimeOffset second{ instant + TimeSpan::fromMinutes( 1 ) };
+            EXPECT_EQ( first.offset(), second.offset() );
+        } };
+        worker.join();
+
+        const Stats snapshot{ stats() };
+        EXPECT_EQ( snapshot.timezoneCacheMisses, 1u );
+        EXPECT_EQ( snapshot.timezoneCacheHits, 1u );
+    }
+
+    TEST( Stats, AggregatesLiveAndExitedThreads )
+    {
+        if constexpr( !STATS_ENABLED )
+        {
+            GTEST_SKIP() << "Built without NFX_DATETIME_ENABLE_STATS";
+        }
+
+        resetStats();
+
+        constexpr int PER_THREAD{ 1000 };
+        const auto parse{ [] {
+            DateTime value;
+            for( int i{ 0 }; i < PER_THREAD; ++i )
+            {
+                EXPECT_TRUE( DateTime::fromString( "2024-01-15T12:30:45Z", value ) );
+            }
+        } };
+
+        std::thread first{ parse };
+        std::thread second{ parse };
+        first.join();
+        second.join();
+        parse();
+
+        EXPECT_EQ( stats().dateTime.fastPath, 3u * PER_THREAD );
+
+        resetStats();
+        EXPECT_EQ( stats().dateTime.total(), 0u );
+    }
+
+    TEST( Stats, ResetKeepsLiveThreadCountsSinceReset )
+    {
+        if constexpr( !STATS_ENABLED )
+        {
+            GTEST_SKIP() << "Built without NFX_DATETIME_ENABLE_STATS";
+        }
+
+        resetStats();
+
+        std::promise<void> counted;
+        std::promise<void> reset;
+        std::promise<void> countedAgain;
+        std::promise<void> done;
+        std::thread worker{ [&] {
+            DateTime value;
+            EXPECT_TRUE( DateTime::fromString( "2024-01-15T12:30:45Z", value ) );
+            counted.set_value();
+            reset.get_future().wait();
+
+            EXPECT_TRUE( DateTime::fromString( "2024-01-15T12:30:45Z", value ) );
+            EXPECT_TRUE( DateTime::fromString( "2024-01-15T12:30:45Z", value ) );
+            countedAgain.set_value();
+            done.get_future().wait();
+        } };
+
+        counted.get_future().wait();
+        EXPECT_EQ( stats().dateTime.fastPath, 1u );
+        resetStats();
+        EXPECT_EQ( stats().dateTime.fastPath, 0u );
+        reset.set_value();
+
+        countedAgain.get_future().wait();
+        EXPECT_EQ( stats().dateTime.fastPath, 2u );
+        done.set_value();
+        worker.join();
+
+        // Exited threads fold only the counts made after the reset
+        EXPECT_EQ( stats().dateTime.fastPath, 2u );
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_Stopwatch.cpp
+ * @brief Unit tests for BasicStopwatch and the steady clock sources
+ * @details Control-flow tests run on a manually advanced clock so elapsed values are exact;
+ *          the real sources are checked for monotonicity and rough agreement.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include <nfx/datetime/Clock.h>
+#include <nfx/datetime/Stopwatch.h>
+#include <nfx/datetime/TimeSpan.h>
+
+namespace nfx::time::test
+{
+    namespace
+    {
+        /** @brief Steady source advanced by the test */
+        struct ManualClock
+        {
+            static inline std::int64_t now{ 0 };
+
+            static std::int64_t ticks() noexcept
+            {
+                return now;
+            }
+        };
+
+        using ManualStopwatch = BasicStopwatch<ManualClock>;
+    } // namespace
+
+    static_assert( SteadyClockSource<SteadyClock> );
+    static_assert( SteadyClockSource<TscSteadyClock> );
+    static_assert( SteadyClockSource<ManualClock> );
+
+    //=====================================================================
+    // Stopwatch tests
+    //=====================================================================
+
+    TEST( Stopwatch, DefaultIsStoppedAndZero )
+    {
+        const ManualStopwatch watch;
+        EXPECT_FALSE( watch.isRunning() );
+        EXPECT_EQ( watch.elapsed(), TimeSpan{} );
+        EXPECT_EQ( watch.elapsedTicks(), 0 );
+    }
+
+    TEST( Stopwatch, AccumulatesAcrossStartStop )
+    {
+        ManualClock::now = 1000;
+        auto watch{ ManualStopwatch::startNew() };
+        EXPECT_TRUE( watch.isRunning() );
+
+        ManualClock::now = 1250;
+        EXPECT_EQ( watch.elapsedTicks(), 250 );
+        watch.stop();
+        EXPECT_FALSE( watch.isRunning() );
+
+        // Stopped time is not counted
+        ManualClock::now = 5000;
+        EXPECT_EQ( watch.elapsedTicks(), 250 );
+
+        watch.start();
+        ManualClock::now = 5100;
+        EXPECT_EQ( watch.elapsed(), TimeSpan{ 350 } );
+
+        // Redundant start()/stop() calls change nothing
+        watch.start();
+        ManualClock::now = 5200;
+        watch.stop();
+        watch.stop();
+        EXPECT_EQ( watch.elapsedTicks(), 450 );
+    }
+
+    TEST( Stopwatch, ResetAndRestart )
+    {
+        ManualClock::now = 0;
+        auto watch{ ManualStopwatch::startNew() };
+        ManualClock::now = 100;
+
+        watch.reset();
+        EXPECT_FALSE( watch.isRunning() );
+        EXPECT_EQ( watch.elapsedTicks(), 0 );
+
+        ManualClock::now = 200;
+        watch.restart();
+        EXPECT_TRUE( watch.isRunning() );
+        ManualClock::now = 260;
+        EXPECT_EQ( watch.elapsedTicks(), 60 );
+    }
+
+    TEST( Stopwatch, LapReturnsBackToBackIntervals )
+    {
+        ManualClock::now = 10;
+        auto watch{ ManualStopwatch::startNew() };
+
+        ManualClock::now = 40;
+        EXPECT_EQ( watch.lap(), TimeSpan{ 30 } );
+        ManualClock::now = 45;
+        EXPECT_EQ( watch.lap(), TimeSpan{ 5 } );
+        EXPECT_TRUE( watch.isRunning() );
+
+        // A lap of a stopped watch returns the accumulated time and starts it again
+        watch.stop();
+        ManualClock::now = 100;
+        EXPECT_EQ( watch.lap(), TimeSpan{} );
+        ManualClock::now = 107;
+        EXPECT_EQ( watch.elapsedTicks(), 7 );
+    }
+
+    //=====================================================================
+    // Steady source tests
+    //=====================================================================
+
+    TEST( SteadyClock, MonotonicAndTracksSleep )
+    {
+        for( const bool tsc : { false, true } )
+        {
+            const auto read{ [tsc] { return tsc ? TscSteadyClock::ticks() : SteadyClock::ticks(); } };
+
+            auto previous{ read() };
+            for( int i{ 0 }; i < 10000; ++i )
+            {
+                const auto current{ read() };
+                ASSERT_GE( current, previous );
+                previous = current;
+            }
+
+            const auto before{ read() };
+            std::this_thread::sleep_for( std::chrono::milliseconds{ 20 } );
+            const auto slept{ TimeSpan{ read() - before } };
+
+            EXPECT_GE( slept.milliseconds(), 15.0 ) << ( tsc ? "TscSteadyClock" : "SteadyClock" );
+            EXPECT_LT( slept.milliseconds(), 2000.0 ) << ( tsc ? "TscSteadyClock" : "SteadyClock" );
+        }
+    }
+
+    TEST( SteadyClock, StopwatchMeasuresSleep )
+    {
+        auto watch{ Stopwatch::startNew() };
+        auto tscWatch{ TscStopwatch::startNew() };
+        std::this_thread::sleep_for( std::chrono::milliseconds{ 10 } );
+
+        EXPECT_GE( watch.elapsed().milliseconds(), 8.0 );
+        EXPECT_GE( tscWatch.elapsed().milliseconds(), 8.0 );
+    }
+} // namespace nfx::time::test
@@ -31,7 +31,11 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <iterator>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 #include <nfx/datetime/TimeSpan.h>
 
@@ -398,6 +402,49 @@ namespace nfx::time::test
             result.find( "P2DT3H30M" ) != std::string::npos || result.find( "PT51H30M" ) != std::string::npos );
     }
 
+    TEST( TimeSpanStringFormatting, FormatToMatchesToString )
+    {
+        const TimeSpan values[]{
+            TimeSpan{},
+            TimeSpan::fromHours( 1 ) + TimeSpan::fromMinutes( 30 ) + TimeSpan::fromSeconds( 45 ),
+            TimeSpan::fromDays( 2 ) + TimeSpan{ 1234567 },
+            TimeSpan::fromMinutes( -30 ),
+            TimeSpan::fromDays( 3 ) };
+
+        for( const auto& value : values )
+        {
+            char buffer[constants::MAX_ISO8601_DURATION_LENGTH];
+            const auto length{ value.formatTo( buffer, sizeof( buffer ) ) };
+            EXPECT_EQ( std::string_view( buffer, length ), value.toString() );
+        }
+
+        EXPECT_EQ( TimeSpan::fromDays( 2 ).toString(), "P2D" );
+        EXPECT_EQ( TimeSpan{ 1234567 }.toString(), "PT0.1234567S" );
+    }
+
+    TEST( TimeSpanStringFormatting, FormatToExtremeValues )
+    {
+        // Minimum value must not overflow when taking the magnitude
+        EXPECT_EQ( TimeSpan{ std::numeric_limits<std::int64_t>::min() }.toString(), "-P10675199DT2H48M5.4775808S" );
+        EXPECT_EQ( TimeSpan{ std::numeric_limits<std::int64_t>::max() }.toString(), "P10675199DT2H48M5.4775807S" );
+    }
+
+    TEST( TimeSpanStringFormatting, FormatToBufferTooSmallSpanAndIterator )
+    {
+        TimeSpan ts{ TimeSpan::fromHours( 1 ) + TimeSpan::fromMinutes( 30 ) };
+
+        char small[6];
+        EXPECT_EQ( ts.formatTo( small, sizeof( small ) ), 0u );
+
+        std::array<char, 8> buffer{};
+        const auto length{ ts.formatTo( std::span<char>{ buffer } ) };
+        EXPECT_EQ( std::string_view( buffer.data(), length ), "PT1H30M" );
+
+        std::string out;
+        ts.formatTo( std::back_inserter( out ) );
+        EXPECT_EQ( out, "PT1H30M" );
+    }
+
     //----------------------------------------------
     // String parsing
     //----------------------------------------------
@@ -626,6 +673,63 @@ namespace nfx::time::test
         EXPECT_TRUE( TimeSpan::fromString( "PT45S" ).has_value() );
     }
 
+    TEST( TimeSpanStringParsing, ExactTickAccumulation )
+    {
+        EXPECT_EQ( TimeSpan::fromString( "PT0.0000001S" )->ticks(), 1 );
+        EXPECT_EQ( TimeSpan::fromString( "PT0.00000019S" )->ticks(), 1 ); // Sub-tick digits truncated
+        EXPECT_EQ( TimeSpan::fromString( "PT1.1234567S" )->ticks(), 11234567 );
+        EXPECT_EQ( TimeSpan::fromString( "PT0,5S" )->ticks(), 5000000 ); // Comma decimal separator
+        EXPECT_EQ( TimeSpan::fromString( "PT1.5H" )->ticks(), 54000000000LL );
+        EXPECT_EQ( TimeSpan::fromString( "PT0.00000001H" )->ticks(), 360 );
+        EXPECT_EQ( TimeSpan::fromString( "P0.5DT0.5M" )->ticks(), 432000000000LL + 300000000LL );
+        EXPECT_EQ( TimeSpan::fromString( "P2DT3H4M5.0000006S" )->ticks(),
+            2 * constants::TICKS_PER_DAY + 3 * constants::TICKS_PER_HOUR + 4 * constants::TICKS_PER_MINUTE +
+                5 * constants::TICKS_PER_SECOND + 6 );
+        EXPECT_EQ( TimeSpan::fromString( "-PT0.0000001S" )->ticks(), -1 );
+    }
+
+    TEST( TimeSpanStringParsing, FullRangeRoundTrip )
+    {
+        EXPECT_EQ(
+            TimeSpan::fromString( "P10675199DT2H48M5.4775807S" )->ticks(), std::numeric_limits<std::int64_t>::max() );
+        EXPECT_EQ(
+            TimeSpan::fromString( "-P10675199DT2H48M5.4775808S" )->ticks(), std::numeric_limits<std::int64_t>::min() );
+        EXPECT_FALSE( TimeSpan::fromString( "P10675199DT2H48M5.4775808S" ).has_value() );
+        EXPECT_FALSE( TimeSpan::fromString( "P10675200D" ).has_value() );
+        EXPECT_FALSE( TimeSpan::fromString( "PT9999999999999999999S" ).has_value() );
+
+        std::uint64_t state{ 0x9E3779B97F4A7C15ULL };
+        for( int i{ 0 }; i < 10000; ++i )
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            const TimeSpan value{ static_cast<std::int64_t>( state >> ( i % 40 ) ) * ( i % 2 ? -1 : 1 ) };
+
+            const auto parsed{ TimeSpan::fromString( value.toString() ) };
+            ASSERT_TRUE( parsed.has_value() ) << value.toString();
+            EXPECT_EQ( parsed->ticks(), value.ticks() ) << value.toString();
+        }
+    }
+
+    TEST( TimeSpanStringParsing, RejectMalformedDurations )
+    {
+        EXPECT_FALSE( TimeSpan::fromString( "P" ).has_value() );
+        EXPECT_FALSE( TimeSpan::fromString( "PT" ).has_value() );
+        EXPECT_FALSE( TimeSpan::fromString( "P1DT" ).has_value() );
+        EXPECT_FALSE( TimeSpan::fromString( "PTT1H" ).has_value() );
+        EXPECT_FALSE( TimeSpan::fromString( "P1H" ).has_value() );      // Time component without T
+        EXPECT_FALSE( TimeSpan::fromString( "PT1D" ).has_value() );     // Date component after T
+        EXPECT_FALSE( TimeSpan::fromString( "P1D1D" ).has_value() );
+        EXPECT_FALSE( TimeSpan::fromString( "PT1S2" ).has_value() );    // Trailing digits
+        EXPECT_FALSE( TimeSpan::fromString( "P1DX" ).has_value() );     // Trailing text
+        EXPECT_FALSE( TimeSpan::fromString( "PT.5S" ).has_value() );    // Missing integer part
+        EXPECT_FALSE( TimeSpan::fromString( "PT1.S" ).has_value() );    // Missing fraction digits
+        EXPECT_FALSE( TimeSpan::fromString( "PT-1H" ).has_value() );    // Sign inside the duration
+        EXPECT_FALSE( TimeSpan::fromString( "--PT1H" ).has_value() );
+        EXPECT_FALSE( TimeSpan::fromString( "P1Y" ).has_value() );      // Years are not fixed-length
+    }
+
     //----------------------------------------------
     // Factory
     //----------------------------------------------
@@ -734,6 +838,23 @@ namespace nfx::time::test
         EXPECT_THROW( { [[maybe_unused]] auto _ = TimeSpan{ "PT" }; }, std::invalid_argument );
     }
 
+    TEST( TimeSpanStringParsing, ParseManyMatchesFromString )
+    {
+        const std::vector<std::string_view> inputs{ "PT1H30M", "PT45S", "P1DT2H", "-PT30M", "60.5", "invalid", "" };
+
+        std::vector<TimeSpan> results( inputs.size() );
+        std::vector<std::uint8_t> ok( inputs.size() );
+
+        EXPECT_EQ( TimeSpan::parseMany( inputs, results, ok ), 5u );
+
+        for( std::size_t i{ 0 }; i < inputs.size(); ++i )
+        {
+            const auto expected{ TimeSpan::fromString( inputs[i] ) };
+            EXPECT_EQ( ok[i] != 0, expected.has_value() ) << inputs[i];
+            EXPECT_EQ( results[i], expected.value_or( TimeSpan{} ) ) << inputs[i];
+        }
+    }
+
     //----------------------------------------------
     // std::chrono interoperability
     //----------------------------------------------
@@ -789,6 +910,41 @@ namespace nfx::time::test
         EXPECT_NEAR( roundTrip.seconds(), original.seconds(), 0.001 );
     }
 
+    //----------------------------------------------
+    // Prefix parsing
+    //----------------------------------------------
+
+    TEST( TimeSpanPrefixParsing, DurationsAndSeconds )
+    {
+        const auto parse = []( std::string_view text, TimeSpan& ts ) {
+            return TimeSpan::parsePrefix( text.data(), text.data() + text.size(), ts ) - text.data();
+        };
+
+        TimeSpan ts;
+        EXPECT_EQ( parse( "PT1H30M,retry", ts ), 7 );
+        EXPECT_EQ( ts, TimeSpan::fromMinutes( 90 ) );
+
+        EXPECT_EQ( parse( "-PT45S rest", ts ), 6 );
+        EXPECT_EQ( ts, TimeSpan::fromSeconds( -45 ) );
+
+        EXPECT_EQ( parse( "P1DT ", ts ), 3 );
+        EXPECT_EQ( ts, TimeSpan::fromDays( 1 ) );
+
+        EXPECT_EQ( parse( "12.5s", ts ), 4 );
+        EXPECT_EQ( ts, TimeSpan::fromSeconds( 12.5 ) );
+
+        EXPECT_EQ( parse( "-60 seconds", ts ), 3 );
+        EXPECT_EQ( ts, TimeSpan::fromSeconds( -60 ) );
+
+        const TimeSpan before{ TimeSpan::fromHours( 3 ) };
+        ts = before;
+        for( const std::string_view bad : { "", "P", "-", "PT", "x12", "-x" } )
+        {
+            EXPECT_EQ( parse( bad, ts ), 0 ) << bad;
+        }
+        EXPECT_EQ( ts, before );
+    }
+
     //----------------------------------------------
     // Stream operators
     //----------------------------------------------
@@ -820,6 +976,22 @@ namespace nfx::time::test
         EXPECT_TRUE( iss2.fail() );
     }
 
+    TEST( TimeSpanStreamOperators, InputOperatorReadsTokens )
+    {
+        std::istringstream iss{ "  PT1M\tPT2M\nPT3M" };
+        TimeSpan a, b, c;
+        iss >> a >> b >> c;
+
+        EXPECT_FALSE( iss.fail() );
+        EXPECT_TRUE( iss.eof() );
+        EXPECT_EQ( c - a, TimeSpan::fromMinutes( 2 ) );
+
+        // Tokens longer than any valid duration fail without allocating
+        std::istringstream longToken{ "PT" + std::string( 200, '1' ) + "S next" };
+        longToken >> a;
+        EXPECT_TRUE( longToken.fail() );
+    }
+
     //----------------------------------------------
     // std::formatter support
     //----------------------------------------------
@@ -881,6 +1053,15 @@ namespace nfx::time::test
         EXPECT_NE( formatted.find( "PT0S" ), std::string::npos );
     }
 
+    TEST( TimeSpanFormatter, FormatSpecs )
+    {
+        const TimeSpan ts{ TimeSpan::fromSeconds( 3661.5 ) };
+
+        EXPECT_EQ( std::format( "{}", ts ), ts.toString() );
+        EXPECT_EQ( std::format( "{:iso}", ts ), ts.toString() );
+        EXPECT_THROW( (void)std::vformat( "{:ms}", std::make_format_args( ts ) ), std::format_error );
+    }
+
     //----------------------------------------------
     // Literals
     //----------------------------------------------
@@ -1140,6 +1321,35 @@ namespace nfx::time::test
         EXPECT_EQ( lit4.ticks(), fact4.ticks() );
     }
 
+    TEST( TimeSpanLiterals, DurationLiteral )
+    {
+        using namespace nfx::time::literals;
+
+        static_assert( "PT1H30M"_ts == 1_h + 30_min );
+        static_assert( "P1DT0.5S"_ts == TimeSpan{ constants::TICKS_PER_DAY + constants::TICKS_PER_SECOND / 2 } );
+        static_assert( "-PT0,25S"_ts == -250_ms );
+
+        constexpr TimeSpan timeout{ "PT45S" };
+        static_assert( timeout == 45_s );
+
+        EXPECT_EQ( "PT2H30M45.5S"_ts, TimeSpan::fromString( "PT2H30M45.5S" ) );
+    }
+
+    TEST( TimeSpanLiterals, OffsetLiteral )
+    {
+        using namespace nfx::time::literals;
+
+        static_assert( "+02:00"_offset == 2_h );
+        static_assert( "-0530"_offset == -( 5_h + 30_min ) );
+        static_assert( "+14"_offset == 14_h );
+        static_assert( "Z"_offset == TimeSpan{ 0 } );
+
+        std::int64_t ticks{ 0 };
+        EXPECT_FALSE( detail::decodeIso8601Offset( "+14:30", ticks ) );
+        EXPECT_FALSE( detail::decodeIso8601Offset( "+01:60", ticks ) );
+        EXPECT_FALSE( detail::decodeIso8601Offset( "02:00", ticks ) );
+    }
+
     TEST( TimeSpanLiterals, StringFormatting )
     {
         using namespace nfx::time::literals;
@@ -0,0 +1,264 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_TimeSpanHistogram.cpp
+ * @brief Unit tests for TimeSpanHistogram and ConcurrentTimeSpanHistogram
+ * @details Tests the bucket layout and its error bound, percentile selection, merging,
+ *          ISO 8601 summaries and concurrent recording from several threads.
+ */
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <nfx/datetime/TimeSpan.h>
+#include <nfx/datetime/TimeSpanHistogram.h>
+
+namespace nfx::time::test
+{
+    //=====================================================================
+    // Bucket layout tests
+    //=====================================================================
+
+    TEST( TimeSpanHistogram, BucketLayout )
+    {
+        using H = TimeSpanHistogram;
+
+        static_assert( H::BUCKET_COUNT == 3712 );
+        static_assert( H::bucketIndex( -5 ) == 0 );
+        static_assert( H::bucketIndex( 127 ) == 127 );
+        static_assert( H::bucketIndex( 128 ) == 128 );
+        static_assert( H::bucketIndex( 129 ) == 128 );
+        static_assert( H::bucketIndex( 130 ) == 129 );
+        static_assert( H::bucketIndex( INT64_MAX ) == H::BUCKET_COUNT - 1 );
+        static_assert( H::bucketUpperBound( H::BUCKET_COUNT - 1 ) == INT64_MAX );
+
+        // Buckets tile the range without gaps or overlap
+        for( std::size_t i{ 1 }; i < H::BUCKET_COUNT; ++i )
+        {
+            ASSERT_EQ( H::bucketLowerBound( i ), H::bucketUpperBound( i - 1 ) + 1 ) << i;
+            ASSERT_EQ( H::bucketIndex( H::bucketLowerBound( i ) ), i );
+            ASSERT_EQ( H::bucketIndex( H::bucketUpperBound( i ) ), i );
+        }
+    }
+
+    TEST( TimeSpanHistogram, RelativeErrorBound )
+    {
+        for( std::int64_t value{ 1 }; value < INT64_MAX / 3; value = value * 3 + 1 )
+        {
+            const auto index{ TimeSpanHistogram::bucketIndex( value ) };
+            const auto lower{ static_cast<double>( TimeSpanHistogram::bucketLowerBound( index ) ) };
+            const auto upper{ static_cast<double>( TimeSpanHistogram::bucketUpperBound( index ) ) };
+
+            EXPECT_LE( ( upper - lower ) / static_cast<double>( value ), 1.0 / 64.0 ) << value;
+        }
+    }
+
+    //=====================================================================
+    // Recording and query tests
+    //=====================================================================
+
+    TEST( TimeSpanHistogram, EmptyHistogram )
+    {
+        const TimeSpanHistogram histogram;
+        EXPECT_EQ( histogram.count(), 0u );
+        EXPECT_EQ( histogram.min(), TimeSpan{} );
+        EXPECT_EQ( histogram.max(), TimeSpan{} );
+        EXPECT_EQ( histogram.mean(), TimeSpan{} );
+        EXPECT_EQ( histogram.percentile( 99.0 ), TimeSpan{} );
+    }
+
+    TEST( TimeSpanHistogram, ExactRangePercentiles )
+    {
+        TimeSpanHistogram histogram;
+        for( std::int64_t ticks{ 1 }; ticks <= 100; ++ticks )
+        {
+            histogram.record( TimeSpan{ ticks } );
+        }
+
+        EXPECT_EQ( histogram.count(), 100u );
+        EXPECT_EQ( histogram.min(), TimeSpan{ 1 } );
+        EXPECT_EQ( histogram.max(), TimeSpan{ 100 } );
+        EXPECT_EQ( histogram.mean(), TimeSpan{ 51 } ); // 50.5 rounded
+        EXPECT_EQ( histogram.percentile( 0.0 ), TimeSpan{ 1 } );
+        EXPECT_EQ( histogram.percentile( 50.0 ), TimeSpan{ 50 } );
+        EXPECT_EQ( histogram.percentile( 90.0 ), TimeSpan{ 90 } );
+        EXPECT_EQ( histogram.percentile( 99.5 ), TimeSpan{ 100 } );
+        EXPECT_EQ( histogram.percentile( 100.0 ), TimeSpan{ 100 } );
+    }
+
+    TEST( TimeSpanHistogram, LargeValuesWithinErrorBound )
+    {
+        TimeSpanHistogram histogram;
+        histogram.record( TimeSpan::fromMilliseconds( 1.0 ), 99 );
+        histogram.record( TimeSpan::fromSeconds( 2.0 ) );
+
+        const auto p50{ histogram.percentile( 50.0 ) };
+        EXPECT_GE( p50, TimeSpan::fromMilliseconds( 1.0 ) );
+        EXPECT_LE( p50.ticks(), TimeSpan::fromMilliseconds( 1.0 ).ticks() * 65 / 64 );
+
+        // The tail sample is the exact maximum
+        EXPECT_EQ( histogram.percentile( 99.5 ), TimeSpan::fromSeconds( 2.0 ) );
+        EXPECT_EQ( histogram.max(), TimeSpan::fromSeconds( 2.0 ) );
+    }
+
+    TEST( TimeSpanHistogram, NegativeValuesCountAsZero )
+    {
+        TimeSpanHistogram histogram;
+        histogram.record( TimeSpan{ -50 } );
+
+        EXPECT_EQ( histogram.count(), 1u );
+        EXPECT_EQ( histogram.min(), TimeSpan{} );
+        EXPECT_EQ( histogram.buckets()[0], 1u );
+    }
+
+    TEST( TimeSpanHistogram, MergeAndReset )
+    {
+        TimeSpanHistogram a;
+        TimeSpanHistogram b;
+        a.record( TimeSpan{ 10 } );
+        a.record( TimeSpan{ 20 } );
+        b.record( TimeSpan{ 5 } );
+        b.record( TimeSpan{ 1000 } );
+
+        a.merge( b );
+        EXPECT_EQ( a.count(), 4u );
+        EXPECT_EQ( a.min(), TimeSpan{ 5 } );
+        EXPECT_EQ( a.max(), TimeSpan{ 1000 } );
+        EXPECT_EQ( a.percentile( 50.0 ), TimeSpan{ 10 } );
+
+        // Merging an empty histogram changes nothing
+        a.merge( TimeSpanHistogram{} );
+        EXPECT_EQ( a.min(), TimeSpan{ 5 } );
+
+        a.reset();
+        EXPECT_EQ( a.count(), 0u );
+        EXPECT_EQ( a.max(), TimeSpan{} );
+    }
+
+    TEST( TimeSpanHistogram, ToStringUsesIso8601Durations )
+    {
+        TimeSpanHistogram histogram;
+        histogram.record( TimeSpan::fromSeconds( 1.0 ) );
+
+        const auto second{ TimeSpan::fromSeconds( 1.0 ).toString() };
+        EXPECT_EQ( histogram.toString(), "count=1 min=" + second + " mean=" + second + " p50=" + second +
+                                             " p90=" + second + " p99=" + second + " p99.9=" + second +
+                                             " max=" + second );
+    }
+
+    //=====================================================================
+    // ConcurrentTimeSpanHistogram tests
+    //=====================================================================
+
+    TEST( ConcurrentTimeSpanHistogram, MergesAllThreads )
+    {
+        constexpr int threadCount{ 4 };
+        constexpr int perThread{ 10000 };
+
+        ConcurrentTimeSpanHistogram histogram;
+        std::vector<std::thread> threads;
+        for( int t{ 0 }; t < threadCount; ++t )
+        {
+            threads.emplace_back( [&histogram, t] {
+                for( int i{ 0 }; i < perThread; ++i )
+                {
+                    histogram.record( TimeSpan{ t * 1000 + i % 100 } );
+                }
+            } );
+        }
+        for( auto& thread : threads )
+        {
+            thread.join();
+        }
+
+        const auto snapshot{ histogram.snapshot() };
+        EXPECT_EQ( snapshot.count(), static_cast<std::uint64_t>( threadCount * perThread ) );
+        EXPECT_EQ( snapshot.min(), TimeSpan{ 0 } );
+        EXPECT_EQ( snapshot.max(), TimeSpan{ 3099 } );
+
+        histogram.reset();
+        EXPECT_EQ( histogram.snapshot().count(), 0u );
+    }
+
+    TEST( ConcurrentTimeSpanHistogram, ResetKeepsLiveThreadRecordsSinceReset )
+    {
+        ConcurrentTimeSpanHistogram histogram;
+
+        std::promise<void> recorded;
+        std::promise<void> reset;
+        std::promise<void> recordedAgain;
+        std::promise<void> done;
+        std::thread worker{ [&] {
+            histogram.record( TimeSpan{ 5000 } );
+            recorded.set_value();
+            reset.get_future().wait();
+
+            histogram.record( TimeSpan{ 20 } );
+            histogram.record( TimeSpan{ 30 } );
+            recordedAgain.set_value();
+            done.get_future().wait();
+        } };
+
+        recorded.get_future().wait();
+        EXPECT_EQ( histogram.snapshot().count(), 1u );
+        histogram.reset();
+        EXPECT_EQ( histogram.snapshot().count(), 0u );
+        reset.set_value();
+
+        recordedAgain.get_future().wait();
+        const auto snapshot{ histogram.snapshot() };
+        EXPECT_EQ( snapshot.count(), 2u );
+        EXPECT_EQ( snapshot.min(), TimeSpan{ 20 } );
+        EXPECT_EQ( snapshot.max(), TimeSpan{ 30 } );
+        EXPECT_EQ( snapshot.percentile( 100.0 ), TimeSpan{ 30 } );
+        done.set_value();
+        worker.join();
+
+        // The shard outlives its thread with only the records made after the reset
+        EXPECT_EQ( histogram.snapshot().count(), 2u );
+    }
+
+    TEST( ConcurrentTimeSpanHistogram, ThreadAlternatesBetweenHistograms )
+    {
+        std::vector<ConcurrentTimeSpanHistogram> histograms( 6 );
+        for( int round{ 0 }; round < 3; ++round )
+        {
+            for( std::size_t i{ 0 }; i < histograms.size(); ++i )
+            {
+                histograms[i].record( TimeSpan{ static_cast<std::int64_t>( i ) } );
+            }
+        }
+
+        for( std::size_t i{ 0 }; i < histograms.size(); ++i )
+        {
+            const auto snapshot{ histograms[i].snapshot() };
+            EXPECT_EQ( snapshot.count(), 3u );
+            EXPECT_EQ( snapshot.max(), TimeSpan{ static_cast<std::int64_t>( i ) } );
+        }
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,201 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_TimeZone.cpp
+ * @brief Unit tests for TimeZone class
+ * @details Tests IANA zone lookup, offset resolution from TZif transitions and POSIX footer
+ *          rules, registry interning and DateTimeOffset zone conversion. Tests that need
+ *          zone files are skipped when no zoneinfo database is installed.
+ */
+
+#include <gtest/gtest.h>
+
+#include <nfx/datetime/TimeZone.h>
+
+namespace nfx::time::test
+{
+    //=====================================================================
+    // TimeZone type tests
+    //=====================================================================
+
+    //----------------------------------------------
+    // Lookup
+    //----------------------------------------------
+
+    TEST( TimeZoneLookup, BuiltInUtc )
+    {
+        const auto& utc{ TimeZone::utc() };
+        EXPECT_EQ( utc.name(), "UTC" );
+        EXPECT_EQ( utc.offsetAt( DateTime{ 2024, 7, 1 } ), TimeSpan{} );
+        EXPECT_EQ( utc.offsetAt( DateTime::min() ), TimeSpan{} );
+        EXPECT_EQ( utc.offsetAt( DateTime::max() ), TimeSpan{} );
+
+        // UTC always resolves, with or without zone files
+        const auto* found{ TimeZone::find( "UTC" ) };
+        ASSERT_NE( found, nullptr );
+        EXPECT_EQ( found->offsetAt( DateTime{ 2024, 7, 1 } ), TimeSpan{} );
+    }
+
+    TEST( TimeZoneLookup, InvalidNames )
+    {
+        EXPECT_EQ( TimeZone::find( "" ), nullptr );
+        EXPECT_EQ( TimeZone::find( "/etc/passwd" ), nullptr );
+        EXPECT_EQ( TimeZone::find( "../../etc/passwd" ), nullptr );
+        EXPECT_EQ( TimeZone::find( "America/../../etc/passwd" ), nullptr );
+        EXPECT_EQ( TimeZone::find( "America/New York" ), nullptr );
+        EXPECT_EQ( TimeZone::find( "Not/A_Zone" ), nullptr );
+    }
+
+    TEST( TimeZoneLookup, InternedByName )
+    {
+        const auto* first{ TimeZone::find( "Europe/Paris" ) };
+        if( first == nullptr )
+        {
+            GTEST_SKIP() << "zoneinfo database not available";
+        }
+
+        const auto* second{ TimeZone::find( "Europe/Paris" ) };
+        EXPECT_EQ( first, second );
+        EXPECT_EQ( first->name(), "Europe/Paris" );
+    }
+
+    //----------------------------------------------
+    // Offset lookup
+    //----------------------------------------------
+
+    TEST( TimeZoneOffset, NewYorkStandardAndDaylight )
+    {
+        const auto* zone{ TimeZone::find( "America/New_York" ) };
+        if( zone == nullptr )
+        {
+            GTEST_SKIP() << "zoneinfo database not available";
+        }
+
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2024, 1, 15, 12, 0, 0 } ), TimeSpan::fromHours( -5 ) );
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2024, 7, 15, 12, 0, 0 } ), TimeSpan::fromHours( -4 ) );
+    }
+
+    TEST( TimeZoneOffset, NewYorkTransitionInstant )
+    {
+        const auto* zone{ TimeZone::find( "America/New_York" ) };
+        if( zone == nullptr )
+        {
+            GTEST_SKIP() << "zoneinfo database not available";
+        }
+
+        // 2024-03-10 02:00 EST = 07:00 UTC
+        const DateTime transition{ 2024, 3, 10, 7, 0, 0 };
+        EXPECT_EQ( zone->offsetAt( transition.ticks() - 1 ), TimeSpan::fromHours( -5 ) );
+        EXPECT_EQ( zone->offsetAt( transition ), TimeSpan::fromHours( -4 ) );
+
+        // 2024-11-03 02:00 EDT = 06:00 UTC
+        const DateTime fallBack{ 2024, 11, 3, 6, 0, 0 };
+        EXPECT_EQ( zone->offsetAt( fallBack.ticks() - 1 ), TimeSpan::fromHours( -4 ) );
+        EXPECT_EQ( zone->offsetAt( fallBack ), TimeSpan::fromHours( -5 ) );
+    }
+
+    TEST( TimeZoneOffset, FooterRuleBeyondLastTransition )
+    {
+        const auto* zone{ TimeZone::find( "America/New_York" ) };
+        if( zone == nullptr )
+        {
+            GTEST_SKIP() << "zoneinfo database not available";
+        }
+
+        // Far beyond any explicit transition: resolved from "EST5EDT,M3.2.0,M11.1.0"
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2100, 1, 15 } ), TimeSpan::fromHours( -5 ) );
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2100, 7, 15 } ), TimeSpan::fromHours( -4 ) );
+
+        // 2100-03-14 is the second Sunday of March
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2100, 3, 14, 6, 59, 59 } ), TimeSpan::fromHours( -5 ) );
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2100, 3, 14, 7, 0, 0 } ), TimeSpan::fromHours( -4 ) );
+    }
+
+    TEST( TimeZoneOffset, SouthernHemisphere )
+    {
+        const auto* zone{ TimeZone::find( "Australia/Sydney" ) };
+        if( zone == nullptr )
+        {
+            GTEST_SKIP() << "zoneinfo database not available";
+        }
+
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2024, 1, 15 } ), TimeSpan::fromHours( 11 ) );
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2024, 7, 15 } ), TimeSpan::fromHours( 10 ) );
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2150, 1, 15 } ), TimeSpan::fromHours( 11 ) );
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2150, 7, 15 } ), TimeSpan::fromHours( 10 ) );
+    }
+
+    TEST( TimeZoneOffset, FractionalHourOffset )
+    {
+        const auto* zone{ TimeZone::find( "Asia/Kathmandu" ) };
+        if( zone == nullptr )
+        {
+            GTEST_SKIP() << "zoneinfo database not available";
+        }
+
+        EXPECT_EQ( zone->offsetAt( DateTime{ 2024, 6, 1 } ), TimeSpan::fromMinutes( 5 * 60 + 45 ) );
+    }
+
+    TEST( TimeZoneOffset, BeforeFirstTransition )
+    {
+        const auto* zone{ TimeZone::find( "Europe/Paris" ) };
+        if( zone == nullptr )
+        {
+            GTEST_SKIP() << "zoneinfo database not available";
+        }
+
+        // Local mean time of Paris before 1891: +00:09:21
+        EXPECT_EQ( zone->offsetAt( DateTime{ 1800, 1, 1 } ), TimeSpan::fromSeconds( 9 * 60 + 21 ) );
+    }
+
+    //----------------------------------------------
+    // Zone conversion
+    //----------------------------------------------
+
+    TEST( TimeZoneConversion, ToZonePreservesInstant )
+    {
+        const auto* tokyo{ TimeZone::find( "Asia/Tokyo" ) };
+        if( tokyo == nullptr )
+        {
+            GTEST_SKIP() << "zoneinfo database not available";
+        }
+
+        const DateTimeOffset source{ DateTime{ 2024, 6, 1, 12, 0, 0 }, TimeSpan::fromHours( 2 ) };
+        const auto converted{ toZone( source, *tokyo ) };
+
+        EXPECT_EQ( converted.utcTicks(), source.utcTicks() );
+        EXPECT_EQ( converted.offset(), TimeSpan::fromHours( 9 ) );
+        EXPECT_EQ( converted.localDateTime(), ( DateTime{ 2024, 6, 1, 19, 0, 0 } ) );
+    }
+
+    TEST( TimeZoneConversion, ToUtc )
+    {
+        const DateTimeOffset source{ DateTime{ 2024, 6, 1, 12, 0, 0 }, TimeSpan::fromHours( -7 ) };
+        const auto converted{ toZone( source, TimeZone::utc() ) };
+
+        EXPECT_EQ( converted.offset(), TimeSpan{} );
+        EXPECT_EQ( converted.localDateTime(), ( DateTime{ 2024, 6, 1, 19, 0, 0 } ) );
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,149 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_Timeline.cpp
+ * @brief Unit tests for Timeline
+ * @details Tests lowerBound and upperBound against std::lower_bound / std::upper_bound for
+ *          sizes around node and level boundaries, duplicates, and half-open range queries.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <nfx/datetime/Timeline.h>
+
+namespace nfx::time::test
+{
+    //=====================================================================
+    // Timeline tests
+    //=====================================================================
+
+    //----------------------------------------------
+    // Search
+    //----------------------------------------------
+
+    TEST( TimelineSearch, EmptyTimeline )
+    {
+        const Timeline timeline;
+
+        EXPECT_EQ( timeline.size(), 0 );
+        EXPECT_EQ( timeline.lowerBound( DateTime{ 2024, 1, 1 } ), 0 );
+        EXPECT_EQ( timeline.upperBound( DateTime{ 2024, 1, 1 } ), 0 );
+        EXPECT_TRUE( timeline.range( DateTime::min(), DateTime::max() ).empty() );
+        EXPECT_FALSE( timeline.contains( DateTime{ 2024, 1, 1 } ) );
+    }
+
+    TEST( TimelineSearch, MatchesStdBoundsAcrossLevelBoundaries )
+    {
+        std::mt19937_64 random{ 22 };
+        const auto start{ DateTime{ 2024, 1, 1 }.ticks() };
+        std::uniform_int_distribution<std::int64_t> offset{ 0, constants::TICKS_PER_DAY };
+
+        for( const std::size_t size : { 1u, 15u, 16u, 17u, 255u, 256u, 257u, 4096u, 4097u, 70000u } )
+        {
+            std::vector<DateTime> values;
+            for( std::size_t i{ 0 }; i < size; ++i )
+            {
+                // Whole minutes, so duplicates occur
+                const auto ticks{ offset( random ) };
+                values.emplace_back( start + ticks - ticks % constants::TICKS_PER_MINUTE );
+            }
+
+            const Timeline timeline{ values };
+            std::sort( values.begin(), values.end() );
+            ASSERT_EQ( timeline.size(), size );
+            ASSERT_TRUE( std::ranges::equal( timeline.values(), values ) );
+
+            for( int probe{ 0 }; probe < 2000; ++probe )
+            {
+                // Mix random instants, indexed instants and instants outside the range
+                const auto mode{ probe % 3 };
+                const DateTime key{ mode == 0   ? values[static_cast<std::size_t>( probe ) % size]
+                                    : mode == 1 ? DateTime{ start - constants::TICKS_PER_DAY + 3 * offset( random ) }
+                                                : DateTime{ start + offset( random ) } };
+
+                const auto [lowerIt, upperIt]{ std::equal_range( values.begin(), values.end(), key ) };
+                const auto lower{ static_cast<std::size_t>( lowerIt - values.begin() ) };
+                const auto upper{ static_cast<std::size_t>( upperIt - values.begin() ) };
+                ASSERT_EQ( timeline.lowerBound( key ), lower ) << size << " " << key.toString();
+                ASSERT_EQ( timeline.upperBound( key ), upper ) << size << " " << key.toString();
+                ASSERT_EQ( timeline.contains( key ), lower != upper );
+            }
+
+            EXPECT_EQ( timeline.lowerBound( DateTime::min() ), 0 );
+            EXPECT_EQ( timeline.lowerBound( DateTime::max() ), size );
+            EXPECT_EQ( timeline.upperBound( DateTime{ std::numeric_limits<std::int64_t>::max() } ), size );
+        }
+    }
+
+    TEST( TimelineSearch, KeyAboveMaximumOfFullLastNode )
+    {
+        for( const std::size_t size : { 16u, 256u, 4096u } )
+        {
+            std::vector<DateTime> values;
+            for( std::size_t i{ 0 }; i < size; ++i )
+            {
+                const auto seconds{ static_cast<std::int64_t>( i ) };
+                values.emplace_back( DateTime{ 2024, 1, 1 }.ticks() + seconds * constants::TICKS_PER_SECOND );
+            }
+
+            const Timeline timeline{ values };
+
+            EXPECT_EQ( timeline.lowerBound( DateTime{ values.back().ticks() + 1 } ), size );
+            EXPECT_EQ( timeline.upperBound( values.back() ), size );
+            EXPECT_EQ( timeline.lowerBound( values.back() ), size - 1 );
+        }
+    }
+
+    //----------------------------------------------
+    // Range queries
+    //----------------------------------------------
+
+    TEST( TimelineRange, HalfOpenInterval )
+    {
+        std::vector<DateTime> values;
+        for( int hour{ 23 }; hour >= 0; --hour )
+        {
+            values.emplace_back( 2024, 6, 15, hour, 0, 0 );
+        }
+        values.emplace_back( 2024, 6, 15, 12, 0, 0 );
+
+        const Timeline timeline{ values };
+
+        const auto morning{ timeline.range( DateTime{ 2024, 6, 15, 9, 0, 0 }, DateTime{ 2024, 6, 15, 12, 0, 0 } ) };
+        ASSERT_EQ( morning.size(), 3 );
+        EXPECT_EQ( morning.front(), ( DateTime{ 2024, 6, 15, 9, 0, 0 } ) );
+        EXPECT_EQ( morning.back(), ( DateTime{ 2024, 6, 15, 11, 0, 0 } ) );
+
+        EXPECT_EQ( timeline.count( DateTime{ 2024, 6, 15, 12, 0, 0 }, DateTime{ 2024, 6, 15, 13, 0, 0 } ), 2 );
+        EXPECT_EQ( timeline.count( DateTime{ 2024, 6, 15 }, DateTime{ 2024, 6, 16 } ), 25 );
+        EXPECT_EQ( timeline.count( DateTime{ 2024, 6, 16 }, DateTime{ 2024, 6, 15 } ), 0 );
+        EXPECT_TRUE( timeline.range( DateTime{ 2024, 6, 16 }, DateTime{ 2024, 6, 17 } ).empty() );
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,286 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_TimestampColumn.cpp
+ * @brief Unit tests for the delta-of-delta timestamp column codec
+ * @details Checks exact round trips for regular, jittered, unsorted and full-range series,
+ *          every packed bit width, short and flushed blocks, random access by block index
+ *          and rejection of malformed columns
+ */
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <nfx/datetime/TimestampColumn.h>
+
+namespace nfx::time::test
+{
+    namespace
+    {
+        /** @brief Encode ticks, flushing the last block */
+        std::vector<std::byte> encodeAll( const std::vector<std::int64_t>& ticks )
+        {
+            TimestampColumnEncoder encoder;
+            encoder.append( ticks );
+            encoder.flush();
+
+            const auto data{ encoder.data() };
+            return { data.begin(), data.end() };
+        }
+
+        /** @brief Decode a whole column */
+        std::vector<std::int64_t> decodeAll( const std::vector<std::byte>& data )
+        {
+            const auto decoder{ TimestampColumnDecoder::open( data ) };
+            EXPECT_TRUE( decoder.has_value() );
+            if( !decoder )
+            {
+                return {};
+            }
+
+            std::vector<std::int64_t> ticks( decoder->size() );
+            EXPECT_EQ( decoder->decode( ticks ), ticks.size() );
+
+            return ticks;
+        }
+    } // namespace
+
+    //=====================================================================
+    // Round trips
+    //=====================================================================
+
+    TEST( TimestampColumnRoundTrip, RegularSeriesCompressesToHeaders )
+    {
+        std::vector<std::int64_t> ticks;
+        const auto start{ DateTime{ 2025, 1, 1 }.ticks() };
+        for( std::int64_t i{ 0 }; i < 10'000; ++i )
+        {
+            ticks.push_back( start + i * constants::TICKS_PER_SECOND );
+        }
+
+        const auto data{ encodeAll( ticks ) };
+        constexpr auto BLOCK_SIZE{ TimestampColumnEncoder::BLOCK_SIZE };
+        const auto blocks{ ( ticks.size() + BLOCK_SIZE - 1 ) / BLOCK_SIZE };
+        EXPECT_EQ( data.size(), blocks * TimestampColumnEncoder::BLOCK_HEADER_SIZE );
+        EXPECT_EQ( decodeAll( data ), ticks );
+    }
+
+    TEST( TimestampColumnRoundTrip, JitteredSeries )
+    {
+        std::mt19937_64 rng{ 7 };
+        std::uniform_int_distribution<std::int64_t> jitter{ -5'000, 5'000 };
+
+        std::vector<std::int64_t> ticks;
+        auto current{ DateTime{ 2024, 6, 1 }.ticks() };
+        for( std::size_t i{ 0 }; i < 5'000; ++i )
+        {
+            current += constants::TICKS_PER_MILLISECOND * 10 + jitter( rng );
+            ticks.push_back( current );
+        }
+
+        const auto data{ encodeAll( ticks ) };
+        EXPECT_LT( data.size(), ticks.size() * sizeof( std::int64_t ) / 3 );
+        EXPECT_EQ( decodeAll( data ), ticks );
+    }
+
+    TEST( TimestampColumnRoundTrip, UnsortedAndFullRange )
+    {
+        std::mt19937_64 rng{ 11 };
+        std::uniform_int_distribution<std::int64_t> full{ std::numeric_limits<std::int64_t>::min(),
+            std::numeric_limits<std::int64_t>::max() };
+
+        std::vector<std::int64_t> ticks{ std::numeric_limits<std::int64_t>::max(),
+            std::numeric_limits<std::int64_t>::min(),
+            0,
+            -1 };
+        for( std::size_t i{ 0 }; i < 1'000; ++i )
+        {
+            ticks.push_back( full( rng ) );
+        }
+
+        EXPECT_EQ( decodeAll( encodeAll( ticks ) ), ticks );
+    }
+
+    TEST( TimestampColumnRoundTrip, EveryBitWidth )
+    {
+        std::mt19937_64 rng{ 3 };
+        for( std::size_t width{ 1 }; width <= 64; ++width )
+        {
+            // Delta-of-deltas alternate between 0 and a value needing exactly width bits once zigzagged
+            const std::uint64_t zigzag{ width == 64 ? ~std::uint64_t{ 0 } : ( std::uint64_t{ 1 } << width ) - 1 };
+            const auto dod{ static_cast<std::int64_t>( ( zigzag >> 1 ) ^ ( 0 - ( zigzag & 1 ) ) ) };
+
+            std::vector<std::int64_t> ticks{ static_cast<std::int64_t>( rng() ), static_cast<std::int64_t>( rng() ) };
+            std::uint64_t delta{ static_cast<std::uint64_t>( ticks[1] ) - static_cast<std::uint64_t>( ticks[0] ) };
+            for( std::size_t i{ 2 }; i < 300; ++i )
+            {
+                delta += ( i % 3 == 0 ) ? static_cast<std::uint64_t>( dod ) : 0;
+                ticks.push_back( static_cast<std::int64_t>( static_cast<std::uint64_t>( ticks.back() ) + delta ) );
+            }
+
+            const auto data{ encodeAll( ticks ) };
+            EXPECT_EQ( static_cast<std::size_t>( data[2] ), width ) << "width " << width;
+            EXPECT_EQ( decodeAll( data ), ticks ) << "width " << width;
+        }
+    }
+
+    TEST( TimestampColumnRoundTrip, ShortBlocks )
+    {
+        for( std::size_t count{ 1 }; count <= 9; ++count )
+        {
+            std::vector<std::int64_t> ticks;
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                ticks.push_back( static_cast<std::int64_t>( 1'000 + i * i * 37 ) );
+            }
+
+            EXPECT_EQ( decodeAll( encodeAll( ticks ) ), ticks ) << "count " << count;
+        }
+    }
+
+    //=====================================================================
+    // Streaming and random access
+    //=====================================================================
+
+    TEST( TimestampColumnStreaming, SealedBytesAreStable )
+    {
+        TimestampColumnEncoder encoder;
+        const auto start{ DateTime{ 2025, 3, 1 } };
+        for( std::size_t i{ 0 }; i < TimestampColumnEncoder::BLOCK_SIZE - 1; ++i )
+        {
+            encoder.append( start + TimeSpan::fromSeconds( static_cast<double>( i ) ) );
+        }
+        EXPECT_EQ( encoder.blockCount(), 0 );
+        EXPECT_TRUE( encoder.data().empty() );
+
+        encoder.append( start );
+        ASSERT_EQ( encoder.blockCount(), 1 );
+        const std::vector<std::byte> firstBlock{ encoder.data().begin(), encoder.data().end() };
+
+        for( std::size_t i{ 0 }; i < 10; ++i )
+        {
+            encoder.append( start + TimeSpan::fromMinutes( static_cast<double>( i ) ) );
+        }
+        encoder.flush();
+        EXPECT_EQ( encoder.blockCount(), 2 );
+        EXPECT_EQ( encoder.size(), TimestampColumnEncoder::BLOCK_SIZE + 10 );
+        EXPECT_TRUE( std::equal( firstBlock.begin(), firstBlock.end(), encoder.data().begin() ) );
+
+        encoder.clear();
+        EXPECT_EQ( encoder.size(), 0 );
+        EXPECT_TRUE( encoder.data().empty() );
+    }
+
+    TEST( TimestampColumnStreaming, RandomAccessByBlock )
+    {
+        TimestampColumnEncoder encoder;
+        std::vector<std::int64_t> ticks;
+        for( std::int64_t i{ 0 }; i < 1'000; ++i )
+        {
+            const auto value{ DateTime{ 2020, 1, 1 }.ticks() + i * i * constants::TICKS_PER_MILLISECOND };
+            ticks.push_back( value );
+            encoder.append( value );
+            if( i == 200 || i == 201 )
+            {
+                encoder.flush(); // Short blocks in the middle of the column
+            }
+        }
+        encoder.flush();
+
+        const auto decoder{ TimestampColumnDecoder::open( encoder.data() ) };
+        ASSERT_TRUE( decoder.has_value() );
+        EXPECT_EQ( decoder->size(), ticks.size() );
+        EXPECT_EQ( decoder->blockCount(), encoder.blockCount() );
+        EXPECT_EQ( decoder->blockFirstRow( decoder->blockCount() ), ticks.size() );
+
+        std::vector<DateTime> values( TimestampColumnDecoder::BLOCK_SIZE );
+        for( std::size_t block{ decoder->blockCount() }; block-- > 0; )
+        {
+            const auto count{ decoder->decodeBlock( block, std::span{ values } ) };
+            ASSERT_EQ( count, decoder->blockSize( block ) );
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                EXPECT_EQ( values[i].ticks(), ticks[decoder->blockFirstRow( block ) + i] );
+            }
+        }
+
+        for( const std::size_t row :
+            { std::size_t{ 0 }, std::size_t{ 200 }, std::size_t{ 201 }, std::size_t{ 202 }, ticks.size() - 1 } )
+        {
+            const auto block{ decoder->findBlock( row ) };
+            EXPECT_LE( decoder->blockFirstRow( block ), row );
+            EXPECT_LT( row, decoder->blockFirstRow( block + 1 ) );
+        }
+
+        std::vector<std::int64_t> small( 1 );
+        EXPECT_EQ( decoder->decodeBlock( decoder->blockCount(), small ), 0 );
+        EXPECT_EQ( decoder->decodeBlock( 0, small ), 0 );
+        EXPECT_EQ( decoder->decode( small ), 0 );
+    }
+
+    //=====================================================================
+    // Validation
+    //=====================================================================
+
+    TEST( TimestampColumnValidation, RejectMalformedColumns )
+    {
+        std::vector<std::int64_t> ticks;
+        for( std::int64_t i{ 0 }; i < 50; ++i )
+        {
+            ticks.push_back( i * i );
+        }
+        const auto data{ encodeAll( ticks ) };
+        ASSERT_TRUE( TimestampColumnDecoder::open( data ).has_value() );
+
+        const auto empty{ TimestampColumnDecoder::open( {} ) };
+        ASSERT_TRUE( empty.has_value() );
+        EXPECT_EQ( empty->size(), 0 );
+        EXPECT_EQ( empty->blockCount(), 0 );
+
+        // Truncated header and payload
+        EXPECT_FALSE( TimestampColumnDecoder::open( std::span{ data }.first( 10 ) ).has_value() );
+        EXPECT_FALSE( TimestampColumnDecoder::open( std::span{ data }.first( data.size() - 1 ) ).has_value() );
+
+        auto corrupted{ data };
+        corrupted[0] = std::byte{ 0 };
+        corrupted[1] = std::byte{ 0 };
+        EXPECT_FALSE( TimestampColumnDecoder::open( corrupted ).has_value() ); // Empty block
+
+        corrupted = data;
+        corrupted[1] = std::byte{ 1 };
+        EXPECT_FALSE( TimestampColumnDecoder::open( corrupted ).has_value() ); // More than BLOCK_SIZE values
+
+        corrupted = data;
+        corrupted[2] = std::byte{ 65 };
+        EXPECT_FALSE( TimestampColumnDecoder::open( corrupted ).has_value() ); // Width beyond 64 bits
+
+        corrupted = data;
+        corrupted[3] = std::byte{ 1 };
+        EXPECT_FALSE( TimestampColumnDecoder::open( corrupted ).has_value() ); // Reserved byte set
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,150 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_TimestampFormatter.cpp
+ * @brief Unit tests for TimestampFormatter class
+ * @details Checks that incremental rendering matches DateTime::toString() and
+ *          DateTimeOffset::toString() for every format across second, minute, hour, day,
+ *          offset and backwards transitions
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <nfx/datetime/TimestampFormatter.h>
+
+namespace nfx::time::test
+{
+    namespace
+    {
+        /** @brief All output formats */
+        constexpr std::array ALL_FORMATS{ DateTime::Format::Iso8601,
+            DateTime::Format::Iso8601Precise,
+            DateTime::Format::Iso8601PreciseTrimmed,
+            DateTime::Format::Iso8601Millis,
+            DateTime::Format::Iso8601Micros,
+            DateTime::Format::Iso8601Extended,
+            DateTime::Format::Iso8601Basic,
+            DateTime::Format::Iso8601Date,
+            DateTime::Format::Iso8601Time,
+            DateTime::Format::UnixSeconds,
+            DateTime::Format::UnixMilliseconds };
+
+        /** @brief Mostly increasing stream crossing every field boundary, with a few steps back */
+        std::vector<std::int64_t> timestampStream()
+        {
+            std::vector<std::int64_t> ticks;
+            std::mt19937_64 rng{ 42 };
+            std::uniform_int_distribution<std::int64_t> smallStep{ 0, 3 * constants::TICKS_PER_MILLISECOND };
+
+            // Starts just before a year boundary so minute, hour, day, month and year roll over
+            auto current{ DateTime{ 2024, 12, 31, 23, 59, 58 }.ticks() };
+            for( int i{ 0 }; i < 3000; ++i )
+            {
+                current += smallStep( rng );
+                ticks.push_back( current );
+            }
+            current += constants::TICKS_PER_MINUTE - 7;
+            ticks.push_back( current );
+            current += constants::TICKS_PER_HOUR + 123;
+            ticks.push_back( current );
+            current += constants::TICKS_PER_DAY;
+            ticks.push_back( current );
+            ticks.push_back( current - constants::TICKS_PER_SECOND ); // Backwards
+            ticks.push_back( current - constants::TICKS_PER_DAY );    // Backwards across a day
+            ticks.push_back( current );
+            ticks.push_back( current + 10 * constants::TICKS_PER_MILLISECOND ); // Trimmed fraction length change
+            ticks.push_back( current - current % constants::TICKS_PER_SECOND ); // Zero fraction
+
+            return ticks;
+        }
+    } // namespace
+
+    //=====================================================================
+    // TimestampFormatter type tests
+    //=====================================================================
+
+    //----------------------------------------------
+    // Formatting
+    //----------------------------------------------
+
+    TEST( TimestampFormatterFormat, MatchesDateTimeToString )
+    {
+        const auto stream{ timestampStream() };
+        for( const auto format : ALL_FORMATS )
+        {
+            TimestampFormatter formatter{ format };
+            EXPECT_EQ( formatter.outputFormat(), format );
+
+            for( const auto ticks : stream )
+            {
+                const DateTime value{ ticks };
+                ASSERT_EQ( formatter.format( value ), value.toString( format ) )
+                    << "format " << static_cast<int>( format ) << ", ticks " << ticks;
+            }
+        }
+    }
+
+    TEST( TimestampFormatterFormat, MatchesDateTimeOffsetToString )
+    {
+        const auto stream{ timestampStream() };
+        const std::array offsets{ TimeSpan{ 0 }, TimeSpan::fromHours( 2 ), TimeSpan::fromMinutes( -( 9 * 60 + 30 ) ) };
+
+        for( const auto format : ALL_FORMATS )
+        {
+            TimestampFormatter formatter{ format };
+            for( std::size_t i{ 0 }; i < stream.size(); ++i )
+            {
+                // Offset switches every 1000 values
+                const DateTimeOffset value{ stream[i], offsets[( i / 1000 ) % offsets.size()] };
+                ASSERT_EQ( formatter.format( value ), value.toString( format ) )
+                    << "format " << static_cast<int>( format ) << ", index " << i;
+            }
+        }
+    }
+
+    TEST( TimestampFormatterFormat, DateTimeAndOffsetInterleaved )
+    {
+        TimestampFormatter formatter{ DateTime::Format::Iso8601Millis };
+        const DateTime utc{ 2025, 1, 24, 5, 42, 0, 123 };
+        const DateTimeOffset zeroOffset{ utc, TimeSpan{ 0 } };
+
+        EXPECT_EQ( formatter.format( utc ), "2025-01-24T05:42:00.123Z" );
+        EXPECT_EQ( formatter.format( zeroOffset ), "2025-01-24T05:42:00.123+00:00" );
+        EXPECT_EQ( formatter.format( utc ), "2025-01-24T05:42:00.123Z" );
+    }
+
+    TEST( TimestampFormatterFormat, Reset )
+    {
+        TimestampFormatter formatter;
+        EXPECT_EQ( formatter.format( DateTime{ 2025, 1, 24, 5, 42, 0, 500 } ), "2025-01-24T05:42:00.500Z" );
+
+        formatter.reset();
+        EXPECT_EQ( formatter.format( DateTime{ 2025, 1, 24, 5, 42, 1, 7 } ), "2025-01-24T05:42:01.007Z" );
+    }
+} // namespace nfx::time::test
@@ -0,0 +1,203 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_TimestampPipeline.cpp
+ * @brief Unit tests for the parallel timestamp conversion pipeline
+ * @details Tests record splitting, agreement with DateTimeOffset::fromString() row by row
+ *          across thread counts and chunk sizes, column capacity limits and custom delimiters.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <nfx/datetime/DateTimeOffset.h>
+#include <nfx/datetime/TimestampPipeline.h>
+
+namespace nfx::time::test
+{
+    namespace
+    {
+        /** @brief Lines in several layouts, with CRLF endings, blanks and malformed records */
+        std::vector<std::string> makeLines( std::size_t count )
+        {
+            static constexpr DateTime::Format layouts[]{ DateTime::Format::Iso8601, DateTime::Format::Iso8601Precise,
+                DateTime::Format::Iso8601Millis, DateTime::Format::Iso8601Extended, DateTime::Format::Iso8601Date };
+
+            std::vector<std::string> lines;
+            DateTimeOffset value{ DateTime{ 2024, 3, 9, 22, 15, 0 }, TimeSpan::fromMinutes( 330 ) };
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                if( i % 97 == 13 )
+                {
+                    lines.emplace_back( i % 2 == 0 ? "" : "not a timestamp" );
+                }
+                else
+                {
+                    lines.push_back( value.toString( layouts[i % std::size( layouts )] ) );
+                }
+                const auto offsetMinutes{ static_cast<int>( i % 9 ) * 45 - 180 };
+                value = DateTimeOffset{
+                    value.dateTime() + TimeSpan{ 7'777'777'777 }, TimeSpan::fromMinutes( offsetMinutes ) };
+            }
+
+            return lines;
+        }
+
+        std::string join( const std::vector<std::string>& lines, std::string_view separator )
+        {
+            std::string text;
+            for( const auto& line : lines )
+            {
+                text += line;
+                text += separator;
+            }
+
+            return text;
+        }
+    } // namespace
+
+    //=====================================================================
+    // Record splitting tests
+    //=====================================================================
+
+    TEST( TimestampPipeline, CountRecords )
+    {
+        EXPECT_EQ( TimestampPipeline::countRecords( "" ), 0u );
+        EXPECT_EQ( TimestampPipeline::countRecords( "a" ), 1u );
+        EXPECT_EQ( TimestampPipeline::countRecords( "a\n" ), 1u );
+        EXPECT_EQ( TimestampPipeline::countRecords( "a\nb" ), 2u );
+        EXPECT_EQ( TimestampPipeline::countRecords( "\n\n" ), 2u );
+        EXPECT_EQ( TimestampPipeline::countRecords( "a,b,c", ',' ), 3u );
+    }
+
+    //=====================================================================
+    // Conversion tests
+    //=====================================================================
+
+    TEST( TimestampPipeline, MatchesFromStringRowByRow )
+    {
+        const auto lines{ makeLines( 5000 ) };
+        const auto text{ join( lines, "\r\n" ) };
+        const auto bucket{ TimeSpan::fromMinutes( 15 ) };
+
+        for( const unsigned threads : { 1u, 4u } )
+        {
+            for( const std::size_t chunkBytes : { std::size_t{ 1 }, std::size_t{ 100 }, std::size_t{ 256 * 1024 } } )
+            {
+                TimestampPipeline pipeline{ threads };
+                ASSERT_EQ( pipeline.threadCount(), threads );
+                ASSERT_EQ( TimestampPipeline::countRecords( text ), lines.size() );
+
+                std::vector<DateTime> utc( lines.size() );
+                std::vector<DateTime> buckets( lines.size() );
+                std::vector<PackedDateTimeOffset> packed( lines.size() );
+                std::vector<std::uint8_t> ok( lines.size(), 2 );
+
+                TimestampPipeline::Options options;
+                options.chunkBytes = chunkBytes;
+                options.bucket = bucket;
+                const auto result{ pipeline.run( text, { utc, packed, buckets, ok }, options ) };
+
+                std::size_t expectedParsed{ 0 };
+                for( std::size_t i{ 0 }; i < lines.size(); ++i )
+                {
+                    DateTimeOffset expected;
+                    const bool parsed{ DateTimeOffset::fromString( lines[i], expected ) };
+                    expectedParsed += parsed ? 1 : 0;
+
+                    ASSERT_EQ( ok[i], parsed ? 1 : 0 ) << "row " << i << " '" << lines[i] << "'";
+                    if( parsed )
+                    {
+                        ASSERT_EQ( utc[i], expected.utcDateTime() ) << "row " << i;
+                        ASSERT_EQ( buckets[i], expected.utcDateTime().floor( bucket ) ) << "row " << i;
+                        ASSERT_EQ( packed[i], PackedDateTimeOffset{ expected } ) << "row " << i;
+                    }
+                }
+
+                EXPECT_EQ( result.records, lines.size() );
+                EXPECT_EQ( result.converted, lines.size() );
+                EXPECT_EQ( result.parsed, expectedParsed );
+                EXPECT_LT( result.parsed, result.records );
+            }
+        }
+    }
+
+    TEST( TimestampPipeline, ReusedAcrossRuns )
+    {
+        TimestampPipeline pipeline{ 3 };
+        for( std::size_t size : { 10u, 1000u, 0u, 3u } )
+        {
+            const auto lines{ makeLines( size ) };
+            const auto text{ join( lines, "\n" ) };
+            std::vector<std::uint8_t> ok( lines.size() );
+
+            TimestampPipeline::Options options;
+            options.chunkBytes = 64;
+            const auto result{ pipeline.run( text, { .ok = ok }, options ) };
+            EXPECT_EQ( result.records, size );
+            EXPECT_EQ( result.converted, size );
+        }
+    }
+
+    TEST( TimestampPipeline, StopsAtColumnCapacity )
+    {
+        const auto lines{ makeLines( 1000 ) };
+        const auto text{ join( lines, "\n" ) };
+
+        TimestampPipeline pipeline{ 4 };
+        std::vector<DateTime> utc( 600 );
+        std::vector<std::uint8_t> ok( 1000, 7 );
+
+        TimestampPipeline::Options options;
+        options.chunkBytes = 128;
+        const auto result{ pipeline.run( text, { .utc = utc, .ok = ok }, options ) };
+
+        EXPECT_EQ( result.records, 1000u );
+        EXPECT_EQ( result.converted, 600u );
+        EXPECT_EQ( ok[599] <= 1, true );
+        EXPECT_EQ( ok[600], 7 ); // Beyond the smallest column: untouched
+    }
+
+    TEST( TimestampPipeline, CustomDelimiterAndDefaultHourBuckets )
+    {
+        const std::string text{ "2024-01-15T12:30:45Z,2024-01-15T12:30:45+02:00,bad,2024-01-15T23:59:59.9-01:00" };
+        TimestampPipeline pipeline{ 2 };
+
+        std::vector<DateTime> hours( 4 );
+        std::vector<std::uint8_t> ok( 4 );
+        TimestampPipeline::Options options;
+        options.delimiter = ',';
+        const auto result{ pipeline.run( text, { .buckets = hours, .ok = ok }, options ) };
+
+        EXPECT_EQ( result.records, 4u );
+        EXPECT_EQ( result.parsed, 3u );
+        EXPECT_EQ( ok, ( std::vector<std::uint8_t>{ 1, 1, 0, 1 } ) );
+        EXPECT_EQ( hours[0], ( DateTime{ 2024, 1, 15, 12, 0, 0 } ) );
+        EXPECT_EQ( hours[1], ( DateTime{ 2024, 1, 15, 10, 0, 0 } ) );
+        EXPECT_EQ( hours[3], ( DateTime{ 2024, 1, 16, 0, 0, 0 } ) );
+    }
+} // namespace nfx::time::test